@@ -0,0 +1,1040 @@
+//Throughput, heap and latency of the telemetry path on a PC (pio run -e native_bench && .pio/build/native_bench/program).
+//
+//Each run encodes mailbox telemetry with TelemetryEncoder and publishes it through Esp32MQTTClient_SendEventAsync,
+//the IoT Hub LL client and umqtt to the loopback broker, which acknowledges every message after a simulated round
+//trip. Per run it reports messages per second, heap allocations and bytes allocated per message and the peak
+//heap, all from gballoc (so only the SDK's own allocations count), and the time from SendEventAsync to the
+//confirmation callback as percentiles. Batched runs pack records with Esp32MQTTClient_BatchAdd and count per record;
+//their messages have no confirmation callback, so no latency either.
+//
+//A second table feeds the MQTT decoder a recorded-like stream of what IoT Hub sends (PUBACKs, PINGRESPs and
+//cloud-to-device PUBLISHes of random size) cut into pieces the way TLS reads may hand it over, and checks every
+//cut decodes to the same packets. A third has the broker send cloud-to-device messages with IoT Hub's system
+//properties and direct method calls, and reports what the client costs per message it hands to the application.
+//The last queues thousands of messages on an IoT Hub LL client of its own, as a device has after a long outage, and
+//times how long they take to be acknowledged and the longest IoTHubClient_LL_DoWork call while they are in flight,
+//once on a steady connection and once with the connection dropped half way, when they all go out again.
+//One table records what a telemetry publish allocates, reallocates and frees, and replays that trace through gballoc
+//next to the client's live blocks. Another prints what gballoc's heap profiler (GB_PROFILE_ALLOC)
+//attributes to which subsystem over the json cpu run, and times gballoc_malloc_at and gballoc_free pairs with it off,
+//on, and on with a new call site every time, the most it can add. The strings table builds the
+//topics, property lists and SAS tokens the transport makes out of STRING_HANDLEs, per string built, and the buffers
+//table the CONNECT and SUBSCRIBE packets mqtt_codec builds in a BUFFER and a packet appended in pieces behind a header.
+//The maps table times each MAP_HANDLE operation, per operation, on maps of 1 to 256 entries. The filters table runs the
+//HX711Filter stages over a noisy trace of a letter landing on the scale: the time per sample, how many samples until
+//the output stays within a gram of the new weight, the noise left at rest, and how many samples until a small step
+//without noise is matched exactly, which only happens if the fixed point state keeps its fractional bits.
+//The suite is a sketch like main.cpp and exits when it is done.
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Esp32MQTTClient.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "HX711Filter.h"
+#include "LoopbackBroker.h"
+#include "TelemetryEncoder.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/map.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/strings.h"
+#include "az_iot/iothub_client/inc/iothub_client_options.h"
+#include "az_iot/umqtt/inc/azure_umqtt_c/mqtt_codec.h"
+
+#define MESSAGE_MAX_LEN 256            //as in main.cpp
+#define DRAIN_TIMEOUT 30000
+#define DECODER_PACKETS 20000
+#define DECODER_SEED 147
+#define INBOUND_MESSAGES 5000
+#define REPLAY_PUBLISHES 20000
+#define PROFILER_MESSAGES 20000
+#define STRING_BUILDS 200000
+#define BUFFER_BUILDS 200000
+#define BUFFER_CHUNKS 16               //of 64 bytes, a 1 KB packet
+#define MAP_OPERATIONS 200000          //per operation and map size
+#define FILTER_SEED 711
+#define FILTER_TRACE 1000              //samples per trace, 100 s at the HX711's 10 samples per second
+#define FILTER_STEP 200                //sample the letter lands at
+#define FILTER_REPEATS 200             //passes over the trace that are timed
+#define FILTER_BASE 45000              //raw counts of the empty mailbox, as the sim's load cell
+#define FILTER_LETTER 8700             //40 g at the 217.5 counts per gram main.cpp calibrates to
+#define FILTER_NOISE 60                //standard deviation of a conversion in counts
+#define FILTER_TOLERANCE 218           //a gram
+#define FILTER_SMALL_STEP 7            //counts, less than the IIR's 2^shift
+#define PROFILER_REPEATS 31            //the median of these counts, the rest is noise of the PC
+#define PROFILER_PAIRS 100000
+#define PROFILER_PAIR_SIZE 64
+#define PROFILER_FIRST_NEW_LINE 100000 //past any line of this file, so each line from here on is a call site gballoc has not seen
+#define BACKLOG_ROUND_TRIP 20000
+#define TIMEOUT_ROUND_TRIP 2000000     //the CONNACK takes this long, so the messages wait to be sent meanwhile
+#define TIMEOUT_MESSAGE_MS 1000
+#define BACKLOG_CONNECTION_STRING "HostName=loopback.azure-devices.net;DeviceId=backlog;SharedAccessKey=bG9vcGJhY2tiZW5jaG1hcms="
+#define CONNECTION_STRING "HostName=loopback.azure-devices.net;DeviceId=bench;SharedAccessKey=bG9vcGJhY2tiZW5jaG1hcms="
+
+struct BenchmarkRun
+{
+  const char* name;
+  TelemetryFormat format;
+  int window;                     //messages in flight at once, the SendWindow option
+  unsigned long roundTripUs;
+  int messages;
+  int batch;                      //records per message, the BatchMaxRecords option
+  int properties;                 //application properties on each message, which go into its topic
+};
+
+static const BenchmarkRun runs[] = {
+  { "json cpu",      TELEMETRY_JSON,  1,     0, 5000, 1, 0 },   //no round trip: what the client costs per message
+  { "json cpu",      TELEMETRY_JSON, 16,     0, 5000, 1, 0 },
+  { "cbor cpu",      TELEMETRY_CBOR, 16,     0, 5000, 1, 0 },
+  { "json props4",   TELEMETRY_JSON, 16,     0, 5000, 1, 4 },   //...and what building a topic with properties adds
+  { "json rtt20",    TELEMETRY_JSON,  1, 20000,  100, 1, 0 },   //a nearby IoT Hub: what pipelining buys
+  { "json rtt20",    TELEMETRY_JSON,  4, 20000,  400, 1, 0 },
+  { "json rtt20",    TELEMETRY_JSON, 16, 20000, 1000, 1, 0 },
+  { "json batch8",   TELEMETRY_JSON,  4, 20000, 2000, 8, 0 },   //...and what batching buys on top
+  { "cbor batch8",   TELEMETRY_CBOR,  4, 20000, 2000, 8, 0 },
+};
+
+//properties like main.cpp and a routing rule would set, some with characters the topic needs escaped
+static const char* const propertyNames[] = { "reconnectMs", "batch", "mailbox", "route" };
+static const char* const propertyValues[] = { "1520", "8", "front door", "alerts/mail&post" };
+
+//what IoT Hub puts behind the topic of a cloud-to-device message, followed by two properties of the sender's
+#define C2D_PROPERTIES "%24.mid=7c3f0d2e-5a1b-4a7e-9b1e-2f6c8d4e1a90&%24.to=%2Fdevices%2Fbench%2Fmessages%2FdeviceBound" \
+                       "&%24.cid=req-1520&%24.ct=application%2Fjson&%24.ce=utf-8&command=open&door=front%20door"
+
+static std::vector<unsigned long> latencies;   //micros() when sent, replaced by the latency on confirmation
+static int failures;
+
+static void Confirmed(int trackingId, IOTHUB_CLIENT_CONFIRMATION_RESULT result, void* context)
+{
+  unsigned long* slot = (unsigned long*)context;
+  *slot = micros() - *slot;
+  if (result != IOTHUB_CLIENT_CONFIRMATION_OK)
+  {
+    failures++;
+  }
+}
+
+static unsigned long Percentile(const std::vector<unsigned long>& sorted, int percent)
+{
+  return sorted[(sorted.size() - 1) * percent / 100];
+}
+
+static void Run(const BenchmarkRun& run)
+{
+  int window = run.window;
+  Esp32MQTTClient_SetOption(OPTION_SEND_WINDOW, &window);
+  int batch = run.batch;
+  BATCH_FORMAT format = run.format == TELEMETRY_JSON ? BATCH_JSON : BATCH_CBOR;
+  Esp32MQTTClient_SetOption(OPTION_BATCH_MAX_RECORDS, &batch);
+  Esp32MQTTClient_SetOption(OPTION_BATCH_FORMAT, &format);
+  LoopbackBroker::instance().setRoundTripUs(run.roundTripUs);
+  TelemetryEncoder encoder(run.format);
+  latencies.assign(run.messages, 0);
+  failures = 0;
+
+  size_t baseline = gballoc_getCurrentMemoryUsed();   //the client and its connection, there before the run
+  gballoc_resetMetrics();
+  unsigned long start = micros();
+  for (int i = 0; i < run.messages; i++)
+  {
+    while (Esp32MQTTClient_EventsInFlight() >= window)
+    {
+      Esp32MQTTClient_Check(false);
+    }
+    MailboxTelemetry telemetry = { i, 40.0f + (i % 100) / 100.0f, false, (uint32_t)(1700000000 + i), "mailDelivered", "delivered" };
+    uint8_t payload[MESSAGE_MAX_LEN];
+    size_t length = encoder.encode(telemetry, payload, sizeof(payload));
+    if (batch > 1)
+    {
+      if (!Esp32MQTTClient_BatchAdd(payload, length, false))
+      {
+        failures++;
+      }
+      continue;
+    }
+    latencies[i] = micros();
+    EVENT_INSTANCE* message = Esp32MQTTClient_Event_GenerateBinary(payload, length, encoder.contentType());
+    for (int p = 0; p < run.properties; p++)
+    {
+      Esp32MQTTClient_Event_AddProp(message, propertyNames[p], propertyValues[p]);
+    }
+    if (Esp32MQTTClient_SendEventAsync(message, Confirmed, &latencies[i]) < 0)
+    {
+      latencies[i] = 0;
+      failures++;
+    }
+  }
+  while (!Esp32MQTTClient_BatchFlush())
+  {
+    Esp32MQTTClient_Check(false);
+  }
+  bool drained = Esp32MQTTClient_Drain(DRAIN_TIMEOUT);
+  unsigned long elapsed = micros() - start;
+
+  size_t allocations = gballoc_getAllocationCount();
+  size_t allocated = gballoc_getTotalMemoryAllocated();
+  size_t peak = gballoc_getMaximumMemoryUsed();
+  std::vector<unsigned long> sorted(latencies);
+  std::sort(sorted.begin(), sorted.end());
+
+  Serial.printf("%-11s %6d %3d %9.0f %9.1f %9.0f %8u %8u %7lu %7lu %7lu %7lu %s\r\n",
+                run.name, run.messages, run.window, run.messages * 1e6 / elapsed,
+                (double)allocations / run.messages, (double)allocated / run.messages,
+                (unsigned)peak, (unsigned)(peak - baseline),
+                Percentile(sorted, 50), Percentile(sorted, 90), Percentile(sorted, 99), sorted.back(),
+                !drained ? "not drained" : failures > 0 ? "failures" : "");
+}
+
+struct DecoderFeed
+{
+  const char* name;
+  size_t minPiece;                //each call to mqtt_codec_bytesReceived gets a random size in between
+  size_t maxPiece;
+};
+
+static const DecoderFeed feeds[] = {
+  { "whole",     0,    0 },       //the stream in one call
+  { "tls16k",    16384, 16384 },  //full TLS records
+  { "tcp1460",   1, 1460 },
+  { "rand1-64",  1,   64 },
+  { "byte",      1,    1 },
+};
+
+struct DecodedStream
+{
+  size_t packets;
+  size_t bytes;
+  uint32_t hash;                  //FNV-1a over type, flags, length and contents of every packet
+};
+
+static void Decoded(void* context, CONTROL_PACKET_TYPE packet, int flags, const uint8_t* data, size_t length)
+{
+  DecodedStream* stream = (DecodedStream*)context;
+  uint32_t hash = stream->hash;
+  uint8_t header[3] = { (uint8_t)packet, (uint8_t)flags, (uint8_t)length };
+  for (size_t i = 0; i < sizeof(header); i++)
+  {
+    hash = (hash ^ header[i]) * 16777619u;
+  }
+  for (size_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  stream->hash = hash;
+  stream->packets++;
+  stream->bytes += length;
+}
+
+static void AppendPacket(std::vector<uint8_t>& stream, uint8_t type, const std::vector<uint8_t>& body)
+{
+  stream.push_back(type);
+  size_t length = body.size();
+  do
+  {
+    uint8_t digit = length % 128;
+    length /= 128;
+    stream.push_back(length > 0 ? digit | 0x80 : digit);
+  } while (length > 0);
+  stream.insert(stream.end(), body.begin(), body.end());
+}
+
+//what a device hears from IoT Hub: mostly PUBACKs, some pings and cloud-to-device messages up to 4 KB
+static std::vector<uint8_t> HubStream(int packets)
+{
+  std::vector<uint8_t> stream;
+  srand(DECODER_SEED);
+  for (int i = 0; i < packets; i++)
+  {
+    int kind = rand() % 10;
+    if (kind < 7)
+    {
+      AppendPacket(stream, PUBACK_TYPE, { (uint8_t)(i >> 8), (uint8_t)i });
+    }
+    else if (kind < 8)
+    {
+      AppendPacket(stream, PINGRESP_TYPE, {});
+    }
+    else
+    {
+      std::string topic = "devices/bench/messages/devicebound/%24.mid=" + std::to_string(i) + "&%24.to=%2Fdevices%2Fbench%2Fmessages%2FdeviceBound";
+      std::vector<uint8_t> body = { (uint8_t)(topic.size() >> 8), (uint8_t)topic.size() };
+      body.insert(body.end(), topic.begin(), topic.end());
+      body.push_back((uint8_t)(i >> 8));
+      body.push_back((uint8_t)i);
+      size_t payload = kind < 9 ? 16 + rand() % 240 : 256 + rand() % 3840;
+      for (size_t j = 0; j < payload; j++)
+      {
+        body.push_back((uint8_t)rand());
+      }
+      AppendPacket(stream, PUBLISH_TYPE | 0x02, body);
+    }
+  }
+  return stream;
+}
+
+static DecodedStream Decode(const std::vector<uint8_t>& stream, const DecoderFeed& feed, bool* failed)
+{
+  DecodedStream decoded = { 0, 0, 2166136261u };
+  MQTTCODEC_HANDLE codec = mqtt_codec_create(Decoded, &decoded);
+  srand(DECODER_SEED);
+  size_t offset = 0;
+  *failed = false;
+  while (offset < stream.size() && !*failed)
+  {
+    size_t piece = feed.maxPiece == 0 ? stream.size() : feed.minPiece + rand() % (feed.maxPiece - feed.minPiece + 1);
+    piece = std::min(piece, stream.size() - offset);
+    *failed = mqtt_codec_bytesReceived(codec, &stream[offset], piece) != 0;
+    offset += piece;
+  }
+  mqtt_codec_destroy(codec);
+  return decoded;
+}
+
+static bool DecoderRejectsLongLength()
+{
+  const uint8_t packet[] = { PUBLISH_TYPE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };   //five bytes of remaining length
+  DecodedStream decoded = { 0, 0, 2166136261u };
+  MQTTCODEC_HANDLE codec = mqtt_codec_create(Decoded, &decoded);
+  bool rejected = mqtt_codec_bytesReceived(codec, packet, sizeof(packet)) != 0;
+  mqtt_codec_destroy(codec);
+  return rejected && decoded.packets == 0;
+}
+
+static void BenchmarkDecoder()
+{
+  std::vector<uint8_t> stream = HubStream(DECODER_PACKETS);
+  bool failed;
+  DecodedStream expected = Decode(stream, feeds[0], &failed);
+
+  Serial.println("feed        packets    bytes     MB/s   pkt/s allocs/pkt bytes/pkt");
+  for (size_t i = 0; i < sizeof(feeds) / sizeof(feeds[0]); i++)
+  {
+    gballoc_resetMetrics();
+    unsigned long start = micros();
+    DecodedStream decoded = Decode(stream, feeds[i], &failed);
+    unsigned long elapsed = std::max(micros() - start, 1UL);
+    bool same = !failed && decoded.packets == expected.packets && decoded.bytes == expected.bytes && decoded.hash == expected.hash;
+    Serial.printf("%-10s %8u %8u %8.1f %7.0f %10.2f %9.1f %s\r\n",
+                  feeds[i].name, (unsigned)decoded.packets, (unsigned)stream.size(), stream.size() / (double)elapsed,
+                  decoded.packets * 1e6 / elapsed, (double)gballoc_getAllocationCount() / decoded.packets,
+                  (double)gballoc_getTotalMemoryAllocated() / decoded.packets, same ? "" : "MISMATCH");
+  }
+  if (!DecoderRejectsLongLength())
+  {
+    Serial.println("Decoder accepted a remaining length of five bytes.");
+  }
+}
+
+static int inboundCount;
+
+static void InboundMessage(const char* payload, int size)
+{
+  inboundCount++;
+}
+
+static int InboundMethod(const char* methodName, const unsigned char* payload, int size, unsigned char** response, int* response_size)
+{
+  inboundCount++;
+  *response = (unsigned char*)strdup("{}");
+  *response_size = 2;
+  return 200;
+}
+
+static void BenchmarkInbound(const char* name, bool method)
+{
+  LoopbackBroker& broker = LoopbackBroker::instance();
+  broker.setRoundTripUs(0);
+  inboundCount = 0;
+  gballoc_resetMetrics();
+  unsigned long start = micros();
+  unsigned long deadline = millis() + DRAIN_TIMEOUT;
+  for (int i = 0; i < INBOUND_MESSAGES && millis() < deadline; i++)
+  {
+    if (method)
+    {
+      broker.invokeMethod("echo", "{\"text\":\"bench\"}");
+    }
+    else
+    {
+      broker.sendCloudToDevice("bench", C2D_PROPERTIES, "{\"command\":\"open\"}");
+    }
+    while (inboundCount <= i && millis() < deadline)
+    {
+      Esp32MQTTClient_Check(false);
+    }
+  }
+  unsigned long elapsed = std::max(micros() - start, 1UL);
+  Serial.printf("%-11s %6d %9.0f %10.1f %9.0f %s\r\n",
+                name, inboundCount, inboundCount * 1e6 / elapsed,
+                (double)gballoc_getAllocationCount() / std::max(inboundCount, 1),
+                (double)gballoc_getTotalMemoryAllocated() / std::max(inboundCount, 1),
+                inboundCount < INBOUND_MESSAGES ? "timed out" : "");
+}
+
+enum TraceOp { TRACE_ALLOCATE, TRACE_REALLOCATE, TRACE_RELEASE };
+
+struct TraceStep
+{
+  TraceOp op;
+  int block;                      //blocks are numbered in the order the trace allocates them
+  size_t size;
+};
+
+static std::vector<TraceStep> trace;
+static std::unordered_map<void*, int> traceBlocks;
+static int traceBlockCount;
+static const GBALLOC_BACKEND* traced;   //what the recording backend passes the calls on to
+
+static void* TraceAllocate(size_t size)
+{
+  void* ptr = traced->allocate(size);
+  if (ptr != NULL)
+  {
+    trace.push_back({ TRACE_ALLOCATE, traceBlockCount, size });
+    traceBlocks[ptr] = traceBlockCount++;
+  }
+  return ptr;
+}
+
+static void* TraceReallocate(void* ptr, size_t size)
+{
+  void* moved = traced->reallocate(ptr, size);
+  if (moved != NULL)
+  {
+    auto block = traceBlocks.find(ptr);
+    if (block == traceBlocks.end())
+    {
+      //a block from before the publish: replayed as allocated in it
+      trace.push_back({ TRACE_ALLOCATE, traceBlockCount, size });
+      traceBlocks[moved] = traceBlockCount++;
+    }
+    else
+    {
+      int id = block->second;
+      trace.push_back({ TRACE_REALLOCATE, id, size });
+      traceBlocks.erase(block);
+      traceBlocks[moved] = id;
+    }
+  }
+  return moved;
+}
+
+static void TraceRelease(void* ptr)
+{
+  auto block = traceBlocks.find(ptr);
+  if (block != traceBlocks.end())
+  {
+    trace.push_back({ TRACE_RELEASE, block->second, 0 });
+    traceBlocks.erase(block);
+  }
+  traced->release(ptr);
+}
+
+static const GBALLOC_BACKEND recorder = { TraceAllocate, TraceReallocate, TraceRelease };
+
+static void Publish()
+{
+  uint8_t payload[] = "{\"messageId\":1,\"temperature\":40.5,\"mail\":\"delivered\"}";
+  EVENT_INSTANCE* message = Esp32MQTTClient_Event_GenerateBinary(payload, sizeof(payload) - 1, "application/json");
+  (void)Esp32MQTTClient_SendEventAsync(message, NULL, NULL);
+  while (Esp32MQTTClient_EventsInFlight() > 0)
+  {
+    Esp32MQTTClient_Check(false);
+  }
+}
+
+//the time per allocator call of publishing, with the client's blocks live in gballoc as they are on a device
+static void Replay(const char* name)
+{
+  std::vector<void*> blocks(traceBlockCount, (void*)NULL);
+  unsigned long start = micros();
+  for (int i = 0; i < REPLAY_PUBLISHES; i++)
+  {
+    for (const TraceStep& step : trace)
+    {
+      switch (step.op)
+      {
+      case TRACE_ALLOCATE:
+        blocks[step.block] = gballoc_malloc(step.size);
+        break;
+      case TRACE_REALLOCATE:
+        blocks[step.block] = gballoc_realloc(blocks[step.block], step.size);
+        break;
+      case TRACE_RELEASE:
+        gballoc_free(blocks[step.block]);
+        blocks[step.block] = NULL;
+        break;
+      }
+    }
+    for (void*& block : blocks)   //what the publish leaves allocated, a grown buffer say
+    {
+      gballoc_free(block);
+      block = NULL;
+    }
+  }
+  unsigned long elapsed = micros() - start;
+  Serial.printf("%-11s %7u %9.1f\r\n", name, (unsigned)trace.size(), elapsed * 1000.0 / ((double)REPLAY_PUBLISHES * trace.size()));
+}
+
+static void BenchmarkAllocator()
+{
+  int window = 1;
+  int batch = 1;
+  Esp32MQTTClient_SetOption(OPTION_SEND_WINDOW, &window);
+  Esp32MQTTClient_SetOption(OPTION_BATCH_MAX_RECORDS, &batch);
+  LoopbackBroker::instance().setRoundTripUs(0);
+  Publish();                      //once first, so the trace has none of what the first publish sets up
+  traced = gballoc_getBackend();
+  gballoc_setBackend(&recorder);
+  Publish();
+  gballoc_setBackend(traced);
+  traceBlocks.clear();
+
+  Serial.println("allocator   ops/msg     ns/op");
+  Replay("heap");
+}
+
+//the json cpu run, for what the profiler attributes to which subsystem
+static void PublishProfiled(int messages)
+{
+  int window = 16;
+  Esp32MQTTClient_SetOption(OPTION_SEND_WINDOW, &window);
+  TelemetryEncoder encoder(TELEMETRY_JSON);
+  for (int i = 0; i < messages; i++)
+  {
+    while (Esp32MQTTClient_EventsInFlight() >= window)
+    {
+      Esp32MQTTClient_Check(false);
+    }
+    MailboxTelemetry telemetry = { i, 40.0f, false, (uint32_t)(1700000000 + i), "mailDelivered", "delivered" };
+    uint8_t payload[MESSAGE_MAX_LEN];
+    size_t length = encoder.encode(telemetry, payload, sizeof(payload));
+    (void)Esp32MQTTClient_SendEventAsync(Esp32MQTTClient_Event_GenerateBinary(payload, length, encoder.contentType()), NULL, NULL);
+  }
+  Esp32MQTTClient_Drain(DRAIN_TIMEOUT);
+}
+
+//ns per gballoc_malloc_at and gballoc_free pair; a line of 0 allocates from a new call site every time
+static double PairTime(int line)
+{
+  static int newLine = PROFILER_FIRST_NEW_LINE;
+  unsigned long start = micros();
+  for (int i = 0; i < PROFILER_PAIRS; i++)
+  {
+    gballoc_free(gballoc_malloc_at(PROFILER_PAIR_SIZE, __FILE__, line != 0 ? line : newLine++));
+  }
+  return (micros() - start) * 1000.0 / PROFILER_PAIRS;
+}
+
+static void BenchmarkProfiler()
+{
+  LoopbackBroker::instance().setRoundTripUs(0);
+  gballoc_setProfiling(1);
+  PublishProfiled(PROFILER_MESSAGES);
+  gballoc_setProfiling(0);
+  Serial.println("subsystem   live(B) peak(B)  allocs bytes");
+  GBALLOC_PROFILE_STATISTICS statistics;
+  for (int subsystem = 0; subsystem < GBALLOC_SUBSYSTEM_COUNT; subsystem++)
+  {
+    if (gballoc_getSubsystemStatistics((GBALLOC_SUBSYSTEM)subsystem, &statistics) == 0)
+    {
+      Serial.printf("%-11s %7u %7u %7u %9u\r\n", statistics.name, (unsigned)statistics.liveBytes, (unsigned)statistics.peakBytes,
+                    (unsigned)statistics.allocations, (unsigned)statistics.bytesAllocated);
+    }
+  }
+  Serial.println();
+
+  //the call sites taken before the new ones fill the table, after which each of them misses all 8 probes and has its
+  //file classified again, 5 strstr calls on this file's path: the most profiling can add to an allocation
+  gballoc_setProfiling(1);
+  (void)PairTime(0);
+  const char* names[] = { "off", "on", "new site" };
+  std::vector<double> times[3];
+  for (int repeat = 0; repeat < PROFILER_REPEATS; repeat++)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      gballoc_setProfiling(i > 0);
+      times[i].push_back(PairTime(i < 2 ? __LINE__ : 0));
+    }
+  }
+  gballoc_setProfiling(0);
+  Serial.println("profiler      pairs  min(ns) median(ns)");
+  for (int i = 0; i < 3; i++)
+  {
+    std::sort(times[i].begin(), times[i].end());
+    Serial.printf("%-11s %7d %8.1f %10.1f\r\n", names[i], PROFILER_PAIRS, times[i].front(), times[i][times[i].size() / 2]);
+  }
+  Serial.printf("profiling adds %.1f ns a pair, %.1f ns at most (a %u byte path)\r\n",
+                times[1][times[1].size() / 2] - times[0][times[0].size() / 2],
+                times[2][times[2].size() / 2] - times[0][times[0].size() / 2], (unsigned)strlen(__FILE__));
+}
+
+enum StringPattern { STRING_RESPONSE_TOPIC, STRING_TWIN_TOPIC, STRING_PROPERTIES, STRING_SAS_TOKEN };
+
+//one string as the transport builds it, the topic of a direct method response and of a reported properties patch
+//from a format, a topic with application properties appended one at a time and a SAS token concatenated in pieces
+static size_t BuildString(StringPattern pattern, int i, int properties)
+{
+  STRING_HANDLE string = NULL;
+  switch (pattern)
+  {
+  case STRING_RESPONSE_TOPIC:
+    string = STRING_construct_sprintf("$iothub/methods/res/%d/?$rid=%d", 200, i);
+    break;
+  case STRING_TWIN_TOPIC:
+    string = STRING_construct_sprintf("$iothub/twin/PATCH/properties/reported/?$rid=%d", i);
+    break;
+  case STRING_PROPERTIES:
+    string = STRING_construct("devices/bench/messages/events/");
+    for (int property = 0; property < properties; property++)
+    {
+      (void)STRING_sprintf(string, "%s=%s&", propertyNames[property % 4], propertyValues[property % 4]);
+    }
+    break;
+  case STRING_SAS_TOKEN:
+    string = STRING_new();
+    (void)STRING_concat(string, "SharedAccessSignature sr=");
+    (void)STRING_concat(string, "loopback.azure-devices.net%2Fdevices%2Fbench");
+    (void)STRING_concat(string, "&sig=");
+    (void)STRING_concat(string, "q9bG9vcGJhY2tiZW5jaG1hcmsbG9vcGJhY2tiZW5jaG1hcms%3D");
+    (void)STRING_concat(string, "&se=");
+    (void)STRING_sprintf(string, "%d", 1700000000 + i);
+    break;
+  }
+  size_t length = STRING_length(string);
+  STRING_delete(string);
+  return length;
+}
+
+static void BenchmarkStrings(const char* name, StringPattern pattern, int properties)
+{
+  size_t bytes = 0;
+  gballoc_resetMetrics();
+  unsigned long start = micros();
+  for (int i = 0; i < STRING_BUILDS; i++)
+  {
+    bytes += BuildString(pattern, i, properties);
+  }
+  unsigned long elapsed = micros() - start;
+  Serial.printf("%-11s %6u %9.1f %11.2f\r\n", name, (unsigned)(bytes / STRING_BUILDS), elapsed * 1000.0 / STRING_BUILDS,
+                (double)gballoc_getAllocationCount() / STRING_BUILDS);
+}
+
+enum BufferPattern { BUFFER_CONNECT, BUFFER_SUBSCRIBE, BUFFER_CHUNKED };
+
+//one packet as the SDK builds it in a BUFFER, the header going in front once the rest is there
+static size_t BuildBuffer(BufferPattern pattern, BUFFER_HANDLE header)
+{
+  static const uint8_t chunk[64] = { 0 };
+  static char clientId[] = "bench";
+  static char username[] = "loopback.azure-devices.net/bench/?api-version=2018-06-30&DeviceClientType=iothubclient%2F1.2.8";
+  static char password[] = "SharedAccessSignature sr=loopback.azure-devices.net%2Fdevices%2Fbench&sig=q9bG9vcGJhY2tiZW5jaG1hcms%3D&se=1700000000";
+  static SUBSCRIBE_PAYLOAD subscriptions[] = {
+    { "$iothub/twin/res/#", DELIVER_AT_MOST_ONCE },
+    { "$iothub/methods/POST/#", DELIVER_AT_MOST_ONCE },
+    { "devices/bench/messages/devicebound/#", DELIVER_AT_LEAST_ONCE },
+  };
+  BUFFER_HANDLE packet = NULL;
+  switch (pattern)
+  {
+  case BUFFER_CONNECT:
+  {
+    MQTT_CLIENT_OPTIONS options = { clientId, NULL, NULL, username, password, 240, false, false, DELIVER_AT_LEAST_ONCE, false };
+    packet = mqtt_codec_connect(&options, NULL);
+    break;
+  }
+  case BUFFER_SUBSCRIBE:
+    packet = mqtt_codec_subscribe(7, subscriptions, 3, NULL);
+    break;
+  case BUFFER_CHUNKED:
+    packet = BUFFER_new();
+    for (int i = 0; i < BUFFER_CHUNKS; i++)
+    {
+      (void)BUFFER_append_build(packet, chunk, sizeof(chunk));
+    }
+    (void)BUFFER_prepend(packet, header);
+    break;
+  }
+  size_t length = BUFFER_length(packet);
+  BUFFER_delete(packet);
+  return length;
+}
+
+static void BenchmarkBuffers(const char* name, BufferPattern pattern)
+{
+  static const uint8_t fixedHeader[] = { 0x30, 0x80, 0x08 };
+  BUFFER_HANDLE header = BUFFER_create(fixedHeader, sizeof(fixedHeader));
+  size_t bytes = 0;
+  gballoc_resetMetrics();
+  unsigned long start = micros();
+  for (int i = 0; i < BUFFER_BUILDS; i++)
+  {
+    bytes += BuildBuffer(pattern, header);
+  }
+  unsigned long elapsed = micros() - start;
+  Serial.printf("%-11s %6u %9.1f %11.2f\r\n", name, (unsigned)(bytes / BUFFER_BUILDS), elapsed * 1000.0 / BUFFER_BUILDS,
+                (double)gballoc_getAllocationCount() / BUFFER_BUILDS);
+  BUFFER_delete(header);
+}
+
+//fills enough maps of entries keys each to make a thousand entries, times each kind of operation on all of them and
+//empties them again, as often as it takes to make MAP_OPERATIONS of each
+static void BenchmarkMap(int entries)
+{
+  std::vector<std::string> keys;
+  for (int i = 0; i < entries; i++)
+  {
+    keys.push_back("property" + std::to_string(i * 7919));
+  }
+  std::vector<MAP_HANDLE> maps(std::max(1, 1024 / entries));
+  int rounds = std::max(1, MAP_OPERATIONS / (entries * (int)maps.size()));
+  unsigned long add = 0, get = 0, update = 0, miss = 0, remove = 0;
+  size_t allocations = 0;
+  bool found = true;
+  for (int round = 0; round < rounds; round++)
+  {
+    for (MAP_HANDLE& map : maps)
+    {
+      map = Map_Create(NULL);
+    }
+    gballoc_resetMetrics();
+    unsigned long start = micros();
+    for (MAP_HANDLE map : maps)
+    {
+      for (int i = 0; i < entries; i++)
+      {
+        (void)Map_Add(map, keys[i].c_str(), "value");
+      }
+    }
+    add += micros() - start;
+    allocations += gballoc_getAllocationCount();
+    start = micros();
+    for (MAP_HANDLE map : maps)
+    {
+      for (int i = 0; i < entries; i++)
+      {
+        found &= Map_GetValueFromKey(map, keys[i].c_str()) != NULL;
+      }
+    }
+    get += micros() - start;
+    start = micros();
+    for (MAP_HANDLE map : maps)
+    {
+      for (int i = 0; i < entries; i++)
+      {
+        (void)Map_AddOrUpdate(map, keys[i].c_str(), "other");
+      }
+    }
+    update += micros() - start;
+    start = micros();
+    for (MAP_HANDLE map : maps)
+    {
+      for (int i = 0; i < entries; i++)
+      {
+        bool exists;
+        (void)Map_ContainsKey(map, "absent", &exists);
+        found &= !exists;
+      }
+    }
+    miss += micros() - start;
+    start = micros();
+    for (MAP_HANDLE map : maps)
+    {
+      for (int i = 0; i < entries; i++)
+      {
+        (void)Map_Delete(map, keys[i].c_str());
+      }
+    }
+    remove += micros() - start;
+    for (MAP_HANDLE map : maps)
+    {
+      Map_Destroy(map);
+    }
+  }
+  double operations = (double)rounds * maps.size() * entries / 1000.0;
+  Serial.printf("%7d %8.1f %8.1f %8.1f %8.1f %8.1f %10.2f%s\r\n", entries, add / operations, get / operations, update / operations,
+                miss / operations, remove / operations, allocations / operations / 1000.0, found ? "" : " WRONG");
+}
+
+//the load cell at rest, then a letter landing on it, with the noise of the HX711's conversions
+static std::vector<long> FilterTrace(int noise)
+{
+  std::vector<long> trace;
+  srand(FILTER_SEED);
+  for (int i = 0; i < FILTER_TRACE; i++)
+  {
+    int sum = 0;
+    for (int j = 0; j < 12; j++)
+    {
+      sum += rand() % 1001 - 500;       //a sum of 12 uniform draws is close to normal, with a deviation of 1000
+    }
+    trace.push_back(FILTER_BASE + (i < FILTER_STEP ? 0 : FILTER_LETTER) + sum * noise / 1000);
+  }
+  return trace;
+}
+
+//samples after the step until the output stays within tolerance of level, or -1 if it never does
+static int SettlingSamples(HX711Filter& filter, const std::vector<long>& trace, long level, long tolerance,
+                           double* noise)
+{
+  int settled = FILTER_STEP;
+  double squares = 0;
+  filter.reset_all();
+  for (int i = 0; i < (int)trace.size(); i++)
+  {
+    long output = filter.apply(trace[i]);
+    long expected = i < FILTER_STEP ? FILTER_BASE : level;
+    if (labs(output - expected) > tolerance)
+    {
+      settled = i + 1;
+    }
+    if (i >= FILTER_TRACE / 2)
+    {
+      squares += (double)(output - expected) * (output - expected);
+    }
+  }
+  if (noise != NULL)
+  {
+    *noise = sqrt(squares / (trace.size() - FILTER_TRACE / 2));
+  }
+  return settled >= (int)trace.size() ? -1 : settled - FILTER_STEP;
+}
+
+static void BenchmarkFilter(const char* name, HX711Filter& filter)
+{
+  std::vector<long> noisy = FilterTrace(FILTER_NOISE);
+  std::vector<long> small;
+  for (int i = 0; i < FILTER_TRACE; i++)
+  {
+    small.push_back(FILTER_BASE + (i < FILTER_STEP ? 0 : FILTER_SMALL_STEP));
+  }
+
+  static volatile long sink;            //keeps the outputs from being optimized away
+  unsigned long start = micros();
+  for (int pass = 0; pass < FILTER_REPEATS; pass++)
+  {
+    filter.reset_all();
+    for (long sample : noisy)
+    {
+      sink = filter.apply(sample);
+    }
+  }
+  unsigned long elapsed = micros() - start;
+
+  double noise;
+  int settle = SettlingSamples(filter, noisy, FILTER_BASE + FILTER_LETTER, FILTER_TOLERANCE, &noise);
+  int exact = SettlingSamples(filter, small, FILTER_BASE + FILTER_SMALL_STEP, 0, NULL);
+  Serial.printf("%-12s %9.1f %7d %8.1f %7d%s\r\n", name, elapsed * 1000.0 / ((double)FILTER_REPEATS * FILTER_TRACE),
+                settle, noise, exact, settle < 0 || exact < 0 ? " WRONG" : "");
+}
+
+static void BenchmarkFilters()
+{
+  MovingAverageFilter<10> average;
+  MedianFilter<5> median;
+  IirFilter iir(3);
+  KalmanFilter kalman(4, 400);
+  MedianFilter<5> pipelineMedian;
+  IirFilter pipelineIir(3);
+  pipelineMedian.then(pipelineIir);
+
+  Serial.println("filters      ns/sample  settle  noise(c)   exact");
+  BenchmarkFilter("average10", average);
+  BenchmarkFilter("median5", median);
+  BenchmarkFilter("iir3", iir);
+  BenchmarkFilter("kalman", kalman);
+  BenchmarkFilter("median+iir", pipelineMedian);
+}
+
+static int backlogConfirmed;
+static int backlogFailed;
+
+static void BacklogConfirmed(IOTHUB_CLIENT_CONFIRMATION_RESULT result, void* context)
+{
+  if (result == IOTHUB_CLIENT_CONFIRMATION_OK)
+  {
+    backlogConfirmed++;
+  }
+  else
+  {
+    backlogFailed++;
+  }
+}
+
+static void BenchmarkBacklog(int messages, bool drop)
+{
+  LoopbackBroker& broker = LoopbackBroker::instance();
+  broker.setRoundTripUs(BACKLOG_ROUND_TRIP);
+  IOTHUB_CLIENT_LL_HANDLE client = IoTHubClient_LL_CreateFromConnectionString(BACKLOG_CONNECTION_STRING, MQTT_Protocol);
+  if (client == NULL)
+  {
+    Serial.println("Could not create the backlog client.");
+    return;
+  }
+  (void)IoTHubClient_LL_SetRetryPolicy(client, IOTHUB_CLIENT_RETRY_IMMEDIATE, 0);
+  TelemetryEncoder encoder(TELEMETRY_JSON);
+  for (int i = 0; i < messages; i++)
+  {
+    MailboxTelemetry telemetry = { i, 40.0f, false, (uint32_t)(1700000000 + i), "mailDelivered", "delivered" };
+    uint8_t payload[MESSAGE_MAX_LEN];
+    size_t length = encoder.encode(telemetry, payload, sizeof(payload));
+    IOTHUB_MESSAGE_HANDLE message = IoTHubMessage_CreateFromByteArray(payload, length);
+    (void)IoTHubClient_LL_SendEventAsync(client, message, BacklogConfirmed, NULL);
+    IoTHubMessage_Destroy(message);
+  }
+
+  backlogConfirmed = 0;
+  backlogFailed = 0;
+  bool dropped = !drop;
+  unsigned long longest = 0;
+  unsigned long start = micros();
+  unsigned long deadline = millis() + DRAIN_TIMEOUT;
+  while (backlogConfirmed + backlogFailed < messages && millis() < deadline)
+  {
+    if (!dropped && backlogConfirmed >= messages / 2)
+    {
+      broker.dropConnections();
+      dropped = true;
+    }
+    unsigned long call = micros();
+    IoTHubClient_LL_DoWork(client);
+    longest = std::max(longest, micros() - call);
+  }
+  unsigned long elapsed = std::max(micros() - start, 1UL);
+  Serial.printf("%-11s %6d %9.0f %9.0f %11lu %s\r\n",
+                drop ? "dropped" : "steady", messages, elapsed / 1000.0, backlogConfirmed * 1e6 / elapsed, longest,
+                backlogConfirmed + backlogFailed < messages ? "timed out" : backlogFailed > 0 ? "failures" : "");
+  IoTHubClient_LL_Destroy(client);
+}
+
+static int timedOut;
+
+static void TimeoutConfirmed(IOTHUB_CLIENT_CONFIRMATION_RESULT result, void* context)
+{
+  if (result == IOTHUB_CLIENT_CONFIRMATION_MESSAGE_TIMEOUT)
+  {
+    timedOut++;
+  }
+}
+
+//DoWork while messages with a timeout wait to be sent, until they have all timed out
+static void BenchmarkTimeouts(int messages)
+{
+  LoopbackBroker& broker = LoopbackBroker::instance();
+  broker.setRoundTripUs(TIMEOUT_ROUND_TRIP);
+  IOTHUB_CLIENT_LL_HANDLE client = IoTHubClient_LL_CreateFromConnectionString(BACKLOG_CONNECTION_STRING, MQTT_Protocol);
+  if (client == NULL)
+  {
+    Serial.println("Could not create the timeout client.");
+    return;
+  }
+  tickcounter_ms_t timeout = TIMEOUT_MESSAGE_MS;
+  (void)IoTHubClient_LL_SetOption(client, OPTION_MESSAGE_TIMEOUT, &timeout);
+  uint8_t payload[] = "{}";
+  for (int i = 0; i < messages; i++)
+  {
+    IOTHUB_MESSAGE_HANDLE message = IoTHubMessage_CreateFromByteArray(payload, sizeof(payload) - 1);
+    (void)IoTHubClient_LL_SendEventAsync(client, message, TimeoutConfirmed, NULL);
+    IoTHubMessage_Destroy(message);
+  }
+
+  timedOut = 0;
+  unsigned long calls = 0;
+  unsigned long waiting = 0;      //time spent in DoWork before the timeouts, when there is nothing to do
+  unsigned long longest = 0;
+  unsigned long deadline = millis() + DRAIN_TIMEOUT;
+  while (timedOut < messages && millis() < deadline)
+  {
+    unsigned long call = micros();
+    IoTHubClient_LL_DoWork(client);
+    unsigned long took = micros() - call;
+    if (timedOut == 0)
+    {
+      calls++;
+      waiting += took;
+    }
+    longest = std::max(longest, took);
+  }
+  Serial.printf("%-11s %6d %9.2f %11lu %s\r\n",
+                "waiting", messages, calls == 0 ? 0.0 : (double)waiting / calls, longest, timedOut < messages ? "timed out" : "");
+  IoTHubClient_LL_Destroy(client);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  gballoc_init();                 //before the first SDK allocation, or it is not tracked
+
+  WiFi.mode(WIFI_STA);
+  WiFi.begin("loopback");
+  while (WiFi.status() != WL_CONNECTED)
+  {
+    delay(10);
+  }
+  LoopbackBroker::instance().setRecording(false);
+  Esp32MQTTClient_SetMessageCallback(InboundMessage);
+  Esp32MQTTClient_SetDeviceMethodCallback(InboundMethod);
+  if (!Esp32MQTTClient_Init((const uint8_t*)CONNECTION_STRING, true))   //with twin, for the direct methods
+  {
+    Serial.println("Could not connect to the loopback broker.");
+    exit(1);
+  }
+
+  LOGGER_LOG log = xlogging_get_log_function();
+  xlogging_set_log_function(NULL);    //the client logs every confirmation, which would be most of what is measured
+  Serial.println("run         msgs win     msg/s allocs/msg bytes/msg peak(B)  +run(B)   p50us   p90us   p99us   maxus");
+  for (size_t i = 0; i < sizeof(runs) / sizeof(runs[0]); i++)
+  {
+    Run(runs[i]);
+  }
+  Serial.println();
+  BenchmarkDecoder();
+  Serial.println();
+  Serial.println("inbound     msgs     msg/s allocs/msg bytes/msg");
+  BenchmarkInbound("c2d props", false);
+  BenchmarkInbound("method", true);
+  Serial.println();
+  BenchmarkAllocator();
+  Serial.println();
+  BenchmarkProfiler();
+  Serial.println();
+  Serial.println("strings      bytes ns/string allocs/string");
+  BenchmarkStrings("response", STRING_RESPONSE_TOPIC, 0);
+  BenchmarkStrings("twin", STRING_TWIN_TOPIC, 0);
+  BenchmarkStrings("props4", STRING_PROPERTIES, 4);
+  BenchmarkStrings("props16", STRING_PROPERTIES, 16);
+  BenchmarkStrings("sas", STRING_SAS_TOKEN, 0);
+  Serial.println();
+  Serial.println("buffers      bytes ns/packet allocs/packet");
+  BenchmarkBuffers("connect", BUFFER_CONNECT);
+  BenchmarkBuffers("subscribe3", BUFFER_SUBSCRIBE);
+  BenchmarkBuffers("chunks16", BUFFER_CHUNKED);
+  Serial.println();
+  Serial.println("maps     add ns   get ns   upd ns  miss ns   del ns allocs/add");
+  for (int entries : { 1, 4, 8, 16, 64, 256 })
+  {
+    BenchmarkMap(entries);
+  }
+  Serial.println();
+  BenchmarkFilters();
+  Serial.println();
+  Serial.println("backlog     msgs        ms     msg/s max dowork us");
+  BenchmarkBacklog(2000, false);
+  BenchmarkBacklog(8000, false);
+  BenchmarkBacklog(8000, true);
+  Serial.println();
+  Serial.println("timeouts    msgs dowork us max dowork us");
+  BenchmarkTimeouts(1000);
+  BenchmarkTimeouts(10000);
+  xlogging_set_log_function(log);
+
+  Esp32MQTTClient_Close();
+  fflush(stdout);
+  exit(0);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. 
+
+// Measures how many messages per second reach IoT Hub with 1, 4 and 16 events in flight.
+// With one event in flight every message waits a full round trip for its PUBACK; a wider
+// window keeps the link busy while earlier messages are still being confirmed.
+
+#include <WiFi.h>
+#include "AzureIotHub.h"
+#include "Esp32MQTTClient.h"
+
+#define MESSAGES_PER_ROUND 64
+#define DRAIN_TIMEOUT_MS 30000
+
+// Please input the SSID and password of WiFi
+const char* ssid     = "";
+const char* password = "";
+
+/*String containing Hostname, Device Id & Device Key in the format:                         */
+/*  "HostName=<host_name>;DeviceId=<device_id>;SharedAccessKey=<device_key>"                */
+static const char* connectionString = "";
+
+static const int windows[] = { 1, 4, SEND_WINDOW_MAX };
+static int confirmed;
+
+static void EventCompleted(int trackingId, IOTHUB_CLIENT_CONFIRMATION_RESULT result, void* context)
+{
+  if (result == IOTHUB_CLIENT_CONFIRMATION_OK)
+  {
+    confirmed++;
+  }
+}
+
+static void RunRound(int window)
+{
+  Esp32MQTTClient_SetOption(OPTION_SEND_WINDOW, &window);
+  confirmed = 0;
+
+  unsigned long start_ms = millis();
+  int sent = 0;
+  while (sent < MESSAGES_PER_ROUND)
+  {
+    if (Esp32MQTTClient_EventsInFlight() < window)
+    {
+      char payload[32];
+      snprintf(payload, sizeof(payload), "{\"messageId\":%d}", sent);
+      if (Esp32MQTTClient_SendEventAsync(Esp32MQTTClient_Event_Generate(payload, MESSAGE), EventCompleted, NULL) >= 0)
+      {
+        sent++;
+      }
+    }
+    Esp32MQTTClient_Check(false);
+  }
+  Esp32MQTTClient_Drain(DRAIN_TIMEOUT_MS);
+  unsigned long elapsed = millis() - start_ms;
+
+  Serial.printf("window %2d: %d of %d confirmed in %lu ms, %.1f messages/s\r\n",
+                window, confirmed, MESSAGES_PER_ROUND, elapsed, confirmed * 1000.0 / elapsed);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  WiFi.begin(ssid, password);
+  while (WiFi.status() != WL_CONNECTED)
+  {
+    delay(500);
+  }
+  if (!Esp32MQTTClient_Init((const uint8_t*)connectionString))
+  {
+    Serial.println("Initializing IoT hub failed.");
+    return;
+  }
+
+  for (unsigned int i = 0; i < sizeof(windows) / sizeof(windows[0]); i++)
+  {
+    RunRound(windows[i]);
+  }
+}
+
+void loop()
+{
+  Esp32MQTTClient_Check();
+  delay(100);
+}
@@ -0,0 +1,2 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. 
\ No newline at end of file
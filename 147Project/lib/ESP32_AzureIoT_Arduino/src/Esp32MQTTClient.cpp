@@ -0,0 +1,1196 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license.
+#include "Esp32MQTTClient.h"
+#include "Arduino.h"
+// Blocks handed to the SDK are freed by it, so they must come from its allocator
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
+
+#define CONNECT_TIMEOUT_MS 30000
+#define CHECK_INTERVAL_MS 5000
+#define MQTT_KEEPALIVE_INTERVAL_S 240         // the longest quiet time, umqtt pings sooner when the NAT needs it
+#define SEND_EVENT_RETRY_COUNT 2
+#define EVENT_TIMEOUT_MS 10000
+#define EVENT_CONFIRMED -2
+#define EVENT_FAILED -3
+#define DEFAULT_SEND_WINDOW 4
+#define RECONNECT_TIMEOUT_MS 30000
+#define DEFAULT_BATCH_MAX_BYTES 4096
+#define DEFAULT_BATCH_MAX_AGE_MS 10000
+
+static int callbackCounter;
+static IOTHUB_CLIENT_LL_HANDLE iotHubClientHandle = NULL;
+static int receiveContext = 0;
+static int statusContext = 0;
+static int trackingId = 0;
+static int currentTrackingId = -1;
+static bool clientConnected = false;
+static bool resetClient = false;
+static CONNECTION_STATUS_CALLBACK _connection_status_callback = NULL;
+static SEND_CONFIRMATION_CALLBACK _send_confirmation_callback = NULL;
+static MESSAGE_CALLBACK _message_callback = NULL;
+static DEVICE_TWIN_CALLBACK _device_twin_callback = NULL;
+static DEVICE_METHOD_CALLBACK _device_method_callback = NULL;
+static REPORT_CONFIRMATION_CALLBACK _report_confirmation_callback = NULL;
+static bool enableDeviceTwin = false;
+static int sendWindow = DEFAULT_SEND_WINDOW;
+static EVENT_INSTANCE *inFlight[SEND_WINDOW_MAX];
+static int eventsInFlight = 0;
+static int keepAliveInterval = MQTT_KEEPALIVE_INTERVAL_S;
+static bool reconnecting = false;           // the connection is gone, the transport is making a new one
+static bool rebuilding = false;             // ...with a new client, after it did not manage on its own
+static unsigned long disconnected_ms;
+static unsigned long reconnect_attempt_ms;
+static RECONNECT_STATS reconnectStats;
+static int batchMaxRecords = 1;             // 1 sends every record on its own
+static int batchMaxBytes = DEFAULT_BATCH_MAX_BYTES;
+static int batchMaxAge = DEFAULT_BATCH_MAX_AGE_MS;
+static BATCH_FORMAT batchFormat = BATCH_JSON;
+static char *batchContentType = NULL;
+static uint8_t *batchBuffer = NULL;         // batchMaxBytes, [0] is kept for the start of the array
+static size_t batchUsed = 1;
+static int batchRecords = 0;
+static bool batchUrgent = false;
+static unsigned long batch_start_ms;
+
+static unsigned long iothub_check_ms;
+
+static char *iothub_hostname = NULL;
+static char *miniSolutionName = NULL;
+const uint8_t* deviceConnectionString = NULL;
+const char *esp32Version = "0.1.0";
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Utilities
+static void ConnectionLost()
+{
+    if (!reconnecting)
+    {
+        reconnecting = true;
+        disconnected_ms = millis();
+        reconnect_attempt_ms = disconnected_ms;
+    }
+}
+
+// Start over with a new client, which parses the connection string again and blocks until connected
+static void RebuildClient()
+{
+    LogInfo(">>>Re-connect with a new client.");
+    unsigned long lost_ms = disconnected_ms;
+    Esp32MQTTClient_Close();
+    reconnecting = true;
+    rebuilding = true;
+    disconnected_ms = lost_ms;
+    Esp32MQTTClient_Init(deviceConnectionString, enableDeviceTwin);
+    reconnect_attempt_ms = millis();
+}
+
+static void CheckConnection()
+{
+    if (resetClient)
+    {
+        // The connection stopped answering: drop it and have the transport connect again, keeping the
+        // client, its TLS transport and the MQTT session
+        LogInfo(">>>Re-connect.");
+        resetClient = false;
+        ConnectionLost();
+        bool reconnect = true;
+        IoTHubClient_LL_SetOption(iotHubClientHandle, "reconnect", &reconnect);
+    }
+    if (reconnecting && (int)(millis() - reconnect_attempt_ms) >= RECONNECT_TIMEOUT_MS)
+    {
+        RebuildClient();
+    }
+}
+
+static void Reconnected()
+{
+    unsigned long took = millis() - disconnected_ms;
+    reconnecting = false;
+    reconnectStats.count++;
+    if (rebuilding)
+    {
+        reconnectStats.fullResets++;
+        rebuilding = false;
+    }
+    reconnectStats.lastMs = took;
+    if (took > reconnectStats.maxMs)
+    {
+        reconnectStats.maxMs = took;
+    }
+    LogInfo(">>>Re-connected in %lu ms", took);
+
+    // The transport publishes what was in flight again, give it the full time for the confirmation
+    unsigned long now = millis();
+    for (int i = 0; i < SEND_WINDOW_MAX; i++)
+    {
+        if (inFlight[i] != NULL)
+        {
+            inFlight[i]->sentMs = now;
+        }
+    }
+}
+
+static char *GetHostNameFromConnectionString(char *connectionString)
+{
+    if (connectionString == NULL)
+    {
+        return NULL;
+    }
+    int start = 0;
+    int cur = 0;
+    bool find = false;
+    while (connectionString[cur] > 0)
+    {
+        if (connectionString[cur] == '=')
+        {
+            // Check the key
+            if (memcmp(&connectionString[start], "HostName", 8) == 0)
+            {
+                // This is the host name
+                find = true;
+            }
+            start = ++cur;
+            // Value
+            while (connectionString[cur] > 0)
+            {
+                if (connectionString[cur] == ';')
+                {
+                    break;
+                }
+                cur++;
+            }
+            if (find && cur - start > 0)
+            {
+                char *hostname = (char *)malloc(cur - start + 1);
+                memcpy(hostname, &connectionString[start], cur - start);
+                hostname[cur - start] = 0;
+                return hostname;
+            }
+            start = cur + 1;
+        }
+        cur++;
+    }
+    return NULL;
+}
+
+static void FreeEventInstance(EVENT_INSTANCE *event)
+{
+    if (event != NULL)    
+    {
+        if (event->type == MESSAGE)
+        {
+            IoTHubMessage_Destroy(event->messageHandle);
+        }
+        free(event);
+    }
+}
+
+static bool AddInFlight(EVENT_INSTANCE *event)
+{
+    for (int i = 0; i < SEND_WINDOW_MAX; i++)
+    {
+        if (inFlight[i] == NULL)
+        {
+            inFlight[i] = event;
+            eventsInFlight++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool RemoveInFlight(EVENT_INSTANCE *event)
+{
+    for (int i = 0; i < SEND_WINDOW_MAX; i++)
+    {
+        if (inFlight[i] == event)
+        {
+            inFlight[i] = NULL;
+            eventsInFlight--;
+            return true;
+        }
+    }
+    return false;
+}
+
+// An event that waits longer than EVENT_TIMEOUT_MS means the connection is gone
+static void CheckInFlightTimeout()
+{
+    if (reconnecting)
+    {
+        return;
+    }
+    unsigned long now = millis();
+    for (int i = 0; i < SEND_WINDOW_MAX; i++)
+    {
+        if (inFlight[i] != NULL && (int)(now - inFlight[i]->sentMs) >= EVENT_TIMEOUT_MS)
+        {
+            LogError("Waiting for send confirmation of tracking id %d, time is up", inFlight[i]->trackingId);
+            resetClient = true;
+            return;
+        }
+    }
+}
+
+static EVENT_INSTANCE *NewEventInstance(EVENT_TYPE type)
+{
+    EVENT_INSTANCE *event = (EVENT_INSTANCE *)malloc(sizeof(EVENT_INSTANCE));
+    if (event != NULL)
+    {
+        event->type = type;
+        event->messageHandle = NULL;
+        event->stateString = NULL;
+        event->trackingId = -1;
+        event->completionCallback = NULL;
+        event->completionContext = NULL;
+        event->sentMs = 0;
+    }
+    return event;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Event handlers
+static void ConnectionStatusCallback(IOTHUB_CLIENT_CONNECTION_STATUS result, IOTHUB_CLIENT_CONNECTION_STATUS_REASON reason, void *userContextCallback)
+{
+    clientConnected = false;
+
+    switch (reason)
+    {
+    case IOTHUB_CLIENT_CONNECTION_EXPIRED_SAS_TOKEN:
+        if (result == IOTHUB_CLIENT_CONNECTION_UNAUTHENTICATED)
+        {
+            ConnectionLost();
+            LogInfo(">>>Connection status: timeout");
+        }
+        break;
+    case IOTHUB_CLIENT_CONNECTION_DEVICE_DISABLED:
+        break;
+    case IOTHUB_CLIENT_CONNECTION_BAD_CREDENTIAL:
+        break;
+    case IOTHUB_CLIENT_CONNECTION_RETRY_EXPIRED:
+        break;
+    case IOTHUB_CLIENT_CONNECTION_NO_NETWORK:
+        if (result == IOTHUB_CLIENT_CONNECTION_UNAUTHENTICATED)
+        {
+            ConnectionLost();
+            LogInfo(">>>Connection status: disconnected");
+        }
+        break;
+    case IOTHUB_CLIENT_CONNECTION_COMMUNICATION_ERROR:
+        ConnectionLost();
+        break;
+    case IOTHUB_CLIENT_CONNECTION_OK:
+        if (result == IOTHUB_CLIENT_CONNECTION_AUTHENTICATED)
+        {
+            clientConnected = true;
+            LogInfo(">>>Connection status: connected");
+            if (reconnecting)
+            {
+                Reconnected();
+            }
+        }
+        break;
+    }
+
+    if (_connection_status_callback)
+    {
+        _connection_status_callback(result, reason);
+    }
+}
+
+static void SendConfirmationCallback(IOTHUB_CLIENT_CONFIRMATION_RESULT result, void *userContextCallback)
+{
+    EVENT_INSTANCE *event = (EVENT_INSTANCE *)userContextCallback;
+    LogInfo(">>>Confirmation[%d] received for message tracking id = %d with result = %s", callbackCounter++, event->trackingId, ENUM_TO_STRING(IOTHUB_CLIENT_CONFIRMATION_RESULT, result));
+
+    if (RemoveInFlight(event) && event->completionCallback != NULL)
+    {
+        event->completionCallback(event->trackingId, result, event->completionContext);
+    }
+
+    if (currentTrackingId == event->trackingId)
+    {
+        if (result == IOTHUB_CLIENT_CONFIRMATION_OK)
+        {
+            currentTrackingId = EVENT_CONFIRMED;
+        }
+        else
+        {
+            currentTrackingId = EVENT_FAILED;
+        }
+    }
+
+    // Free the message
+    FreeEventInstance(event);
+
+    if (_send_confirmation_callback)
+    {
+        _send_confirmation_callback(result);
+    }
+}
+
+static IOTHUBMESSAGE_DISPOSITION_RESULT ReceiveMessageCallback(IOTHUB_MESSAGE_HANDLE message, void *userContextCallback)
+{
+    int *counter = (int *)userContextCallback;
+    const char *buffer;
+    size_t size;
+
+    // Message content
+    if (IoTHubMessage_GetByteArray(message, (const unsigned char **)&buffer, &size) != IOTHUB_MESSAGE_OK)
+    {
+        LogError("unable to retrieve the message data");
+        return IOTHUBMESSAGE_REJECTED;
+    }
+    else
+    {
+        char *temp = (char *)malloc(size + 1);
+        if (temp == NULL)
+        {
+            LogError("Failed to malloc for command");
+            return IOTHUBMESSAGE_REJECTED;
+        }
+        memcpy(temp, buffer, size);
+        temp[size] = '\0';
+        LogInfo(">>>Received Message [%d], Size=%d Message %s", *counter, (int)size, temp);
+        if (_message_callback)
+        {
+            _message_callback(temp, size);
+        }
+        free(temp);
+    }
+
+    /* Some device specific action code goes here... */
+    (*counter)++;
+    return IOTHUBMESSAGE_ACCEPTED;
+}
+
+static void DeviceTwinCallback(DEVICE_TWIN_UPDATE_STATE updateState, const unsigned char *payLoad, size_t size, void *userContextCallback)
+{
+    if (_device_twin_callback)
+    {
+        _device_twin_callback(updateState, payLoad, size);
+    }
+}
+
+static int DeviceMethodCallback(const char *methodName, const unsigned char *payload, size_t size, unsigned char **response, size_t *response_size, void *userContextCallback)
+{
+    if (_device_method_callback)
+    {
+        return _device_method_callback(methodName, payload, size, response, (int *)response_size);
+    }
+
+    const char *responseMessage = "\"No method found\"";
+    *response_size = strlen(responseMessage);
+    *response = (unsigned char *)malloc(*response_size + 1);
+    if (*response != NULL)
+    {
+        memcpy(*response, responseMessage, *response_size + 1);
+    }
+
+    return 404;
+}
+
+static void ReportConfirmationCallback(int statusCode, void *userContextCallback)
+{
+    EVENT_INSTANCE *event = (EVENT_INSTANCE *)userContextCallback;
+    LogInfo(">>>Confirmation[%d] received for state tracking id = %d with state code = %d", callbackCounter++, event->trackingId, statusCode);
+
+    if (statusCode == 204)
+    {
+        if (currentTrackingId == event->trackingId)
+        {
+            currentTrackingId = EVENT_CONFIRMED;
+        }
+    }
+    else
+    {
+        LogError("Report confirmation failed with state code %d", statusCode);
+    }
+
+    // Free the state
+    FreeEventInstance(event);
+
+    if (_report_confirmation_callback)
+    {
+        _report_confirmation_callback(statusCode);
+    }
+}
+
+// A state reported with Esp32MQTTClient_ReportStateAsync, which has no event to free
+static void ReportAsyncConfirmationCallback(int statusCode, void *userContextCallback)
+{
+    (void)userContextCallback;
+    if (statusCode != 204)
+    {
+        LogError("Report confirmation failed with state code %d", statusCode);
+    }
+
+    if (_report_confirmation_callback)
+    {
+        _report_confirmation_callback(statusCode);
+    }
+}
+
+static bool SendEventOnce(EVENT_INSTANCE *event)
+{
+    if (event == NULL)
+    {
+        return false;
+    }
+
+    if (iotHubClientHandle == NULL)
+    {
+        FreeEventInstance(event);
+        return false;
+    }
+
+    event->trackingId = trackingId++;
+    currentTrackingId = event->trackingId;
+
+    uint64_t start_ms = millis();
+
+    CheckConnection();
+    
+    if (event->type == MESSAGE)
+    {
+        if (IoTHubClient_LL_SendEventAsync(iotHubClientHandle, event->messageHandle, SendConfirmationCallback, event) != IOTHUB_CLIENT_OK)
+        {
+            LogError("IoTHubClient_LL_SendEventAsync..........FAILED!");
+            FreeEventInstance(event);
+            return false;
+        }
+        LogInfo(">>>IoTHubClient_LL_SendEventAsync accepted message for transmission to IoT Hub.");
+    }
+    else if (event->type == STATE)
+    {
+        if (IoTHubClient_LL_SendReportedState(iotHubClientHandle, (const unsigned char *)event->stateString, strlen(event->stateString), ReportConfirmationCallback, event) != IOTHUB_CLIENT_OK)
+        {
+            LogError("IoTHubClient_LL_SendReportedState..........FAILED!");
+            FreeEventInstance(event);
+            return false;
+        }
+        LogInfo(">>>IoTHubClient_LL_SendReportedState accepted state for transmission to IoT Hub.");
+    }
+
+    while (true)
+    {
+        IoTHubClient_LL_DoWork(iotHubClientHandle);
+
+        if (currentTrackingId == EVENT_CONFIRMED)
+        {
+            // IoT Hub got this event
+            return true;
+        }
+
+        // Check timeout
+        int diff = (int)(millis() - start_ms);
+        if (diff >= EVENT_TIMEOUT_MS)
+        {
+            // Time out, reset the client
+            LogError("Waiting for send confirmation, time is up %d", diff);
+            resetClient = true;
+        }
+
+        if (resetClient)
+        {
+            // resetClient also can be set as true in the IoTHubClient_LL_DoWork
+            // Disconnected, re-send the message
+            break;
+        }
+        else
+        {
+            // Sleep a while
+            ThreadAPI_Sleep(100);
+        }
+    }
+
+    return false;
+}
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MQTT APIs
+EVENT_INSTANCE *Esp32MQTTClient_Event_Generate(const char *eventString, EVENT_TYPE type)
+{
+    if (eventString == NULL)
+    {
+        return NULL;
+    }
+
+    EVENT_INSTANCE *event = NewEventInstance(type);
+    if (event == NULL)
+    {
+        return NULL;
+    }
+
+    if (type == MESSAGE)
+    {
+        event->messageHandle = IoTHubMessage_CreateFromByteArray((const unsigned char *)eventString, strlen(eventString));
+        if (event->messageHandle == NULL)
+        {
+            LogError("iotHubMessageHandle is NULL!");
+            free(event);
+            return NULL;
+        }
+    }
+    else if (type == STATE)
+    {
+        event->stateString = eventString;
+    }
+
+    return event;
+}
+
+EVENT_INSTANCE *Esp32MQTTClient_Event_GenerateBinary(const uint8_t *data, size_t length, const char *contentType)
+{
+    if (data == NULL)
+    {
+        return NULL;
+    }
+
+    EVENT_INSTANCE *event = NewEventInstance(MESSAGE);
+    if (event == NULL)
+    {
+        return NULL;
+    }
+    event->messageHandle = IoTHubMessage_CreateFromByteArray(data, length);
+    if (event->messageHandle == NULL)
+    {
+        LogError("iotHubMessageHandle is NULL!");
+        free(event);
+        return NULL;
+    }
+    if (contentType != NULL && IoTHubMessage_SetContentTypeSystemProperty(event->messageHandle, contentType) != IOTHUB_MESSAGE_OK)
+    {
+        LogError("Failed to set the content type!");
+        IoTHubMessage_Destroy(event->messageHandle);
+        free(event);
+        return NULL;
+    }
+
+    return event;
+}
+
+void Esp32MQTTClient_Event_AddProp(EVENT_INSTANCE *message, const char *key, const char *value)
+{
+    if (message == NULL || key == NULL)
+        return;
+    MAP_HANDLE propMap = IoTHubMessage_Properties(message->messageHandle);
+    Map_AddOrUpdate(propMap, key, value);
+}
+
+bool Esp32MQTTClient_Init(const uint8_t* deviceConnString, bool hasDeviceTwin, bool traceOn)
+{
+    if (iotHubClientHandle != NULL)
+    {
+        return true;
+    }
+    enableDeviceTwin = hasDeviceTwin;
+    callbackCounter = 0;
+    deviceConnectionString = deviceConnString;
+
+    srand((unsigned int)time(NULL));
+    trackingId = 0;
+
+    // Create the IoTHub client
+    if (platform_init() != 0)
+    {
+        LogError("Failed to initialize the platform.");
+        return false;
+    }
+
+    iothub_hostname = GetHostNameFromConnectionString((char *)deviceConnectionString);
+
+    // Create the IoTHub client
+    if ((iotHubClientHandle = IoTHubClient_LL_CreateFromConnectionString((char *)deviceConnectionString, MQTT_Protocol)) == NULL)
+    {
+        return false;
+    }
+
+    IoTHubClient_LL_SetOption(iotHubClientHandle, "keepalive", &keepAliveInterval);
+    IoTHubClient_LL_SetOption(iotHubClientHandle, "logtrace", &traceOn);
+
+    char *product_info = NULL;
+    if (miniSolutionName == NULL)
+    {
+        int len = snprintf(NULL, 0, "IoT_Esp32_%s", esp32Version);
+        product_info = (char *)malloc(len + 1);
+        snprintf(product_info, len + 1, "IoT_Esp32_%s", esp32Version);
+    }
+    else
+    {
+        int len = snprintf(NULL, 0, "IoT_Esp32_%s_%s", esp32Version, miniSolutionName);
+        product_info = (char *)malloc(len + 1);
+        snprintf(product_info, len + 1, "IoT_Esp32_%s_%s", esp32Version, miniSolutionName);
+    }
+    if (IoTHubClient_LL_SetOption(iotHubClientHandle, "product_info", product_info) != IOTHUB_CLIENT_OK)
+    {
+        LogError("Failed to set option \"product_info\"");
+        free(product_info);
+        return false;
+    }
+    else
+    {
+        free(product_info);
+    }
+
+    // Setting Message call back, so we can receive commands.
+    if (IoTHubClient_LL_SetMessageCallback(iotHubClientHandle, ReceiveMessageCallback, &receiveContext) != IOTHUB_CLIENT_OK)
+    {
+        LogError("IoTHubClient_LL_SetMessageCallback..........FAILED!");
+        return false;
+    }
+
+    if (IoTHubClient_LL_SetConnectionStatusCallback(iotHubClientHandle, ConnectionStatusCallback, &statusContext) != IOTHUB_CLIENT_OK)
+    {
+        LogError("IoTHubClient_LL_SetConnectionStatusCallback..........FAILED!");
+        return false;
+    }
+
+    if (enableDeviceTwin)
+    {
+        if (IoTHubClient_LL_SetDeviceTwinCallback(iotHubClientHandle, DeviceTwinCallback, NULL) != IOTHUB_CLIENT_OK)
+        {
+            LogError("Failed on IoTHubClient_LL_SetDeviceTwinCallback");
+            return false;
+        }
+
+        if (IoTHubClient_LL_SetDeviceMethodCallback(iotHubClientHandle, DeviceMethodCallback, NULL) != IOTHUB_CLIENT_OK)
+        {
+            LogError("Failed on IoTHubClient_LL_SetDeviceMethodCallback");
+            return false;
+        }
+    }
+
+    iothub_check_ms = millis();
+
+    // Waiting for the confirmation
+    unsigned long start_ms = millis();
+    while (true)
+    {
+        IoTHubClient_LL_DoWork(iotHubClientHandle);
+        if (clientConnected)
+        {
+            break;
+        }
+        int diff = (int)(millis() - start_ms);
+        if (diff >= CONNECT_TIMEOUT_MS)
+        {
+            // Time out, reset the client
+            resetClient = true;
+            return false;
+        }
+        ThreadAPI_Sleep(500);
+    }
+
+    return true;
+}
+
+// Options kept by this client rather than the IoT Hub client, which can be set before Init
+static bool IsClientOption(const char* optionName)
+{
+    return strcmp(optionName, OPTION_MINI_SOLUTION_NAME) == 0 || strcmp(optionName, OPTION_SEND_WINDOW) == 0
+        || strcmp(optionName, OPTION_KEEP_ALIVE_INTERVAL) == 0 || strncmp(optionName, "Batch", 5) == 0;
+}
+
+static bool SetBatchOption(const char* optionName, const void* value)
+{
+    // The layout of the batch depends on them, so the records in it go out first
+    if (!Esp32MQTTClient_BatchFlush())
+    {
+        LogError("Cannot change \"%s\" while the batch waits to be sent", optionName);
+        return false;
+    }
+
+    if (strcmp(optionName, OPTION_BATCH_MAX_RECORDS) == 0)
+    {
+        int records = *(const int *)value;
+        if (records < 1)
+        {
+            LogError("Batch must hold at least one record");
+            return false;
+        }
+        batchMaxRecords = records;
+    }
+    else if (strcmp(optionName, OPTION_BATCH_MAX_BYTES) == 0)
+    {
+        int bytes = *(const int *)value;
+        if (bytes < 16 || bytes > BATCH_MESSAGE_MAX)
+        {
+            LogError("Batch size must be between 16 and %d bytes", BATCH_MESSAGE_MAX);
+            return false;
+        }
+        batchMaxBytes = bytes;
+        free(batchBuffer);
+        batchBuffer = NULL;
+    }
+    else if (strcmp(optionName, OPTION_BATCH_MAX_AGE) == 0)
+    {
+        int ms = *(const int *)value;
+        if (ms < 0)
+        {
+            LogError("Batch age must not be negative");
+            return false;
+        }
+        batchMaxAge = ms;
+    }
+    else if (strcmp(optionName, OPTION_BATCH_FORMAT) == 0)
+    {
+        BATCH_FORMAT format = *(const BATCH_FORMAT *)value;
+        if (format != BATCH_JSON && format != BATCH_CBOR)
+        {
+            LogError("Unknown batch format");
+            return false;
+        }
+        batchFormat = format;
+    }
+    else if (strcmp(optionName, OPTION_BATCH_CONTENT_TYPE) == 0)
+    {
+        if (batchContentType != NULL)
+        {
+            free(batchContentType);
+        }
+        if (mallocAndStrcpy_s(&batchContentType, (const char *)value) != 0)
+        {
+            batchContentType = NULL;
+            LogError("Failed to copy the batch content type");
+            return false;
+        }
+    }
+    else
+    {
+        LogError("Unknown option \"%s\"", optionName);
+        return false;
+    }
+    return true;
+}
+
+bool Esp32MQTTClient_SetOption(const char* optionName, const void* value)
+{
+    if (optionName == NULL || value == NULL || (iotHubClientHandle == NULL && !IsClientOption(optionName)))
+    {
+        return false;
+    }
+
+    if (strcmp(optionName, OPTION_SEND_WINDOW) == 0)
+    {
+        int window = *(const int *)value;
+        if (window < 1 || window > SEND_WINDOW_MAX)
+        {
+            LogError("Send window must be between 1 and %d", SEND_WINDOW_MAX);
+            return false;
+        }
+        sendWindow = window;
+        return true;
+    }
+    else if (strcmp(optionName, OPTION_KEEP_ALIVE_INTERVAL) == 0)
+    {
+        int seconds = *(const int *)value;
+        if (seconds < 30 || seconds > 1177)
+        {
+            // IoT Hub closes connections quiet for longer than 1177 seconds
+            LogError("Keep alive interval must be between 30 and 1177 seconds");
+            return false;
+        }
+        keepAliveInterval = seconds;
+        // a connected client reconnects to apply it
+        return iotHubClientHandle == NULL || IoTHubClient_LL_SetOption(iotHubClientHandle, "keepalive", &keepAliveInterval) == IOTHUB_CLIENT_OK;
+    }
+    else if (strcmp(optionName, OPTION_MINI_SOLUTION_NAME) == 0)
+    {
+        if (miniSolutionName != NULL)
+        {
+            free(miniSolutionName);
+        }
+        if (mallocAndStrcpy_s(&miniSolutionName, (const char *)value) != 0)
+        {
+            miniSolutionName = NULL;
+            LogError("Failed to copy the mini solution name");
+            return false;
+        }
+        return true;
+    }
+    else if (strncmp(optionName, "Batch", 5) == 0)
+    {
+        return SetBatchOption(optionName, value);
+    }
+    else if (IoTHubClient_LL_SetOption(iotHubClientHandle, optionName, value) != IOTHUB_CLIENT_OK)
+    {
+        LogError("Failed to set option \"%s\"", optionName);
+        return false;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+bool Esp32MQTTClient_SendEvent(const char *text)
+{
+    if (text == NULL)
+    {
+        return false;
+    }
+    for (int i = 0; i < SEND_EVENT_RETRY_COUNT; i++)
+    {
+        if (SendEventOnce(Esp32MQTTClient_Event_Generate(text, MESSAGE)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Esp32MQTTClient_ReceiveEvent()
+{
+    CheckConnection();
+
+    int count = receiveContext;
+    unsigned long tm = millis();
+    while ((int)(millis() - tm) < CHECK_INTERVAL_MS)
+    {
+        IoTHubClient_LL_DoWork(iotHubClientHandle);
+        if (count < receiveContext)
+        {
+            return true;
+        }
+
+        if (resetClient)
+        {
+            // Disconnected
+            return false;
+        }
+
+        ThreadAPI_Sleep(500);
+    }
+    // Timeout
+    resetClient = true;
+    return false;
+}
+
+bool Esp32MQTTClient_ReportState(const char *stateString)
+{
+    if (stateString == NULL)
+    {
+        return false;
+    }
+    for (int i = 0; i < SEND_EVENT_RETRY_COUNT; i++)
+    {
+        if (SendEventOnce(Esp32MQTTClient_Event_Generate(stateString, STATE)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Esp32MQTTClient_ReportStateAsync(const char *stateString)
+{
+    if (stateString == NULL || iotHubClientHandle == NULL || reconnecting)
+    {
+        return false;
+    }
+
+    // The client copies the state, IoTHubClient_LL_DoWork in Esp32MQTTClient_Check sends it and collects the confirmation
+    if (IoTHubClient_LL_SendReportedState(iotHubClientHandle, (const unsigned char *)stateString, strlen(stateString), ReportAsyncConfirmationCallback, NULL) != IOTHUB_CLIENT_OK)
+    {
+        LogError("IoTHubClient_LL_SendReportedState..........FAILED!");
+        return false;
+    }
+    return true;
+}
+
+bool Esp32MQTTClient_SendEventInstance(EVENT_INSTANCE *event)
+{
+    if (event == NULL)
+    {
+        return false;
+    }
+
+    return SendEventOnce(event);
+}
+
+int Esp32MQTTClient_SendEventAsync(EVENT_INSTANCE *event, EVENT_COMPLETION_CALLBACK callback, void *context)
+{
+    if (event == NULL)
+    {
+        return -1;
+    }
+
+    if (iotHubClientHandle == NULL || event->type != MESSAGE || eventsInFlight >= sendWindow)
+    {
+        FreeEventInstance(event);
+        return -1;
+    }
+
+    CheckConnection();
+
+    event->trackingId = trackingId++;
+    event->completionCallback = callback;
+    event->completionContext = context;
+    event->sentMs = millis();
+    AddInFlight(event);
+    if (IoTHubClient_LL_SendEventAsync(iotHubClientHandle, event->messageHandle, SendConfirmationCallback, event) != IOTHUB_CLIENT_OK)
+    {
+        LogError("IoTHubClient_LL_SendEventAsync..........FAILED!");
+        RemoveInFlight(event);
+        FreeEventInstance(event);
+        return -1;
+    }
+
+    // Start publishing right away instead of waiting for the next check
+    IoTHubClient_LL_DoWork(iotHubClientHandle);
+    return event->trackingId;
+}
+
+int Esp32MQTTClient_EventsInFlight(void)
+{
+    return eventsInFlight;
+}
+
+bool Esp32MQTTClient_Drain(int timeoutMs)
+{
+    unsigned long start_ms = millis();
+    while (eventsInFlight > 0 && iotHubClientHandle != NULL)
+    {
+        Esp32MQTTClient_Check(false);
+        if ((int)(millis() - start_ms) >= timeoutMs)
+        {
+            return false;
+        }
+        ThreadAPI_Sleep(10);
+    }
+    return eventsInFlight == 0;
+}
+
+static bool BatchDue()
+{
+    return batchRecords > 0
+        && (batchUrgent || batchRecords >= batchMaxRecords || (int)(millis() - batch_start_ms) >= batchMaxAge);
+}
+
+static int SendBatchMessage(const uint8_t *data, size_t length, int records)
+{
+    const char *contentType = batchContentType != NULL ? batchContentType
+                            : batchFormat == BATCH_JSON ? "application/json" : "application/cbor";
+    EVENT_INSTANCE *event = Esp32MQTTClient_Event_GenerateBinary(data, length, contentType);
+    if (event == NULL)
+    {
+        return -1;
+    }
+    if (batchFormat == BATCH_JSON)
+    {
+        IoTHubMessage_SetContentEncodingSystemProperty(event->messageHandle, "utf-8");
+    }
+    if (records > 1)
+    {
+        char count[12];
+        snprintf(count, sizeof(count), "%d", records);
+        Esp32MQTTClient_Event_AddProp(event, "batch", count);
+    }
+    return Esp32MQTTClient_SendEventAsync(event, NULL, NULL);
+}
+
+bool Esp32MQTTClient_BatchFlush(void)
+{
+    if (batchRecords == 0)
+    {
+        return true;
+    }
+    if (iotHubClientHandle == NULL || eventsInFlight >= sendWindow)
+    {
+        // Kept until Esp32MQTTClient_Check finds room for it
+        return false;
+    }
+
+    // JSON records are each followed by a comma, the last one becomes the end of the array
+    bool json = batchFormat == BATCH_JSON;
+    int sent;
+    if (batchRecords == 1)
+    {
+        sent = SendBatchMessage(&batchBuffer[1], json ? batchUsed - 2 : batchUsed - 1, 1);
+    }
+    else if (json)
+    {
+        batchBuffer[0] = '[';
+        batchBuffer[batchUsed - 1] = ']';
+        sent = SendBatchMessage(batchBuffer, batchUsed, batchRecords);
+        batchBuffer[batchUsed - 1] = ',';
+    }
+    else
+    {
+        batchBuffer[0] = 0x9F;
+        batchBuffer[batchUsed] = 0xFF;
+        sent = SendBatchMessage(batchBuffer, batchUsed + 1, batchRecords);
+    }
+    if (sent < 0)
+    {
+        LogError("Failed to send a batch of %d records", batchRecords);
+        return false;
+    }
+
+    batchUsed = 1;
+    batchRecords = 0;
+    batchUrgent = false;
+    return true;
+}
+
+bool Esp32MQTTClient_BatchAdd(const uint8_t *record, size_t length, bool urgent)
+{
+    if (record == NULL || length == 0 || iotHubClientHandle == NULL)
+    {
+        return false;
+    }
+
+    if (batchMaxRecords == 1 || length + 2 >= (size_t)batchMaxBytes)
+    {
+        // Goes out on its own, behind the records batched before it
+        if (length > BATCH_MESSAGE_MAX || !Esp32MQTTClient_BatchFlush())
+        {
+            return false;
+        }
+        return SendBatchMessage(record, length, 1) >= 0;
+    }
+
+    // Room for the record and what follows it, the comma or the end of the CBOR array
+    if (batchUsed + length + 1 > (size_t)batchMaxBytes && !Esp32MQTTClient_BatchFlush())
+    {
+        LogError("Batch is full, record dropped");
+        return false;
+    }
+    if (batchBuffer == NULL)
+    {
+        batchBuffer = (uint8_t *)malloc(batchMaxBytes);
+        if (batchBuffer == NULL)
+        {
+            LogError("Failed to allocate the batch");
+            return false;
+        }
+    }
+
+    if (batchRecords == 0)
+    {
+        batch_start_ms = millis();
+    }
+    memcpy(&batchBuffer[batchUsed], record, length);
+    batchUsed += length;
+    if (batchFormat == BATCH_JSON)
+    {
+        batchBuffer[batchUsed++] = ',';
+    }
+    batchRecords++;
+    batchUrgent = batchUrgent || urgent;
+    if (BatchDue())
+    {
+        Esp32MQTTClient_BatchFlush();
+    }
+    return true;
+}
+
+void Esp32MQTTClient_Check(bool hasDelay)
+{
+    if (iotHubClientHandle == NULL)
+    {
+        return;
+    }
+
+    if (BatchDue())
+    {
+        Esp32MQTTClient_BatchFlush();
+    }
+
+    // Idle, the client still has to run by its next deadline (a reconnect attempt, a message timing out)
+    int interval = CHECK_INTERVAL_MS;
+    tickcounter_ms_t deadline;
+    if (IoTHubClient_LL_GetNextDeadline(iotHubClientHandle, &deadline) == IOTHUB_CLIENT_OK && deadline < (tickcounter_ms_t)interval)
+    {
+        interval = (int)deadline;
+    }
+    int diff = hasDelay && eventsInFlight == 0 ? ((int)(millis() - iothub_check_ms)) : interval;
+    if (diff >= interval)
+    {
+        CheckInFlightTimeout();
+        CheckConnection();
+        for (int i = 0; i < 5; i++)
+        {
+            IoTHubClient_LL_DoWork(iotHubClientHandle);
+            if (resetClient)
+            {
+                // Disconnected
+                break;
+            }
+        }
+        iothub_check_ms = millis();
+    }
+}
+
+void Esp32MQTTClient_Close(void)
+{
+    reconnecting = false;
+    rebuilding = false;
+    if (iotHubClientHandle != NULL)
+    {
+        // Destroying the client completes every event in flight with IOTHUB_CLIENT_CONFIRMATION_BECAUSE_DESTROY
+        IoTHubClient_LL_Destroy(iotHubClientHandle);
+        iotHubClientHandle = NULL;
+    }
+    // Init parses it again from the connection string
+    free(iothub_hostname);
+    iothub_hostname = NULL;
+
+    platform_deinit();
+}
+
+void Esp32MQTTClient_SetConnectionStatusCallback(CONNECTION_STATUS_CALLBACK connection_status_callback)
+{
+    _connection_status_callback = connection_status_callback;
+}
+
+void Esp32MQTTClient_SetSendConfirmationCallback(SEND_CONFIRMATION_CALLBACK send_confirmation_callback)
+{
+    _send_confirmation_callback = send_confirmation_callback;
+}
+
+void Esp32MQTTClient_SetMessageCallback(MESSAGE_CALLBACK message_callback)
+{
+    _message_callback = message_callback;
+}
+
+void Esp32MQTTClient_SetDeviceTwinCallback(DEVICE_TWIN_CALLBACK device_twin_callback)
+{
+    _device_twin_callback = device_twin_callback;
+}
+
+void Esp32MQTTClient_SetDeviceMethodCallback(DEVICE_METHOD_CALLBACK device_method_callback)
+{
+    _device_method_callback = device_method_callback;
+}
+
+void Esp32MQTTClient_SetReportConfirmationCallback(REPORT_CONFIRMATION_CALLBACK report_confirmation_callback)
+{
+    _report_confirmation_callback = report_confirmation_callback;
+}
+
+void Esp32MQTTClient_Reset(void)
+{
+    resetClient = false;
+    ConnectionLost();
+    RebuildClient();
+}
+
+bool Esp32MQTTClient_GetKeepAliveStats(MQTT_CLIENT_KEEPALIVE_STATS *stats)
+{
+    return iotHubClientHandle != NULL && stats != NULL
+        && IoTHubClient_LL_SetOption(iotHubClientHandle, "keepalive_stats", stats) == IOTHUB_CLIENT_OK;
+}
+
+void Esp32MQTTClient_GetReconnectStats(RECONNECT_STATS *stats)
+{
+    if (stats != NULL)
+    {
+        *stats = reconnectStats;
+    }
+}
+
+bool Esp32MQTTClient_IsReconnecting(void)
+{
+    return reconnecting;
+}
@@ -0,0 +1,288 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. 
+
+#ifndef __IOTHUB_MQTT_CLIENT_H__
+#define __IOTHUB_MQTT_CLIENT_H__
+
+#include <stdlib.h>
+#include "AzureIotHub.h"
+#include "az_iot/umqtt/inc/azure_umqtt_c/mqtt_client.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define OPTION_MINI_SOLUTION_NAME "MiniSolution"
+#define OPTION_SEND_WINDOW "SendWindow"
+#define OPTION_KEEP_ALIVE_INTERVAL "KeepAliveInterval"
+#define OPTION_BATCH_MAX_RECORDS "BatchMaxRecords"
+#define OPTION_BATCH_MAX_BYTES "BatchMaxBytes"
+#define OPTION_BATCH_MAX_AGE "BatchMaxAge"
+#define OPTION_BATCH_FORMAT "BatchFormat"
+#define OPTION_BATCH_CONTENT_TYPE "BatchContentType"
+#define SEND_WINDOW_MAX 16
+#define BATCH_MESSAGE_MAX (256 * 1024 - 1024)   // IoT Hub takes messages up to 256 KB, properties included
+
+enum EVENT_TYPE
+{
+    MESSAGE, STATE
+};
+
+enum BATCH_FORMAT
+{
+    BATCH_JSON,     // [record,record,...]
+    BATCH_CBOR      // an indefinite length CBOR array of the records
+};
+
+typedef void (*EVENT_COMPLETION_CALLBACK)(int trackingId, IOTHUB_CLIENT_CONFIRMATION_RESULT result, void* context);
+
+typedef struct EVENT_INSTANCE_TAG
+{
+    EVENT_TYPE type;
+    IOTHUB_MESSAGE_HANDLE messageHandle;
+    const char* stateString;
+    int trackingId; // For tracking the events within the user callback.
+    EVENT_COMPLETION_CALLBACK completionCallback;
+    void* completionContext;
+    unsigned long sentMs;
+} EVENT_INSTANCE;
+
+typedef struct RECONNECT_STATS_TAG
+{
+    int count;                  // connections lost and made again since the first Init
+    int fullResets;             // of those, the ones that needed a new client
+    unsigned long lastMs;       // from losing the connection to IoT Hub accepting the new one
+    unsigned long maxMs;
+} RECONNECT_STATS;
+
+/**
+* @brief    Generate an event with the event string specified by @p eventString.
+*
+* @param    eventString             The string of event.
+*
+* @return   EVENT_INSTANCE upon success or an error code upon failure.
+*/
+EVENT_INSTANCE* Esp32MQTTClient_Event_Generate(const char *eventString, EVENT_TYPE type);
+
+/**
+* @brief    Generate a message event from a binary payload, such as CBOR, which may contain zero bytes.
+*
+* @param    data                    The payload, copied into the message.
+* @param    length                  The size of the payload in bytes.
+* @param    contentType             The content type system property, or NULL to leave it unset.
+*
+* @return   EVENT_INSTANCE upon success or NULL upon failure.
+*/
+EVENT_INSTANCE* Esp32MQTTClient_Event_GenerateBinary(const uint8_t *data, size_t length, const char *contentType);
+
+/**
+* @brief    Add new property value for message.
+*
+* @param    message                 The message need to be modified.
+* @param    key                     The property name.
+* @param    value                   The property value.
+*/
+void Esp32MQTTClient_Event_AddProp(EVENT_INSTANCE *message, const char * key, const char * value);
+
+/**
+* @brief    Initialize a IoT Hub MQTT client for communication with an existing IoT hub.
+*           The connection string is load from the EEPROM.
+* @param    deviceConnString   Device connection string.
+* @param    hasDeviceTwin   Enable / disable device twin, default is disable.
+* @param    traceOn         Enable / disable IoT Hub trace, default is disable.
+*
+* @return   Return true if initialize successfully, or false if fails.
+*/
+bool Esp32MQTTClient_Init(const uint8_t* deviceConnString, bool hasDeviceTwin = false, bool traceOn = false);
+
+/**
+* @brief    This API sets a runtime option identified by parameter @p optionName
+*           to a value pointed to by @p value. @p optionName and the data type
+*           @p value is pointing to are specific for every option.
+*
+* @param    optionName              Name of the option.
+*
+* @param    value                   The value.
+*
+* @return   Return true if set option successfully, or false if fails.
+*/
+bool Esp32MQTTClient_SetOption(const char* optionName, const void* value);
+
+/**
+* @brief    Asynchronous call to send the message specified by @p text.
+*
+* @param    text                The text message.
+*
+* @return   Return true if send successfully, or false if fails.
+*/
+bool Esp32MQTTClient_SendEvent(const char *text);
+
+/**
+* @brief    Synchronous call to report the state specified by @p stateString.
+*
+* @param    stateString         The JSON string of reported state.
+*
+* @return   Return true if send successfully, or false if fails.
+*/
+bool Esp32MQTTClient_ReportState(const char *stateString);
+
+/**
+* @brief    Asynchronous call to report the state specified by @p stateString without waiting for IoT Hub.
+*           Esp32MQTTClient_Check collects the confirmation and passes it to the report confirmation
+*           callback. Nothing is reported while the client is reconnecting.
+*
+* @param    stateString         The JSON string of reported state, copied.
+*
+* @return   Return true if the client took the state, or false if it is reconnecting or the call fails.
+*/
+bool Esp32MQTTClient_ReportStateAsync(const char *stateString);
+
+/**
+* @brief    Synchronous call to report the event specified by @p event.
+*
+* @param    event               The event instance.
+*
+* @return   Return true if send successfully, or false if fails.
+*/
+bool Esp32MQTTClient_SendEventInstance(EVENT_INSTANCE *event);
+
+/**
+* @brief    Asynchronous call to send the event specified by @p event without waiting for IoT Hub.
+*           Up to the send window (option "SendWindow", 1 to SEND_WINDOW_MAX, default 4) events
+*           may be in flight at once; Esp32MQTTClient_Check moves them along.
+*
+* @param    event               The message event, owned by the client from now on.
+* @param    callback            Called once with the result when the event completes, may be NULL.
+* @param    context             Passed to @p callback.
+*
+* @return   The tracking id of the event, or -1 if the window is full or the send failed; the event
+*           is freed and @p callback is not called then.
+*/
+int Esp32MQTTClient_SendEventAsync(EVENT_INSTANCE *event, EVENT_COMPLETION_CALLBACK callback, void *context);
+
+/**
+* @brief    Number of events sent with Esp32MQTTClient_SendEventAsync that have not completed yet.
+*/
+int Esp32MQTTClient_EventsInFlight(void);
+
+/**
+* @brief    Synchronous call that waits until every event in flight has completed.
+*
+* @param    timeoutMs           The longest time to wait.
+*
+* @return   Return true if nothing is in flight any more, or false on timeout.
+*/
+bool Esp32MQTTClient_Drain(int timeoutMs);
+
+/**
+* @brief    Add a telemetry record to the batch, which goes out as one message when it holds
+*           "BatchMaxRecords" records, would grow past "BatchMaxBytes" or is "BatchMaxAge" ms old,
+*           or right away for an urgent record. A batch of one record is sent as the record itself,
+*           larger ones as a JSON array or CBOR array ("BatchFormat") with the property "batch"
+*           set to the number of records. With "BatchMaxRecords" 1, the default, every record
+*           is sent on its own.
+*
+* @param    record              The encoded record, a JSON object or a CBOR item; copied.
+* @param    length              The size of the record in bytes.
+* @param    urgent              Send the batch now, such as for a door that was opened.
+*
+* @return   Return false if the record was dropped: it is too big, the client is not initialized,
+*           or the batch is full and the send window too.
+*/
+bool Esp32MQTTClient_BatchAdd(const uint8_t *record, size_t length, bool urgent);
+
+/**
+* @brief    Send the records in the batch now, if the send window has room for them.
+*
+* @return   Return true if the batch is empty afterwards.
+*/
+bool Esp32MQTTClient_BatchFlush(void);
+
+/**
+* @brief    Retrieve a message from IoT hub
+*
+* @return   Return true if get a message successfully, or false if there is no message returns.
+*/
+bool Esp32MQTTClient_ReceiveEvent();
+
+/**
+* @brief    The function is called to try receiving message from IoT hub.
+*           While events are in flight it works on every call, ignoring the delay.
+*
+* @param    hasDelay        Indicate whether check with IoT hub immediately or has delay, default is delay check (true).
+*/
+void Esp32MQTTClient_Check(bool hasDelay = true);
+
+/**
+* @brief    Disposes of resources allocated by the IoT Hub client.
+*/
+void Esp32MQTTClient_Close(void);
+
+/**
+* @brief    Sets up connection status callback to be invoked representing the status of the connection to IOT Hub.
+*/
+void Esp32MQTTClient_SetConnectionStatusCallback(CONNECTION_STATUS_CALLBACK connection_status_callback);
+
+/**
+* @brief    Sets up send confirmation status callback to be invoked representing the status of sending message to IOT Hub.
+*/
+void Esp32MQTTClient_SetSendConfirmationCallback(SEND_CONFIRMATION_CALLBACK send_confirmation_callback);
+
+/**
+* @brief    Sets up the message callback to be invoked when IoT Hub issues a message to the device.
+*/
+void Esp32MQTTClient_SetMessageCallback(MESSAGE_CALLBACK message_callback);
+
+/**
+* @brief    Sets up the device twin callback to be invoked when IoT Hub update device twin of the device.
+*/
+void Esp32MQTTClient_SetDeviceTwinCallback(DEVICE_TWIN_CALLBACK device_twin_callback);
+
+/**
+* @brief    Sets up the device method callback to be invoked when IoT Hub call method on the device.
+*/
+void Esp32MQTTClient_SetDeviceMethodCallback(DEVICE_METHOD_CALLBACK device_method_callback);
+
+/**
+* @brief    Sets up the report confirmation callback to be invoked when report of the device's properties.
+*/
+void Esp32MQTTClient_SetReportConfirmationCallback(REPORT_CONFIRMATION_CALLBACK report_confirmation_callback);
+
+/**
+* @brief    Force reset the connection.
+*/
+void Esp32MQTTClient_Reset(void);
+
+/**
+* @brief    How often and how fast the client got its connection back. A lost connection is made again
+*           on the same client, TLS transport and MQTT session; only when that takes longer than
+*           the connect timeout the client is built anew.
+*
+* @param    stats               Filled in with the figures since the first Esp32MQTTClient_Init.
+*/
+void Esp32MQTTClient_GetReconnectStats(RECONNECT_STATS *stats);
+
+/**
+* @brief    Whether the connection is lost and the client is making it again.
+*/
+bool Esp32MQTTClient_IsReconnecting(void);
+
+/**
+* @brief    Round trip and keep alive figures of the MQTT connection. The link is pinged only when it has been
+*           quiet for the ping interval, which starts at the keep alive (OPTION_KEEP_ALIVE_INTERVAL, in seconds)
+*           and shrinks when a NAT on the way turns out to forget quiet connections sooner; a message IoT Hub does
+*           not acknowledge within the round trip plus four times its jitter gets the link probed right away.
+*
+* @param    stats               Filled in with the current figures.
+*
+* @return   Return false if the client is not initialized.
+*/
+bool Esp32MQTTClient_GetKeepAliveStats(MQTT_CLIENT_KEEPALIVE_STATS *stats);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IOTHUB_MQTT_CLIENT_H__ */
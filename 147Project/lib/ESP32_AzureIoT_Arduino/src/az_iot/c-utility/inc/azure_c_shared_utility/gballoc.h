@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef GBALLOC_H
+#define GBALLOC_H
+
+#ifdef __cplusplus
+#include <cstddef>
+extern "C"
+{
+#else
+#include <stddef.h>
+#endif
+
+#include "umock_c_prod.h"
+#include "gballoc_backend.h"
+#include "gballoc_profile.h"
+
+/* all translation units that need memory measurement need to have GB_MEASURE_MEMORY_FOR_THIS defined */
+/* GB_DEBUG_ALLOC is the switch that turns the measurement on/off, so that it is not on always */
+#if defined(GB_DEBUG_ALLOC)
+
+MOCKABLE_FUNCTION(, int, gballoc_init);
+MOCKABLE_FUNCTION(, void, gballoc_deinit);
+MOCKABLE_FUNCTION(, void*, gballoc_malloc, size_t, size);
+MOCKABLE_FUNCTION(, void*, gballoc_calloc, size_t, nmemb, size_t, size);
+MOCKABLE_FUNCTION(, void*, gballoc_realloc, void*, ptr, size_t, size);
+MOCKABLE_FUNCTION(, void, gballoc_free, void*, ptr);
+/* the same, telling gballoc where they are called from; GB_PROFILE_ALLOC makes malloc, calloc and realloc use them */
+MOCKABLE_FUNCTION(, void*, gballoc_malloc_at, size_t, size, const char*, file, int, line);
+MOCKABLE_FUNCTION(, void*, gballoc_calloc_at, size_t, nmemb, size_t, size, const char*, file, int, line);
+MOCKABLE_FUNCTION(, void*, gballoc_realloc_at, void*, ptr, size_t, size, const char*, file, int, line);
+/* switches what the functions above allocate from, NULL being the C heap; a backend that passes the calls on to the
+   heap sees every allocation the SDK makes, which is how the bench records them */
+MOCKABLE_FUNCTION(, int, gballoc_setBackend, const GBALLOC_BACKEND*, backend);
+/* the backend in use, the C heap's own when none was set */
+MOCKABLE_FUNCTION(, const GBALLOC_BACKEND*, gballoc_getBackend);
+
+MOCKABLE_FUNCTION(, size_t, gballoc_getMaximumMemoryUsed);
+MOCKABLE_FUNCTION(, size_t, gballoc_getCurrentMemoryUsed);
+MOCKABLE_FUNCTION(, size_t, gballoc_getAllocationCount);
+MOCKABLE_FUNCTION(, size_t, gballoc_getTotalMemoryAllocated);
+MOCKABLE_FUNCTION(, void, gballoc_resetMetrics);
+
+/* while profiling is on, every block allocated is attributed to its call site and subsystem until it is freed;
+   a realloc keeps the call site that first allocated the block */
+MOCKABLE_FUNCTION(, void, gballoc_setProfiling, int, enabled);
+MOCKABLE_FUNCTION(, int, gballoc_getSubsystemStatistics, GBALLOC_SUBSYSTEM, subsystem, GBALLOC_PROFILE_STATISTICS*, statistics);
+/* the call sites in the order they first allocated; non-zero past the last one */
+MOCKABLE_FUNCTION(, int, gballoc_getCallSiteStatistics, size_t, index, GBALLOC_PROFILE_STATISTICS*, statistics);
+
+/* if GB_MEASURE_MEMORY_FOR_THIS is defined then we want to redirect memory allocation functions to gballoc_xxx functions */
+#ifdef GB_MEASURE_MEMORY_FOR_THIS
+/* Unfortunately this is still needed here for things to still compile when using _CRTDBG_MAP_ALLOC.
+That is because there is a rogue component (most likely CppUnitTest) including crtdbg. */
+#if defined(_CRTDBG_MAP_ALLOC) && defined(_DEBUG)
+#undef _malloc_dbg
+#undef _calloc_dbg
+#undef _realloc_dbg
+#undef _free_dbg
+#define _malloc_dbg(size, ...) gballoc_malloc(size)
+#define _calloc_dbg(nmemb, size, ...) gballoc_calloc(nmemb, size)
+#define _realloc_dbg(ptr, size, ...) gballoc_realloc(ptr, size)
+#define _free_dbg(ptr, ...) gballoc_free(ptr)
+#elif defined(GB_PROFILE_ALLOC)
+#define malloc(size) gballoc_malloc_at(size, __FILE__, __LINE__)
+#define calloc(nmemb, size) gballoc_calloc_at(nmemb, size, __FILE__, __LINE__)
+#define realloc(ptr, size) gballoc_realloc_at(ptr, size, __FILE__, __LINE__)
+#define free gballoc_free
+#else
+#define malloc gballoc_malloc
+#define calloc gballoc_calloc
+#define realloc gballoc_realloc
+#define free gballoc_free
+#endif
+#endif
+
+#else /* GB_DEBUG_ALLOC */
+
+#define gballoc_init() 0
+#define gballoc_deinit() ((void)0)
+
+#define gballoc_getMaximumMemoryUsed() SIZE_MAX
+#define gballoc_getCurrentMemoryUsed() SIZE_MAX
+#define gballoc_getAllocationCount() SIZE_MAX
+#define gballoc_getTotalMemoryAllocated() SIZE_MAX
+#define gballoc_resetMetrics() ((void)0)
+#define gballoc_setProfiling(enabled) ((void)0)
+
+#endif /* GB_DEBUG_ALLOC */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GBALLOC_H */
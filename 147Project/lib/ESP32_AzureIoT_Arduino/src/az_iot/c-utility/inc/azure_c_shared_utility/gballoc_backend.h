@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef GBALLOC_BACKEND_H
+#define GBALLOC_BACKEND_H
+
+#ifdef __cplusplus
+#include <cstddef>
+extern "C"
+{
+#else
+#include <stddef.h>
+#endif
+
+/**
+* @brief                What gballoc gets its memory from, see gballoc_setBackend. The C heap is the default. release
+*                       and reallocate may be handed any block gballoc ever returned, including ones from before the
+*                       backend was set.
+*/
+typedef struct GBALLOC_BACKEND_TAG
+{
+    void* (*allocate)(size_t size);
+    void* (*reallocate)(void* ptr, size_t size);
+    void (*release)(void* ptr);
+} GBALLOC_BACKEND;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GBALLOC_BACKEND_H */
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef GBALLOC_PROFILE_H
+#define GBALLOC_PROFILE_H
+
+#ifdef __cplusplus
+#include <cstddef>
+extern "C"
+{
+#else
+#include <stddef.h>
+#endif
+
+/**
+* @brief                The parts of the firmware gballoc_setProfiling attributes the heap to, told apart by the path of
+*                       the source file that allocates: umqtt, the IoT Hub transports, TLS, the rest of the IoT Hub
+*                       client and the rest of c-utility. Everything else, gballoc_malloc called directly included,
+*                       is the application's.
+*/
+typedef enum GBALLOC_SUBSYSTEM_TAG
+{
+    GBALLOC_SUBSYSTEM_APP,
+    GBALLOC_SUBSYSTEM_UMQTT,
+    GBALLOC_SUBSYSTEM_TRANSPORT,
+    GBALLOC_SUBSYSTEM_TLSIO,
+    GBALLOC_SUBSYSTEM_CLIENT,
+    GBALLOC_SUBSYSTEM_UTILITY,
+    GBALLOC_SUBSYSTEM_COUNT
+} GBALLOC_SUBSYSTEM;
+
+typedef struct GBALLOC_PROFILE_STATISTICS_TAG
+{
+    /** @brief           The subsystem's name, or the source file of a call site. */
+    const char* name;
+    /** @brief           The line of a call site, 0 for a subsystem. */
+    int line;
+    GBALLOC_SUBSYSTEM subsystem;
+    size_t liveBytes;
+    size_t peakBytes;
+    /** @brief           Since gballoc_init, reallocations included; the difference between two looks is the rate. */
+    size_t allocations;
+    size_t bytesAllocated;
+} GBALLOC_PROFILE_STATISTICS;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GBALLOC_PROFILE_H */
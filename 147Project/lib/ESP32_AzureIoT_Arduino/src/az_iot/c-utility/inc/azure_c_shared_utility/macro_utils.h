@@ -0,0 +1,12636 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+/*THIS FILE IS GENERATED*/
+/*DO NOT EDIT BY HAND!!!*/
+/*instead edit macro_utils.tt here: http://www.github.com/azure/azure-macro-utils-c.git */
+/*and then copy the generated file overwriting this one*/
+
+
+#ifndef MACRO_UTILS_H
+#define MACRO_UTILS_H
+
+#include <string.h>
+
+#if (defined OPTIMIZE_RETURN_CODES)
+    #define __FAILURE__ 1
+#else
+    #define __FAILURE__ __LINE__
+#endif
+
+/*"pointer or NULL" macro - because when printf-ing arguments NULL is not valid for %s (section 7.1.4 of C11 standard) */
+#define P_OR_NULL(p) (((p)!=NULL)?(p):"NULL")
+
+#define TOSTRING_(x) #x
+#define TOSTRING(x) TOSTRING_(x)
+
+#define IFCOMMA(N) C2(IFCOMMA_, N)
+#define IFCOMMA_0
+#define IFCOMMA_2
+#define IFCOMMA_4 ,
+#define IFCOMMA_6 ,
+#define IFCOMMA_8 ,
+#define IFCOMMA_10 ,
+#define IFCOMMA_12 ,
+#define IFCOMMA_14 ,
+#define IFCOMMA_16 ,
+#define IFCOMMA_18 ,
+#define IFCOMMA_20 ,
+#define IFCOMMA_22 ,
+#define IFCOMMA_24 ,
+#define IFCOMMA_26 ,
+#define IFCOMMA_28 ,
+#define IFCOMMA_30 ,
+#define IFCOMMA_32 ,
+#define IFCOMMA_34 ,
+#define IFCOMMA_36 ,
+#define IFCOMMA_38 ,
+#define IFCOMMA_40 ,
+#define IFCOMMA_42 ,
+#define IFCOMMA_44 ,
+#define IFCOMMA_46 ,
+#define IFCOMMA_48 ,
+#define IFCOMMA_50 ,
+#define IFCOMMA_52 ,
+#define IFCOMMA_54 ,
+#define IFCOMMA_56 ,
+#define IFCOMMA_58 ,
+#define IFCOMMA_60 ,
+#define IFCOMMA_62 ,
+#define IFCOMMA_64 ,
+#define IFCOMMA_66 ,
+#define IFCOMMA_68 ,
+#define IFCOMMA_70 ,
+#define IFCOMMA_72 ,
+#define IFCOMMA_74 ,
+#define IFCOMMA_76 ,
+#define IFCOMMA_78 ,
+#define IFCOMMA_80 ,
+#define IFCOMMA_82 ,
+#define IFCOMMA_84 ,
+#define IFCOMMA_86 ,
+#define IFCOMMA_88 ,
+#define IFCOMMA_90 ,
+#define IFCOMMA_92 ,
+#define IFCOMMA_94 ,
+#define IFCOMMA_96 ,
+#define IFCOMMA_98 ,
+#define IFCOMMA_100 ,
+#define IFCOMMA_102 ,
+#define IFCOMMA_104 ,
+#define IFCOMMA_106 ,
+#define IFCOMMA_108 ,
+#define IFCOMMA_110 ,
+#define IFCOMMA_112 ,
+#define IFCOMMA_114 ,
+#define IFCOMMA_116 ,
+#define IFCOMMA_118 ,
+#define IFCOMMA_120 ,
+#define IFCOMMA_122 ,
+#define IFCOMMA_124 ,
+
+#define IFCOMMA_NOFIRST(N) C2(IFCOMMA_NOFIRST, N)
+#define IFCOMMA_NOFIRST1 
+#define IFCOMMA_NOFIRST2 ,
+#define IFCOMMA_NOFIRST3 ,
+#define IFCOMMA_NOFIRST4 ,
+#define IFCOMMA_NOFIRST5 ,
+#define IFCOMMA_NOFIRST6 ,
+#define IFCOMMA_NOFIRST7 ,
+#define IFCOMMA_NOFIRST8 ,
+#define IFCOMMA_NOFIRST9 ,
+#define IFCOMMA_NOFIRST10 ,
+#define IFCOMMA_NOFIRST11 ,
+#define IFCOMMA_NOFIRST12 ,
+#define IFCOMMA_NOFIRST13 ,
+#define IFCOMMA_NOFIRST14 ,
+#define IFCOMMA_NOFIRST15 ,
+#define IFCOMMA_NOFIRST16 ,
+#define IFCOMMA_NOFIRST17 ,
+#define IFCOMMA_NOFIRST18 ,
+#define IFCOMMA_NOFIRST19 ,
+#define IFCOMMA_NOFIRST20 ,
+#define IFCOMMA_NOFIRST21 ,
+#define IFCOMMA_NOFIRST22 ,
+#define IFCOMMA_NOFIRST23 ,
+#define IFCOMMA_NOFIRST24 ,
+#define IFCOMMA_NOFIRST25 ,
+#define IFCOMMA_NOFIRST26 ,
+#define IFCOMMA_NOFIRST27 ,
+#define IFCOMMA_NOFIRST28 ,
+#define IFCOMMA_NOFIRST29 ,
+#define IFCOMMA_NOFIRST30 ,
+#define IFCOMMA_NOFIRST31 ,
+#define IFCOMMA_NOFIRST32 ,
+#define IFCOMMA_NOFIRST33 ,
+#define IFCOMMA_NOFIRST34 ,
+#define IFCOMMA_NOFIRST35 ,
+#define IFCOMMA_NOFIRST36 ,
+#define IFCOMMA_NOFIRST37 ,
+#define IFCOMMA_NOFIRST38 ,
+#define IFCOMMA_NOFIRST39 ,
+#define IFCOMMA_NOFIRST40 ,
+#define IFCOMMA_NOFIRST41 ,
+#define IFCOMMA_NOFIRST42 ,
+#define IFCOMMA_NOFIRST43 ,
+#define IFCOMMA_NOFIRST44 ,
+#define IFCOMMA_NOFIRST45 ,
+#define IFCOMMA_NOFIRST46 ,
+#define IFCOMMA_NOFIRST47 ,
+#define IFCOMMA_NOFIRST48 ,
+#define IFCOMMA_NOFIRST49 ,
+#define IFCOMMA_NOFIRST50 ,
+#define IFCOMMA_NOFIRST51 ,
+#define IFCOMMA_NOFIRST52 ,
+#define IFCOMMA_NOFIRST53 ,
+#define IFCOMMA_NOFIRST54 ,
+#define IFCOMMA_NOFIRST55 ,
+#define IFCOMMA_NOFIRST56 ,
+#define IFCOMMA_NOFIRST57 ,
+#define IFCOMMA_NOFIRST58 ,
+#define IFCOMMA_NOFIRST59 ,
+#define IFCOMMA_NOFIRST60 ,
+#define IFCOMMA_NOFIRST61 ,
+#define IFCOMMA_NOFIRST62 ,
+#define IFCOMMA_NOFIRST63 ,
+#define IFCOMMA_NOFIRST64 ,
+#define IFCOMMA_NOFIRST65 ,
+#define IFCOMMA_NOFIRST66 ,
+#define IFCOMMA_NOFIRST67 ,
+#define IFCOMMA_NOFIRST68 ,
+#define IFCOMMA_NOFIRST69 ,
+#define IFCOMMA_NOFIRST70 ,
+#define IFCOMMA_NOFIRST71 ,
+#define IFCOMMA_NOFIRST72 ,
+#define IFCOMMA_NOFIRST73 ,
+#define IFCOMMA_NOFIRST74 ,
+#define IFCOMMA_NOFIRST75 ,
+#define IFCOMMA_NOFIRST76 ,
+#define IFCOMMA_NOFIRST77 ,
+#define IFCOMMA_NOFIRST78 ,
+#define IFCOMMA_NOFIRST79 ,
+#define IFCOMMA_NOFIRST80 ,
+#define IFCOMMA_NOFIRST81 ,
+#define IFCOMMA_NOFIRST82 ,
+#define IFCOMMA_NOFIRST83 ,
+#define IFCOMMA_NOFIRST84 ,
+#define IFCOMMA_NOFIRST85 ,
+#define IFCOMMA_NOFIRST86 ,
+#define IFCOMMA_NOFIRST87 ,
+#define IFCOMMA_NOFIRST88 ,
+#define IFCOMMA_NOFIRST89 ,
+#define IFCOMMA_NOFIRST90 ,
+#define IFCOMMA_NOFIRST91 ,
+#define IFCOMMA_NOFIRST92 ,
+#define IFCOMMA_NOFIRST93 ,
+#define IFCOMMA_NOFIRST94 ,
+#define IFCOMMA_NOFIRST95 ,
+#define IFCOMMA_NOFIRST96 ,
+#define IFCOMMA_NOFIRST97 ,
+#define IFCOMMA_NOFIRST98 ,
+#define IFCOMMA_NOFIRST99 ,
+#define IFCOMMA_NOFIRST100 ,
+#define IFCOMMA_NOFIRST101 ,
+#define IFCOMMA_NOFIRST102 ,
+#define IFCOMMA_NOFIRST103 ,
+#define IFCOMMA_NOFIRST104 ,
+#define IFCOMMA_NOFIRST105 ,
+#define IFCOMMA_NOFIRST106 ,
+#define IFCOMMA_NOFIRST107 ,
+#define IFCOMMA_NOFIRST108 ,
+#define IFCOMMA_NOFIRST109 ,
+#define IFCOMMA_NOFIRST110 ,
+#define IFCOMMA_NOFIRST111 ,
+#define IFCOMMA_NOFIRST112 ,
+#define IFCOMMA_NOFIRST113 ,
+#define IFCOMMA_NOFIRST114 ,
+#define IFCOMMA_NOFIRST115 ,
+#define IFCOMMA_NOFIRST116 ,
+#define IFCOMMA_NOFIRST117 ,
+#define IFCOMMA_NOFIRST118 ,
+#define IFCOMMA_NOFIRST119 ,
+#define IFCOMMA_NOFIRST120 ,
+#define IFCOMMA_NOFIRST121 ,
+#define IFCOMMA_NOFIRST122 ,
+#define IFCOMMA_NOFIRST123 ,
+#define IFCOMMA_NOFIRST124 ,
+
+//#define DEC(x) C2(DEC,x)
+#define DEC1024 1023
+#define DEC1023 1022
+#define DEC1022 1021
+#define DEC1021 1020
+#define DEC1020 1019
+#define DEC1019 1018
+#define DEC1018 1017
+#define DEC1017 1016
+#define DEC1016 1015
+#define DEC1015 1014
+#define DEC1014 1013
+#define DEC1013 1012
+#define DEC1012 1011
+#define DEC1011 1010
+#define DEC1010 1009
+#define DEC1009 1008
+#define DEC1008 1007
+#define DEC1007 1006
+#define DEC1006 1005
+#define DEC1005 1004
+#define DEC1004 1003
+#define DEC1003 1002
+#define DEC1002 1001
+#define DEC1001 1000
+#define DEC1000 999
+#define DEC999 998
+#define DEC998 997
+#define DEC997 996
+#define DEC996 995
+#define DEC995 994
+#define DEC994 993
+#define DEC993 992
+#define DEC992 991
+#define DEC991 990
+#define DEC990 989
+#define DEC989 988
+#define DEC988 987
+#define DEC987 986
+#define DEC986 985
+#define DEC985 984
+#define DEC984 983
+#define DEC983 982
+#define DEC982 981
+#define DEC981 980
+#define DEC980 979
+#define DEC979 978
+#define DEC978 977
+#define DEC977 976
+#define DEC976 975
+#define DEC975 974
+#define DEC974 973
+#define DEC973 972
+#define DEC972 971
+#define DEC971 970
+#define DEC970 969
+#define DEC969 968
+#define DEC968 967
+#define DEC967 966
+#define DEC966 965
+#define DEC965 964
+#define DEC964 963
+#define DEC963 962
+#define DEC962 961
+#define DEC961 960
+#define DEC960 959
+#define DEC959 958
+#define DEC958 957
+#define DEC957 956
+#define DEC956 955
+#define DEC955 954
+#define DEC954 953
+#define DEC953 952
+#define DEC952 951
+#define DEC951 950
+#define DEC950 949
+#define DEC949 948
+#define DEC948 947
+#define DEC947 946
+#define DEC946 945
+#define DEC945 944
+#define DEC944 943
+#define DEC943 942
+#define DEC942 941
+#define DEC941 940
+#define DEC940 939
+#define DEC939 938
+#define DEC938 937
+#define DEC937 936
+#define DEC936 935
+#define DEC935 934
+#define DEC934 933
+#define DEC933 932
+#define DEC932 931
+#define DEC931 930
+#define DEC930 929
+#define DEC929 928
+#define DEC928 927
+#define DEC927 926
+#define DEC926 925
+#define DEC925 924
+#define DEC924 923
+#define DEC923 922
+#define DEC922 921
+#define DEC921 920
+#define DEC920 919
+#define DEC919 918
+#define DEC918 917
+#define DEC917 916
+#define DEC916 915
+#define DEC915 914
+#define DEC914 913
+#define DEC913 912
+#define DEC912 911
+#define DEC911 910
+#define DEC910 909
+#define DEC909 908
+#define DEC908 907
+#define DEC907 906
+#define DEC906 905
+#define DEC905 904
+#define DEC904 903
+#define DEC903 902
+#define DEC902 901
+#define DEC901 900
+#define DEC900 899
+#define DEC899 898
+#define DEC898 897
+#define DEC897 896
+#define DEC896 895
+#define DEC895 894
+#define DEC894 893
+#define DEC893 892
+#define DEC892 891
+#define DEC891 890
+#define DEC890 889
+#define DEC889 888
+#define DEC888 887
+#define DEC887 886
+#define DEC886 885
+#define DEC885 884
+#define DEC884 883
+#define DEC883 882
+#define DEC882 881
+#define DEC881 880
+#define DEC880 879
+#define DEC879 878
+#define DEC878 877
+#define DEC877 876
+#define DEC876 875
+#define DEC875 874
+#define DEC874 873
+#define DEC873 872
+#define DEC872 871
+#define DEC871 870
+#define DEC870 869
+#define DEC869 868
+#define DEC868 867
+#define DEC867 866
+#define DEC866 865
+#define DEC865 864
+#define DEC864 863
+#define DEC863 862
+#define DEC862 861
+#define DEC861 860
+#define DEC860 859
+#define DEC859 858
+#define DEC858 857
+#define DEC857 856
+#define DEC856 855
+#define DEC855 854
+#define DEC854 853
+#define DEC853 852
+#define DEC852 851
+#define DEC851 850
+#define DEC850 849
+#define DEC849 848
+#define DEC848 847
+#define DEC847 846
+#define DEC846 845
+#define DEC845 844
+#define DEC844 843
+#define DEC843 842
+#define DEC842 841
+#define DEC841 840
+#define DEC840 839
+#define DEC839 838
+#define DEC838 837
+#define DEC837 836
+#define DEC836 835
+#define DEC835 834
+#define DEC834 833
+#define DEC833 832
+#define DEC832 831
+#define DEC831 830
+#define DEC830 829
+#define DEC829 828
+#define DEC828 827
+#define DEC827 826
+#define DEC826 825
+#define DEC825 824
+#define DEC824 823
+#define DEC823 822
+#define DEC822 821
+#define DEC821 820
+#define DEC820 819
+#define DEC819 818
+#define DEC818 817
+#define DEC817 816
+#define DEC816 815
+#define DEC815 814
+#define DEC814 813
+#define DEC813 812
+#define DEC812 811
+#define DEC811 810
+#define DEC810 809
+#define DEC809 808
+#define DEC808 807
+#define DEC807 806
+#define DEC806 805
+#define DEC805 804
+#define DEC804 803
+#define DEC803 802
+#define DEC802 801
+#define DEC801 800
+#define DEC800 799
+#define DEC799 798
+#define DEC798 797
+#define DEC797 796
+#define DEC796 795
+#define DEC795 794
+#define DEC794 793
+#define DEC793 792
+#define DEC792 791
+#define DEC791 790
+#define DEC790 789
+#define DEC789 788
+#define DEC788 787
+#define DEC787 786
+#define DEC786 785
+#define DEC785 784
+#define DEC784 783
+#define DEC783 782
+#define DEC782 781
+#define DEC781 780
+#define DEC780 779
+#define DEC779 778
+#define DEC778 777
+#define DEC777 776
+#define DEC776 775
+#define DEC775 774
+#define DEC774 773
+#define DEC773 772
+#define DEC772 771
+#define DEC771 770
+#define DEC770 769
+#define DEC769 768
+#define DEC768 767
+#define DEC767 766
+#define DEC766 765
+#define DEC765 764
+#define DEC764 763
+#define DEC763 762
+#define DEC762 761
+#define DEC761 760
+#define DEC760 759
+#define DEC759 758
+#define DEC758 757
+#define DEC757 756
+#define DEC756 755
+#define DEC755 754
+#define DEC754 753
+#define DEC753 752
+#define DEC752 751
+#define DEC751 750
+#define DEC750 749
+#define DEC749 748
+#define DEC748 747
+#define DEC747 746
+#define DEC746 745
+#define DEC745 744
+#define DEC744 743
+#define DEC743 742
+#define DEC742 741
+#define DEC741 740
+#define DEC740 739
+#define DEC739 738
+#define DEC738 737
+#define DEC737 736
+#define DEC736 735
+#define DEC735 734
+#define DEC734 733
+#define DEC733 732
+#define DEC732 731
+#define DEC731 730
+#define DEC730 729
+#define DEC729 728
+#define DEC728 727
+#define DEC727 726
+#define DEC726 725
+#define DEC725 724
+#define DEC724 723
+#define DEC723 722
+#define DEC722 721
+#define DEC721 720
+#define DEC720 719
+#define DEC719 718
+#define DEC718 717
+#define DEC717 716
+#define DEC716 715
+#define DEC715 714
+#define DEC714 713
+#define DEC713 712
+#define DEC712 711
+#define DEC711 710
+#define DEC710 709
+#define DEC709 708
+#define DEC708 707
+#define DEC707 706
+#define DEC706 705
+#define DEC705 704
+#define DEC704 703
+#define DEC703 702
+#define DEC702 701
+#define DEC701 700
+#define DEC700 699
+#define DEC699 698
+#define DEC698 697
+#define DEC697 696
+#define DEC696 695
+#define DEC695 694
+#define DEC694 693
+#define DEC693 692
+#define DEC692 691
+#define DEC691 690
+#define DEC690 689
+#define DEC689 688
+#define DEC688 687
+#define DEC687 686
+#define DEC686 685
+#define DEC685 684
+#define DEC684 683
+#define DEC683 682
+#define DEC682 681
+#define DEC681 680
+#define DEC680 679
+#define DEC679 678
+#define DEC678 677
+#define DEC677 676
+#define DEC676 675
+#define DEC675 674
+#define DEC674 673
+#define DEC673 672
+#define DEC672 671
+#define DEC671 670
+#define DEC670 669
+#define DEC669 668
+#define DEC668 667
+#define DEC667 666
+#define DEC666 665
+#define DEC665 664
+#define DEC664 663
+#define DEC663 662
+#define DEC662 661
+#define DEC661 660
+#define DEC660 659
+#define DEC659 658
+#define DEC658 657
+#define DEC657 656
+#define DEC656 655
+#define DEC655 654
+#define DEC654 653
+#define DEC653 652
+#define DEC652 651
+#define DEC651 650
+#define DEC650 649
+#define DEC649 648
+#define DEC648 647
+#define DEC647 646
+#define DEC646 645
+#define DEC645 644
+#define DEC644 643
+#define DEC643 642
+#define DEC642 641
+#define DEC641 640
+#define DEC640 639
+#define DEC639 638
+#define DEC638 637
+#define DEC637 636
+#define DEC636 635
+#define DEC635 634
+#define DEC634 633
+#define DEC633 632
+#define DEC632 631
+#define DEC631 630
+#define DEC630 629
+#define DEC629 628
+#define DEC628 627
+#define DEC627 626
+#define DEC626 625
+#define DEC625 624
+#define DEC624 623
+#define DEC623 622
+#define DEC622 621
+#define DEC621 620
+#define DEC620 619
+#define DEC619 618
+#define DEC618 617
+#define DEC617 616
+#define DEC616 615
+#define DEC615 614
+#define DEC614 613
+#define DEC613 612
+#define DEC612 611
+#define DEC611 610
+#define DEC610 609
+#define DEC609 608
+#define DEC608 607
+#define DEC607 606
+#define DEC606 605
+#define DEC605 604
+#define DEC604 603
+#define DEC603 602
+#define DEC602 601
+#define DEC601 600
+#define DEC600 599
+#define DEC599 598
+#define DEC598 597
+#define DEC597 596
+#define DEC596 595
+#define DEC595 594
+#define DEC594 593
+#define DEC593 592
+#define DEC592 591
+#define DEC591 590
+#define DEC590 589
+#define DEC589 588
+#define DEC588 587
+#define DEC587 586
+#define DEC586 585
+#define DEC585 584
+#define DEC584 583
+#define DEC583 582
+#define DEC582 581
+#define DEC581 580
+#define DEC580 579
+#define DEC579 578
+#define DEC578 577
+#define DEC577 576
+#define DEC576 575
+#define DEC575 574
+#define DEC574 573
+#define DEC573 572
+#define DEC572 571
+#define DEC571 570
+#define DEC570 569
+#define DEC569 568
+#define DEC568 567
+#define DEC567 566
+#define DEC566 565
+#define DEC565 564
+#define DEC564 563
+#define DEC563 562
+#define DEC562 561
+#define DEC561 560
+#define DEC560 559
+#define DEC559 558
+#define DEC558 557
+#define DEC557 556
+#define DEC556 555
+#define DEC555 554
+#define DEC554 553
+#define DEC553 552
+#define DEC552 551
+#define DEC551 550
+#define DEC550 549
+#define DEC549 548
+#define DEC548 547
+#define DEC547 546
+#define DEC546 545
+#define DEC545 544
+#define DEC544 543
+#define DEC543 542
+#define DEC542 541
+#define DEC541 540
+#define DEC540 539
+#define DEC539 538
+#define DEC538 537
+#define DEC537 536
+#define DEC536 535
+#define DEC535 534
+#define DEC534 533
+#define DEC533 532
+#define DEC532 531
+#define DEC531 530
+#define DEC530 529
+#define DEC529 528
+#define DEC528 527
+#define DEC527 526
+#define DEC526 525
+#define DEC525 524
+#define DEC524 523
+#define DEC523 522
+#define DEC522 521
+#define DEC521 520
+#define DEC520 519
+#define DEC519 518
+#define DEC518 517
+#define DEC517 516
+#define DEC516 515
+#define DEC515 514
+#define DEC514 513
+#define DEC513 512
+#define DEC512 511
+#define DEC511 510
+#define DEC510 509
+#define DEC509 508
+#define DEC508 507
+#define DEC507 506
+#define DEC506 505
+#define DEC505 504
+#define DEC504 503
+#define DEC503 502
+#define DEC502 501
+#define DEC501 500
+#define DEC500 499
+#define DEC499 498
+#define DEC498 497
+#define DEC497 496
+#define DEC496 495
+#define DEC495 494
+#define DEC494 493
+#define DEC493 492
+#define DEC492 491
+#define DEC491 490
+#define DEC490 489
+#define DEC489 488
+#define DEC488 487
+#define DEC487 486
+#define DEC486 485
+#define DEC485 484
+#define DEC484 483
+#define DEC483 482
+#define DEC482 481
+#define DEC481 480
+#define DEC480 479
+#define DEC479 478
+#define DEC478 477
+#define DEC477 476
+#define DEC476 475
+#define DEC475 474
+#define DEC474 473
+#define DEC473 472
+#define DEC472 471
+#define DEC471 470
+#define DEC470 469
+#define DEC469 468
+#define DEC468 467
+#define DEC467 466
+#define DEC466 465
+#define DEC465 464
+#define DEC464 463
+#define DEC463 462
+#define DEC462 461
+#define DEC461 460
+#define DEC460 459
+#define DEC459 458
+#define DEC458 457
+#define DEC457 456
+#define DEC456 455
+#define DEC455 454
+#define DEC454 453
+#define DEC453 452
+#define DEC452 451
+#define DEC451 450
+#define DEC450 449
+#define DEC449 448
+#define DEC448 447
+#define DEC447 446
+#define DEC446 445
+#define DEC445 444
+#define DEC444 443
+#define DEC443 442
+#define DEC442 441
+#define DEC441 440
+#define DEC440 439
+#define DEC439 438
+#define DEC438 437
+#define DEC437 436
+#define DEC436 435
+#define DEC435 434
+#define DEC434 433
+#define DEC433 432
+#define DEC432 431
+#define DEC431 430
+#define DEC430 429
+#define DEC429 428
+#define DEC428 427
+#define DEC427 426
+#define DEC426 425
+#define DEC425 424
+#define DEC424 423
+#define DEC423 422
+#define DEC422 421
+#define DEC421 420
+#define DEC420 419
+#define DEC419 418
+#define DEC418 417
+#define DEC417 416
+#define DEC416 415
+#define DEC415 414
+#define DEC414 413
+#define DEC413 412
+#define DEC412 411
+#define DEC411 410
+#define DEC410 409
+#define DEC409 408
+#define DEC408 407
+#define DEC407 406
+#define DEC406 405
+#define DEC405 404
+#define DEC404 403
+#define DEC403 402
+#define DEC402 401
+#define DEC401 400
+#define DEC400 399
+#define DEC399 398
+#define DEC398 397
+#define DEC397 396
+#define DEC396 395
+#define DEC395 394
+#define DEC394 393
+#define DEC393 392
+#define DEC392 391
+#define DEC391 390
+#define DEC390 389
+#define DEC389 388
+#define DEC388 387
+#define DEC387 386
+#define DEC386 385
+#define DEC385 384
+#define DEC384 383
+#define DEC383 382
+#define DEC382 381
+#define DEC381 380
+#define DEC380 379
+#define DEC379 378
+#define DEC378 377
+#define DEC377 376
+#define DEC376 375
+#define DEC375 374
+#define DEC374 373
+#define DEC373 372
+#define DEC372 371
+#define DEC371 370
+#define DEC370 369
+#define DEC369 368
+#define DEC368 367
+#define DEC367 366
+#define DEC366 365
+#define DEC365 364
+#define DEC364 363
+#define DEC363 362
+#define DEC362 361
+#define DEC361 360
+#define DEC360 359
+#define DEC359 358
+#define DEC358 357
+#define DEC357 356
+#define DEC356 355
+#define DEC355 354
+#define DEC354 353
+#define DEC353 352
+#define DEC352 351
+#define DEC351 350
+#define DEC350 349
+#define DEC349 348
+#define DEC348 347
+#define DEC347 346
+#define DEC346 345
+#define DEC345 344
+#define DEC344 343
+#define DEC343 342
+#define DEC342 341
+#define DEC341 340
+#define DEC340 339
+#define DEC339 338
+#define DEC338 337
+#define DEC337 336
+#define DEC336 335
+#define DEC335 334
+#define DEC334 333
+#define DEC333 332
+#define DEC332 331
+#define DEC331 330
+#define DEC330 329
+#define DEC329 328
+#define DEC328 327
+#define DEC327 326
+#define DEC326 325
+#define DEC325 324
+#define DEC324 323
+#define DEC323 322
+#define DEC322 321
+#define DEC321 320
+#define DEC320 319
+#define DEC319 318
+#define DEC318 317
+#define DEC317 316
+#define DEC316 315
+#define DEC315 314
+#define DEC314 313
+#define DEC313 312
+#define DEC312 311
+#define DEC311 310
+#define DEC310 309
+#define DEC309 308
+#define DEC308 307
+#define DEC307 306
+#define DEC306 305
+#define DEC305 304
+#define DEC304 303
+#define DEC303 302
+#define DEC302 301
+#define DEC301 300
+#define DEC300 299
+#define DEC299 298
+#define DEC298 297
+#define DEC297 296
+#define DEC296 295
+#define DEC295 294
+#define DEC294 293
+#define DEC293 292
+#define DEC292 291
+#define DEC291 290
+#define DEC290 289
+#define DEC289 288
+#define DEC288 287
+#define DEC287 286
+#define DEC286 285
+#define DEC285 284
+#define DEC284 283
+#define DEC283 282
+#define DEC282 281
+#define DEC281 280
+#define DEC280 279
+#define DEC279 278
+#define DEC278 277
+#define DEC277 276
+#define DEC276 275
+#define DEC275 274
+#define DEC274 273
+#define DEC273 272
+#define DEC272 271
+#define DEC271 270
+#define DEC270 269
+#define DEC269 268
+#define DEC268 267
+#define DEC267 266
+#define DEC266 265
+#define DEC265 264
+#define DEC264 263
+#define DEC263 262
+#define DEC262 261
+#define DEC261 260
+#define DEC260 259
+#define DEC259 258
+#define DEC258 257
+#define DEC257 256
+#define DEC256 255
+#define DEC255 254
+#define DEC254 253
+#define DEC253 252
+#define DEC252 251
+#define DEC251 250
+#define DEC250 249
+#define DEC249 248
+#define DEC248 247
+#define DEC247 246
+#define DEC246 245
+#define DEC245 244
+#define DEC244 243
+#define DEC243 242
+#define DEC242 241
+#define DEC241 240
+#define DEC240 239
+#define DEC239 238
+#define DEC238 237
+#define DEC237 236
+#define DEC236 235
+#define DEC235 234
+#define DEC234 233
+#define DEC233 232
+#define DEC232 231
+#define DEC231 230
+#define DEC230 229
+#define DEC229 228
+#define DEC228 227
+#define DEC227 226
+#define DEC226 225
+#define DEC225 224
+#define DEC224 223
+#define DEC223 222
+#define DEC222 221
+#define DEC221 220
+#define DEC220 219
+#define DEC219 218
+#define DEC218 217
+#define DEC217 216
+#define DEC216 215
+#define DEC215 214
+#define DEC214 213
+#define DEC213 212
+#define DEC212 211
+#define DEC211 210
+#define DEC210 209
+#define DEC209 208
+#define DEC208 207
+#define DEC207 206
+#define DEC206 205
+#define DEC205 204
+#define DEC204 203
+#define DEC203 202
+#define DEC202 201
+#define DEC201 200
+#define DEC200 199
+#define DEC199 198
+#define DEC198 197
+#define DEC197 196
+#define DEC196 195
+#define DEC195 194
+#define DEC194 193
+#define DEC193 192
+#define DEC192 191
+#define DEC191 190
+#define DEC190 189
+#define DEC189 188
+#define DEC188 187
+#define DEC187 186
+#define DEC186 185
+#define DEC185 184
+#define DEC184 183
+#define DEC183 182
+#define DEC182 181
+#define DEC181 180
+#define DEC180 179
+#define DEC179 178
+#define DEC178 177
+#define DEC177 176
+#define DEC176 175
+#define DEC175 174
+#define DEC174 173
+#define DEC173 172
+#define DEC172 171
+#define DEC171 170
+#define DEC170 169
+#define DEC169 168
+#define DEC168 167
+#define DEC167 166
+#define DEC166 165
+#define DEC165 164
+#define DEC164 163
+#define DEC163 162
+#define DEC162 161
+#define DEC161 160
+#define DEC160 159
+#define DEC159 158
+#define DEC158 157
+#define DEC157 156
+#define DEC156 155
+#define DEC155 154
+#define DEC154 153
+#define DEC153 152
+#define DEC152 151
+#define DEC151 150
+#define DEC150 149
+#define DEC149 148
+#define DEC148 147
+#define DEC147 146
+#define DEC146 145
+#define DEC145 144
+#define DEC144 143
+#define DEC143 142
+#define DEC142 141
+#define DEC141 140
+#define DEC140 139
+#define DEC139 138
+#define DEC138 137
+#define DEC137 136
+#define DEC136 135
+#define DEC135 134
+#define DEC134 133
+#define DEC133 132
+#define DEC132 131
+#define DEC131 130
+#define DEC130 129
+#define DEC129 128
+#define DEC128 127
+#define DEC127 126
+#define DEC126 125
+#define DEC125 124
+#define DEC124 123
+#define DEC123 122
+#define DEC122 121
+#define DEC121 120
+#define DEC120 119
+#define DEC119 118
+#define DEC118 117
+#define DEC117 116
+#define DEC116 115
+#define DEC115 114
+#define DEC114 113
+#define DEC113 112
+#define DEC112 111
+#define DEC111 110
+#define DEC110 109
+#define DEC109 108
+#define DEC108 107
+#define DEC107 106
+#define DEC106 105
+#define DEC105 104
+#define DEC104 103
+#define DEC103 102
+#define DEC102 101
+#define DEC101 100
+#define DEC100 99
+#define DEC99 98
+#define DEC98 97
+#define DEC97 96
+#define DEC96 95
+#define DEC95 94
+#define DEC94 93
+#define DEC93 92
+#define DEC92 91
+#define DEC91 90
+#define DEC90 89
+#define DEC89 88
+#define DEC88 87
+#define DEC87 86
+#define DEC86 85
+#define DEC85 84
+#define DEC84 83
+#define DEC83 82
+#define DEC82 81
+#define DEC81 80
+#define DEC80 79
+#define DEC79 78
+#define DEC78 77
+#define DEC77 76
+#define DEC76 75
+#define DEC75 74
+#define DEC74 73
+#define DEC73 72
+#define DEC72 71
+#define DEC71 70
+#define DEC70 69
+#define DEC69 68
+#define DEC68 67
+#define DEC67 66
+#define DEC66 65
+#define DEC65 64
+#define DEC64 63
+#define DEC63 62
+#define DEC62 61
+#define DEC61 60
+#define DEC60 59
+#define DEC59 58
+#define DEC58 57
+#define DEC57 56
+#define DEC56 55
+#define DEC55 54
+#define DEC54 53
+#define DEC53 52
+#define DEC52 51
+#define DEC51 50
+#define DEC50 49
+#define DEC49 48
+#define DEC48 47
+#define DEC47 46
+#define DEC46 45
+#define DEC45 44
+#define DEC44 43
+#define DEC43 42
+#define DEC42 41
+#define DEC41 40
+#define DEC40 39
+#define DEC39 38
+#define DEC38 37
+#define DEC37 36
+#define DEC36 35
+#define DEC35 34
+#define DEC34 33
+#define DEC33 32
+#define DEC32 31
+#define DEC31 30
+#define DEC30 29
+#define DEC29 28
+#define DEC28 27
+#define DEC27 26
+#define DEC26 25
+#define DEC25 24
+#define DEC24 23
+#define DEC23 22
+#define DEC22 21
+#define DEC21 20
+#define DEC20 19
+#define DEC19 18
+#define DEC18 17
+#define DEC17 16
+#define DEC16 15
+#define DEC15 14
+#define DEC14 13
+#define DEC13 12
+#define DEC12 11
+#define DEC11 10
+#define DEC10 9
+#define DEC9 8
+#define DEC8 7
+#define DEC7 6
+#define DEC6 5
+#define DEC5 4
+#define DEC4 3
+#define DEC3 2
+#define DEC2 1
+#define DEC1 0
+
+#define INC(x) C2(INC,x)
+#define INC1024 1025
+#define INC1023 1024
+#define INC1022 1023
+#define INC1021 1022
+#define INC1020 1021
+#define INC1019 1020
+#define INC1018 1019
+#define INC1017 1018
+#define INC1016 1017
+#define INC1015 1016
+#define INC1014 1015
+#define INC1013 1014
+#define INC1012 1013
+#define INC1011 1012
+#define INC1010 1011
+#define INC1009 1010
+#define INC1008 1009
+#define INC1007 1008
+#define INC1006 1007
+#define INC1005 1006
+#define INC1004 1005
+#define INC1003 1004
+#define INC1002 1003
+#define INC1001 1002
+#define INC1000 1001
+#define INC999 1000
+#define INC998 999
+#define INC997 998
+#define INC996 997
+#define INC995 996
+#define INC994 995
+#define INC993 994
+#define INC992 993
+#define INC991 992
+#define INC990 991
+#define INC989 990
+#define INC988 989
+#define INC987 988
+#define INC986 987
+#define INC985 986
+#define INC984 985
+#define INC983 984
+#define INC982 983
+#define INC981 982
+#define INC980 981
+#define INC979 980
+#define INC978 979
+#define INC977 978
+#define INC976 977
+#define INC975 976
+#define INC974 975
+#define INC973 974
+#define INC972 973
+#define INC971 972
+#define INC970 971
+#define INC969 970
+#define INC968 969
+#define INC967 968
+#define INC966 967
+#define INC965 966
+#define INC964 965
+#define INC963 964
+#define INC962 963
+#define INC961 962
+#define INC960 961
+#define INC959 960
+#define INC958 959
+#define INC957 958
+#define INC956 957
+#define INC955 956
+#define INC954 955
+#define INC953 954
+#define INC952 953
+#define INC951 952
+#define INC950 951
+#define INC949 950
+#define INC948 949
+#define INC947 948
+#define INC946 947
+#define INC945 946
+#define INC944 945
+#define INC943 944
+#define INC942 943
+#define INC941 942
+#define INC940 941
+#define INC939 940
+#define INC938 939
+#define INC937 938
+#define INC936 937
+#define INC935 936
+#define INC934 935
+#define INC933 934
+#define INC932 933
+#define INC931 932
+#define INC930 931
+#define INC929 930
+#define INC928 929
+#define INC927 928
+#define INC926 927
+#define INC925 926
+#define INC924 925
+#define INC923 924
+#define INC922 923
+#define INC921 922
+#define INC920 921
+#define INC919 920
+#define INC918 919
+#define INC917 918
+#define INC916 917
+#define INC915 916
+#define INC914 915
+#define INC913 914
+#define INC912 913
+#define INC911 912
+#define INC910 911
+#define INC909 910
+#define INC908 909
+#define INC907 908
+#define INC906 907
+#define INC905 906
+#define INC904 905
+#define INC903 904
+#define INC902 903
+#define INC901 902
+#define INC900 901
+#define INC899 900
+#define INC898 899
+#define INC897 898
+#define INC896 897
+#define INC895 896
+#define INC894 895
+#define INC893 894
+#define INC892 893
+#define INC891 892
+#define INC890 891
+#define INC889 890
+#define INC888 889
+#define INC887 888
+#define INC886 887
+#define INC885 886
+#define INC884 885
+#define INC883 884
+#define INC882 883
+#define INC881 882
+#define INC880 881
+#define INC879 880
+#define INC878 879
+#define INC877 878
+#define INC876 877
+#define INC875 876
+#define INC874 875
+#define INC873 874
+#define INC872 873
+#define INC871 872
+#define INC870 871
+#define INC869 870
+#define INC868 869
+#define INC867 868
+#define INC866 867
+#define INC865 866
+#define INC864 865
+#define INC863 864
+#define INC862 863
+#define INC861 862
+#define INC860 861
+#define INC859 860
+#define INC858 859
+#define INC857 858
+#define INC856 857
+#define INC855 856
+#define INC854 855
+#define INC853 854
+#define INC852 853
+#define INC851 852
+#define INC850 851
+#define INC849 850
+#define INC848 849
+#define INC847 848
+#define INC846 847
+#define INC845 846
+#define INC844 845
+#define INC843 844
+#define INC842 843
+#define INC841 842
+#define INC840 841
+#define INC839 840
+#define INC838 839
+#define INC837 838
+#define INC836 837
+#define INC835 836
+#define INC834 835
+#define INC833 834
+#define INC832 833
+#define INC831 832
+#define INC830 831
+#define INC829 830
+#define INC828 829
+#define INC827 828
+#define INC826 827
+#define INC825 826
+#define INC824 825
+#define INC823 824
+#define INC822 823
+#define INC821 822
+#define INC820 821
+#define INC819 820
+#define INC818 819
+#define INC817 818
+#define INC816 817
+#define INC815 816
+#define INC814 815
+#define INC813 814
+#define INC812 813
+#define INC811 812
+#define INC810 811
+#define INC809 810
+#define INC808 809
+#define INC807 808
+#define INC806 807
+#define INC805 806
+#define INC804 805
+#define INC803 804
+#define INC802 803
+#define INC801 802
+#define INC800 801
+#define INC799 800
+#define INC798 799
+#define INC797 798
+#define INC796 797
+#define INC795 796
+#define INC794 795
+#define INC793 794
+#define INC792 793
+#define INC791 792
+#define INC790 791
+#define INC789 790
+#define INC788 789
+#define INC787 788
+#define INC786 787
+#define INC785 786
+#define INC784 785
+#define INC783 784
+#define INC782 783
+#define INC781 782
+#define INC780 781
+#define INC779 780
+#define INC778 779
+#define INC777 778
+#define INC776 777
+#define INC775 776
+#define INC774 775
+#define INC773 774
+#define INC772 773
+#define INC771 772
+#define INC770 771
+#define INC769 770
+#define INC768 769
+#define INC767 768
+#define INC766 767
+#define INC765 766
+#define INC764 765
+#define INC763 764
+#define INC762 763
+#define INC761 762
+#define INC760 761
+#define INC759 760
+#define INC758 759
+#define INC757 758
+#define INC756 757
+#define INC755 756
+#define INC754 755
+#define INC753 754
+#define INC752 753
+#define INC751 752
+#define INC750 751
+#define INC749 750
+#define INC748 749
+#define INC747 748
+#define INC746 747
+#define INC745 746
+#define INC744 745
+#define INC743 744
+#define INC742 743
+#define INC741 742
+#define INC740 741
+#define INC739 740
+#define INC738 739
+#define INC737 738
+#define INC736 737
+#define INC735 736
+#define INC734 735
+#define INC733 734
+#define INC732 733
+#define INC731 732
+#define INC730 731
+#define INC729 730
+#define INC728 729
+#define INC727 728
+#define INC726 727
+#define INC725 726
+#define INC724 725
+#define INC723 724
+#define INC722 723
+#define INC721 722
+#define INC720 721
+#define INC719 720
+#define INC718 719
+#define INC717 718
+#define INC716 717
+#define INC715 716
+#define INC714 715
+#define INC713 714
+#define INC712 713
+#define INC711 712
+#define INC710 711
+#define INC709 710
+#define INC708 709
+#define INC707 708
+#define INC706 707
+#define INC705 706
+#define INC704 705
+#define INC703 704
+#define INC702 703
+#define INC701 702
+#define INC700 701
+#define INC699 700
+#define INC698 699
+#define INC697 698
+#define INC696 697
+#define INC695 696
+#define INC694 695
+#define INC693 694
+#define INC692 693
+#define INC691 692
+#define INC690 691
+#define INC689 690
+#define INC688 689
+#define INC687 688
+#define INC686 687
+#define INC685 686
+#define INC684 685
+#define INC683 684
+#define INC682 683
+#define INC681 682
+#define INC680 681
+#define INC679 680
+#define INC678 679
+#define INC677 678
+#define INC676 677
+#define INC675 676
+#define INC674 675
+#define INC673 674
+#define INC672 673
+#define INC671 672
+#define INC670 671
+#define INC669 670
+#define INC668 669
+#define INC667 668
+#define INC666 667
+#define INC665 666
+#define INC664 665
+#define INC663 664
+#define INC662 663
+#define INC661 662
+#define INC660 661
+#define INC659 660
+#define INC658 659
+#define INC657 658
+#define INC656 657
+#define INC655 656
+#define INC654 655
+#define INC653 654
+#define INC652 653
+#define INC651 652
+#define INC650 651
+#define INC649 650
+#define INC648 649
+#define INC647 648
+#define INC646 647
+#define INC645 646
+#define INC644 645
+#define INC643 644
+#define INC642 643
+#define INC641 642
+#define INC640 641
+#define INC639 640
+#define INC638 639
+#define INC637 638
+#define INC636 637
+#define INC635 636
+#define INC634 635
+#define INC633 634
+#define INC632 633
+#define INC631 632
+#define INC630 631
+#define INC629 630
+#define INC628 629
+#define INC627 628
+#define INC626 627
+#define INC625 626
+#define INC624 625
+#define INC623 624
+#define INC622 623
+#define INC621 622
+#define INC620 621
+#define INC619 620
+#define INC618 619
+#define INC617 618
+#define INC616 617
+#define INC615 616
+#define INC614 615
+#define INC613 614
+#define INC612 613
+#define INC611 612
+#define INC610 611
+#define INC609 610
+#define INC608 609
+#define INC607 608
+#define INC606 607
+#define INC605 606
+#define INC604 605
+#define INC603 604
+#define INC602 603
+#define INC601 602
+#define INC600 601
+#define INC599 600
+#define INC598 599
+#define INC597 598
+#define INC596 597
+#define INC595 596
+#define INC594 595
+#define INC593 594
+#define INC592 593
+#define INC591 592
+#define INC590 591
+#define INC589 590
+#define INC588 589
+#define INC587 588
+#define INC586 587
+#define INC585 586
+#define INC584 585
+#define INC583 584
+#define INC582 583
+#define INC581 582
+#define INC580 581
+#define INC579 580
+#define INC578 579
+#define INC577 578
+#define INC576 577
+#define INC575 576
+#define INC574 575
+#define INC573 574
+#define INC572 573
+#define INC571 572
+#define INC570 571
+#define INC569 570
+#define INC568 569
+#define INC567 568
+#define INC566 567
+#define INC565 566
+#define INC564 565
+#define INC563 564
+#define INC562 563
+#define INC561 562
+#define INC560 561
+#define INC559 560
+#define INC558 559
+#define INC557 558
+#define INC556 557
+#define INC555 556
+#define INC554 555
+#define INC553 554
+#define INC552 553
+#define INC551 552
+#define INC550 551
+#define INC549 550
+#define INC548 549
+#define INC547 548
+#define INC546 547
+#define INC545 546
+#define INC544 545
+#define INC543 544
+#define INC542 543
+#define INC541 542
+#define INC540 541
+#define INC539 540
+#define INC538 539
+#define INC537 538
+#define INC536 537
+#define INC535 536
+#define INC534 535
+#define INC533 534
+#define INC532 533
+#define INC531 532
+#define INC530 531
+#define INC529 530
+#define INC528 529
+#define INC527 528
+#define INC526 527
+#define INC525 526
+#define INC524 525
+#define INC523 524
+#define INC522 523
+#define INC521 522
+#define INC520 521
+#define INC519 520
+#define INC518 519
+#define INC517 518
+#define INC516 517
+#define INC515 516
+#define INC514 515
+#define INC513 514
+#define INC512 513
+#define INC511 512
+#define INC510 511
+#define INC509 510
+#define INC508 509
+#define INC507 508
+#define INC506 507
+#define INC505 506
+#define INC504 505
+#define INC503 504
+#define INC502 503
+#define INC501 502
+#define INC500 501
+#define INC499 500
+#define INC498 499
+#define INC497 498
+#define INC496 497
+#define INC495 496
+#define INC494 495
+#define INC493 494
+#define INC492 493
+#define INC491 492
+#define INC490 491
+#define INC489 490
+#define INC488 489
+#define INC487 488
+#define INC486 487
+#define INC485 486
+#define INC484 485
+#define INC483 484
+#define INC482 483
+#define INC481 482
+#define INC480 481
+#define INC479 480
+#define INC478 479
+#define INC477 478
+#define INC476 477
+#define INC475 476
+#define INC474 475
+#define INC473 474
+#define INC472 473
+#define INC471 472
+#define INC470 471
+#define INC469 470
+#define INC468 469
+#define INC467 468
+#define INC466 467
+#define INC465 466
+#define INC464 465
+#define INC463 464
+#define INC462 463
+#define INC461 462
+#define INC460 461
+#define INC459 460
+#define INC458 459
+#define INC457 458
+#define INC456 457
+#define INC455 456
+#define INC454 455
+#define INC453 454
+#define INC452 453
+#define INC451 452
+#define INC450 451
+#define INC449 450
+#define INC448 449
+#define INC447 448
+#define INC446 447
+#define INC445 446
+#define INC444 445
+#define INC443 444
+#define INC442 443
+#define INC441 442
+#define INC440 441
+#define INC439 440
+#define INC438 439
+#define INC437 438
+#define INC436 437
+#define INC435 436
+#define INC434 435
+#define INC433 434
+#define INC432 433
+#define INC431 432
+#define INC430 431
+#define INC429 430
+#define INC428 429
+#define INC427 428
+#define INC426 427
+#define INC425 426
+#define INC424 425
+#define INC423 424
+#define INC422 423
+#define INC421 422
+#define INC420 421
+#define INC419 420
+#define INC418 419
+#define INC417 418
+#define INC416 417
+#define INC415 416
+#define INC414 415
+#define INC413 414
+#define INC412 413
+#define INC411 412
+#define INC410 411
+#define INC409 410
+#define INC408 409
+#define INC407 408
+#define INC406 407
+#define INC405 406
+#define INC404 405
+#define INC403 404
+#define INC402 403
+#define INC401 402
+#define INC400 401
+#define INC399 400
+#define INC398 399
+#define INC397 398
+#define INC396 397
+#define INC395 396
+#define INC394 395
+#define INC393 394
+#define INC392 393
+#define INC391 392
+#define INC390 391
+#define INC389 390
+#define INC388 389
+#define INC387 388
+#define INC386 387
+#define INC385 386
+#define INC384 385
+#define INC383 384
+#define INC382 383
+#define INC381 382
+#define INC380 381
+#define INC379 380
+#define INC378 379
+#define INC377 378
+#define INC376 377
+#define INC375 376
+#define INC374 375
+#define INC373 374
+#define INC372 373
+#define INC371 372
+#define INC370 371
+#define INC369 370
+#define INC368 369
+#define INC367 368
+#define INC366 367
+#define INC365 366
+#define INC364 365
+#define INC363 364
+#define INC362 363
+#define INC361 362
+#define INC360 361
+#define INC359 360
+#define INC358 359
+#define INC357 358
+#define INC356 357
+#define INC355 356
+#define INC354 355
+#define INC353 354
+#define INC352 353
+#define INC351 352
+#define INC350 351
+#define INC349 350
+#define INC348 349
+#define INC347 348
+#define INC346 347
+#define INC345 346
+#define INC344 345
+#define INC343 344
+#define INC342 343
+#define INC341 342
+#define INC340 341
+#define INC339 340
+#define INC338 339
+#define INC337 338
+#define INC336 337
+#define INC335 336
+#define INC334 335
+#define INC333 334
+#define INC332 333
+#define INC331 332
+#define INC330 331
+#define INC329 330
+#define INC328 329
+#define INC327 328
+#define INC326 327
+#define INC325 326
+#define INC324 325
+#define INC323 324
+#define INC322 323
+#define INC321 322
+#define INC320 321
+#define INC319 320
+#define INC318 319
+#define INC317 318
+#define INC316 317
+#define INC315 316
+#define INC314 315
+#define INC313 314
+#define INC312 313
+#define INC311 312
+#define INC310 311
+#define INC309 310
+#define INC308 309
+#define INC307 308
+#define INC306 307
+#define INC305 306
+#define INC304 305
+#define INC303 304
+#define INC302 303
+#define INC301 302
+#define INC300 301
+#define INC299 300
+#define INC298 299
+#define INC297 298
+#define INC296 297
+#define INC295 296
+#define INC294 295
+#define INC293 294
+#define INC292 293
+#define INC291 292
+#define INC290 291
+#define INC289 290
+#define INC288 289
+#define INC287 288
+#define INC286 287
+#define INC285 286
+#define INC284 285
+#define INC283 284
+#define INC282 283
+#define INC281 282
+#define INC280 281
+#define INC279 280
+#define INC278 279
+#define INC277 278
+#define INC276 277
+#define INC275 276
+#define INC274 275
+#define INC273 274
+#define INC272 273
+#define INC271 272
+#define INC270 271
+#define INC269 270
+#define INC268 269
+#define INC267 268
+#define INC266 267
+#define INC265 266
+#define INC264 265
+#define INC263 264
+#define INC262 263
+#define INC261 262
+#define INC260 261
+#define INC259 260
+#define INC258 259
+#define INC257 258
+#define INC256 257
+#define INC255 256
+#define INC254 255
+#define INC253 254
+#define INC252 253
+#define INC251 252
+#define INC250 251
+#define INC249 250
+#define INC248 249
+#define INC247 248
+#define INC246 247
+#define INC245 246
+#define INC244 245
+#define INC243 244
+#define INC242 243
+#define INC241 242
+#define INC240 241
+#define INC239 240
+#define INC238 239
+#define INC237 238
+#define INC236 237
+#define INC235 236
+#define INC234 235
+#define INC233 234
+#define INC232 233
+#define INC231 232
+#define INC230 231
+#define INC229 230
+#define INC228 229
+#define INC227 228
+#define INC226 227
+#define INC225 226
+#define INC224 225
+#define INC223 224
+#define INC222 223
+#define INC221 222
+#define INC220 221
+#define INC219 220
+#define INC218 219
+#define INC217 218
+#define INC216 217
+#define INC215 216
+#define INC214 215
+#define INC213 214
+#define INC212 213
+#define INC211 212
+#define INC210 211
+#define INC209 210
+#define INC208 209
+#define INC207 208
+#define INC206 207
+#define INC205 206
+#define INC204 205
+#define INC203 204
+#define INC202 203
+#define INC201 202
+#define INC200 201
+#define INC199 200
+#define INC198 199
+#define INC197 198
+#define INC196 197
+#define INC195 196
+#define INC194 195
+#define INC193 194
+#define INC192 193
+#define INC191 192
+#define INC190 191
+#define INC189 190
+#define INC188 189
+#define INC187 188
+#define INC186 187
+#define INC185 186
+#define INC184 185
+#define INC183 184
+#define INC182 183
+#define INC181 182
+#define INC180 181
+#define INC179 180
+#define INC178 179
+#define INC177 178
+#define INC176 177
+#define INC175 176
+#define INC174 175
+#define INC173 174
+#define INC172 173
+#define INC171 172
+#define INC170 171
+#define INC169 170
+#define INC168 169
+#define INC167 168
+#define INC166 167
+#define INC165 166
+#define INC164 165
+#define INC163 164
+#define INC162 163
+#define INC161 162
+#define INC160 161
+#define INC159 160
+#define INC158 159
+#define INC157 158
+#define INC156 157
+#define INC155 156
+#define INC154 155
+#define INC153 154
+#define INC152 153
+#define INC151 152
+#define INC150 151
+#define INC149 150
+#define INC148 149
+#define INC147 148
+#define INC146 147
+#define INC145 146
+#define INC144 145
+#define INC143 144
+#define INC142 143
+#define INC141 142
+#define INC140 141
+#define INC139 140
+#define INC138 139
+#define INC137 138
+#define INC136 137
+#define INC135 136
+#define INC134 135
+#define INC133 134
+#define INC132 133
+#define INC131 132
+#define INC130 131
+#define INC129 130
+#define INC128 129
+#define INC127 128
+#define INC126 127
+#define INC125 126
+#define INC124 125
+#define INC123 124
+#define INC122 123
+#define INC121 122
+#define INC120 121
+#define INC119 120
+#define INC118 119
+#define INC117 118
+#define INC116 117
+#define INC115 116
+#define INC114 115
+#define INC113 114
+#define INC112 113
+#define INC111 112
+#define INC110 111
+#define INC109 110
+#define INC108 109
+#define INC107 108
+#define INC106 107
+#define INC105 106
+#define INC104 105
+#define INC103 104
+#define INC102 103
+#define INC101 102
+#define INC100 101
+#define INC99 100
+#define INC98 99
+#define INC97 98
+#define INC96 97
+#define INC95 96
+#define INC94 95
+#define INC93 94
+#define INC92 93
+#define INC91 92
+#define INC90 91
+#define INC89 90
+#define INC88 89
+#define INC87 88
+#define INC86 87
+#define INC85 86
+#define INC84 85
+#define INC83 84
+#define INC82 83
+#define INC81 82
+#define INC80 81
+#define INC79 80
+#define INC78 79
+#define INC77 78
+#define INC76 77
+#define INC75 76
+#define INC74 75
+#define INC73 74
+#define INC72 73
+#define INC71 72
+#define INC70 71
+#define INC69 70
+#define INC68 69
+#define INC67 68
+#define INC66 67
+#define INC65 66
+#define INC64 65
+#define INC63 64
+#define INC62 63
+#define INC61 62
+#define INC60 61
+#define INC59 60
+#define INC58 59
+#define INC57 58
+#define INC56 57
+#define INC55 56
+#define INC54 55
+#define INC53 54
+#define INC52 53
+#define INC51 52
+#define INC50 51
+#define INC49 50
+#define INC48 49
+#define INC47 48
+#define INC46 47
+#define INC45 46
+#define INC44 45
+#define INC43 44
+#define INC42 43
+#define INC41 42
+#define INC40 41
+#define INC39 40
+#define INC38 39
+#define INC37 38
+#define INC36 37
+#define INC35 36
+#define INC34 35
+#define INC33 34
+#define INC32 33
+#define INC31 32
+#define INC30 31
+#define INC29 30
+#define INC28 29
+#define INC27 28
+#define INC26 27
+#define INC25 26
+#define INC24 25
+#define INC23 24
+#define INC22 23
+#define INC21 22
+#define INC20 21
+#define INC19 20
+#define INC18 19
+#define INC17 18
+#define INC16 17
+#define INC15 16
+#define INC14 15
+#define INC13 14
+#define INC12 13
+#define INC11 12
+#define INC10 11
+#define INC9 10
+#define INC8 9
+#define INC7 8
+#define INC6 7
+#define INC5 6
+#define INC4 5
+#define INC3 4
+#define INC2 3
+#define INC1 2
+#define INC0 1
+
+#define DIV2(x) C2(DIV2_,x)
+
+#define DIV2_1024 512
+#define DIV2_1023 511
+#define DIV2_1022 511
+#define DIV2_1021 510
+#define DIV2_1020 510
+#define DIV2_1019 509
+#define DIV2_1018 509
+#define DIV2_1017 508
+#define DIV2_1016 508
+#define DIV2_1015 507
+#define DIV2_1014 507
+#define DIV2_1013 506
+#define DIV2_1012 506
+#define DIV2_1011 505
+#define DIV2_1010 505
+#define DIV2_1009 504
+#define DIV2_1008 504
+#define DIV2_1007 503
+#define DIV2_1006 503
+#define DIV2_1005 502
+#define DIV2_1004 502
+#define DIV2_1003 501
+#define DIV2_1002 501
+#define DIV2_1001 500
+#define DIV2_1000 500
+#define DIV2_999 499
+#define DIV2_998 499
+#define DIV2_997 498
+#define DIV2_996 498
+#define DIV2_995 497
+#define DIV2_994 497
+#define DIV2_993 496
+#define DIV2_992 496
+#define DIV2_991 495
+#define DIV2_990 495
+#define DIV2_989 494
+#define DIV2_988 494
+#define DIV2_987 493
+#define DIV2_986 493
+#define DIV2_985 492
+#define DIV2_984 492
+#define DIV2_983 491
+#define DIV2_982 491
+#define DIV2_981 490
+#define DIV2_980 490
+#define DIV2_979 489
+#define DIV2_978 489
+#define DIV2_977 488
+#define DIV2_976 488
+#define DIV2_975 487
+#define DIV2_974 487
+#define DIV2_973 486
+#define DIV2_972 486
+#define DIV2_971 485
+#define DIV2_970 485
+#define DIV2_969 484
+#define DIV2_968 484
+#define DIV2_967 483
+#define DIV2_966 483
+#define DIV2_965 482
+#define DIV2_964 482
+#define DIV2_963 481
+#define DIV2_962 481
+#define DIV2_961 480
+#define DIV2_960 480
+#define DIV2_959 479
+#define DIV2_958 479
+#define DIV2_957 478
+#define DIV2_956 478
+#define DIV2_955 477
+#define DIV2_954 477
+#define DIV2_953 476
+#define DIV2_952 476
+#define DIV2_951 475
+#define DIV2_950 475
+#define DIV2_949 474
+#define DIV2_948 474
+#define DIV2_947 473
+#define DIV2_946 473
+#define DIV2_945 472
+#define DIV2_944 472
+#define DIV2_943 471
+#define DIV2_942 471
+#define DIV2_941 470
+#define DIV2_940 470
+#define DIV2_939 469
+#define DIV2_938 469
+#define DIV2_937 468
+#define DIV2_936 468
+#define DIV2_935 467
+#define DIV2_934 467
+#define DIV2_933 466
+#define DIV2_932 466
+#define DIV2_931 465
+#define DIV2_930 465
+#define DIV2_929 464
+#define DIV2_928 464
+#define DIV2_927 463
+#define DIV2_926 463
+#define DIV2_925 462
+#define DIV2_924 462
+#define DIV2_923 461
+#define DIV2_922 461
+#define DIV2_921 460
+#define DIV2_920 460
+#define DIV2_919 459
+#define DIV2_918 459
+#define DIV2_917 458
+#define DIV2_916 458
+#define DIV2_915 457
+#define DIV2_914 457
+#define DIV2_913 456
+#define DIV2_912 456
+#define DIV2_911 455
+#define DIV2_910 455
+#define DIV2_909 454
+#define DIV2_908 454
+#define DIV2_907 453
+#define DIV2_906 453
+#define DIV2_905 452
+#define DIV2_904 452
+#define DIV2_903 451
+#define DIV2_902 451
+#define DIV2_901 450
+#define DIV2_900 450
+#define DIV2_899 449
+#define DIV2_898 449
+#define DIV2_897 448
+#define DIV2_896 448
+#define DIV2_895 447
+#define DIV2_894 447
+#define DIV2_893 446
+#define DIV2_892 446
+#define DIV2_891 445
+#define DIV2_890 445
+#define DIV2_889 444
+#define DIV2_888 444
+#define DIV2_887 443
+#define DIV2_886 443
+#define DIV2_885 442
+#define DIV2_884 442
+#define DIV2_883 441
+#define DIV2_882 441
+#define DIV2_881 440
+#define DIV2_880 440
+#define DIV2_879 439
+#define DIV2_878 439
+#define DIV2_877 438
+#define DIV2_876 438
+#define DIV2_875 437
+#define DIV2_874 437
+#define DIV2_873 436
+#define DIV2_872 436
+#define DIV2_871 435
+#define DIV2_870 435
+#define DIV2_869 434
+#define DIV2_868 434
+#define DIV2_867 433
+#define DIV2_866 433
+#define DIV2_865 432
+#define DIV2_864 432
+#define DIV2_863 431
+#define DIV2_862 431
+#define DIV2_861 430
+#define DIV2_860 430
+#define DIV2_859 429
+#define DIV2_858 429
+#define DIV2_857 428
+#define DIV2_856 428
+#define DIV2_855 427
+#define DIV2_854 427
+#define DIV2_853 426
+#define DIV2_852 426
+#define DIV2_851 425
+#define DIV2_850 425
+#define DIV2_849 424
+#define DIV2_848 424
+#define DIV2_847 423
+#define DIV2_846 423
+#define DIV2_845 422
+#define DIV2_844 422
+#define DIV2_843 421
+#define DIV2_842 421
+#define DIV2_841 420
+#define DIV2_840 420
+#define DIV2_839 419
+#define DIV2_838 419
+#define DIV2_837 418
+#define DIV2_836 418
+#define DIV2_835 417
+#define DIV2_834 417
+#define DIV2_833 416
+#define DIV2_832 416
+#define DIV2_831 415
+#define DIV2_830 415
+#define DIV2_829 414
+#define DIV2_828 414
+#define DIV2_827 413
+#define DIV2_826 413
+#define DIV2_825 412
+#define DIV2_824 412
+#define DIV2_823 411
+#define DIV2_822 411
+#define DIV2_821 410
+#define DIV2_820 410
+#define DIV2_819 409
+#define DIV2_818 409
+#define DIV2_817 408
+#define DIV2_816 408
+#define DIV2_815 407
+#define DIV2_814 407
+#define DIV2_813 406
+#define DIV2_812 406
+#define DIV2_811 405
+#define DIV2_810 405
+#define DIV2_809 404
+#define DIV2_808 404
+#define DIV2_807 403
+#define DIV2_806 403
+#define DIV2_805 402
+#define DIV2_804 402
+#define DIV2_803 401
+#define DIV2_802 401
+#define DIV2_801 400
+#define DIV2_800 400
+#define DIV2_799 399
+#define DIV2_798 399
+#define DIV2_797 398
+#define DIV2_796 398
+#define DIV2_795 397
+#define DIV2_794 397
+#define DIV2_793 396
+#define DIV2_792 396
+#define DIV2_791 395
+#define DIV2_790 395
+#define DIV2_789 394
+#define DIV2_788 394
+#define DIV2_787 393
+#define DIV2_786 393
+#define DIV2_785 392
+#define DIV2_784 392
+#define DIV2_783 391
+#define DIV2_782 391
+#define DIV2_781 390
+#define DIV2_780 390
+#define DIV2_779 389
+#define DIV2_778 389
+#define DIV2_777 388
+#define DIV2_776 388
+#define DIV2_775 387
+#define DIV2_774 387
+#define DIV2_773 386
+#define DIV2_772 386
+#define DIV2_771 385
+#define DIV2_770 385
+#define DIV2_769 384
+#define DIV2_768 384
+#define DIV2_767 383
+#define DIV2_766 383
+#define DIV2_765 382
+#define DIV2_764 382
+#define DIV2_763 381
+#define DIV2_762 381
+#define DIV2_761 380
+#define DIV2_760 380
+#define DIV2_759 379
+#define DIV2_758 379
+#define DIV2_757 378
+#define DIV2_756 378
+#define DIV2_755 377
+#define DIV2_754 377
+#define DIV2_753 376
+#define DIV2_752 376
+#define DIV2_751 375
+#define DIV2_750 375
+#define DIV2_749 374
+#define DIV2_748 374
+#define DIV2_747 373
+#define DIV2_746 373
+#define DIV2_745 372
+#define DIV2_744 372
+#define DIV2_743 371
+#define DIV2_742 371
+#define DIV2_741 370
+#define DIV2_740 370
+#define DIV2_739 369
+#define DIV2_738 369
+#define DIV2_737 368
+#define DIV2_736 368
+#define DIV2_735 367
+#define DIV2_734 367
+#define DIV2_733 366
+#define DIV2_732 366
+#define DIV2_731 365
+#define DIV2_730 365
+#define DIV2_729 364
+#define DIV2_728 364
+#define DIV2_727 363
+#define DIV2_726 363
+#define DIV2_725 362
+#define DIV2_724 362
+#define DIV2_723 361
+#define DIV2_722 361
+#define DIV2_721 360
+#define DIV2_720 360
+#define DIV2_719 359
+#define DIV2_718 359
+#define DIV2_717 358
+#define DIV2_716 358
+#define DIV2_715 357
+#define DIV2_714 357
+#define DIV2_713 356
+#define DIV2_712 356
+#define DIV2_711 355
+#define DIV2_710 355
+#define DIV2_709 354
+#define DIV2_708 354
+#define DIV2_707 353
+#define DIV2_706 353
+#define DIV2_705 352
+#define DIV2_704 352
+#define DIV2_703 351
+#define DIV2_702 351
+#define DIV2_701 350
+#define DIV2_700 350
+#define DIV2_699 349
+#define DIV2_698 349
+#define DIV2_697 348
+#define DIV2_696 348
+#define DIV2_695 347
+#define DIV2_694 347
+#define DIV2_693 346
+#define DIV2_692 346
+#define DIV2_691 345
+#define DIV2_690 345
+#define DIV2_689 344
+#define DIV2_688 344
+#define DIV2_687 343
+#define DIV2_686 343
+#define DIV2_685 342
+#define DIV2_684 342
+#define DIV2_683 341
+#define DIV2_682 341
+#define DIV2_681 340
+#define DIV2_680 340
+#define DIV2_679 339
+#define DIV2_678 339
+#define DIV2_677 338
+#define DIV2_676 338
+#define DIV2_675 337
+#define DIV2_674 337
+#define DIV2_673 336
+#define DIV2_672 336
+#define DIV2_671 335
+#define DIV2_670 335
+#define DIV2_669 334
+#define DIV2_668 334
+#define DIV2_667 333
+#define DIV2_666 333
+#define DIV2_665 332
+#define DIV2_664 332
+#define DIV2_663 331
+#define DIV2_662 331
+#define DIV2_661 330
+#define DIV2_660 330
+#define DIV2_659 329
+#define DIV2_658 329
+#define DIV2_657 328
+#define DIV2_656 328
+#define DIV2_655 327
+#define DIV2_654 327
+#define DIV2_653 326
+#define DIV2_652 326
+#define DIV2_651 325
+#define DIV2_650 325
+#define DIV2_649 324
+#define DIV2_648 324
+#define DIV2_647 323
+#define DIV2_646 323
+#define DIV2_645 322
+#define DIV2_644 322
+#define DIV2_643 321
+#define DIV2_642 321
+#define DIV2_641 320
+#define DIV2_640 320
+#define DIV2_639 319
+#define DIV2_638 319
+#define DIV2_637 318
+#define DIV2_636 318
+#define DIV2_635 317
+#define DIV2_634 317
+#define DIV2_633 316
+#define DIV2_632 316
+#define DIV2_631 315
+#define DIV2_630 315
+#define DIV2_629 314
+#define DIV2_628 314
+#define DIV2_627 313
+#define DIV2_626 313
+#define DIV2_625 312
+#define DIV2_624 312
+#define DIV2_623 311
+#define DIV2_622 311
+#define DIV2_621 310
+#define DIV2_620 310
+#define DIV2_619 309
+#define DIV2_618 309
+#define DIV2_617 308
+#define DIV2_616 308
+#define DIV2_615 307
+#define DIV2_614 307
+#define DIV2_613 306
+#define DIV2_612 306
+#define DIV2_611 305
+#define DIV2_610 305
+#define DIV2_609 304
+#define DIV2_608 304
+#define DIV2_607 303
+#define DIV2_606 303
+#define DIV2_605 302
+#define DIV2_604 302
+#define DIV2_603 301
+#define DIV2_602 301
+#define DIV2_601 300
+#define DIV2_600 300
+#define DIV2_599 299
+#define DIV2_598 299
+#define DIV2_597 298
+#define DIV2_596 298
+#define DIV2_595 297
+#define DIV2_594 297
+#define DIV2_593 296
+#define DIV2_592 296
+#define DIV2_591 295
+#define DIV2_590 295
+#define DIV2_589 294
+#define DIV2_588 294
+#define DIV2_587 293
+#define DIV2_586 293
+#define DIV2_585 292
+#define DIV2_584 292
+#define DIV2_583 291
+#define DIV2_582 291
+#define DIV2_581 290
+#define DIV2_580 290
+#define DIV2_579 289
+#define DIV2_578 289
+#define DIV2_577 288
+#define DIV2_576 288
+#define DIV2_575 287
+#define DIV2_574 287
+#define DIV2_573 286
+#define DIV2_572 286
+#define DIV2_571 285
+#define DIV2_570 285
+#define DIV2_569 284
+#define DIV2_568 284
+#define DIV2_567 283
+#define DIV2_566 283
+#define DIV2_565 282
+#define DIV2_564 282
+#define DIV2_563 281
+#define DIV2_562 281
+#define DIV2_561 280
+#define DIV2_560 280
+#define DIV2_559 279
+#define DIV2_558 279
+#define DIV2_557 278
+#define DIV2_556 278
+#define DIV2_555 277
+#define DIV2_554 277
+#define DIV2_553 276
+#define DIV2_552 276
+#define DIV2_551 275
+#define DIV2_550 275
+#define DIV2_549 274
+#define DIV2_548 274
+#define DIV2_547 273
+#define DIV2_546 273
+#define DIV2_545 272
+#define DIV2_544 272
+#define DIV2_543 271
+#define DIV2_542 271
+#define DIV2_541 270
+#define DIV2_540 270
+#define DIV2_539 269
+#define DIV2_538 269
+#define DIV2_537 268
+#define DIV2_536 268
+#define DIV2_535 267
+#define DIV2_534 267
+#define DIV2_533 266
+#define DIV2_532 266
+#define DIV2_531 265
+#define DIV2_530 265
+#define DIV2_529 264
+#define DIV2_528 264
+#define DIV2_527 263
+#define DIV2_526 263
+#define DIV2_525 262
+#define DIV2_524 262
+#define DIV2_523 261
+#define DIV2_522 261
+#define DIV2_521 260
+#define DIV2_520 260
+#define DIV2_519 259
+#define DIV2_518 259
+#define DIV2_517 258
+#define DIV2_516 258
+#define DIV2_515 257
+#define DIV2_514 257
+#define DIV2_513 256
+#define DIV2_512 256
+#define DIV2_511 255
+#define DIV2_510 255
+#define DIV2_509 254
+#define DIV2_508 254
+#define DIV2_507 253
+#define DIV2_506 253
+#define DIV2_505 252
+#define DIV2_504 252
+#define DIV2_503 251
+#define DIV2_502 251
+#define DIV2_501 250
+#define DIV2_500 250
+#define DIV2_499 249
+#define DIV2_498 249
+#define DIV2_497 248
+#define DIV2_496 248
+#define DIV2_495 247
+#define DIV2_494 247
+#define DIV2_493 246
+#define DIV2_492 246
+#define DIV2_491 245
+#define DIV2_490 245
+#define DIV2_489 244
+#define DIV2_488 244
+#define DIV2_487 243
+#define DIV2_486 243
+#define DIV2_485 242
+#define DIV2_484 242
+#define DIV2_483 241
+#define DIV2_482 241
+#define DIV2_481 240
+#define DIV2_480 240
+#define DIV2_479 239
+#define DIV2_478 239
+#define DIV2_477 238
+#define DIV2_476 238
+#define DIV2_475 237
+#define DIV2_474 237
+#define DIV2_473 236
+#define DIV2_472 236
+#define DIV2_471 235
+#define DIV2_470 235
+#define DIV2_469 234
+#define DIV2_468 234
+#define DIV2_467 233
+#define DIV2_466 233
+#define DIV2_465 232
+#define DIV2_464 232
+#define DIV2_463 231
+#define DIV2_462 231
+#define DIV2_461 230
+#define DIV2_460 230
+#define DIV2_459 229
+#define DIV2_458 229
+#define DIV2_457 228
+#define DIV2_456 228
+#define DIV2_455 227
+#define DIV2_454 227
+#define DIV2_453 226
+#define DIV2_452 226
+#define DIV2_451 225
+#define DIV2_450 225
+#define DIV2_449 224
+#define DIV2_448 224
+#define DIV2_447 223
+#define DIV2_446 223
+#define DIV2_445 222
+#define DIV2_444 222
+#define DIV2_443 221
+#define DIV2_442 221
+#define DIV2_441 220
+#define DIV2_440 220
+#define DIV2_439 219
+#define DIV2_438 219
+#define DIV2_437 218
+#define DIV2_436 218
+#define DIV2_435 217
+#define DIV2_434 217
+#define DIV2_433 216
+#define DIV2_432 216
+#define DIV2_431 215
+#define DIV2_430 215
+#define DIV2_429 214
+#define DIV2_428 214
+#define DIV2_427 213
+#define DIV2_426 213
+#define DIV2_425 212
+#define DIV2_424 212
+#define DIV2_423 211
+#define DIV2_422 211
+#define DIV2_421 210
+#define DIV2_420 210
+#define DIV2_419 209
+#define DIV2_418 209
+#define DIV2_417 208
+#define DIV2_416 208
+#define DIV2_415 207
+#define DIV2_414 207
+#define DIV2_413 206
+#define DIV2_412 206
+#define DIV2_411 205
+#define DIV2_410 205
+#define DIV2_409 204
+#define DIV2_408 204
+#define DIV2_407 203
+#define DIV2_406 203
+#define DIV2_405 202
+#define DIV2_404 202
+#define DIV2_403 201
+#define DIV2_402 201
+#define DIV2_401 200
+#define DIV2_400 200
+#define DIV2_399 199
+#define DIV2_398 199
+#define DIV2_397 198
+#define DIV2_396 198
+#define DIV2_395 197
+#define DIV2_394 197
+#define DIV2_393 196
+#define DIV2_392 196
+#define DIV2_391 195
+#define DIV2_390 195
+#define DIV2_389 194
+#define DIV2_388 194
+#define DIV2_387 193
+#define DIV2_386 193
+#define DIV2_385 192
+#define DIV2_384 192
+#define DIV2_383 191
+#define DIV2_382 191
+#define DIV2_381 190
+#define DIV2_380 190
+#define DIV2_379 189
+#define DIV2_378 189
+#define DIV2_377 188
+#define DIV2_376 188
+#define DIV2_375 187
+#define DIV2_374 187
+#define DIV2_373 186
+#define DIV2_372 186
+#define DIV2_371 185
+#define DIV2_370 185
+#define DIV2_369 184
+#define DIV2_368 184
+#define DIV2_367 183
+#define DIV2_366 183
+#define DIV2_365 182
+#define DIV2_364 182
+#define DIV2_363 181
+#define DIV2_362 181
+#define DIV2_361 180
+#define DIV2_360 180
+#define DIV2_359 179
+#define DIV2_358 179
+#define DIV2_357 178
+#define DIV2_356 178
+#define DIV2_355 177
+#define DIV2_354 177
+#define DIV2_353 176
+#define DIV2_352 176
+#define DIV2_351 175
+#define DIV2_350 175
+#define DIV2_349 174
+#define DIV2_348 174
+#define DIV2_347 173
+#define DIV2_346 173
+#define DIV2_345 172
+#define DIV2_344 172
+#define DIV2_343 171
+#define DIV2_342 171
+#define DIV2_341 170
+#define DIV2_340 170
+#define DIV2_339 169
+#define DIV2_338 169
+#define DIV2_337 168
+#define DIV2_336 168
+#define DIV2_335 167
+#define DIV2_334 167
+#define DIV2_333 166
+#define DIV2_332 166
+#define DIV2_331 165
+#define DIV2_330 165
+#define DIV2_329 164
+#define DIV2_328 164
+#define DIV2_327 163
+#define DIV2_326 163
+#define DIV2_325 162
+#define DIV2_324 162
+#define DIV2_323 161
+#define DIV2_322 161
+#define DIV2_321 160
+#define DIV2_320 160
+#define DIV2_319 159
+#define DIV2_318 159
+#define DIV2_317 158
+#define DIV2_316 158
+#define DIV2_315 157
+#define DIV2_314 157
+#define DIV2_313 156
+#define DIV2_312 156
+#define DIV2_311 155
+#define DIV2_310 155
+#define DIV2_309 154
+#define DIV2_308 154
+#define DIV2_307 153
+#define DIV2_306 153
+#define DIV2_305 152
+#define DIV2_304 152
+#define DIV2_303 151
+#define DIV2_302 151
+#define DIV2_301 150
+#define DIV2_300 150
+#define DIV2_299 149
+#define DIV2_298 149
+#define DIV2_297 148
+#define DIV2_296 148
+#define DIV2_295 147
+#define DIV2_294 147
+#define DIV2_293 146
+#define DIV2_292 146
+#define DIV2_291 145
+#define DIV2_290 145
+#define DIV2_289 144
+#define DIV2_288 144
+#define DIV2_287 143
+#define DIV2_286 143
+#define DIV2_285 142
+#define DIV2_284 142
+#define DIV2_283 141
+#define DIV2_282 141
+#define DIV2_281 140
+#define DIV2_280 140
+#define DIV2_279 139
+#define DIV2_278 139
+#define DIV2_277 138
+#define DIV2_276 138
+#define DIV2_275 137
+#define DIV2_274 137
+#define DIV2_273 136
+#define DIV2_272 136
+#define DIV2_271 135
+#define DIV2_270 135
+#define DIV2_269 134
+#define DIV2_268 134
+#define DIV2_267 133
+#define DIV2_266 133
+#define DIV2_265 132
+#define DIV2_264 132
+#define DIV2_263 131
+#define DIV2_262 131
+#define DIV2_261 130
+#define DIV2_260 130
+#define DIV2_259 129
+#define DIV2_258 129
+#define DIV2_257 128
+#define DIV2_256 128
+#define DIV2_255 127
+#define DIV2_254 127
+#define DIV2_253 126
+#define DIV2_252 126
+#define DIV2_251 125
+#define DIV2_250 125
+#define DIV2_249 124
+#define DIV2_248 124
+#define DIV2_247 123
+#define DIV2_246 123
+#define DIV2_245 122
+#define DIV2_244 122
+#define DIV2_243 121
+#define DIV2_242 121
+#define DIV2_241 120
+#define DIV2_240 120
+#define DIV2_239 119
+#define DIV2_238 119
+#define DIV2_237 118
+#define DIV2_236 118
+#define DIV2_235 117
+#define DIV2_234 117
+#define DIV2_233 116
+#define DIV2_232 116
+#define DIV2_231 115
+#define DIV2_230 115
+#define DIV2_229 114
+#define DIV2_228 114
+#define DIV2_227 113
+#define DIV2_226 113
+#define DIV2_225 112
+#define DIV2_224 112
+#define DIV2_223 111
+#define DIV2_222 111
+#define DIV2_221 110
+#define DIV2_220 110
+#define DIV2_219 109
+#define DIV2_218 109
+#define DIV2_217 108
+#define DIV2_216 108
+#define DIV2_215 107
+#define DIV2_214 107
+#define DIV2_213 106
+#define DIV2_212 106
+#define DIV2_211 105
+#define DIV2_210 105
+#define DIV2_209 104
+#define DIV2_208 104
+#define DIV2_207 103
+#define DIV2_206 103
+#define DIV2_205 102
+#define DIV2_204 102
+#define DIV2_203 101
+#define DIV2_202 101
+#define DIV2_201 100
+#define DIV2_200 100
+#define DIV2_199 99
+#define DIV2_198 99
+#define DIV2_197 98
+#define DIV2_196 98
+#define DIV2_195 97
+#define DIV2_194 97
+#define DIV2_193 96
+#define DIV2_192 96
+#define DIV2_191 95
+#define DIV2_190 95
+#define DIV2_189 94
+#define DIV2_188 94
+#define DIV2_187 93
+#define DIV2_186 93
+#define DIV2_185 92
+#define DIV2_184 92
+#define DIV2_183 91
+#define DIV2_182 91
+#define DIV2_181 90
+#define DIV2_180 90
+#define DIV2_179 89
+#define DIV2_178 89
+#define DIV2_177 88
+#define DIV2_176 88
+#define DIV2_175 87
+#define DIV2_174 87
+#define DIV2_173 86
+#define DIV2_172 86
+#define DIV2_171 85
+#define DIV2_170 85
+#define DIV2_169 84
+#define DIV2_168 84
+#define DIV2_167 83
+#define DIV2_166 83
+#define DIV2_165 82
+#define DIV2_164 82
+#define DIV2_163 81
+#define DIV2_162 81
+#define DIV2_161 80
+#define DIV2_160 80
+#define DIV2_159 79
+#define DIV2_158 79
+#define DIV2_157 78
+#define DIV2_156 78
+#define DIV2_155 77
+#define DIV2_154 77
+#define DIV2_153 76
+#define DIV2_152 76
+#define DIV2_151 75
+#define DIV2_150 75
+#define DIV2_149 74
+#define DIV2_148 74
+#define DIV2_147 73
+#define DIV2_146 73
+#define DIV2_145 72
+#define DIV2_144 72
+#define DIV2_143 71
+#define DIV2_142 71
+#define DIV2_141 70
+#define DIV2_140 70
+#define DIV2_139 69
+#define DIV2_138 69
+#define DIV2_137 68
+#define DIV2_136 68
+#define DIV2_135 67
+#define DIV2_134 67
+#define DIV2_133 66
+#define DIV2_132 66
+#define DIV2_131 65
+#define DIV2_130 65
+#define DIV2_129 64
+#define DIV2_128 64
+#define DIV2_127 63
+#define DIV2_126 63
+#define DIV2_125 62
+#define DIV2_124 62
+#define DIV2_123 61
+#define DIV2_122 61
+#define DIV2_121 60
+#define DIV2_120 60
+#define DIV2_119 59
+#define DIV2_118 59
+#define DIV2_117 58
+#define DIV2_116 58
+#define DIV2_115 57
+#define DIV2_114 57
+#define DIV2_113 56
+#define DIV2_112 56
+#define DIV2_111 55
+#define DIV2_110 55
+#define DIV2_109 54
+#define DIV2_108 54
+#define DIV2_107 53
+#define DIV2_106 53
+#define DIV2_105 52
+#define DIV2_104 52
+#define DIV2_103 51
+#define DIV2_102 51
+#define DIV2_101 50
+#define DIV2_100 50
+#define DIV2_99 49
+#define DIV2_98 49
+#define DIV2_97 48
+#define DIV2_96 48
+#define DIV2_95 47
+#define DIV2_94 47
+#define DIV2_93 46
+#define DIV2_92 46
+#define DIV2_91 45
+#define DIV2_90 45
+#define DIV2_89 44
+#define DIV2_88 44
+#define DIV2_87 43
+#define DIV2_86 43
+#define DIV2_85 42
+#define DIV2_84 42
+#define DIV2_83 41
+#define DIV2_82 41
+#define DIV2_81 40
+#define DIV2_80 40
+#define DIV2_79 39
+#define DIV2_78 39
+#define DIV2_77 38
+#define DIV2_76 38
+#define DIV2_75 37
+#define DIV2_74 37
+#define DIV2_73 36
+#define DIV2_72 36
+#define DIV2_71 35
+#define DIV2_70 35
+#define DIV2_69 34
+#define DIV2_68 34
+#define DIV2_67 33
+#define DIV2_66 33
+#define DIV2_65 32
+#define DIV2_64 32
+#define DIV2_63 31
+#define DIV2_62 31
+#define DIV2_61 30
+#define DIV2_60 30
+#define DIV2_59 29
+#define DIV2_58 29
+#define DIV2_57 28
+#define DIV2_56 28
+#define DIV2_55 27
+#define DIV2_54 27
+#define DIV2_53 26
+#define DIV2_52 26
+#define DIV2_51 25
+#define DIV2_50 25
+#define DIV2_49 24
+#define DIV2_48 24
+#define DIV2_47 23
+#define DIV2_46 23
+#define DIV2_45 22
+#define DIV2_44 22
+#define DIV2_43 21
+#define DIV2_42 21
+#define DIV2_41 20
+#define DIV2_40 20
+#define DIV2_39 19
+#define DIV2_38 19
+#define DIV2_37 18
+#define DIV2_36 18
+#define DIV2_35 17
+#define DIV2_34 17
+#define DIV2_33 16
+#define DIV2_32 16
+#define DIV2_31 15
+#define DIV2_30 15
+#define DIV2_29 14
+#define DIV2_28 14
+#define DIV2_27 13
+#define DIV2_26 13
+#define DIV2_25 12
+#define DIV2_24 12
+#define DIV2_23 11
+#define DIV2_22 11
+#define DIV2_21 10
+#define DIV2_20 10
+#define DIV2_19 9
+#define DIV2_18 9
+#define DIV2_17 8
+#define DIV2_16 8
+#define DIV2_15 7
+#define DIV2_14 7
+#define DIV2_13 6
+#define DIV2_12 6
+#define DIV2_11 5
+#define DIV2_10 5
+#define DIV2_9 4
+#define DIV2_8 4
+#define DIV2_7 3
+#define DIV2_6 3
+#define DIV2_5 2
+#define DIV2_4 2
+#define DIV2_3 1
+#define DIV2_2 1
+#define DIV2_1 0
+#define DIV2_0 0
+
+#define MOD2(x) C2(MOD2_,x)
+#define MOD2_1024 0
+#define MOD2_1023 1
+#define MOD2_1022 0
+#define MOD2_1021 1
+#define MOD2_1020 0
+#define MOD2_1019 1
+#define MOD2_1018 0
+#define MOD2_1017 1
+#define MOD2_1016 0
+#define MOD2_1015 1
+#define MOD2_1014 0
+#define MOD2_1013 1
+#define MOD2_1012 0
+#define MOD2_1011 1
+#define MOD2_1010 0
+#define MOD2_1009 1
+#define MOD2_1008 0
+#define MOD2_1007 1
+#define MOD2_1006 0
+#define MOD2_1005 1
+#define MOD2_1004 0
+#define MOD2_1003 1
+#define MOD2_1002 0
+#define MOD2_1001 1
+#define MOD2_1000 0
+#define MOD2_999 1
+#define MOD2_998 0
+#define MOD2_997 1
+#define MOD2_996 0
+#define MOD2_995 1
+#define MOD2_994 0
+#define MOD2_993 1
+#define MOD2_992 0
+#define MOD2_991 1
+#define MOD2_990 0
+#define MOD2_989 1
+#define MOD2_988 0
+#define MOD2_987 1
+#define MOD2_986 0
+#define MOD2_985 1
+#define MOD2_984 0
+#define MOD2_983 1
+#define MOD2_982 0
+#define MOD2_981 1
+#define MOD2_980 0
+#define MOD2_979 1
+#define MOD2_978 0
+#define MOD2_977 1
+#define MOD2_976 0
+#define MOD2_975 1
+#define MOD2_974 0
+#define MOD2_973 1
+#define MOD2_972 0
+#define MOD2_971 1
+#define MOD2_970 0
+#define MOD2_969 1
+#define MOD2_968 0
+#define MOD2_967 1
+#define MOD2_966 0
+#define MOD2_965 1
+#define MOD2_964 0
+#define MOD2_963 1
+#define MOD2_962 0
+#define MOD2_961 1
+#define MOD2_960 0
+#define MOD2_959 1
+#define MOD2_958 0
+#define MOD2_957 1
+#define MOD2_956 0
+#define MOD2_955 1
+#define MOD2_954 0
+#define MOD2_953 1
+#define MOD2_952 0
+#define MOD2_951 1
+#define MOD2_950 0
+#define MOD2_949 1
+#define MOD2_948 0
+#define MOD2_947 1
+#define MOD2_946 0
+#define MOD2_945 1
+#define MOD2_944 0
+#define MOD2_943 1
+#define MOD2_942 0
+#define MOD2_941 1
+#define MOD2_940 0
+#define MOD2_939 1
+#define MOD2_938 0
+#define MOD2_937 1
+#define MOD2_936 0
+#define MOD2_935 1
+#define MOD2_934 0
+#define MOD2_933 1
+#define MOD2_932 0
+#define MOD2_931 1
+#define MOD2_930 0
+#define MOD2_929 1
+#define MOD2_928 0
+#define MOD2_927 1
+#define MOD2_926 0
+#define MOD2_925 1
+#define MOD2_924 0
+#define MOD2_923 1
+#define MOD2_922 0
+#define MOD2_921 1
+#define MOD2_920 0
+#define MOD2_919 1
+#define MOD2_918 0
+#define MOD2_917 1
+#define MOD2_916 0
+#define MOD2_915 1
+#define MOD2_914 0
+#define MOD2_913 1
+#define MOD2_912 0
+#define MOD2_911 1
+#define MOD2_910 0
+#define MOD2_909 1
+#define MOD2_908 0
+#define MOD2_907 1
+#define MOD2_906 0
+#define MOD2_905 1
+#define MOD2_904 0
+#define MOD2_903 1
+#define MOD2_902 0
+#define MOD2_901 1
+#define MOD2_900 0
+#define MOD2_899 1
+#define MOD2_898 0
+#define MOD2_897 1
+#define MOD2_896 0
+#define MOD2_895 1
+#define MOD2_894 0
+#define MOD2_893 1
+#define MOD2_892 0
+#define MOD2_891 1
+#define MOD2_890 0
+#define MOD2_889 1
+#define MOD2_888 0
+#define MOD2_887 1
+#define MOD2_886 0
+#define MOD2_885 1
+#define MOD2_884 0
+#define MOD2_883 1
+#define MOD2_882 0
+#define MOD2_881 1
+#define MOD2_880 0
+#define MOD2_879 1
+#define MOD2_878 0
+#define MOD2_877 1
+#define MOD2_876 0
+#define MOD2_875 1
+#define MOD2_874 0
+#define MOD2_873 1
+#define MOD2_872 0
+#define MOD2_871 1
+#define MOD2_870 0
+#define MOD2_869 1
+#define MOD2_868 0
+#define MOD2_867 1
+#define MOD2_866 0
+#define MOD2_865 1
+#define MOD2_864 0
+#define MOD2_863 1
+#define MOD2_862 0
+#define MOD2_861 1
+#define MOD2_860 0
+#define MOD2_859 1
+#define MOD2_858 0
+#define MOD2_857 1
+#define MOD2_856 0
+#define MOD2_855 1
+#define MOD2_854 0
+#define MOD2_853 1
+#define MOD2_852 0
+#define MOD2_851 1
+#define MOD2_850 0
+#define MOD2_849 1
+#define MOD2_848 0
+#define MOD2_847 1
+#define MOD2_846 0
+#define MOD2_845 1
+#define MOD2_844 0
+#define MOD2_843 1
+#define MOD2_842 0
+#define MOD2_841 1
+#define MOD2_840 0
+#define MOD2_839 1
+#define MOD2_838 0
+#define MOD2_837 1
+#define MOD2_836 0
+#define MOD2_835 1
+#define MOD2_834 0
+#define MOD2_833 1
+#define MOD2_832 0
+#define MOD2_831 1
+#define MOD2_830 0
+#define MOD2_829 1
+#define MOD2_828 0
+#define MOD2_827 1
+#define MOD2_826 0
+#define MOD2_825 1
+#define MOD2_824 0
+#define MOD2_823 1
+#define MOD2_822 0
+#define MOD2_821 1
+#define MOD2_820 0
+#define MOD2_819 1
+#define MOD2_818 0
+#define MOD2_817 1
+#define MOD2_816 0
+#define MOD2_815 1
+#define MOD2_814 0
+#define MOD2_813 1
+#define MOD2_812 0
+#define MOD2_811 1
+#define MOD2_810 0
+#define MOD2_809 1
+#define MOD2_808 0
+#define MOD2_807 1
+#define MOD2_806 0
+#define MOD2_805 1
+#define MOD2_804 0
+#define MOD2_803 1
+#define MOD2_802 0
+#define MOD2_801 1
+#define MOD2_800 0
+#define MOD2_799 1
+#define MOD2_798 0
+#define MOD2_797 1
+#define MOD2_796 0
+#define MOD2_795 1
+#define MOD2_794 0
+#define MOD2_793 1
+#define MOD2_792 0
+#define MOD2_791 1
+#define MOD2_790 0
+#define MOD2_789 1
+#define MOD2_788 0
+#define MOD2_787 1
+#define MOD2_786 0
+#define MOD2_785 1
+#define MOD2_784 0
+#define MOD2_783 1
+#define MOD2_782 0
+#define MOD2_781 1
+#define MOD2_780 0
+#define MOD2_779 1
+#define MOD2_778 0
+#define MOD2_777 1
+#define MOD2_776 0
+#define MOD2_775 1
+#define MOD2_774 0
+#define MOD2_773 1
+#define MOD2_772 0
+#define MOD2_771 1
+#define MOD2_770 0
+#define MOD2_769 1
+#define MOD2_768 0
+#define MOD2_767 1
+#define MOD2_766 0
+#define MOD2_765 1
+#define MOD2_764 0
+#define MOD2_763 1
+#define MOD2_762 0
+#define MOD2_761 1
+#define MOD2_760 0
+#define MOD2_759 1
+#define MOD2_758 0
+#define MOD2_757 1
+#define MOD2_756 0
+#define MOD2_755 1
+#define MOD2_754 0
+#define MOD2_753 1
+#define MOD2_752 0
+#define MOD2_751 1
+#define MOD2_750 0
+#define MOD2_749 1
+#define MOD2_748 0
+#define MOD2_747 1
+#define MOD2_746 0
+#define MOD2_745 1
+#define MOD2_744 0
+#define MOD2_743 1
+#define MOD2_742 0
+#define MOD2_741 1
+#define MOD2_740 0
+#define MOD2_739 1
+#define MOD2_738 0
+#define MOD2_737 1
+#define MOD2_736 0
+#define MOD2_735 1
+#define MOD2_734 0
+#define MOD2_733 1
+#define MOD2_732 0
+#define MOD2_731 1
+#define MOD2_730 0
+#define MOD2_729 1
+#define MOD2_728 0
+#define MOD2_727 1
+#define MOD2_726 0
+#define MOD2_725 1
+#define MOD2_724 0
+#define MOD2_723 1
+#define MOD2_722 0
+#define MOD2_721 1
+#define MOD2_720 0
+#define MOD2_719 1
+#define MOD2_718 0
+#define MOD2_717 1
+#define MOD2_716 0
+#define MOD2_715 1
+#define MOD2_714 0
+#define MOD2_713 1
+#define MOD2_712 0
+#define MOD2_711 1
+#define MOD2_710 0
+#define MOD2_709 1
+#define MOD2_708 0
+#define MOD2_707 1
+#define MOD2_706 0
+#define MOD2_705 1
+#define MOD2_704 0
+#define MOD2_703 1
+#define MOD2_702 0
+#define MOD2_701 1
+#define MOD2_700 0
+#define MOD2_699 1
+#define MOD2_698 0
+#define MOD2_697 1
+#define MOD2_696 0
+#define MOD2_695 1
+#define MOD2_694 0
+#define MOD2_693 1
+#define MOD2_692 0
+#define MOD2_691 1
+#define MOD2_690 0
+#define MOD2_689 1
+#define MOD2_688 0
+#define MOD2_687 1
+#define MOD2_686 0
+#define MOD2_685 1
+#define MOD2_684 0
+#define MOD2_683 1
+#define MOD2_682 0
+#define MOD2_681 1
+#define MOD2_680 0
+#define MOD2_679 1
+#define MOD2_678 0
+#define MOD2_677 1
+#define MOD2_676 0
+#define MOD2_675 1
+#define MOD2_674 0
+#define MOD2_673 1
+#define MOD2_672 0
+#define MOD2_671 1
+#define MOD2_670 0
+#define MOD2_669 1
+#define MOD2_668 0
+#define MOD2_667 1
+#define MOD2_666 0
+#define MOD2_665 1
+#define MOD2_664 0
+#define MOD2_663 1
+#define MOD2_662 0
+#define MOD2_661 1
+#define MOD2_660 0
+#define MOD2_659 1
+#define MOD2_658 0
+#define MOD2_657 1
+#define MOD2_656 0
+#define MOD2_655 1
+#define MOD2_654 0
+#define MOD2_653 1
+#define MOD2_652 0
+#define MOD2_651 1
+#define MOD2_650 0
+#define MOD2_649 1
+#define MOD2_648 0
+#define MOD2_647 1
+#define MOD2_646 0
+#define MOD2_645 1
+#define MOD2_644 0
+#define MOD2_643 1
+#define MOD2_642 0
+#define MOD2_641 1
+#define MOD2_640 0
+#define MOD2_639 1
+#define MOD2_638 0
+#define MOD2_637 1
+#define MOD2_636 0
+#define MOD2_635 1
+#define MOD2_634 0
+#define MOD2_633 1
+#define MOD2_632 0
+#define MOD2_631 1
+#define MOD2_630 0
+#define MOD2_629 1
+#define MOD2_628 0
+#define MOD2_627 1
+#define MOD2_626 0
+#define MOD2_625 1
+#define MOD2_624 0
+#define MOD2_623 1
+#define MOD2_622 0
+#define MOD2_621 1
+#define MOD2_620 0
+#define MOD2_619 1
+#define MOD2_618 0
+#define MOD2_617 1
+#define MOD2_616 0
+#define MOD2_615 1
+#define MOD2_614 0
+#define MOD2_613 1
+#define MOD2_612 0
+#define MOD2_611 1
+#define MOD2_610 0
+#define MOD2_609 1
+#define MOD2_608 0
+#define MOD2_607 1
+#define MOD2_606 0
+#define MOD2_605 1
+#define MOD2_604 0
+#define MOD2_603 1
+#define MOD2_602 0
+#define MOD2_601 1
+#define MOD2_600 0
+#define MOD2_599 1
+#define MOD2_598 0
+#define MOD2_597 1
+#define MOD2_596 0
+#define MOD2_595 1
+#define MOD2_594 0
+#define MOD2_593 1
+#define MOD2_592 0
+#define MOD2_591 1
+#define MOD2_590 0
+#define MOD2_589 1
+#define MOD2_588 0
+#define MOD2_587 1
+#define MOD2_586 0
+#define MOD2_585 1
+#define MOD2_584 0
+#define MOD2_583 1
+#define MOD2_582 0
+#define MOD2_581 1
+#define MOD2_580 0
+#define MOD2_579 1
+#define MOD2_578 0
+#define MOD2_577 1
+#define MOD2_576 0
+#define MOD2_575 1
+#define MOD2_574 0
+#define MOD2_573 1
+#define MOD2_572 0
+#define MOD2_571 1
+#define MOD2_570 0
+#define MOD2_569 1
+#define MOD2_568 0
+#define MOD2_567 1
+#define MOD2_566 0
+#define MOD2_565 1
+#define MOD2_564 0
+#define MOD2_563 1
+#define MOD2_562 0
+#define MOD2_561 1
+#define MOD2_560 0
+#define MOD2_559 1
+#define MOD2_558 0
+#define MOD2_557 1
+#define MOD2_556 0
+#define MOD2_555 1
+#define MOD2_554 0
+#define MOD2_553 1
+#define MOD2_552 0
+#define MOD2_551 1
+#define MOD2_550 0
+#define MOD2_549 1
+#define MOD2_548 0
+#define MOD2_547 1
+#define MOD2_546 0
+#define MOD2_545 1
+#define MOD2_544 0
+#define MOD2_543 1
+#define MOD2_542 0
+#define MOD2_541 1
+#define MOD2_540 0
+#define MOD2_539 1
+#define MOD2_538 0
+#define MOD2_537 1
+#define MOD2_536 0
+#define MOD2_535 1
+#define MOD2_534 0
+#define MOD2_533 1
+#define MOD2_532 0
+#define MOD2_531 1
+#define MOD2_530 0
+#define MOD2_529 1
+#define MOD2_528 0
+#define MOD2_527 1
+#define MOD2_526 0
+#define MOD2_525 1
+#define MOD2_524 0
+#define MOD2_523 1
+#define MOD2_522 0
+#define MOD2_521 1
+#define MOD2_520 0
+#define MOD2_519 1
+#define MOD2_518 0
+#define MOD2_517 1
+#define MOD2_516 0
+#define MOD2_515 1
+#define MOD2_514 0
+#define MOD2_513 1
+#define MOD2_512 0
+#define MOD2_511 1
+#define MOD2_510 0
+#define MOD2_509 1
+#define MOD2_508 0
+#define MOD2_507 1
+#define MOD2_506 0
+#define MOD2_505 1
+#define MOD2_504 0
+#define MOD2_503 1
+#define MOD2_502 0
+#define MOD2_501 1
+#define MOD2_500 0
+#define MOD2_499 1
+#define MOD2_498 0
+#define MOD2_497 1
+#define MOD2_496 0
+#define MOD2_495 1
+#define MOD2_494 0
+#define MOD2_493 1
+#define MOD2_492 0
+#define MOD2_491 1
+#define MOD2_490 0
+#define MOD2_489 1
+#define MOD2_488 0
+#define MOD2_487 1
+#define MOD2_486 0
+#define MOD2_485 1
+#define MOD2_484 0
+#define MOD2_483 1
+#define MOD2_482 0
+#define MOD2_481 1
+#define MOD2_480 0
+#define MOD2_479 1
+#define MOD2_478 0
+#define MOD2_477 1
+#define MOD2_476 0
+#define MOD2_475 1
+#define MOD2_474 0
+#define MOD2_473 1
+#define MOD2_472 0
+#define MOD2_471 1
+#define MOD2_470 0
+#define MOD2_469 1
+#define MOD2_468 0
+#define MOD2_467 1
+#define MOD2_466 0
+#define MOD2_465 1
+#define MOD2_464 0
+#define MOD2_463 1
+#define MOD2_462 0
+#define MOD2_461 1
+#define MOD2_460 0
+#define MOD2_459 1
+#define MOD2_458 0
+#define MOD2_457 1
+#define MOD2_456 0
+#define MOD2_455 1
+#define MOD2_454 0
+#define MOD2_453 1
+#define MOD2_452 0
+#define MOD2_451 1
+#define MOD2_450 0
+#define MOD2_449 1
+#define MOD2_448 0
+#define MOD2_447 1
+#define MOD2_446 0
+#define MOD2_445 1
+#define MOD2_444 0
+#define MOD2_443 1
+#define MOD2_442 0
+#define MOD2_441 1
+#define MOD2_440 0
+#define MOD2_439 1
+#define MOD2_438 0
+#define MOD2_437 1
+#define MOD2_436 0
+#define MOD2_435 1
+#define MOD2_434 0
+#define MOD2_433 1
+#define MOD2_432 0
+#define MOD2_431 1
+#define MOD2_430 0
+#define MOD2_429 1
+#define MOD2_428 0
+#define MOD2_427 1
+#define MOD2_426 0
+#define MOD2_425 1
+#define MOD2_424 0
+#define MOD2_423 1
+#define MOD2_422 0
+#define MOD2_421 1
+#define MOD2_420 0
+#define MOD2_419 1
+#define MOD2_418 0
+#define MOD2_417 1
+#define MOD2_416 0
+#define MOD2_415 1
+#define MOD2_414 0
+#define MOD2_413 1
+#define MOD2_412 0
+#define MOD2_411 1
+#define MOD2_410 0
+#define MOD2_409 1
+#define MOD2_408 0
+#define MOD2_407 1
+#define MOD2_406 0
+#define MOD2_405 1
+#define MOD2_404 0
+#define MOD2_403 1
+#define MOD2_402 0
+#define MOD2_401 1
+#define MOD2_400 0
+#define MOD2_399 1
+#define MOD2_398 0
+#define MOD2_397 1
+#define MOD2_396 0
+#define MOD2_395 1
+#define MOD2_394 0
+#define MOD2_393 1
+#define MOD2_392 0
+#define MOD2_391 1
+#define MOD2_390 0
+#define MOD2_389 1
+#define MOD2_388 0
+#define MOD2_387 1
+#define MOD2_386 0
+#define MOD2_385 1
+#define MOD2_384 0
+#define MOD2_383 1
+#define MOD2_382 0
+#define MOD2_381 1
+#define MOD2_380 0
+#define MOD2_379 1
+#define MOD2_378 0
+#define MOD2_377 1
+#define MOD2_376 0
+#define MOD2_375 1
+#define MOD2_374 0
+#define MOD2_373 1
+#define MOD2_372 0
+#define MOD2_371 1
+#define MOD2_370 0
+#define MOD2_369 1
+#define MOD2_368 0
+#define MOD2_367 1
+#define MOD2_366 0
+#define MOD2_365 1
+#define MOD2_364 0
+#define MOD2_363 1
+#define MOD2_362 0
+#define MOD2_361 1
+#define MOD2_360 0
+#define MOD2_359 1
+#define MOD2_358 0
+#define MOD2_357 1
+#define MOD2_356 0
+#define MOD2_355 1
+#define MOD2_354 0
+#define MOD2_353 1
+#define MOD2_352 0
+#define MOD2_351 1
+#define MOD2_350 0
+#define MOD2_349 1
+#define MOD2_348 0
+#define MOD2_347 1
+#define MOD2_346 0
+#define MOD2_345 1
+#define MOD2_344 0
+#define MOD2_343 1
+#define MOD2_342 0
+#define MOD2_341 1
+#define MOD2_340 0
+#define MOD2_339 1
+#define MOD2_338 0
+#define MOD2_337 1
+#define MOD2_336 0
+#define MOD2_335 1
+#define MOD2_334 0
+#define MOD2_333 1
+#define MOD2_332 0
+#define MOD2_331 1
+#define MOD2_330 0
+#define MOD2_329 1
+#define MOD2_328 0
+#define MOD2_327 1
+#define MOD2_326 0
+#define MOD2_325 1
+#define MOD2_324 0
+#define MOD2_323 1
+#define MOD2_322 0
+#define MOD2_321 1
+#define MOD2_320 0
+#define MOD2_319 1
+#define MOD2_318 0
+#define MOD2_317 1
+#define MOD2_316 0
+#define MOD2_315 1
+#define MOD2_314 0
+#define MOD2_313 1
+#define MOD2_312 0
+#define MOD2_311 1
+#define MOD2_310 0
+#define MOD2_309 1
+#define MOD2_308 0
+#define MOD2_307 1
+#define MOD2_306 0
+#define MOD2_305 1
+#define MOD2_304 0
+#define MOD2_303 1
+#define MOD2_302 0
+#define MOD2_301 1
+#define MOD2_300 0
+#define MOD2_299 1
+#define MOD2_298 0
+#define MOD2_297 1
+#define MOD2_296 0
+#define MOD2_295 1
+#define MOD2_294 0
+#define MOD2_293 1
+#define MOD2_292 0
+#define MOD2_291 1
+#define MOD2_290 0
+#define MOD2_289 1
+#define MOD2_288 0
+#define MOD2_287 1
+#define MOD2_286 0
+#define MOD2_285 1
+#define MOD2_284 0
+#define MOD2_283 1
+#define MOD2_282 0
+#define MOD2_281 1
+#define MOD2_280 0
+#define MOD2_279 1
+#define MOD2_278 0
+#define MOD2_277 1
+#define MOD2_276 0
+#define MOD2_275 1
+#define MOD2_274 0
+#define MOD2_273 1
+#define MOD2_272 0
+#define MOD2_271 1
+#define MOD2_270 0
+#define MOD2_269 1
+#define MOD2_268 0
+#define MOD2_267 1
+#define MOD2_266 0
+#define MOD2_265 1
+#define MOD2_264 0
+#define MOD2_263 1
+#define MOD2_262 0
+#define MOD2_261 1
+#define MOD2_260 0
+#define MOD2_259 1
+#define MOD2_258 0
+#define MOD2_257 1
+#define MOD2_256 0
+#define MOD2_255 1
+#define MOD2_254 0
+#define MOD2_253 1
+#define MOD2_252 0
+#define MOD2_251 1
+#define MOD2_250 0
+#define MOD2_249 1
+#define MOD2_248 0
+#define MOD2_247 1
+#define MOD2_246 0
+#define MOD2_245 1
+#define MOD2_244 0
+#define MOD2_243 1
+#define MOD2_242 0
+#define MOD2_241 1
+#define MOD2_240 0
+#define MOD2_239 1
+#define MOD2_238 0
+#define MOD2_237 1
+#define MOD2_236 0
+#define MOD2_235 1
+#define MOD2_234 0
+#define MOD2_233 1
+#define MOD2_232 0
+#define MOD2_231 1
+#define MOD2_230 0
+#define MOD2_229 1
+#define MOD2_228 0
+#define MOD2_227 1
+#define MOD2_226 0
+#define MOD2_225 1
+#define MOD2_224 0
+#define MOD2_223 1
+#define MOD2_222 0
+#define MOD2_221 1
+#define MOD2_220 0
+#define MOD2_219 1
+#define MOD2_218 0
+#define MOD2_217 1
+#define MOD2_216 0
+#define MOD2_215 1
+#define MOD2_214 0
+#define MOD2_213 1
+#define MOD2_212 0
+#define MOD2_211 1
+#define MOD2_210 0
+#define MOD2_209 1
+#define MOD2_208 0
+#define MOD2_207 1
+#define MOD2_206 0
+#define MOD2_205 1
+#define MOD2_204 0
+#define MOD2_203 1
+#define MOD2_202 0
+#define MOD2_201 1
+#define MOD2_200 0
+#define MOD2_199 1
+#define MOD2_198 0
+#define MOD2_197 1
+#define MOD2_196 0
+#define MOD2_195 1
+#define MOD2_194 0
+#define MOD2_193 1
+#define MOD2_192 0
+#define MOD2_191 1
+#define MOD2_190 0
+#define MOD2_189 1
+#define MOD2_188 0
+#define MOD2_187 1
+#define MOD2_186 0
+#define MOD2_185 1
+#define MOD2_184 0
+#define MOD2_183 1
+#define MOD2_182 0
+#define MOD2_181 1
+#define MOD2_180 0
+#define MOD2_179 1
+#define MOD2_178 0
+#define MOD2_177 1
+#define MOD2_176 0
+#define MOD2_175 1
+#define MOD2_174 0
+#define MOD2_173 1
+#define MOD2_172 0
+#define MOD2_171 1
+#define MOD2_170 0
+#define MOD2_169 1
+#define MOD2_168 0
+#define MOD2_167 1
+#define MOD2_166 0
+#define MOD2_165 1
+#define MOD2_164 0
+#define MOD2_163 1
+#define MOD2_162 0
+#define MOD2_161 1
+#define MOD2_160 0
+#define MOD2_159 1
+#define MOD2_158 0
+#define MOD2_157 1
+#define MOD2_156 0
+#define MOD2_155 1
+#define MOD2_154 0
+#define MOD2_153 1
+#define MOD2_152 0
+#define MOD2_151 1
+#define MOD2_150 0
+#define MOD2_149 1
+#define MOD2_148 0
+#define MOD2_147 1
+#define MOD2_146 0
+#define MOD2_145 1
+#define MOD2_144 0
+#define MOD2_143 1
+#define MOD2_142 0
+#define MOD2_141 1
+#define MOD2_140 0
+#define MOD2_139 1
+#define MOD2_138 0
+#define MOD2_137 1
+#define MOD2_136 0
+#define MOD2_135 1
+#define MOD2_134 0
+#define MOD2_133 1
+#define MOD2_132 0
+#define MOD2_131 1
+#define MOD2_130 0
+#define MOD2_129 1
+#define MOD2_128 0
+#define MOD2_127 1
+#define MOD2_126 0
+#define MOD2_125 1
+#define MOD2_124 0
+#define MOD2_123 1
+#define MOD2_122 0
+#define MOD2_121 1
+#define MOD2_120 0
+#define MOD2_119 1
+#define MOD2_118 0
+#define MOD2_117 1
+#define MOD2_116 0
+#define MOD2_115 1
+#define MOD2_114 0
+#define MOD2_113 1
+#define MOD2_112 0
+#define MOD2_111 1
+#define MOD2_110 0
+#define MOD2_109 1
+#define MOD2_108 0
+#define MOD2_107 1
+#define MOD2_106 0
+#define MOD2_105 1
+#define MOD2_104 0
+#define MOD2_103 1
+#define MOD2_102 0
+#define MOD2_101 1
+#define MOD2_100 0
+#define MOD2_99 1
+#define MOD2_98 0
+#define MOD2_97 1
+#define MOD2_96 0
+#define MOD2_95 1
+#define MOD2_94 0
+#define MOD2_93 1
+#define MOD2_92 0
+#define MOD2_91 1
+#define MOD2_90 0
+#define MOD2_89 1
+#define MOD2_88 0
+#define MOD2_87 1
+#define MOD2_86 0
+#define MOD2_85 1
+#define MOD2_84 0
+#define MOD2_83 1
+#define MOD2_82 0
+#define MOD2_81 1
+#define MOD2_80 0
+#define MOD2_79 1
+#define MOD2_78 0
+#define MOD2_77 1
+#define MOD2_76 0
+#define MOD2_75 1
+#define MOD2_74 0
+#define MOD2_73 1
+#define MOD2_72 0
+#define MOD2_71 1
+#define MOD2_70 0
+#define MOD2_69 1
+#define MOD2_68 0
+#define MOD2_67 1
+#define MOD2_66 0
+#define MOD2_65 1
+#define MOD2_64 0
+#define MOD2_63 1
+#define MOD2_62 0
+#define MOD2_61 1
+#define MOD2_60 0
+#define MOD2_59 1
+#define MOD2_58 0
+#define MOD2_57 1
+#define MOD2_56 0
+#define MOD2_55 1
+#define MOD2_54 0
+#define MOD2_53 1
+#define MOD2_52 0
+#define MOD2_51 1
+#define MOD2_50 0
+#define MOD2_49 1
+#define MOD2_48 0
+#define MOD2_47 1
+#define MOD2_46 0
+#define MOD2_45 1
+#define MOD2_44 0
+#define MOD2_43 1
+#define MOD2_42 0
+#define MOD2_41 1
+#define MOD2_40 0
+#define MOD2_39 1
+#define MOD2_38 0
+#define MOD2_37 1
+#define MOD2_36 0
+#define MOD2_35 1
+#define MOD2_34 0
+#define MOD2_33 1
+#define MOD2_32 0
+#define MOD2_31 1
+#define MOD2_30 0
+#define MOD2_29 1
+#define MOD2_28 0
+#define MOD2_27 1
+#define MOD2_26 0
+#define MOD2_25 1
+#define MOD2_24 0
+#define MOD2_23 1
+#define MOD2_22 0
+#define MOD2_21 1
+#define MOD2_20 0
+#define MOD2_19 1
+#define MOD2_18 0
+#define MOD2_17 1
+#define MOD2_16 0
+#define MOD2_15 1
+#define MOD2_14 0
+#define MOD2_13 1
+#define MOD2_12 0
+#define MOD2_11 1
+#define MOD2_10 0
+#define MOD2_9 1
+#define MOD2_8 0
+#define MOD2_7 1
+#define MOD2_6 0
+#define MOD2_5 1
+#define MOD2_4 0
+#define MOD2_3 1
+#define MOD2_2 0
+#define MOD2_1 1
+#define MOD2_0 0
+
+#define THE_NTH_ARG(P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124,  ... ) P124
+
+#define _TRIGGER_PARENTHESIS_(...) ,
+
+#define LPAREN (
+
+#ifdef _MSC_VER
+#define COUNT_1_OR_MORE_ARG(...) THE_NTH_ARG LPAREN __VA_ARGS__, \
+123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1)
+#define MORE_THAN_1_ARG(...) THE_NTH_ARG LPAREN __VA_ARGS__, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0)
+#else
+#define COUNT_1_OR_MORE_ARG(...) THE_NTH_ARG (__VA_ARGS__, \
+123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1)
+#define MORE_THAN_1_ARG(...) THE_NTH_ARG(__VA_ARGS__, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 0)
+#endif
+
+#define COUNT_ARG(...) C2(COUNT_ARG_, ISEMPTY(__VA_ARGS__))(__VA_ARGS__)
+#define COUNT_ARG_1(...) 0
+#define COUNT_ARG_0(...) C1(COUNT_1_OR_MORE_ARG(__VA_ARGS__))
+
+#define ISEMPTY(...) C5(DISPTACH_EMPTY_, MORE_THAN_1_ARG(_TRIGGER_PARENTHESIS_ __VA_ARGS__ ()), MORE_THAN_1_ARG(__VA_ARGS__), MORE_THAN_1_ARG(__VA_ARGS__ ()), MORE_THAN_1_ARG(_TRIGGER_PARENTHESIS_ __VA_ARGS__))
+#define DISPTACH_EMPTY_1000 1
+#define DISPTACH_EMPTY_0000 0
+#define DISPTACH_EMPTY_1100 0
+#define DISPTACH_EMPTY_1111 0
+#define DISPTACH_EMPTY_1001 0
+#define DISPTACH_EMPTY_1010 0
+
+
+#define C2_(x,y) x##y
+
+#define C2(x,y) C2_(x,y)
+
+#define C3(x,y,z) C2(x, C2(y,z))
+
+#define C4(x,y,z, u) C2(C2(x,y), C2(z,u))
+
+#define C5(x,y,z,u, v) C2(C4(x,y, z, u), v)
+
+#define C1_(x) x
+
+#define C1(x) C1_(x)
+
+#define C2STRING(x,y) x y
+
+#define C3STRING(x,y,z) x y z
+
+#define C4STRING(x,y,z,u) x y z u
+
+#define C5STRING(x,y,z,u,v) x y z u v
+
+
+#define FOR_EACH_1_124(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124) \
+X(P1) \
+FOR_EACH_1_123(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124)
+
+#define FOR_EACH_1_123(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123) \
+X(P1) \
+FOR_EACH_1_122(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123)
+
+#define FOR_EACH_1_122(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122) \
+X(P1) \
+FOR_EACH_1_121(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122)
+
+#define FOR_EACH_1_121(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121) \
+X(P1) \
+FOR_EACH_1_120(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121)
+
+#define FOR_EACH_1_120(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120) \
+X(P1) \
+FOR_EACH_1_119(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120)
+
+#define FOR_EACH_1_119(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119) \
+X(P1) \
+FOR_EACH_1_118(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119)
+
+#define FOR_EACH_1_118(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118) \
+X(P1) \
+FOR_EACH_1_117(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118)
+
+#define FOR_EACH_1_117(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117) \
+X(P1) \
+FOR_EACH_1_116(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117)
+
+#define FOR_EACH_1_116(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116) \
+X(P1) \
+FOR_EACH_1_115(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116)
+
+#define FOR_EACH_1_115(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115) \
+X(P1) \
+FOR_EACH_1_114(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115)
+
+#define FOR_EACH_1_114(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114) \
+X(P1) \
+FOR_EACH_1_113(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114)
+
+#define FOR_EACH_1_113(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113) \
+X(P1) \
+FOR_EACH_1_112(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113)
+
+#define FOR_EACH_1_112(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112) \
+X(P1) \
+FOR_EACH_1_111(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112)
+
+#define FOR_EACH_1_111(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111) \
+X(P1) \
+FOR_EACH_1_110(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111)
+
+#define FOR_EACH_1_110(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110) \
+X(P1) \
+FOR_EACH_1_109(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110)
+
+#define FOR_EACH_1_109(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109) \
+X(P1) \
+FOR_EACH_1_108(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109)
+
+#define FOR_EACH_1_108(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108) \
+X(P1) \
+FOR_EACH_1_107(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108)
+
+#define FOR_EACH_1_107(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107) \
+X(P1) \
+FOR_EACH_1_106(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107)
+
+#define FOR_EACH_1_106(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106) \
+X(P1) \
+FOR_EACH_1_105(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106)
+
+#define FOR_EACH_1_105(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105) \
+X(P1) \
+FOR_EACH_1_104(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105)
+
+#define FOR_EACH_1_104(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104) \
+X(P1) \
+FOR_EACH_1_103(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104)
+
+#define FOR_EACH_1_103(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103) \
+X(P1) \
+FOR_EACH_1_102(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103)
+
+#define FOR_EACH_1_102(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102) \
+X(P1) \
+FOR_EACH_1_101(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102)
+
+#define FOR_EACH_1_101(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101) \
+X(P1) \
+FOR_EACH_1_100(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101)
+
+#define FOR_EACH_1_100(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100) \
+X(P1) \
+FOR_EACH_1_99(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100)
+
+#define FOR_EACH_1_99(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99) \
+X(P1) \
+FOR_EACH_1_98(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99)
+
+#define FOR_EACH_1_98(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98) \
+X(P1) \
+FOR_EACH_1_97(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98)
+
+#define FOR_EACH_1_97(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97) \
+X(P1) \
+FOR_EACH_1_96(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97)
+
+#define FOR_EACH_1_96(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96) \
+X(P1) \
+FOR_EACH_1_95(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96)
+
+#define FOR_EACH_1_95(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95) \
+X(P1) \
+FOR_EACH_1_94(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95)
+
+#define FOR_EACH_1_94(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94) \
+X(P1) \
+FOR_EACH_1_93(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94)
+
+#define FOR_EACH_1_93(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93) \
+X(P1) \
+FOR_EACH_1_92(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93)
+
+#define FOR_EACH_1_92(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92) \
+X(P1) \
+FOR_EACH_1_91(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92)
+
+#define FOR_EACH_1_91(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91) \
+X(P1) \
+FOR_EACH_1_90(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91)
+
+#define FOR_EACH_1_90(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90) \
+X(P1) \
+FOR_EACH_1_89(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90)
+
+#define FOR_EACH_1_89(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89) \
+X(P1) \
+FOR_EACH_1_88(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89)
+
+#define FOR_EACH_1_88(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88) \
+X(P1) \
+FOR_EACH_1_87(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88)
+
+#define FOR_EACH_1_87(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87) \
+X(P1) \
+FOR_EACH_1_86(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87)
+
+#define FOR_EACH_1_86(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86) \
+X(P1) \
+FOR_EACH_1_85(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86)
+
+#define FOR_EACH_1_85(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85) \
+X(P1) \
+FOR_EACH_1_84(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85)
+
+#define FOR_EACH_1_84(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84) \
+X(P1) \
+FOR_EACH_1_83(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84)
+
+#define FOR_EACH_1_83(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83) \
+X(P1) \
+FOR_EACH_1_82(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83)
+
+#define FOR_EACH_1_82(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82) \
+X(P1) \
+FOR_EACH_1_81(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82)
+
+#define FOR_EACH_1_81(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81) \
+X(P1) \
+FOR_EACH_1_80(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81)
+
+#define FOR_EACH_1_80(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80) \
+X(P1) \
+FOR_EACH_1_79(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80)
+
+#define FOR_EACH_1_79(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79) \
+X(P1) \
+FOR_EACH_1_78(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79)
+
+#define FOR_EACH_1_78(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78) \
+X(P1) \
+FOR_EACH_1_77(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78)
+
+#define FOR_EACH_1_77(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77) \
+X(P1) \
+FOR_EACH_1_76(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77)
+
+#define FOR_EACH_1_76(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76) \
+X(P1) \
+FOR_EACH_1_75(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76)
+
+#define FOR_EACH_1_75(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75) \
+X(P1) \
+FOR_EACH_1_74(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75)
+
+#define FOR_EACH_1_74(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74) \
+X(P1) \
+FOR_EACH_1_73(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74)
+
+#define FOR_EACH_1_73(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73) \
+X(P1) \
+FOR_EACH_1_72(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73)
+
+#define FOR_EACH_1_72(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72) \
+X(P1) \
+FOR_EACH_1_71(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72)
+
+#define FOR_EACH_1_71(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71) \
+X(P1) \
+FOR_EACH_1_70(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71)
+
+#define FOR_EACH_1_70(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70) \
+X(P1) \
+FOR_EACH_1_69(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70)
+
+#define FOR_EACH_1_69(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69) \
+X(P1) \
+FOR_EACH_1_68(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69)
+
+#define FOR_EACH_1_68(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68) \
+X(P1) \
+FOR_EACH_1_67(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68)
+
+#define FOR_EACH_1_67(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67) \
+X(P1) \
+FOR_EACH_1_66(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67)
+
+#define FOR_EACH_1_66(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66) \
+X(P1) \
+FOR_EACH_1_65(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66)
+
+#define FOR_EACH_1_65(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65) \
+X(P1) \
+FOR_EACH_1_64(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65)
+
+#define FOR_EACH_1_64(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64) \
+X(P1) \
+FOR_EACH_1_63(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64)
+
+#define FOR_EACH_1_63(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63) \
+X(P1) \
+FOR_EACH_1_62(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63)
+
+#define FOR_EACH_1_62(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62) \
+X(P1) \
+FOR_EACH_1_61(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62)
+
+#define FOR_EACH_1_61(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61) \
+X(P1) \
+FOR_EACH_1_60(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61)
+
+#define FOR_EACH_1_60(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60) \
+X(P1) \
+FOR_EACH_1_59(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60)
+
+#define FOR_EACH_1_59(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59) \
+X(P1) \
+FOR_EACH_1_58(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59)
+
+#define FOR_EACH_1_58(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58) \
+X(P1) \
+FOR_EACH_1_57(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58)
+
+#define FOR_EACH_1_57(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57) \
+X(P1) \
+FOR_EACH_1_56(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57)
+
+#define FOR_EACH_1_56(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56) \
+X(P1) \
+FOR_EACH_1_55(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56)
+
+#define FOR_EACH_1_55(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55) \
+X(P1) \
+FOR_EACH_1_54(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55)
+
+#define FOR_EACH_1_54(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54) \
+X(P1) \
+FOR_EACH_1_53(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54)
+
+#define FOR_EACH_1_53(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53) \
+X(P1) \
+FOR_EACH_1_52(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53)
+
+#define FOR_EACH_1_52(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52) \
+X(P1) \
+FOR_EACH_1_51(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52)
+
+#define FOR_EACH_1_51(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51) \
+X(P1) \
+FOR_EACH_1_50(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51)
+
+#define FOR_EACH_1_50(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50) \
+X(P1) \
+FOR_EACH_1_49(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50)
+
+#define FOR_EACH_1_49(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49) \
+X(P1) \
+FOR_EACH_1_48(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49)
+
+#define FOR_EACH_1_48(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48) \
+X(P1) \
+FOR_EACH_1_47(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48)
+
+#define FOR_EACH_1_47(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47) \
+X(P1) \
+FOR_EACH_1_46(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47)
+
+#define FOR_EACH_1_46(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46) \
+X(P1) \
+FOR_EACH_1_45(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46)
+
+#define FOR_EACH_1_45(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45) \
+X(P1) \
+FOR_EACH_1_44(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45)
+
+#define FOR_EACH_1_44(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44) \
+X(P1) \
+FOR_EACH_1_43(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44)
+
+#define FOR_EACH_1_43(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43) \
+X(P1) \
+FOR_EACH_1_42(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43)
+
+#define FOR_EACH_1_42(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42) \
+X(P1) \
+FOR_EACH_1_41(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42)
+
+#define FOR_EACH_1_41(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41) \
+X(P1) \
+FOR_EACH_1_40(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41)
+
+#define FOR_EACH_1_40(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40) \
+X(P1) \
+FOR_EACH_1_39(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40)
+
+#define FOR_EACH_1_39(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39) \
+X(P1) \
+FOR_EACH_1_38(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39)
+
+#define FOR_EACH_1_38(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38) \
+X(P1) \
+FOR_EACH_1_37(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38)
+
+#define FOR_EACH_1_37(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37) \
+X(P1) \
+FOR_EACH_1_36(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37)
+
+#define FOR_EACH_1_36(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36) \
+X(P1) \
+FOR_EACH_1_35(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36)
+
+#define FOR_EACH_1_35(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35) \
+X(P1) \
+FOR_EACH_1_34(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35)
+
+#define FOR_EACH_1_34(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34) \
+X(P1) \
+FOR_EACH_1_33(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34)
+
+#define FOR_EACH_1_33(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33) \
+X(P1) \
+FOR_EACH_1_32(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33)
+
+#define FOR_EACH_1_32(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32) \
+X(P1) \
+FOR_EACH_1_31(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32)
+
+#define FOR_EACH_1_31(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31) \
+X(P1) \
+FOR_EACH_1_30(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31)
+
+#define FOR_EACH_1_30(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30) \
+X(P1) \
+FOR_EACH_1_29(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30)
+
+#define FOR_EACH_1_29(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29) \
+X(P1) \
+FOR_EACH_1_28(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29)
+
+#define FOR_EACH_1_28(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28) \
+X(P1) \
+FOR_EACH_1_27(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28)
+
+#define FOR_EACH_1_27(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27) \
+X(P1) \
+FOR_EACH_1_26(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27)
+
+#define FOR_EACH_1_26(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26) \
+X(P1) \
+FOR_EACH_1_25(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26)
+
+#define FOR_EACH_1_25(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25) \
+X(P1) \
+FOR_EACH_1_24(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25)
+
+#define FOR_EACH_1_24(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24) \
+X(P1) \
+FOR_EACH_1_23(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24)
+
+#define FOR_EACH_1_23(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23) \
+X(P1) \
+FOR_EACH_1_22(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23)
+
+#define FOR_EACH_1_22(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22) \
+X(P1) \
+FOR_EACH_1_21(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22)
+
+#define FOR_EACH_1_21(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21) \
+X(P1) \
+FOR_EACH_1_20(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21)
+
+#define FOR_EACH_1_20(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20) \
+X(P1) \
+FOR_EACH_1_19(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20)
+
+#define FOR_EACH_1_19(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19) \
+X(P1) \
+FOR_EACH_1_18(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19)
+
+#define FOR_EACH_1_18(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18) \
+X(P1) \
+FOR_EACH_1_17(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18)
+
+#define FOR_EACH_1_17(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17) \
+X(P1) \
+FOR_EACH_1_16(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17)
+
+#define FOR_EACH_1_16(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16) \
+X(P1) \
+FOR_EACH_1_15(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16)
+
+#define FOR_EACH_1_15(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15) \
+X(P1) \
+FOR_EACH_1_14(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15)
+
+#define FOR_EACH_1_14(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14) \
+X(P1) \
+FOR_EACH_1_13(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14)
+
+#define FOR_EACH_1_13(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13) \
+X(P1) \
+FOR_EACH_1_12(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13)
+
+#define FOR_EACH_1_12(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12) \
+X(P1) \
+FOR_EACH_1_11(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12)
+
+#define FOR_EACH_1_11(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11) \
+X(P1) \
+FOR_EACH_1_10(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11)
+
+#define FOR_EACH_1_10(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10) \
+X(P1) \
+FOR_EACH_1_9(X, P2, P3, P4, P5, P6, P7, P8, P9, P10)
+
+#define FOR_EACH_1_9(X, P1, P2, P3, P4, P5, P6, P7, P8, P9) \
+X(P1) \
+FOR_EACH_1_8(X, P2, P3, P4, P5, P6, P7, P8, P9)
+
+#define FOR_EACH_1_8(X, P1, P2, P3, P4, P5, P6, P7, P8) \
+X(P1) \
+FOR_EACH_1_7(X, P2, P3, P4, P5, P6, P7, P8)
+
+#define FOR_EACH_1_7(X, P1, P2, P3, P4, P5, P6, P7) \
+X(P1) \
+FOR_EACH_1_6(X, P2, P3, P4, P5, P6, P7)
+
+#define FOR_EACH_1_6(X, P1, P2, P3, P4, P5, P6) \
+X(P1) \
+FOR_EACH_1_5(X, P2, P3, P4, P5, P6)
+
+#define FOR_EACH_1_5(X, P1, P2, P3, P4, P5) \
+X(P1) \
+FOR_EACH_1_4(X, P2, P3, P4, P5)
+
+#define FOR_EACH_1_4(X, P1, P2, P3, P4) \
+X(P1) \
+FOR_EACH_1_3(X, P2, P3, P4)
+
+#define FOR_EACH_1_3(X, P1, P2, P3) \
+X(P1) \
+FOR_EACH_1_2(X, P2, P3)
+
+#define FOR_EACH_1_2(X, P1, P2) \
+X(P1) \
+FOR_EACH_1_1(X, P2)
+
+#define FOR_EACH_1_1(X, P1) \
+X(P1)
+
+#ifdef _MSC_VER
+#define FOR_EACH_1(MACRO_TO_INVOKE, ...) C2(FOR_EACH_1_,C1(COUNT_ARG(__VA_ARGS__))) LPAREN MACRO_TO_INVOKE, __VA_ARGS__)
+#else
+#define FOR_EACH_1(MACRO_TO_INVOKE, ...) C2(FOR_EACH_1_,C1(COUNT_ARG(__VA_ARGS__))) ( MACRO_TO_INVOKE, __VA_ARGS__)
+#endif
+
+#define FOR_EACH_1_KEEP_1_124(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_123(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124)
+
+
+#define FOR_EACH_1_KEEP_1_123(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_122(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123)
+
+
+#define FOR_EACH_1_KEEP_1_122(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_121(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122)
+
+
+#define FOR_EACH_1_KEEP_1_121(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_120(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121)
+
+
+#define FOR_EACH_1_KEEP_1_120(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_119(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120)
+
+
+#define FOR_EACH_1_KEEP_1_119(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_118(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119)
+
+
+#define FOR_EACH_1_KEEP_1_118(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_117(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118)
+
+
+#define FOR_EACH_1_KEEP_1_117(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_116(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117)
+
+
+#define FOR_EACH_1_KEEP_1_116(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_115(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116)
+
+
+#define FOR_EACH_1_KEEP_1_115(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_114(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115)
+
+
+#define FOR_EACH_1_KEEP_1_114(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_113(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114)
+
+
+#define FOR_EACH_1_KEEP_1_113(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_112(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113)
+
+
+#define FOR_EACH_1_KEEP_1_112(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_111(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112)
+
+
+#define FOR_EACH_1_KEEP_1_111(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_110(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111)
+
+
+#define FOR_EACH_1_KEEP_1_110(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_109(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110)
+
+
+#define FOR_EACH_1_KEEP_1_109(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_108(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109)
+
+
+#define FOR_EACH_1_KEEP_1_108(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_107(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108)
+
+
+#define FOR_EACH_1_KEEP_1_107(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_106(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107)
+
+
+#define FOR_EACH_1_KEEP_1_106(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_105(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106)
+
+
+#define FOR_EACH_1_KEEP_1_105(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_104(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105)
+
+
+#define FOR_EACH_1_KEEP_1_104(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_103(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104)
+
+
+#define FOR_EACH_1_KEEP_1_103(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_102(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103)
+
+
+#define FOR_EACH_1_KEEP_1_102(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_101(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102)
+
+
+#define FOR_EACH_1_KEEP_1_101(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_100(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101)
+
+
+#define FOR_EACH_1_KEEP_1_100(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_99(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100)
+
+
+#define FOR_EACH_1_KEEP_1_99(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_98(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99)
+
+
+#define FOR_EACH_1_KEEP_1_98(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_97(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98)
+
+
+#define FOR_EACH_1_KEEP_1_97(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_96(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97)
+
+
+#define FOR_EACH_1_KEEP_1_96(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_95(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96)
+
+
+#define FOR_EACH_1_KEEP_1_95(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_94(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95)
+
+
+#define FOR_EACH_1_KEEP_1_94(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_93(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94)
+
+
+#define FOR_EACH_1_KEEP_1_93(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_92(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93)
+
+
+#define FOR_EACH_1_KEEP_1_92(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_91(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92)
+
+
+#define FOR_EACH_1_KEEP_1_91(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_90(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91)
+
+
+#define FOR_EACH_1_KEEP_1_90(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_89(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90)
+
+
+#define FOR_EACH_1_KEEP_1_89(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_88(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89)
+
+
+#define FOR_EACH_1_KEEP_1_88(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_87(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88)
+
+
+#define FOR_EACH_1_KEEP_1_87(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_86(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87)
+
+
+#define FOR_EACH_1_KEEP_1_86(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_85(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86)
+
+
+#define FOR_EACH_1_KEEP_1_85(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_84(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85)
+
+
+#define FOR_EACH_1_KEEP_1_84(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_83(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84)
+
+
+#define FOR_EACH_1_KEEP_1_83(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_82(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83)
+
+
+#define FOR_EACH_1_KEEP_1_82(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_81(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82)
+
+
+#define FOR_EACH_1_KEEP_1_81(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_80(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81)
+
+
+#define FOR_EACH_1_KEEP_1_80(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_79(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80)
+
+
+#define FOR_EACH_1_KEEP_1_79(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_78(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79)
+
+
+#define FOR_EACH_1_KEEP_1_78(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_77(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78)
+
+
+#define FOR_EACH_1_KEEP_1_77(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_76(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77)
+
+
+#define FOR_EACH_1_KEEP_1_76(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_75(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76)
+
+
+#define FOR_EACH_1_KEEP_1_75(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_74(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75)
+
+
+#define FOR_EACH_1_KEEP_1_74(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_73(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74)
+
+
+#define FOR_EACH_1_KEEP_1_73(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_72(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73)
+
+
+#define FOR_EACH_1_KEEP_1_72(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_71(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72)
+
+
+#define FOR_EACH_1_KEEP_1_71(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_70(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71)
+
+
+#define FOR_EACH_1_KEEP_1_70(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_69(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70)
+
+
+#define FOR_EACH_1_KEEP_1_69(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_68(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69)
+
+
+#define FOR_EACH_1_KEEP_1_68(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_67(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68)
+
+
+#define FOR_EACH_1_KEEP_1_67(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_66(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67)
+
+
+#define FOR_EACH_1_KEEP_1_66(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_65(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66)
+
+
+#define FOR_EACH_1_KEEP_1_65(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_64(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65)
+
+
+#define FOR_EACH_1_KEEP_1_64(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_63(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64)
+
+
+#define FOR_EACH_1_KEEP_1_63(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_62(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63)
+
+
+#define FOR_EACH_1_KEEP_1_62(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_61(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62)
+
+
+#define FOR_EACH_1_KEEP_1_61(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_60(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61)
+
+
+#define FOR_EACH_1_KEEP_1_60(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_59(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60)
+
+
+#define FOR_EACH_1_KEEP_1_59(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_58(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59)
+
+
+#define FOR_EACH_1_KEEP_1_58(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_57(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58)
+
+
+#define FOR_EACH_1_KEEP_1_57(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_56(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57)
+
+
+#define FOR_EACH_1_KEEP_1_56(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_55(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56)
+
+
+#define FOR_EACH_1_KEEP_1_55(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_54(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55)
+
+
+#define FOR_EACH_1_KEEP_1_54(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_53(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54)
+
+
+#define FOR_EACH_1_KEEP_1_53(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_52(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53)
+
+
+#define FOR_EACH_1_KEEP_1_52(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_51(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52)
+
+
+#define FOR_EACH_1_KEEP_1_51(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_50(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51)
+
+
+#define FOR_EACH_1_KEEP_1_50(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_49(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50)
+
+
+#define FOR_EACH_1_KEEP_1_49(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_48(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49)
+
+
+#define FOR_EACH_1_KEEP_1_48(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_47(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48)
+
+
+#define FOR_EACH_1_KEEP_1_47(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_46(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47)
+
+
+#define FOR_EACH_1_KEEP_1_46(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_45(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46)
+
+
+#define FOR_EACH_1_KEEP_1_45(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_44(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45)
+
+
+#define FOR_EACH_1_KEEP_1_44(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_43(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44)
+
+
+#define FOR_EACH_1_KEEP_1_43(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_42(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43)
+
+
+#define FOR_EACH_1_KEEP_1_42(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_41(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42)
+
+
+#define FOR_EACH_1_KEEP_1_41(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_40(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41)
+
+
+#define FOR_EACH_1_KEEP_1_40(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_39(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40)
+
+
+#define FOR_EACH_1_KEEP_1_39(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_38(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39)
+
+
+#define FOR_EACH_1_KEEP_1_38(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_37(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38)
+
+
+#define FOR_EACH_1_KEEP_1_37(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_36(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37)
+
+
+#define FOR_EACH_1_KEEP_1_36(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_35(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36)
+
+
+#define FOR_EACH_1_KEEP_1_35(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_34(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35)
+
+
+#define FOR_EACH_1_KEEP_1_34(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_33(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34)
+
+
+#define FOR_EACH_1_KEEP_1_33(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_32(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33)
+
+
+#define FOR_EACH_1_KEEP_1_32(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_31(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32)
+
+
+#define FOR_EACH_1_KEEP_1_31(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_30(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31)
+
+
+#define FOR_EACH_1_KEEP_1_30(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_29(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30)
+
+
+#define FOR_EACH_1_KEEP_1_29(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_28(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29)
+
+
+#define FOR_EACH_1_KEEP_1_28(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_27(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28)
+
+
+#define FOR_EACH_1_KEEP_1_27(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_26(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27)
+
+
+#define FOR_EACH_1_KEEP_1_26(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_25(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26)
+
+
+#define FOR_EACH_1_KEEP_1_25(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_24(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25)
+
+
+#define FOR_EACH_1_KEEP_1_24(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_23(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24)
+
+
+#define FOR_EACH_1_KEEP_1_23(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_22(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23)
+
+
+#define FOR_EACH_1_KEEP_1_22(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_21(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22)
+
+
+#define FOR_EACH_1_KEEP_1_21(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_20(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21)
+
+
+#define FOR_EACH_1_KEEP_1_20(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_19(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20)
+
+
+#define FOR_EACH_1_KEEP_1_19(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_18(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19)
+
+
+#define FOR_EACH_1_KEEP_1_18(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_17(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18)
+
+
+#define FOR_EACH_1_KEEP_1_17(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_16(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17)
+
+
+#define FOR_EACH_1_KEEP_1_16(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_15(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16)
+
+
+#define FOR_EACH_1_KEEP_1_15(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_14(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15)
+
+
+#define FOR_EACH_1_KEEP_1_14(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_13(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14)
+
+
+#define FOR_EACH_1_KEEP_1_13(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_12(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13)
+
+
+#define FOR_EACH_1_KEEP_1_12(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_11(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12)
+
+
+#define FOR_EACH_1_KEEP_1_11(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_10(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11)
+
+
+#define FOR_EACH_1_KEEP_1_10(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_9(X, keep, P2, P3, P4, P5, P6, P7, P8, P9, P10)
+
+
+#define FOR_EACH_1_KEEP_1_9(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_8(X, keep, P2, P3, P4, P5, P6, P7, P8, P9)
+
+
+#define FOR_EACH_1_KEEP_1_8(X, keep, P1, P2, P3, P4, P5, P6, P7, P8) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_7(X, keep, P2, P3, P4, P5, P6, P7, P8)
+
+
+#define FOR_EACH_1_KEEP_1_7(X, keep, P1, P2, P3, P4, P5, P6, P7) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_6(X, keep, P2, P3, P4, P5, P6, P7)
+
+
+#define FOR_EACH_1_KEEP_1_6(X, keep, P1, P2, P3, P4, P5, P6) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_5(X, keep, P2, P3, P4, P5, P6)
+
+
+#define FOR_EACH_1_KEEP_1_5(X, keep, P1, P2, P3, P4, P5) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_4(X, keep, P2, P3, P4, P5)
+
+
+#define FOR_EACH_1_KEEP_1_4(X, keep, P1, P2, P3, P4) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_3(X, keep, P2, P3, P4)
+
+
+#define FOR_EACH_1_KEEP_1_3(X, keep, P1, P2, P3) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_2(X, keep, P2, P3)
+
+
+#define FOR_EACH_1_KEEP_1_2(X, keep, P1, P2) \
+X(keep, P1) \
+FOR_EACH_1_KEEP_1_1(X, keep, P2)
+
+
+
+#define FOR_EACH_1_KEEP_1_1(X, keep, P1) \
+X(keep, P1)
+
+#ifdef _MSC_VER
+#define FOR_EACH_1_KEEP_1(MACRO_TO_INVOKE, ...) C2(FOR_EACH_1_KEEP_1_, C2(DEC,C1(COUNT_ARG(__VA_ARGS__)))) LPAREN MACRO_TO_INVOKE, __VA_ARGS__)
+#else
+#define FOR_EACH_1_KEEP_1(MACRO_TO_INVOKE, ...) C2(FOR_EACH_1_KEEP_1_, C2(DEC,C1(COUNT_ARG(__VA_ARGS__)))) ( MACRO_TO_INVOKE, __VA_ARGS__)
+#endif
+
+#define FOR_EACH_2_KEEP_1_124(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_122(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124)
+
+
+#define FOR_EACH_2_KEEP_1_122(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_120(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122)
+
+
+#define FOR_EACH_2_KEEP_1_120(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_118(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120)
+
+
+#define FOR_EACH_2_KEEP_1_118(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_116(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118)
+
+
+#define FOR_EACH_2_KEEP_1_116(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_114(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116)
+
+
+#define FOR_EACH_2_KEEP_1_114(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_112(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114)
+
+
+#define FOR_EACH_2_KEEP_1_112(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_110(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112)
+
+
+#define FOR_EACH_2_KEEP_1_110(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_108(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110)
+
+
+#define FOR_EACH_2_KEEP_1_108(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_106(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108)
+
+
+#define FOR_EACH_2_KEEP_1_106(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_104(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106)
+
+
+#define FOR_EACH_2_KEEP_1_104(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_102(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104)
+
+
+#define FOR_EACH_2_KEEP_1_102(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_100(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102)
+
+
+#define FOR_EACH_2_KEEP_1_100(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_98(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100)
+
+
+#define FOR_EACH_2_KEEP_1_98(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_96(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98)
+
+
+#define FOR_EACH_2_KEEP_1_96(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_94(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96)
+
+
+#define FOR_EACH_2_KEEP_1_94(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_92(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94)
+
+
+#define FOR_EACH_2_KEEP_1_92(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_90(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92)
+
+
+#define FOR_EACH_2_KEEP_1_90(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_88(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90)
+
+
+#define FOR_EACH_2_KEEP_1_88(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_86(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88)
+
+
+#define FOR_EACH_2_KEEP_1_86(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_84(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86)
+
+
+#define FOR_EACH_2_KEEP_1_84(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_82(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84)
+
+
+#define FOR_EACH_2_KEEP_1_82(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_80(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82)
+
+
+#define FOR_EACH_2_KEEP_1_80(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_78(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80)
+
+
+#define FOR_EACH_2_KEEP_1_78(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_76(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78)
+
+
+#define FOR_EACH_2_KEEP_1_76(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_74(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76)
+
+
+#define FOR_EACH_2_KEEP_1_74(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_72(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74)
+
+
+#define FOR_EACH_2_KEEP_1_72(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_70(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72)
+
+
+#define FOR_EACH_2_KEEP_1_70(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_68(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70)
+
+
+#define FOR_EACH_2_KEEP_1_68(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_66(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68)
+
+
+#define FOR_EACH_2_KEEP_1_66(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_64(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66)
+
+
+#define FOR_EACH_2_KEEP_1_64(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_62(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64)
+
+
+#define FOR_EACH_2_KEEP_1_62(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_60(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62)
+
+
+#define FOR_EACH_2_KEEP_1_60(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_58(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60)
+
+
+#define FOR_EACH_2_KEEP_1_58(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_56(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58)
+
+
+#define FOR_EACH_2_KEEP_1_56(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_54(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56)
+
+
+#define FOR_EACH_2_KEEP_1_54(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_52(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54)
+
+
+#define FOR_EACH_2_KEEP_1_52(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_50(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52)
+
+
+#define FOR_EACH_2_KEEP_1_50(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_48(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50)
+
+
+#define FOR_EACH_2_KEEP_1_48(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_46(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48)
+
+
+#define FOR_EACH_2_KEEP_1_46(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_44(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46)
+
+
+#define FOR_EACH_2_KEEP_1_44(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_42(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44)
+
+
+#define FOR_EACH_2_KEEP_1_42(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_40(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42)
+
+
+#define FOR_EACH_2_KEEP_1_40(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_38(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40)
+
+
+#define FOR_EACH_2_KEEP_1_38(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_36(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38)
+
+
+#define FOR_EACH_2_KEEP_1_36(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_34(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36)
+
+
+#define FOR_EACH_2_KEEP_1_34(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_32(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34)
+
+
+#define FOR_EACH_2_KEEP_1_32(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_30(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32)
+
+
+#define FOR_EACH_2_KEEP_1_30(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_28(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30)
+
+
+#define FOR_EACH_2_KEEP_1_28(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_26(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28)
+
+
+#define FOR_EACH_2_KEEP_1_26(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_24(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26)
+
+
+#define FOR_EACH_2_KEEP_1_24(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_22(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24)
+
+
+#define FOR_EACH_2_KEEP_1_22(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_20(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22)
+
+
+#define FOR_EACH_2_KEEP_1_20(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_18(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20)
+
+
+#define FOR_EACH_2_KEEP_1_18(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_16(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18)
+
+
+#define FOR_EACH_2_KEEP_1_16(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_14(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16)
+
+
+#define FOR_EACH_2_KEEP_1_14(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_12(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14)
+
+
+#define FOR_EACH_2_KEEP_1_12(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_10(X, keep, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12)
+
+
+#define FOR_EACH_2_KEEP_1_10(X, keep, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_8(X, keep, P3, P4, P5, P6, P7, P8, P9, P10)
+
+
+#define FOR_EACH_2_KEEP_1_8(X, keep, P1, P2, P3, P4, P5, P6, P7, P8) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_6(X, keep, P3, P4, P5, P6, P7, P8)
+
+
+#define FOR_EACH_2_KEEP_1_6(X, keep, P1, P2, P3, P4, P5, P6) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_4(X, keep, P3, P4, P5, P6)
+
+
+#define FOR_EACH_2_KEEP_1_4(X, keep, P1, P2, P3, P4) \
+X(keep, P1, P2) \
+FOR_EACH_2_KEEP_1_2(X, keep, P3, P4)
+
+
+
+#define FOR_EACH_2_KEEP_1_1(...)
+
+#define FOR_EACH_2_KEEP_1_0(...)
+
+#define FOR_EACH_2_KEEP_1_2(X, keep, P1, P2) \
+    X(keep, P1, P2) \
+
+#ifdef _MSC_VER
+#define FOR_EACH_2_KEEP_1(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_KEEP_1_, C2(DEC,C1(COUNT_ARG(__VA_ARGS__)))) LPAREN MACRO_TO_INVOKE, __VA_ARGS__)
+#else
+#define FOR_EACH_2_KEEP_1(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_KEEP_1_, C2(DEC,C1(COUNT_ARG(__VA_ARGS__)))) ( MACRO_TO_INVOKE, __VA_ARGS__)
+#endif
+
+
+#define FOR_EACH_2_KEEP_2_124(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_122(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124)
+
+
+#define FOR_EACH_2_KEEP_2_122(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_120(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122)
+
+
+#define FOR_EACH_2_KEEP_2_120(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_118(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120)
+
+
+#define FOR_EACH_2_KEEP_2_118(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_116(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118)
+
+
+#define FOR_EACH_2_KEEP_2_116(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_114(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116)
+
+
+#define FOR_EACH_2_KEEP_2_114(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_112(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114)
+
+
+#define FOR_EACH_2_KEEP_2_112(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_110(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112)
+
+
+#define FOR_EACH_2_KEEP_2_110(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_108(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110)
+
+
+#define FOR_EACH_2_KEEP_2_108(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_106(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108)
+
+
+#define FOR_EACH_2_KEEP_2_106(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_104(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106)
+
+
+#define FOR_EACH_2_KEEP_2_104(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_102(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104)
+
+
+#define FOR_EACH_2_KEEP_2_102(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_100(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102)
+
+
+#define FOR_EACH_2_KEEP_2_100(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_98(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100)
+
+
+#define FOR_EACH_2_KEEP_2_98(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_96(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98)
+
+
+#define FOR_EACH_2_KEEP_2_96(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_94(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96)
+
+
+#define FOR_EACH_2_KEEP_2_94(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_92(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94)
+
+
+#define FOR_EACH_2_KEEP_2_92(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_90(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92)
+
+
+#define FOR_EACH_2_KEEP_2_90(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_88(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90)
+
+
+#define FOR_EACH_2_KEEP_2_88(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_86(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88)
+
+
+#define FOR_EACH_2_KEEP_2_86(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_84(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86)
+
+
+#define FOR_EACH_2_KEEP_2_84(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_82(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84)
+
+
+#define FOR_EACH_2_KEEP_2_82(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_80(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82)
+
+
+#define FOR_EACH_2_KEEP_2_80(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_78(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80)
+
+
+#define FOR_EACH_2_KEEP_2_78(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_76(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78)
+
+
+#define FOR_EACH_2_KEEP_2_76(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_74(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76)
+
+
+#define FOR_EACH_2_KEEP_2_74(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_72(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74)
+
+
+#define FOR_EACH_2_KEEP_2_72(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_70(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72)
+
+
+#define FOR_EACH_2_KEEP_2_70(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_68(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70)
+
+
+#define FOR_EACH_2_KEEP_2_68(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_66(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68)
+
+
+#define FOR_EACH_2_KEEP_2_66(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_64(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66)
+
+
+#define FOR_EACH_2_KEEP_2_64(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_62(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64)
+
+
+#define FOR_EACH_2_KEEP_2_62(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_60(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62)
+
+
+#define FOR_EACH_2_KEEP_2_60(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_58(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60)
+
+
+#define FOR_EACH_2_KEEP_2_58(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_56(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58)
+
+
+#define FOR_EACH_2_KEEP_2_56(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_54(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56)
+
+
+#define FOR_EACH_2_KEEP_2_54(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_52(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54)
+
+
+#define FOR_EACH_2_KEEP_2_52(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_50(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52)
+
+
+#define FOR_EACH_2_KEEP_2_50(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_48(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50)
+
+
+#define FOR_EACH_2_KEEP_2_48(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_46(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48)
+
+
+#define FOR_EACH_2_KEEP_2_46(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_44(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46)
+
+
+#define FOR_EACH_2_KEEP_2_44(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_42(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44)
+
+
+#define FOR_EACH_2_KEEP_2_42(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_40(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42)
+
+
+#define FOR_EACH_2_KEEP_2_40(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_38(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40)
+
+
+#define FOR_EACH_2_KEEP_2_38(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_36(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38)
+
+
+#define FOR_EACH_2_KEEP_2_36(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_34(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36)
+
+
+#define FOR_EACH_2_KEEP_2_34(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_32(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34)
+
+
+#define FOR_EACH_2_KEEP_2_32(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_30(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32)
+
+
+#define FOR_EACH_2_KEEP_2_30(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_28(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30)
+
+
+#define FOR_EACH_2_KEEP_2_28(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_26(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28)
+
+
+#define FOR_EACH_2_KEEP_2_26(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_24(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26)
+
+
+#define FOR_EACH_2_KEEP_2_24(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_22(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24)
+
+
+#define FOR_EACH_2_KEEP_2_22(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_20(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22)
+
+
+#define FOR_EACH_2_KEEP_2_20(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_18(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20)
+
+
+#define FOR_EACH_2_KEEP_2_18(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_16(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18)
+
+
+#define FOR_EACH_2_KEEP_2_16(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_14(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16)
+
+
+#define FOR_EACH_2_KEEP_2_14(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_12(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14)
+
+
+#define FOR_EACH_2_KEEP_2_12(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_10(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12)
+
+
+#define FOR_EACH_2_KEEP_2_10(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_8(X, keep1, keep2, P3, P4, P5, P6, P7, P8, P9, P10)
+
+
+#define FOR_EACH_2_KEEP_2_8(X, keep1, keep2, P1, P2, P3, P4, P5, P6, P7, P8) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_6(X, keep1, keep2, P3, P4, P5, P6, P7, P8)
+
+
+#define FOR_EACH_2_KEEP_2_6(X, keep1, keep2, P1, P2, P3, P4, P5, P6) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_4(X, keep1, keep2, P3, P4, P5, P6)
+
+
+#define FOR_EACH_2_KEEP_2_4(X, keep1, keep2, P1, P2, P3, P4) \
+X(keep1, keep2, P1, P2) \
+FOR_EACH_2_KEEP_2_2(X, keep1, keep2, P3, P4)
+
+
+
+#define FOR_EACH_2_KEEP_2_1(...)
+
+#define FOR_EACH_2_KEEP_2_0(...)
+
+#define FOR_EACH_2_KEEP_2_2(X, keep1, keep2, P1, P2) \
+    X(keep1, keep2, P1, P2) \
+
+#ifdef _MSC_VER
+#define FOR_EACH_2_KEEP_2(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_KEEP_2_, C2(DEC,C2(DEC,C1(COUNT_ARG(__VA_ARGS__))))) LPAREN MACRO_TO_INVOKE, __VA_ARGS__)
+#else
+#define FOR_EACH_2_KEEP_2(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_KEEP_2_, C2(DEC, C2(DEC,C1(COUNT_ARG(__VA_ARGS__))))) ( MACRO_TO_INVOKE, __VA_ARGS__)
+#endif
+
+
+#define FOR_EACH_2_0(...)
+
+#define FOR_EACH_2_2(X, P1, P2) \
+X(P1, P2)
+
+#define FOR_EACH_2_4(X, P1, P2, P3, P4) \
+X(P1, P2) \
+FOR_EACH_2_2(X, P3, P4)
+
+#define FOR_EACH_2_6(X, P1, P2, P3, P4, P5, P6) \
+X(P1, P2) \
+FOR_EACH_2_4(X, P3, P4, P5, P6)
+
+#define FOR_EACH_2_8(X, P1, P2, P3, P4, P5, P6, P7, P8) \
+X(P1, P2) \
+FOR_EACH_2_6(X, P3, P4, P5, P6, P7, P8)
+
+#define FOR_EACH_2_10(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10) \
+X(P1, P2) \
+FOR_EACH_2_8(X, P3, P4, P5, P6, P7, P8, P9, P10)
+
+#define FOR_EACH_2_12(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12) \
+X(P1, P2) \
+FOR_EACH_2_10(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12)
+
+#define FOR_EACH_2_14(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14) \
+X(P1, P2) \
+FOR_EACH_2_12(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14)
+
+#define FOR_EACH_2_16(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16) \
+X(P1, P2) \
+FOR_EACH_2_14(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16)
+
+#define FOR_EACH_2_18(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18) \
+X(P1, P2) \
+FOR_EACH_2_16(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18)
+
+#define FOR_EACH_2_20(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20) \
+X(P1, P2) \
+FOR_EACH_2_18(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20)
+
+#define FOR_EACH_2_22(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22) \
+X(P1, P2) \
+FOR_EACH_2_20(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22)
+
+#define FOR_EACH_2_24(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24) \
+X(P1, P2) \
+FOR_EACH_2_22(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24)
+
+#define FOR_EACH_2_26(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26) \
+X(P1, P2) \
+FOR_EACH_2_24(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26)
+
+#define FOR_EACH_2_28(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28) \
+X(P1, P2) \
+FOR_EACH_2_26(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28)
+
+#define FOR_EACH_2_30(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30) \
+X(P1, P2) \
+FOR_EACH_2_28(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30)
+
+#define FOR_EACH_2_32(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32) \
+X(P1, P2) \
+FOR_EACH_2_30(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32)
+
+#define FOR_EACH_2_34(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34) \
+X(P1, P2) \
+FOR_EACH_2_32(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34)
+
+#define FOR_EACH_2_36(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36) \
+X(P1, P2) \
+FOR_EACH_2_34(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36)
+
+#define FOR_EACH_2_38(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38) \
+X(P1, P2) \
+FOR_EACH_2_36(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38)
+
+#define FOR_EACH_2_40(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40) \
+X(P1, P2) \
+FOR_EACH_2_38(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40)
+
+#define FOR_EACH_2_42(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42) \
+X(P1, P2) \
+FOR_EACH_2_40(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42)
+
+#define FOR_EACH_2_44(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44) \
+X(P1, P2) \
+FOR_EACH_2_42(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44)
+
+#define FOR_EACH_2_46(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46) \
+X(P1, P2) \
+FOR_EACH_2_44(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46)
+
+#define FOR_EACH_2_48(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48) \
+X(P1, P2) \
+FOR_EACH_2_46(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48)
+
+#define FOR_EACH_2_50(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50) \
+X(P1, P2) \
+FOR_EACH_2_48(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50)
+
+#define FOR_EACH_2_52(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52) \
+X(P1, P2) \
+FOR_EACH_2_50(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52)
+
+#define FOR_EACH_2_54(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54) \
+X(P1, P2) \
+FOR_EACH_2_52(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54)
+
+#define FOR_EACH_2_56(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56) \
+X(P1, P2) \
+FOR_EACH_2_54(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56)
+
+#define FOR_EACH_2_58(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58) \
+X(P1, P2) \
+FOR_EACH_2_56(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58)
+
+#define FOR_EACH_2_60(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60) \
+X(P1, P2) \
+FOR_EACH_2_58(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60)
+
+#define FOR_EACH_2_62(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62) \
+X(P1, P2) \
+FOR_EACH_2_60(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62)
+
+#define FOR_EACH_2_64(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64) \
+X(P1, P2) \
+FOR_EACH_2_62(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64)
+
+#define FOR_EACH_2_66(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66) \
+X(P1, P2) \
+FOR_EACH_2_64(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66)
+
+#define FOR_EACH_2_68(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68) \
+X(P1, P2) \
+FOR_EACH_2_66(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68)
+
+#define FOR_EACH_2_70(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70) \
+X(P1, P2) \
+FOR_EACH_2_68(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70)
+
+#define FOR_EACH_2_72(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72) \
+X(P1, P2) \
+FOR_EACH_2_70(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72)
+
+#define FOR_EACH_2_74(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74) \
+X(P1, P2) \
+FOR_EACH_2_72(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74)
+
+#define FOR_EACH_2_76(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76) \
+X(P1, P2) \
+FOR_EACH_2_74(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76)
+
+#define FOR_EACH_2_78(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78) \
+X(P1, P2) \
+FOR_EACH_2_76(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78)
+
+#define FOR_EACH_2_80(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80) \
+X(P1, P2) \
+FOR_EACH_2_78(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80)
+
+#define FOR_EACH_2_82(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82) \
+X(P1, P2) \
+FOR_EACH_2_80(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82)
+
+#define FOR_EACH_2_84(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84) \
+X(P1, P2) \
+FOR_EACH_2_82(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84)
+
+#define FOR_EACH_2_86(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86) \
+X(P1, P2) \
+FOR_EACH_2_84(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86)
+
+#define FOR_EACH_2_88(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88) \
+X(P1, P2) \
+FOR_EACH_2_86(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88)
+
+#define FOR_EACH_2_90(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90) \
+X(P1, P2) \
+FOR_EACH_2_88(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90)
+
+#define FOR_EACH_2_92(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92) \
+X(P1, P2) \
+FOR_EACH_2_90(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92)
+
+#define FOR_EACH_2_94(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94) \
+X(P1, P2) \
+FOR_EACH_2_92(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94)
+
+#define FOR_EACH_2_96(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96) \
+X(P1, P2) \
+FOR_EACH_2_94(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96)
+
+#define FOR_EACH_2_98(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98) \
+X(P1, P2) \
+FOR_EACH_2_96(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98)
+
+#define FOR_EACH_2_100(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100) \
+X(P1, P2) \
+FOR_EACH_2_98(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100)
+
+#define FOR_EACH_2_102(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102) \
+X(P1, P2) \
+FOR_EACH_2_100(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102)
+
+#define FOR_EACH_2_104(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104) \
+X(P1, P2) \
+FOR_EACH_2_102(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104)
+
+#define FOR_EACH_2_106(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106) \
+X(P1, P2) \
+FOR_EACH_2_104(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106)
+
+#define FOR_EACH_2_108(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108) \
+X(P1, P2) \
+FOR_EACH_2_106(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108)
+
+#define FOR_EACH_2_110(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110) \
+X(P1, P2) \
+FOR_EACH_2_108(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110)
+
+#define FOR_EACH_2_112(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112) \
+X(P1, P2) \
+FOR_EACH_2_110(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112)
+
+#define FOR_EACH_2_114(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114) \
+X(P1, P2) \
+FOR_EACH_2_112(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114)
+
+#define FOR_EACH_2_116(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116) \
+X(P1, P2) \
+FOR_EACH_2_114(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116)
+
+#define FOR_EACH_2_118(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118) \
+X(P1, P2) \
+FOR_EACH_2_116(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118)
+
+#define FOR_EACH_2_120(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120) \
+X(P1, P2) \
+FOR_EACH_2_118(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120)
+
+#define FOR_EACH_2_122(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122) \
+X(P1, P2) \
+FOR_EACH_2_120(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122)
+
+#define FOR_EACH_2_124(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124) \
+X(P1, P2) \
+FOR_EACH_2_122(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124)
+
+
+#define FOR_EACH_2_REVERSE_0(...)
+
+#define FOR_EACH_2_REVERSE_2(X, P1, P2) \
+X(P1, P2)
+
+#define FOR_EACH_2_REVERSE_4(X, P1, P2, P3, P4) \
+X(P3, P4) \
+FOR_EACH_2_REVERSE_2(X, P1, P2)
+
+#define FOR_EACH_2_REVERSE_6(X, P1, P2, P3, P4, P5, P6) \
+X(P5, P6) \
+FOR_EACH_2_REVERSE_4(X, P1, P2, P3, P4)
+
+#define FOR_EACH_2_REVERSE_8(X, P1, P2, P3, P4, P5, P6, P7, P8) \
+X(P7, P8) \
+FOR_EACH_2_REVERSE_6(X, P1, P2, P3, P4, P5, P6)
+
+#define FOR_EACH_2_REVERSE_10(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10) \
+X(P9, P10) \
+FOR_EACH_2_REVERSE_8(X, P1, P2, P3, P4, P5, P6, P7, P8)
+
+#define FOR_EACH_2_REVERSE_12(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12) \
+X(P11, P12) \
+FOR_EACH_2_REVERSE_10(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10)
+
+#define FOR_EACH_2_REVERSE_14(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14) \
+X(P13, P14) \
+FOR_EACH_2_REVERSE_12(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12)
+
+#define FOR_EACH_2_REVERSE_16(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16) \
+X(P15, P16) \
+FOR_EACH_2_REVERSE_14(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14)
+
+#define FOR_EACH_2_REVERSE_18(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18) \
+X(P17, P18) \
+FOR_EACH_2_REVERSE_16(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16)
+
+#define FOR_EACH_2_REVERSE_20(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20) \
+X(P19, P20) \
+FOR_EACH_2_REVERSE_18(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18)
+
+#define FOR_EACH_2_REVERSE_22(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22) \
+X(P21, P22) \
+FOR_EACH_2_REVERSE_20(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20)
+
+#define FOR_EACH_2_REVERSE_24(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24) \
+X(P23, P24) \
+FOR_EACH_2_REVERSE_22(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22)
+
+#define FOR_EACH_2_REVERSE_26(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26) \
+X(P25, P26) \
+FOR_EACH_2_REVERSE_24(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24)
+
+#define FOR_EACH_2_REVERSE_28(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28) \
+X(P27, P28) \
+FOR_EACH_2_REVERSE_26(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26)
+
+#define FOR_EACH_2_REVERSE_30(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30) \
+X(P29, P30) \
+FOR_EACH_2_REVERSE_28(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28)
+
+#define FOR_EACH_2_REVERSE_32(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32) \
+X(P31, P32) \
+FOR_EACH_2_REVERSE_30(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30)
+
+#define FOR_EACH_2_REVERSE_34(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34) \
+X(P33, P34) \
+FOR_EACH_2_REVERSE_32(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32)
+
+#define FOR_EACH_2_REVERSE_36(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36) \
+X(P35, P36) \
+FOR_EACH_2_REVERSE_34(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34)
+
+#define FOR_EACH_2_REVERSE_38(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38) \
+X(P37, P38) \
+FOR_EACH_2_REVERSE_36(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36)
+
+#define FOR_EACH_2_REVERSE_40(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40) \
+X(P39, P40) \
+FOR_EACH_2_REVERSE_38(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38)
+
+#define FOR_EACH_2_REVERSE_42(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42) \
+X(P41, P42) \
+FOR_EACH_2_REVERSE_40(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40)
+
+#define FOR_EACH_2_REVERSE_44(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44) \
+X(P43, P44) \
+FOR_EACH_2_REVERSE_42(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42)
+
+#define FOR_EACH_2_REVERSE_46(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46) \
+X(P45, P46) \
+FOR_EACH_2_REVERSE_44(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44)
+
+#define FOR_EACH_2_REVERSE_48(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48) \
+X(P47, P48) \
+FOR_EACH_2_REVERSE_46(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46)
+
+#define FOR_EACH_2_REVERSE_50(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50) \
+X(P49, P50) \
+FOR_EACH_2_REVERSE_48(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48)
+
+#define FOR_EACH_2_REVERSE_52(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52) \
+X(P51, P52) \
+FOR_EACH_2_REVERSE_50(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50)
+
+#define FOR_EACH_2_REVERSE_54(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54) \
+X(P53, P54) \
+FOR_EACH_2_REVERSE_52(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52)
+
+#define FOR_EACH_2_REVERSE_56(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56) \
+X(P55, P56) \
+FOR_EACH_2_REVERSE_54(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54)
+
+#define FOR_EACH_2_REVERSE_58(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58) \
+X(P57, P58) \
+FOR_EACH_2_REVERSE_56(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56)
+
+#define FOR_EACH_2_REVERSE_60(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60) \
+X(P59, P60) \
+FOR_EACH_2_REVERSE_58(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58)
+
+#define FOR_EACH_2_REVERSE_62(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62) \
+X(P61, P62) \
+FOR_EACH_2_REVERSE_60(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60)
+
+#define FOR_EACH_2_REVERSE_64(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64) \
+X(P63, P64) \
+FOR_EACH_2_REVERSE_62(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62)
+
+#define FOR_EACH_2_REVERSE_66(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66) \
+X(P65, P66) \
+FOR_EACH_2_REVERSE_64(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64)
+
+#define FOR_EACH_2_REVERSE_68(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68) \
+X(P67, P68) \
+FOR_EACH_2_REVERSE_66(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66)
+
+#define FOR_EACH_2_REVERSE_70(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70) \
+X(P69, P70) \
+FOR_EACH_2_REVERSE_68(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68)
+
+#define FOR_EACH_2_REVERSE_72(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72) \
+X(P71, P72) \
+FOR_EACH_2_REVERSE_70(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70)
+
+#define FOR_EACH_2_REVERSE_74(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74) \
+X(P73, P74) \
+FOR_EACH_2_REVERSE_72(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72)
+
+#define FOR_EACH_2_REVERSE_76(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76) \
+X(P75, P76) \
+FOR_EACH_2_REVERSE_74(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74)
+
+#define FOR_EACH_2_REVERSE_78(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78) \
+X(P77, P78) \
+FOR_EACH_2_REVERSE_76(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76)
+
+#define FOR_EACH_2_REVERSE_80(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80) \
+X(P79, P80) \
+FOR_EACH_2_REVERSE_78(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78)
+
+#define FOR_EACH_2_REVERSE_82(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82) \
+X(P81, P82) \
+FOR_EACH_2_REVERSE_80(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80)
+
+#define FOR_EACH_2_REVERSE_84(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84) \
+X(P83, P84) \
+FOR_EACH_2_REVERSE_82(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82)
+
+#define FOR_EACH_2_REVERSE_86(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86) \
+X(P85, P86) \
+FOR_EACH_2_REVERSE_84(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84)
+
+#define FOR_EACH_2_REVERSE_88(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88) \
+X(P87, P88) \
+FOR_EACH_2_REVERSE_86(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86)
+
+#define FOR_EACH_2_REVERSE_90(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90) \
+X(P89, P90) \
+FOR_EACH_2_REVERSE_88(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88)
+
+#define FOR_EACH_2_REVERSE_92(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92) \
+X(P91, P92) \
+FOR_EACH_2_REVERSE_90(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90)
+
+#define FOR_EACH_2_REVERSE_94(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94) \
+X(P93, P94) \
+FOR_EACH_2_REVERSE_92(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92)
+
+#define FOR_EACH_2_REVERSE_96(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96) \
+X(P95, P96) \
+FOR_EACH_2_REVERSE_94(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94)
+
+#define FOR_EACH_2_REVERSE_98(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98) \
+X(P97, P98) \
+FOR_EACH_2_REVERSE_96(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96)
+
+#define FOR_EACH_2_REVERSE_100(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100) \
+X(P99, P100) \
+FOR_EACH_2_REVERSE_98(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98)
+
+#define FOR_EACH_2_REVERSE_102(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102) \
+X(P101, P102) \
+FOR_EACH_2_REVERSE_100(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100)
+
+#define FOR_EACH_2_REVERSE_104(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104) \
+X(P103, P104) \
+FOR_EACH_2_REVERSE_102(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102)
+
+#define FOR_EACH_2_REVERSE_106(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106) \
+X(P105, P106) \
+FOR_EACH_2_REVERSE_104(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104)
+
+#define FOR_EACH_2_REVERSE_108(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108) \
+X(P107, P108) \
+FOR_EACH_2_REVERSE_106(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106)
+
+#define FOR_EACH_2_REVERSE_110(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110) \
+X(P109, P110) \
+FOR_EACH_2_REVERSE_108(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108)
+
+#define FOR_EACH_2_REVERSE_112(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112) \
+X(P111, P112) \
+FOR_EACH_2_REVERSE_110(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110)
+
+#define FOR_EACH_2_REVERSE_114(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114) \
+X(P113, P114) \
+FOR_EACH_2_REVERSE_112(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112)
+
+#define FOR_EACH_2_REVERSE_116(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116) \
+X(P115, P116) \
+FOR_EACH_2_REVERSE_114(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114)
+
+#define FOR_EACH_2_REVERSE_118(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118) \
+X(P117, P118) \
+FOR_EACH_2_REVERSE_116(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116)
+
+#define FOR_EACH_2_REVERSE_120(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120) \
+X(P119, P120) \
+FOR_EACH_2_REVERSE_118(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118)
+
+#define FOR_EACH_2_REVERSE_122(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122) \
+X(P121, P122) \
+FOR_EACH_2_REVERSE_120(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120)
+
+#define FOR_EACH_2_REVERSE_124(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124) \
+X(P123, P124) \
+FOR_EACH_2_REVERSE_122(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122)
+
+
+#define FOR_EACH_1_COUNTED_0(...)
+
+#define FOR_EACH_1_COUNTED_1(X, P1) \
+    X(1, P1)
+
+#define FOR_EACH_1_COUNTED_2(X, P1, P2) \
+X(2, P1) \
+FOR_EACH_1_COUNTED_1(X, P2)
+
+#define FOR_EACH_1_COUNTED_3(X, P1, P2, P3) \
+X(3, P1) \
+FOR_EACH_1_COUNTED_2(X, P2, P3)
+
+#define FOR_EACH_1_COUNTED_4(X, P1, P2, P3, P4) \
+X(4, P1) \
+FOR_EACH_1_COUNTED_3(X, P2, P3, P4)
+
+#define FOR_EACH_1_COUNTED_5(X, P1, P2, P3, P4, P5) \
+X(5, P1) \
+FOR_EACH_1_COUNTED_4(X, P2, P3, P4, P5)
+
+#define FOR_EACH_1_COUNTED_6(X, P1, P2, P3, P4, P5, P6) \
+X(6, P1) \
+FOR_EACH_1_COUNTED_5(X, P2, P3, P4, P5, P6)
+
+#define FOR_EACH_1_COUNTED_7(X, P1, P2, P3, P4, P5, P6, P7) \
+X(7, P1) \
+FOR_EACH_1_COUNTED_6(X, P2, P3, P4, P5, P6, P7)
+
+#define FOR_EACH_1_COUNTED_8(X, P1, P2, P3, P4, P5, P6, P7, P8) \
+X(8, P1) \
+FOR_EACH_1_COUNTED_7(X, P2, P3, P4, P5, P6, P7, P8)
+
+#define FOR_EACH_1_COUNTED_9(X, P1, P2, P3, P4, P5, P6, P7, P8, P9) \
+X(9, P1) \
+FOR_EACH_1_COUNTED_8(X, P2, P3, P4, P5, P6, P7, P8, P9)
+
+#define FOR_EACH_1_COUNTED_10(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10) \
+X(10, P1) \
+FOR_EACH_1_COUNTED_9(X, P2, P3, P4, P5, P6, P7, P8, P9, P10)
+
+#define FOR_EACH_1_COUNTED_11(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11) \
+X(11, P1) \
+FOR_EACH_1_COUNTED_10(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11)
+
+#define FOR_EACH_1_COUNTED_12(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12) \
+X(12, P1) \
+FOR_EACH_1_COUNTED_11(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12)
+
+#define FOR_EACH_1_COUNTED_13(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13) \
+X(13, P1) \
+FOR_EACH_1_COUNTED_12(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13)
+
+#define FOR_EACH_1_COUNTED_14(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14) \
+X(14, P1) \
+FOR_EACH_1_COUNTED_13(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14)
+
+#define FOR_EACH_1_COUNTED_15(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15) \
+X(15, P1) \
+FOR_EACH_1_COUNTED_14(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15)
+
+#define FOR_EACH_1_COUNTED_16(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16) \
+X(16, P1) \
+FOR_EACH_1_COUNTED_15(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16)
+
+#define FOR_EACH_1_COUNTED_17(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17) \
+X(17, P1) \
+FOR_EACH_1_COUNTED_16(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17)
+
+#define FOR_EACH_1_COUNTED_18(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18) \
+X(18, P1) \
+FOR_EACH_1_COUNTED_17(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18)
+
+#define FOR_EACH_1_COUNTED_19(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19) \
+X(19, P1) \
+FOR_EACH_1_COUNTED_18(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19)
+
+#define FOR_EACH_1_COUNTED_20(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20) \
+X(20, P1) \
+FOR_EACH_1_COUNTED_19(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20)
+
+#define FOR_EACH_1_COUNTED_21(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21) \
+X(21, P1) \
+FOR_EACH_1_COUNTED_20(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21)
+
+#define FOR_EACH_1_COUNTED_22(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22) \
+X(22, P1) \
+FOR_EACH_1_COUNTED_21(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22)
+
+#define FOR_EACH_1_COUNTED_23(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23) \
+X(23, P1) \
+FOR_EACH_1_COUNTED_22(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23)
+
+#define FOR_EACH_1_COUNTED_24(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24) \
+X(24, P1) \
+FOR_EACH_1_COUNTED_23(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24)
+
+#define FOR_EACH_1_COUNTED_25(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25) \
+X(25, P1) \
+FOR_EACH_1_COUNTED_24(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25)
+
+#define FOR_EACH_1_COUNTED_26(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26) \
+X(26, P1) \
+FOR_EACH_1_COUNTED_25(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26)
+
+#define FOR_EACH_1_COUNTED_27(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27) \
+X(27, P1) \
+FOR_EACH_1_COUNTED_26(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27)
+
+#define FOR_EACH_1_COUNTED_28(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28) \
+X(28, P1) \
+FOR_EACH_1_COUNTED_27(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28)
+
+#define FOR_EACH_1_COUNTED_29(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29) \
+X(29, P1) \
+FOR_EACH_1_COUNTED_28(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29)
+
+#define FOR_EACH_1_COUNTED_30(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30) \
+X(30, P1) \
+FOR_EACH_1_COUNTED_29(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30)
+
+#define FOR_EACH_1_COUNTED_31(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31) \
+X(31, P1) \
+FOR_EACH_1_COUNTED_30(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31)
+
+#define FOR_EACH_1_COUNTED_32(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32) \
+X(32, P1) \
+FOR_EACH_1_COUNTED_31(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32)
+
+#define FOR_EACH_1_COUNTED_33(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33) \
+X(33, P1) \
+FOR_EACH_1_COUNTED_32(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33)
+
+#define FOR_EACH_1_COUNTED_34(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34) \
+X(34, P1) \
+FOR_EACH_1_COUNTED_33(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34)
+
+#define FOR_EACH_1_COUNTED_35(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35) \
+X(35, P1) \
+FOR_EACH_1_COUNTED_34(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35)
+
+#define FOR_EACH_1_COUNTED_36(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36) \
+X(36, P1) \
+FOR_EACH_1_COUNTED_35(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36)
+
+#define FOR_EACH_1_COUNTED_37(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37) \
+X(37, P1) \
+FOR_EACH_1_COUNTED_36(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37)
+
+#define FOR_EACH_1_COUNTED_38(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38) \
+X(38, P1) \
+FOR_EACH_1_COUNTED_37(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38)
+
+#define FOR_EACH_1_COUNTED_39(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39) \
+X(39, P1) \
+FOR_EACH_1_COUNTED_38(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39)
+
+#define FOR_EACH_1_COUNTED_40(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40) \
+X(40, P1) \
+FOR_EACH_1_COUNTED_39(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40)
+
+#define FOR_EACH_1_COUNTED_41(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41) \
+X(41, P1) \
+FOR_EACH_1_COUNTED_40(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41)
+
+#define FOR_EACH_1_COUNTED_42(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42) \
+X(42, P1) \
+FOR_EACH_1_COUNTED_41(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42)
+
+#define FOR_EACH_1_COUNTED_43(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43) \
+X(43, P1) \
+FOR_EACH_1_COUNTED_42(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43)
+
+#define FOR_EACH_1_COUNTED_44(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44) \
+X(44, P1) \
+FOR_EACH_1_COUNTED_43(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44)
+
+#define FOR_EACH_1_COUNTED_45(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45) \
+X(45, P1) \
+FOR_EACH_1_COUNTED_44(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45)
+
+#define FOR_EACH_1_COUNTED_46(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46) \
+X(46, P1) \
+FOR_EACH_1_COUNTED_45(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46)
+
+#define FOR_EACH_1_COUNTED_47(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47) \
+X(47, P1) \
+FOR_EACH_1_COUNTED_46(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47)
+
+#define FOR_EACH_1_COUNTED_48(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48) \
+X(48, P1) \
+FOR_EACH_1_COUNTED_47(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48)
+
+#define FOR_EACH_1_COUNTED_49(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49) \
+X(49, P1) \
+FOR_EACH_1_COUNTED_48(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49)
+
+#define FOR_EACH_1_COUNTED_50(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50) \
+X(50, P1) \
+FOR_EACH_1_COUNTED_49(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50)
+
+#define FOR_EACH_1_COUNTED_51(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51) \
+X(51, P1) \
+FOR_EACH_1_COUNTED_50(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51)
+
+#define FOR_EACH_1_COUNTED_52(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52) \
+X(52, P1) \
+FOR_EACH_1_COUNTED_51(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52)
+
+#define FOR_EACH_1_COUNTED_53(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53) \
+X(53, P1) \
+FOR_EACH_1_COUNTED_52(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53)
+
+#define FOR_EACH_1_COUNTED_54(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54) \
+X(54, P1) \
+FOR_EACH_1_COUNTED_53(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54)
+
+#define FOR_EACH_1_COUNTED_55(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55) \
+X(55, P1) \
+FOR_EACH_1_COUNTED_54(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55)
+
+#define FOR_EACH_1_COUNTED_56(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56) \
+X(56, P1) \
+FOR_EACH_1_COUNTED_55(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56)
+
+#define FOR_EACH_1_COUNTED_57(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57) \
+X(57, P1) \
+FOR_EACH_1_COUNTED_56(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57)
+
+#define FOR_EACH_1_COUNTED_58(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58) \
+X(58, P1) \
+FOR_EACH_1_COUNTED_57(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58)
+
+#define FOR_EACH_1_COUNTED_59(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59) \
+X(59, P1) \
+FOR_EACH_1_COUNTED_58(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59)
+
+#define FOR_EACH_1_COUNTED_60(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60) \
+X(60, P1) \
+FOR_EACH_1_COUNTED_59(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60)
+
+#define FOR_EACH_1_COUNTED_61(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61) \
+X(61, P1) \
+FOR_EACH_1_COUNTED_60(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61)
+
+#define FOR_EACH_1_COUNTED_62(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62) \
+X(62, P1) \
+FOR_EACH_1_COUNTED_61(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62)
+
+#define FOR_EACH_1_COUNTED_63(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63) \
+X(63, P1) \
+FOR_EACH_1_COUNTED_62(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63)
+
+#define FOR_EACH_1_COUNTED_64(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64) \
+X(64, P1) \
+FOR_EACH_1_COUNTED_63(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64)
+
+#define FOR_EACH_1_COUNTED_65(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65) \
+X(65, P1) \
+FOR_EACH_1_COUNTED_64(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65)
+
+#define FOR_EACH_1_COUNTED_66(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66) \
+X(66, P1) \
+FOR_EACH_1_COUNTED_65(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66)
+
+#define FOR_EACH_1_COUNTED_67(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67) \
+X(67, P1) \
+FOR_EACH_1_COUNTED_66(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67)
+
+#define FOR_EACH_1_COUNTED_68(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68) \
+X(68, P1) \
+FOR_EACH_1_COUNTED_67(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68)
+
+#define FOR_EACH_1_COUNTED_69(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69) \
+X(69, P1) \
+FOR_EACH_1_COUNTED_68(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69)
+
+#define FOR_EACH_1_COUNTED_70(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70) \
+X(70, P1) \
+FOR_EACH_1_COUNTED_69(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70)
+
+#define FOR_EACH_1_COUNTED_71(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71) \
+X(71, P1) \
+FOR_EACH_1_COUNTED_70(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71)
+
+#define FOR_EACH_1_COUNTED_72(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72) \
+X(72, P1) \
+FOR_EACH_1_COUNTED_71(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72)
+
+#define FOR_EACH_1_COUNTED_73(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73) \
+X(73, P1) \
+FOR_EACH_1_COUNTED_72(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73)
+
+#define FOR_EACH_1_COUNTED_74(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74) \
+X(74, P1) \
+FOR_EACH_1_COUNTED_73(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74)
+
+#define FOR_EACH_1_COUNTED_75(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75) \
+X(75, P1) \
+FOR_EACH_1_COUNTED_74(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75)
+
+#define FOR_EACH_1_COUNTED_76(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76) \
+X(76, P1) \
+FOR_EACH_1_COUNTED_75(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76)
+
+#define FOR_EACH_1_COUNTED_77(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77) \
+X(77, P1) \
+FOR_EACH_1_COUNTED_76(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77)
+
+#define FOR_EACH_1_COUNTED_78(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78) \
+X(78, P1) \
+FOR_EACH_1_COUNTED_77(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78)
+
+#define FOR_EACH_1_COUNTED_79(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79) \
+X(79, P1) \
+FOR_EACH_1_COUNTED_78(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79)
+
+#define FOR_EACH_1_COUNTED_80(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80) \
+X(80, P1) \
+FOR_EACH_1_COUNTED_79(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80)
+
+#define FOR_EACH_1_COUNTED_81(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81) \
+X(81, P1) \
+FOR_EACH_1_COUNTED_80(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81)
+
+#define FOR_EACH_1_COUNTED_82(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82) \
+X(82, P1) \
+FOR_EACH_1_COUNTED_81(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82)
+
+#define FOR_EACH_1_COUNTED_83(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83) \
+X(83, P1) \
+FOR_EACH_1_COUNTED_82(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83)
+
+#define FOR_EACH_1_COUNTED_84(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84) \
+X(84, P1) \
+FOR_EACH_1_COUNTED_83(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84)
+
+#define FOR_EACH_1_COUNTED_85(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85) \
+X(85, P1) \
+FOR_EACH_1_COUNTED_84(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85)
+
+#define FOR_EACH_1_COUNTED_86(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86) \
+X(86, P1) \
+FOR_EACH_1_COUNTED_85(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86)
+
+#define FOR_EACH_1_COUNTED_87(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87) \
+X(87, P1) \
+FOR_EACH_1_COUNTED_86(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87)
+
+#define FOR_EACH_1_COUNTED_88(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88) \
+X(88, P1) \
+FOR_EACH_1_COUNTED_87(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88)
+
+#define FOR_EACH_1_COUNTED_89(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89) \
+X(89, P1) \
+FOR_EACH_1_COUNTED_88(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89)
+
+#define FOR_EACH_1_COUNTED_90(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90) \
+X(90, P1) \
+FOR_EACH_1_COUNTED_89(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90)
+
+#define FOR_EACH_1_COUNTED_91(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91) \
+X(91, P1) \
+FOR_EACH_1_COUNTED_90(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91)
+
+#define FOR_EACH_1_COUNTED_92(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92) \
+X(92, P1) \
+FOR_EACH_1_COUNTED_91(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92)
+
+#define FOR_EACH_1_COUNTED_93(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93) \
+X(93, P1) \
+FOR_EACH_1_COUNTED_92(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93)
+
+#define FOR_EACH_1_COUNTED_94(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94) \
+X(94, P1) \
+FOR_EACH_1_COUNTED_93(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94)
+
+#define FOR_EACH_1_COUNTED_95(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95) \
+X(95, P1) \
+FOR_EACH_1_COUNTED_94(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95)
+
+#define FOR_EACH_1_COUNTED_96(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96) \
+X(96, P1) \
+FOR_EACH_1_COUNTED_95(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96)
+
+#define FOR_EACH_1_COUNTED_97(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97) \
+X(97, P1) \
+FOR_EACH_1_COUNTED_96(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97)
+
+#define FOR_EACH_1_COUNTED_98(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98) \
+X(98, P1) \
+FOR_EACH_1_COUNTED_97(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98)
+
+#define FOR_EACH_1_COUNTED_99(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99) \
+X(99, P1) \
+FOR_EACH_1_COUNTED_98(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99)
+
+#define FOR_EACH_1_COUNTED_100(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100) \
+X(100, P1) \
+FOR_EACH_1_COUNTED_99(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100)
+
+#define FOR_EACH_1_COUNTED_101(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101) \
+X(101, P1) \
+FOR_EACH_1_COUNTED_100(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101)
+
+#define FOR_EACH_1_COUNTED_102(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102) \
+X(102, P1) \
+FOR_EACH_1_COUNTED_101(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102)
+
+#define FOR_EACH_1_COUNTED_103(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103) \
+X(103, P1) \
+FOR_EACH_1_COUNTED_102(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103)
+
+#define FOR_EACH_1_COUNTED_104(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104) \
+X(104, P1) \
+FOR_EACH_1_COUNTED_103(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104)
+
+#define FOR_EACH_1_COUNTED_105(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105) \
+X(105, P1) \
+FOR_EACH_1_COUNTED_104(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105)
+
+#define FOR_EACH_1_COUNTED_106(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106) \
+X(106, P1) \
+FOR_EACH_1_COUNTED_105(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106)
+
+#define FOR_EACH_1_COUNTED_107(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107) \
+X(107, P1) \
+FOR_EACH_1_COUNTED_106(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107)
+
+#define FOR_EACH_1_COUNTED_108(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108) \
+X(108, P1) \
+FOR_EACH_1_COUNTED_107(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108)
+
+#define FOR_EACH_1_COUNTED_109(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109) \
+X(109, P1) \
+FOR_EACH_1_COUNTED_108(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109)
+
+#define FOR_EACH_1_COUNTED_110(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110) \
+X(110, P1) \
+FOR_EACH_1_COUNTED_109(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110)
+
+#define FOR_EACH_1_COUNTED_111(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111) \
+X(111, P1) \
+FOR_EACH_1_COUNTED_110(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111)
+
+#define FOR_EACH_1_COUNTED_112(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112) \
+X(112, P1) \
+FOR_EACH_1_COUNTED_111(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112)
+
+#define FOR_EACH_1_COUNTED_113(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113) \
+X(113, P1) \
+FOR_EACH_1_COUNTED_112(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113)
+
+#define FOR_EACH_1_COUNTED_114(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114) \
+X(114, P1) \
+FOR_EACH_1_COUNTED_113(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114)
+
+#define FOR_EACH_1_COUNTED_115(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115) \
+X(115, P1) \
+FOR_EACH_1_COUNTED_114(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115)
+
+#define FOR_EACH_1_COUNTED_116(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116) \
+X(116, P1) \
+FOR_EACH_1_COUNTED_115(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116)
+
+#define FOR_EACH_1_COUNTED_117(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117) \
+X(117, P1) \
+FOR_EACH_1_COUNTED_116(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117)
+
+#define FOR_EACH_1_COUNTED_118(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118) \
+X(118, P1) \
+FOR_EACH_1_COUNTED_117(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118)
+
+#define FOR_EACH_1_COUNTED_119(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119) \
+X(119, P1) \
+FOR_EACH_1_COUNTED_118(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119)
+
+#define FOR_EACH_1_COUNTED_120(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120) \
+X(120, P1) \
+FOR_EACH_1_COUNTED_119(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120)
+
+#define FOR_EACH_1_COUNTED_121(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121) \
+X(121, P1) \
+FOR_EACH_1_COUNTED_120(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121)
+
+#define FOR_EACH_1_COUNTED_122(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122) \
+X(122, P1) \
+FOR_EACH_1_COUNTED_121(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122)
+
+#define FOR_EACH_1_COUNTED_123(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123) \
+X(123, P1) \
+FOR_EACH_1_COUNTED_122(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123)
+
+#define FOR_EACH_1_COUNTED_124(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124) \
+X(124, P1) \
+FOR_EACH_1_COUNTED_123(X, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124)
+
+
+#define FOR_EACH_2_COUNTED_0(...)
+
+#define FOR_EACH_2_COUNTED_2(X, P1, P2) \
+    X(2, P1, P2)
+
+#define FOR_EACH_2_COUNTED_4(X, P1, P2, P3, P4) \
+X(4, P1, P2) \
+FOR_EACH_2_COUNTED_2(X, P3, P4)
+
+#define FOR_EACH_2_COUNTED_6(X, P1, P2, P3, P4, P5, P6) \
+X(6, P1, P2) \
+FOR_EACH_2_COUNTED_4(X, P3, P4, P5, P6)
+
+#define FOR_EACH_2_COUNTED_8(X, P1, P2, P3, P4, P5, P6, P7, P8) \
+X(8, P1, P2) \
+FOR_EACH_2_COUNTED_6(X, P3, P4, P5, P6, P7, P8)
+
+#define FOR_EACH_2_COUNTED_10(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10) \
+X(10, P1, P2) \
+FOR_EACH_2_COUNTED_8(X, P3, P4, P5, P6, P7, P8, P9, P10)
+
+#define FOR_EACH_2_COUNTED_12(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12) \
+X(12, P1, P2) \
+FOR_EACH_2_COUNTED_10(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12)
+
+#define FOR_EACH_2_COUNTED_14(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14) \
+X(14, P1, P2) \
+FOR_EACH_2_COUNTED_12(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14)
+
+#define FOR_EACH_2_COUNTED_16(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16) \
+X(16, P1, P2) \
+FOR_EACH_2_COUNTED_14(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16)
+
+#define FOR_EACH_2_COUNTED_18(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18) \
+X(18, P1, P2) \
+FOR_EACH_2_COUNTED_16(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18)
+
+#define FOR_EACH_2_COUNTED_20(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20) \
+X(20, P1, P2) \
+FOR_EACH_2_COUNTED_18(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20)
+
+#define FOR_EACH_2_COUNTED_22(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22) \
+X(22, P1, P2) \
+FOR_EACH_2_COUNTED_20(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22)
+
+#define FOR_EACH_2_COUNTED_24(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24) \
+X(24, P1, P2) \
+FOR_EACH_2_COUNTED_22(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24)
+
+#define FOR_EACH_2_COUNTED_26(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26) \
+X(26, P1, P2) \
+FOR_EACH_2_COUNTED_24(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26)
+
+#define FOR_EACH_2_COUNTED_28(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28) \
+X(28, P1, P2) \
+FOR_EACH_2_COUNTED_26(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28)
+
+#define FOR_EACH_2_COUNTED_30(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30) \
+X(30, P1, P2) \
+FOR_EACH_2_COUNTED_28(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30)
+
+#define FOR_EACH_2_COUNTED_32(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32) \
+X(32, P1, P2) \
+FOR_EACH_2_COUNTED_30(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32)
+
+#define FOR_EACH_2_COUNTED_34(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34) \
+X(34, P1, P2) \
+FOR_EACH_2_COUNTED_32(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34)
+
+#define FOR_EACH_2_COUNTED_36(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36) \
+X(36, P1, P2) \
+FOR_EACH_2_COUNTED_34(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36)
+
+#define FOR_EACH_2_COUNTED_38(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38) \
+X(38, P1, P2) \
+FOR_EACH_2_COUNTED_36(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38)
+
+#define FOR_EACH_2_COUNTED_40(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40) \
+X(40, P1, P2) \
+FOR_EACH_2_COUNTED_38(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40)
+
+#define FOR_EACH_2_COUNTED_42(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42) \
+X(42, P1, P2) \
+FOR_EACH_2_COUNTED_40(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42)
+
+#define FOR_EACH_2_COUNTED_44(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44) \
+X(44, P1, P2) \
+FOR_EACH_2_COUNTED_42(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44)
+
+#define FOR_EACH_2_COUNTED_46(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46) \
+X(46, P1, P2) \
+FOR_EACH_2_COUNTED_44(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46)
+
+#define FOR_EACH_2_COUNTED_48(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48) \
+X(48, P1, P2) \
+FOR_EACH_2_COUNTED_46(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48)
+
+#define FOR_EACH_2_COUNTED_50(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50) \
+X(50, P1, P2) \
+FOR_EACH_2_COUNTED_48(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50)
+
+#define FOR_EACH_2_COUNTED_52(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52) \
+X(52, P1, P2) \
+FOR_EACH_2_COUNTED_50(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52)
+
+#define FOR_EACH_2_COUNTED_54(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54) \
+X(54, P1, P2) \
+FOR_EACH_2_COUNTED_52(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54)
+
+#define FOR_EACH_2_COUNTED_56(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56) \
+X(56, P1, P2) \
+FOR_EACH_2_COUNTED_54(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56)
+
+#define FOR_EACH_2_COUNTED_58(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58) \
+X(58, P1, P2) \
+FOR_EACH_2_COUNTED_56(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58)
+
+#define FOR_EACH_2_COUNTED_60(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60) \
+X(60, P1, P2) \
+FOR_EACH_2_COUNTED_58(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60)
+
+#define FOR_EACH_2_COUNTED_62(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62) \
+X(62, P1, P2) \
+FOR_EACH_2_COUNTED_60(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62)
+
+#define FOR_EACH_2_COUNTED_64(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64) \
+X(64, P1, P2) \
+FOR_EACH_2_COUNTED_62(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64)
+
+#define FOR_EACH_2_COUNTED_66(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66) \
+X(66, P1, P2) \
+FOR_EACH_2_COUNTED_64(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66)
+
+#define FOR_EACH_2_COUNTED_68(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68) \
+X(68, P1, P2) \
+FOR_EACH_2_COUNTED_66(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68)
+
+#define FOR_EACH_2_COUNTED_70(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70) \
+X(70, P1, P2) \
+FOR_EACH_2_COUNTED_68(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70)
+
+#define FOR_EACH_2_COUNTED_72(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72) \
+X(72, P1, P2) \
+FOR_EACH_2_COUNTED_70(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72)
+
+#define FOR_EACH_2_COUNTED_74(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74) \
+X(74, P1, P2) \
+FOR_EACH_2_COUNTED_72(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74)
+
+#define FOR_EACH_2_COUNTED_76(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76) \
+X(76, P1, P2) \
+FOR_EACH_2_COUNTED_74(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76)
+
+#define FOR_EACH_2_COUNTED_78(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78) \
+X(78, P1, P2) \
+FOR_EACH_2_COUNTED_76(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78)
+
+#define FOR_EACH_2_COUNTED_80(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80) \
+X(80, P1, P2) \
+FOR_EACH_2_COUNTED_78(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80)
+
+#define FOR_EACH_2_COUNTED_82(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82) \
+X(82, P1, P2) \
+FOR_EACH_2_COUNTED_80(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82)
+
+#define FOR_EACH_2_COUNTED_84(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84) \
+X(84, P1, P2) \
+FOR_EACH_2_COUNTED_82(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84)
+
+#define FOR_EACH_2_COUNTED_86(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86) \
+X(86, P1, P2) \
+FOR_EACH_2_COUNTED_84(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86)
+
+#define FOR_EACH_2_COUNTED_88(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88) \
+X(88, P1, P2) \
+FOR_EACH_2_COUNTED_86(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88)
+
+#define FOR_EACH_2_COUNTED_90(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90) \
+X(90, P1, P2) \
+FOR_EACH_2_COUNTED_88(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90)
+
+#define FOR_EACH_2_COUNTED_92(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92) \
+X(92, P1, P2) \
+FOR_EACH_2_COUNTED_90(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92)
+
+#define FOR_EACH_2_COUNTED_94(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94) \
+X(94, P1, P2) \
+FOR_EACH_2_COUNTED_92(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94)
+
+#define FOR_EACH_2_COUNTED_96(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96) \
+X(96, P1, P2) \
+FOR_EACH_2_COUNTED_94(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96)
+
+#define FOR_EACH_2_COUNTED_98(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98) \
+X(98, P1, P2) \
+FOR_EACH_2_COUNTED_96(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98)
+
+#define FOR_EACH_2_COUNTED_100(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100) \
+X(100, P1, P2) \
+FOR_EACH_2_COUNTED_98(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100)
+
+#define FOR_EACH_2_COUNTED_102(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102) \
+X(102, P1, P2) \
+FOR_EACH_2_COUNTED_100(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102)
+
+#define FOR_EACH_2_COUNTED_104(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104) \
+X(104, P1, P2) \
+FOR_EACH_2_COUNTED_102(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104)
+
+#define FOR_EACH_2_COUNTED_106(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106) \
+X(106, P1, P2) \
+FOR_EACH_2_COUNTED_104(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106)
+
+#define FOR_EACH_2_COUNTED_108(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108) \
+X(108, P1, P2) \
+FOR_EACH_2_COUNTED_106(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108)
+
+#define FOR_EACH_2_COUNTED_110(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110) \
+X(110, P1, P2) \
+FOR_EACH_2_COUNTED_108(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110)
+
+#define FOR_EACH_2_COUNTED_112(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112) \
+X(112, P1, P2) \
+FOR_EACH_2_COUNTED_110(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112)
+
+#define FOR_EACH_2_COUNTED_114(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114) \
+X(114, P1, P2) \
+FOR_EACH_2_COUNTED_112(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114)
+
+#define FOR_EACH_2_COUNTED_116(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116) \
+X(116, P1, P2) \
+FOR_EACH_2_COUNTED_114(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116)
+
+#define FOR_EACH_2_COUNTED_118(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118) \
+X(118, P1, P2) \
+FOR_EACH_2_COUNTED_116(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118)
+
+#define FOR_EACH_2_COUNTED_120(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120) \
+X(120, P1, P2) \
+FOR_EACH_2_COUNTED_118(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120)
+
+#define FOR_EACH_2_COUNTED_122(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122) \
+X(122, P1, P2) \
+FOR_EACH_2_COUNTED_120(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122)
+
+#define FOR_EACH_2_COUNTED_124(X, P1, P2, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124) \
+X(124, P1, P2) \
+FOR_EACH_2_COUNTED_122(X, P3, P4, P5, P6, P7, P8, P9, P10, P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23, P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36, P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49, P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62, P63, P64, P65, P66, P67, P68, P69, P70, P71, P72, P73, P74, P75, P76, P77, P78, P79, P80, P81, P82, P83, P84, P85, P86, P87, P88, P89, P90, P91, P92, P93, P94, P95, P96, P97, P98, P99, P100, P101, P102, P103, P104, P105, P106, P107, P108, P109, P110, P111, P112, P113, P114, P115, P116, P117, P118, P119, P120, P121, P122, P123, P124)
+
+
+#ifdef _MSC_VER
+#define FOR_EACH_2(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_, C1(COUNT_ARG(__VA_ARGS__))) LPAREN MACRO_TO_INVOKE, __VA_ARGS__)
+/*the COUNTED breed of FOR_EACH macro invokes a macro with 3 parameters: 1st being the count of invocation. For example.
+FOR_EACH_2_COUNTER(MACRO, a,b,c,d,e,f) will result in 
+MACRO(6, a,b)
+MACRO(4, c,d)
+MACRO(2, e,f)
+This macro exists because we need a "stop condition" in outputting COMMA... when calling a function f(a,b,c,d) cannot be f(a,b,c,d,) <=doesn't compile (as opposed to enum definition)
+*/
+#define FOR_EACH_2_COUNTED(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_COUNTED_, C1(COUNT_ARG(__VA_ARGS__))) LPAREN MACRO_TO_INVOKE, __VA_ARGS__)
+#define FOR_EACH_1_COUNTED(MACRO_TO_INVOKE, ...) C2(FOR_EACH_1_COUNTED_, C1(COUNT_ARG(__VA_ARGS__))) LPAREN MACRO_TO_INVOKE, __VA_ARGS__)
+
+/*FOR_EACH_2_REVERSE acts just like FOR_EACH_2, but in reverse order. Example:
+FOR_EACH_2_REVERSE(X,a,b,c,d,e,f) => X(e,f) X(c,d) X (a, b) in this order */
+#define FOR_EACH_2_REVERSE(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_REVERSE_, C1(COUNT_ARG(__VA_ARGS__))) LPAREN MACRO_TO_INVOKE, __VA_ARGS__)
+#else
+#define FOR_EACH_2(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_, C1(COUNT_ARG(__VA_ARGS__))) ( MACRO_TO_INVOKE, __VA_ARGS__)
+#define FOR_EACH_2_COUNTED(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_COUNTED_, C1(COUNT_ARG(__VA_ARGS__))) ( MACRO_TO_INVOKE,  __VA_ARGS__)
+#define FOR_EACH_1_COUNTED(MACRO_TO_INVOKE, ...) C2(FOR_EACH_1_COUNTED_, C1(COUNT_ARG(__VA_ARGS__))) ( MACRO_TO_INVOKE,  __VA_ARGS__)
+#define FOR_EACH_2_REVERSE(MACRO_TO_INVOKE, ...) C2(FOR_EACH_2_REVERSE_, C1(COUNT_ARG(__VA_ARGS__))) ( MACRO_TO_INVOKE, __VA_ARGS__)
+#endif
+
+#ifdef _MSC_VER
+#define EXPAND_OR_C1(x) x
+#else
+#define EXPAND_OR_C1(...) __VA_ARGS__
+#endif
+
+#define EXPAND_ARGS(...) __VA_ARGS__
+#define EXPAND_TWICE(...) EXPAND_ARGS(__VA_ARGS__)
+
+#define DO_0(MACRO, ...) \
+MACRO(0, __VA_ARGS__)
+
+#define DO_1(MACRO, ...) \
+MACRO(1, __VA_ARGS__) \
+DO_0(MACRO, __VA_ARGS__)
+
+
+#define DO_2(MACRO, ...) \
+MACRO(2, __VA_ARGS__) \
+DO_1(MACRO, __VA_ARGS__)
+
+
+#define DO_3(MACRO, ...) \
+MACRO(3, __VA_ARGS__) \
+DO_2(MACRO, __VA_ARGS__)
+
+
+#define DO_4(MACRO, ...) \
+MACRO(4, __VA_ARGS__) \
+DO_3(MACRO, __VA_ARGS__)
+
+
+#define DO_5(MACRO, ...) \
+MACRO(5, __VA_ARGS__) \
+DO_4(MACRO, __VA_ARGS__)
+
+
+#define DO_6(MACRO, ...) \
+MACRO(6, __VA_ARGS__) \
+DO_5(MACRO, __VA_ARGS__)
+
+
+#define DO_7(MACRO, ...) \
+MACRO(7, __VA_ARGS__) \
+DO_6(MACRO, __VA_ARGS__)
+
+
+#define DO_8(MACRO, ...) \
+MACRO(8, __VA_ARGS__) \
+DO_7(MACRO, __VA_ARGS__)
+
+
+#define DO_9(MACRO, ...) \
+MACRO(9, __VA_ARGS__) \
+DO_8(MACRO, __VA_ARGS__)
+
+
+#define DO_10(MACRO, ...) \
+MACRO(10, __VA_ARGS__) \
+DO_9(MACRO, __VA_ARGS__)
+
+
+#define DO_11(MACRO, ...) \
+MACRO(11, __VA_ARGS__) \
+DO_10(MACRO, __VA_ARGS__)
+
+
+#define DO_12(MACRO, ...) \
+MACRO(12, __VA_ARGS__) \
+DO_11(MACRO, __VA_ARGS__)
+
+
+#define DO_13(MACRO, ...) \
+MACRO(13, __VA_ARGS__) \
+DO_12(MACRO, __VA_ARGS__)
+
+
+#define DO_14(MACRO, ...) \
+MACRO(14, __VA_ARGS__) \
+DO_13(MACRO, __VA_ARGS__)
+
+
+#define DO_15(MACRO, ...) \
+MACRO(15, __VA_ARGS__) \
+DO_14(MACRO, __VA_ARGS__)
+
+
+#define DO_16(MACRO, ...) \
+MACRO(16, __VA_ARGS__) \
+DO_15(MACRO, __VA_ARGS__)
+
+
+#define DO_17(MACRO, ...) \
+MACRO(17, __VA_ARGS__) \
+DO_16(MACRO, __VA_ARGS__)
+
+
+#define DO_18(MACRO, ...) \
+MACRO(18, __VA_ARGS__) \
+DO_17(MACRO, __VA_ARGS__)
+
+
+#define DO_19(MACRO, ...) \
+MACRO(19, __VA_ARGS__) \
+DO_18(MACRO, __VA_ARGS__)
+
+
+#define DO_20(MACRO, ...) \
+MACRO(20, __VA_ARGS__) \
+DO_19(MACRO, __VA_ARGS__)
+
+
+#define DO_21(MACRO, ...) \
+MACRO(21, __VA_ARGS__) \
+DO_20(MACRO, __VA_ARGS__)
+
+
+#define DO_22(MACRO, ...) \
+MACRO(22, __VA_ARGS__) \
+DO_21(MACRO, __VA_ARGS__)
+
+
+#define DO_23(MACRO, ...) \
+MACRO(23, __VA_ARGS__) \
+DO_22(MACRO, __VA_ARGS__)
+
+
+#define DO_24(MACRO, ...) \
+MACRO(24, __VA_ARGS__) \
+DO_23(MACRO, __VA_ARGS__)
+
+
+#define DO_25(MACRO, ...) \
+MACRO(25, __VA_ARGS__) \
+DO_24(MACRO, __VA_ARGS__)
+
+
+#define DO_26(MACRO, ...) \
+MACRO(26, __VA_ARGS__) \
+DO_25(MACRO, __VA_ARGS__)
+
+
+#define DO_27(MACRO, ...) \
+MACRO(27, __VA_ARGS__) \
+DO_26(MACRO, __VA_ARGS__)
+
+
+#define DO_28(MACRO, ...) \
+MACRO(28, __VA_ARGS__) \
+DO_27(MACRO, __VA_ARGS__)
+
+
+#define DO_29(MACRO, ...) \
+MACRO(29, __VA_ARGS__) \
+DO_28(MACRO, __VA_ARGS__)
+
+
+#define DO_30(MACRO, ...) \
+MACRO(30, __VA_ARGS__) \
+DO_29(MACRO, __VA_ARGS__)
+
+
+#define DO_31(MACRO, ...) \
+MACRO(31, __VA_ARGS__) \
+DO_30(MACRO, __VA_ARGS__)
+
+
+#define DO_32(MACRO, ...) \
+MACRO(32, __VA_ARGS__) \
+DO_31(MACRO, __VA_ARGS__)
+
+
+#define DO_33(MACRO, ...) \
+MACRO(33, __VA_ARGS__) \
+DO_32(MACRO, __VA_ARGS__)
+
+
+#define DO_34(MACRO, ...) \
+MACRO(34, __VA_ARGS__) \
+DO_33(MACRO, __VA_ARGS__)
+
+
+#define DO_35(MACRO, ...) \
+MACRO(35, __VA_ARGS__) \
+DO_34(MACRO, __VA_ARGS__)
+
+
+#define DO_36(MACRO, ...) \
+MACRO(36, __VA_ARGS__) \
+DO_35(MACRO, __VA_ARGS__)
+
+
+#define DO_37(MACRO, ...) \
+MACRO(37, __VA_ARGS__) \
+DO_36(MACRO, __VA_ARGS__)
+
+
+#define DO_38(MACRO, ...) \
+MACRO(38, __VA_ARGS__) \
+DO_37(MACRO, __VA_ARGS__)
+
+
+#define DO_39(MACRO, ...) \
+MACRO(39, __VA_ARGS__) \
+DO_38(MACRO, __VA_ARGS__)
+
+
+#define DO_40(MACRO, ...) \
+MACRO(40, __VA_ARGS__) \
+DO_39(MACRO, __VA_ARGS__)
+
+
+#define DO_41(MACRO, ...) \
+MACRO(41, __VA_ARGS__) \
+DO_40(MACRO, __VA_ARGS__)
+
+
+#define DO_42(MACRO, ...) \
+MACRO(42, __VA_ARGS__) \
+DO_41(MACRO, __VA_ARGS__)
+
+
+#define DO_43(MACRO, ...) \
+MACRO(43, __VA_ARGS__) \
+DO_42(MACRO, __VA_ARGS__)
+
+
+#define DO_44(MACRO, ...) \
+MACRO(44, __VA_ARGS__) \
+DO_43(MACRO, __VA_ARGS__)
+
+
+#define DO_45(MACRO, ...) \
+MACRO(45, __VA_ARGS__) \
+DO_44(MACRO, __VA_ARGS__)
+
+
+#define DO_46(MACRO, ...) \
+MACRO(46, __VA_ARGS__) \
+DO_45(MACRO, __VA_ARGS__)
+
+
+#define DO_47(MACRO, ...) \
+MACRO(47, __VA_ARGS__) \
+DO_46(MACRO, __VA_ARGS__)
+
+
+#define DO_48(MACRO, ...) \
+MACRO(48, __VA_ARGS__) \
+DO_47(MACRO, __VA_ARGS__)
+
+
+#define DO_49(MACRO, ...) \
+MACRO(49, __VA_ARGS__) \
+DO_48(MACRO, __VA_ARGS__)
+
+
+#define DO_50(MACRO, ...) \
+MACRO(50, __VA_ARGS__) \
+DO_49(MACRO, __VA_ARGS__)
+
+
+#define DO_51(MACRO, ...) \
+MACRO(51, __VA_ARGS__) \
+DO_50(MACRO, __VA_ARGS__)
+
+
+#define DO_52(MACRO, ...) \
+MACRO(52, __VA_ARGS__) \
+DO_51(MACRO, __VA_ARGS__)
+
+
+#define DO_53(MACRO, ...) \
+MACRO(53, __VA_ARGS__) \
+DO_52(MACRO, __VA_ARGS__)
+
+
+#define DO_54(MACRO, ...) \
+MACRO(54, __VA_ARGS__) \
+DO_53(MACRO, __VA_ARGS__)
+
+
+#define DO_55(MACRO, ...) \
+MACRO(55, __VA_ARGS__) \
+DO_54(MACRO, __VA_ARGS__)
+
+
+#define DO_56(MACRO, ...) \
+MACRO(56, __VA_ARGS__) \
+DO_55(MACRO, __VA_ARGS__)
+
+
+#define DO_57(MACRO, ...) \
+MACRO(57, __VA_ARGS__) \
+DO_56(MACRO, __VA_ARGS__)
+
+
+#define DO_58(MACRO, ...) \
+MACRO(58, __VA_ARGS__) \
+DO_57(MACRO, __VA_ARGS__)
+
+
+#define DO_59(MACRO, ...) \
+MACRO(59, __VA_ARGS__) \
+DO_58(MACRO, __VA_ARGS__)
+
+
+#define DO_60(MACRO, ...) \
+MACRO(60, __VA_ARGS__) \
+DO_59(MACRO, __VA_ARGS__)
+
+
+#define DO_61(MACRO, ...) \
+MACRO(61, __VA_ARGS__) \
+DO_60(MACRO, __VA_ARGS__)
+
+
+#define DO_62(MACRO, ...) \
+MACRO(62, __VA_ARGS__) \
+DO_61(MACRO, __VA_ARGS__)
+
+
+#define DO_63(MACRO, ...) \
+MACRO(63, __VA_ARGS__) \
+DO_62(MACRO, __VA_ARGS__)
+
+
+#define DO_64(MACRO, ...) \
+MACRO(64, __VA_ARGS__) \
+DO_63(MACRO, __VA_ARGS__)
+
+
+#define DO_65(MACRO, ...) \
+MACRO(65, __VA_ARGS__) \
+DO_64(MACRO, __VA_ARGS__)
+
+
+#define DO_66(MACRO, ...) \
+MACRO(66, __VA_ARGS__) \
+DO_65(MACRO, __VA_ARGS__)
+
+
+#define DO_67(MACRO, ...) \
+MACRO(67, __VA_ARGS__) \
+DO_66(MACRO, __VA_ARGS__)
+
+
+#define DO_68(MACRO, ...) \
+MACRO(68, __VA_ARGS__) \
+DO_67(MACRO, __VA_ARGS__)
+
+
+#define DO_69(MACRO, ...) \
+MACRO(69, __VA_ARGS__) \
+DO_68(MACRO, __VA_ARGS__)
+
+
+#define DO_70(MACRO, ...) \
+MACRO(70, __VA_ARGS__) \
+DO_69(MACRO, __VA_ARGS__)
+
+
+#define DO_71(MACRO, ...) \
+MACRO(71, __VA_ARGS__) \
+DO_70(MACRO, __VA_ARGS__)
+
+
+#define DO_72(MACRO, ...) \
+MACRO(72, __VA_ARGS__) \
+DO_71(MACRO, __VA_ARGS__)
+
+
+#define DO_73(MACRO, ...) \
+MACRO(73, __VA_ARGS__) \
+DO_72(MACRO, __VA_ARGS__)
+
+
+#define DO_74(MACRO, ...) \
+MACRO(74, __VA_ARGS__) \
+DO_73(MACRO, __VA_ARGS__)
+
+
+#define DO_75(MACRO, ...) \
+MACRO(75, __VA_ARGS__) \
+DO_74(MACRO, __VA_ARGS__)
+
+
+#define DO_76(MACRO, ...) \
+MACRO(76, __VA_ARGS__) \
+DO_75(MACRO, __VA_ARGS__)
+
+
+#define DO_77(MACRO, ...) \
+MACRO(77, __VA_ARGS__) \
+DO_76(MACRO, __VA_ARGS__)
+
+
+#define DO_78(MACRO, ...) \
+MACRO(78, __VA_ARGS__) \
+DO_77(MACRO, __VA_ARGS__)
+
+
+#define DO_79(MACRO, ...) \
+MACRO(79, __VA_ARGS__) \
+DO_78(MACRO, __VA_ARGS__)
+
+
+#define DO_80(MACRO, ...) \
+MACRO(80, __VA_ARGS__) \
+DO_79(MACRO, __VA_ARGS__)
+
+
+#define DO_81(MACRO, ...) \
+MACRO(81, __VA_ARGS__) \
+DO_80(MACRO, __VA_ARGS__)
+
+
+#define DO_82(MACRO, ...) \
+MACRO(82, __VA_ARGS__) \
+DO_81(MACRO, __VA_ARGS__)
+
+
+#define DO_83(MACRO, ...) \
+MACRO(83, __VA_ARGS__) \
+DO_82(MACRO, __VA_ARGS__)
+
+
+#define DO_84(MACRO, ...) \
+MACRO(84, __VA_ARGS__) \
+DO_83(MACRO, __VA_ARGS__)
+
+
+#define DO_85(MACRO, ...) \
+MACRO(85, __VA_ARGS__) \
+DO_84(MACRO, __VA_ARGS__)
+
+
+#define DO_86(MACRO, ...) \
+MACRO(86, __VA_ARGS__) \
+DO_85(MACRO, __VA_ARGS__)
+
+
+#define DO_87(MACRO, ...) \
+MACRO(87, __VA_ARGS__) \
+DO_86(MACRO, __VA_ARGS__)
+
+
+#define DO_88(MACRO, ...) \
+MACRO(88, __VA_ARGS__) \
+DO_87(MACRO, __VA_ARGS__)
+
+
+#define DO_89(MACRO, ...) \
+MACRO(89, __VA_ARGS__) \
+DO_88(MACRO, __VA_ARGS__)
+
+
+#define DO_90(MACRO, ...) \
+MACRO(90, __VA_ARGS__) \
+DO_89(MACRO, __VA_ARGS__)
+
+
+#define DO_91(MACRO, ...) \
+MACRO(91, __VA_ARGS__) \
+DO_90(MACRO, __VA_ARGS__)
+
+
+#define DO_92(MACRO, ...) \
+MACRO(92, __VA_ARGS__) \
+DO_91(MACRO, __VA_ARGS__)
+
+
+#define DO_93(MACRO, ...) \
+MACRO(93, __VA_ARGS__) \
+DO_92(MACRO, __VA_ARGS__)
+
+
+#define DO_94(MACRO, ...) \
+MACRO(94, __VA_ARGS__) \
+DO_93(MACRO, __VA_ARGS__)
+
+
+#define DO_95(MACRO, ...) \
+MACRO(95, __VA_ARGS__) \
+DO_94(MACRO, __VA_ARGS__)
+
+
+#define DO_96(MACRO, ...) \
+MACRO(96, __VA_ARGS__) \
+DO_95(MACRO, __VA_ARGS__)
+
+
+#define DO_97(MACRO, ...) \
+MACRO(97, __VA_ARGS__) \
+DO_96(MACRO, __VA_ARGS__)
+
+
+#define DO_98(MACRO, ...) \
+MACRO(98, __VA_ARGS__) \
+DO_97(MACRO, __VA_ARGS__)
+
+
+#define DO_99(MACRO, ...) \
+MACRO(99, __VA_ARGS__) \
+DO_98(MACRO, __VA_ARGS__)
+
+
+#define DO_100(MACRO, ...) \
+MACRO(100, __VA_ARGS__) \
+DO_99(MACRO, __VA_ARGS__)
+
+
+#define DO_101(MACRO, ...) \
+MACRO(101, __VA_ARGS__) \
+DO_100(MACRO, __VA_ARGS__)
+
+
+#define DO_102(MACRO, ...) \
+MACRO(102, __VA_ARGS__) \
+DO_101(MACRO, __VA_ARGS__)
+
+
+#define DO_103(MACRO, ...) \
+MACRO(103, __VA_ARGS__) \
+DO_102(MACRO, __VA_ARGS__)
+
+
+#define DO_104(MACRO, ...) \
+MACRO(104, __VA_ARGS__) \
+DO_103(MACRO, __VA_ARGS__)
+
+
+#define DO_105(MACRO, ...) \
+MACRO(105, __VA_ARGS__) \
+DO_104(MACRO, __VA_ARGS__)
+
+
+#define DO_106(MACRO, ...) \
+MACRO(106, __VA_ARGS__) \
+DO_105(MACRO, __VA_ARGS__)
+
+
+#define DO_107(MACRO, ...) \
+MACRO(107, __VA_ARGS__) \
+DO_106(MACRO, __VA_ARGS__)
+
+
+#define DO_108(MACRO, ...) \
+MACRO(108, __VA_ARGS__) \
+DO_107(MACRO, __VA_ARGS__)
+
+
+#define DO_109(MACRO, ...) \
+MACRO(109, __VA_ARGS__) \
+DO_108(MACRO, __VA_ARGS__)
+
+
+#define DO_110(MACRO, ...) \
+MACRO(110, __VA_ARGS__) \
+DO_109(MACRO, __VA_ARGS__)
+
+
+#define DO_111(MACRO, ...) \
+MACRO(111, __VA_ARGS__) \
+DO_110(MACRO, __VA_ARGS__)
+
+
+#define DO_112(MACRO, ...) \
+MACRO(112, __VA_ARGS__) \
+DO_111(MACRO, __VA_ARGS__)
+
+
+#define DO_113(MACRO, ...) \
+MACRO(113, __VA_ARGS__) \
+DO_112(MACRO, __VA_ARGS__)
+
+
+#define DO_114(MACRO, ...) \
+MACRO(114, __VA_ARGS__) \
+DO_113(MACRO, __VA_ARGS__)
+
+
+#define DO_115(MACRO, ...) \
+MACRO(115, __VA_ARGS__) \
+DO_114(MACRO, __VA_ARGS__)
+
+
+#define DO_116(MACRO, ...) \
+MACRO(116, __VA_ARGS__) \
+DO_115(MACRO, __VA_ARGS__)
+
+
+#define DO_117(MACRO, ...) \
+MACRO(117, __VA_ARGS__) \
+DO_116(MACRO, __VA_ARGS__)
+
+
+#define DO_118(MACRO, ...) \
+MACRO(118, __VA_ARGS__) \
+DO_117(MACRO, __VA_ARGS__)
+
+
+#define DO_119(MACRO, ...) \
+MACRO(119, __VA_ARGS__) \
+DO_118(MACRO, __VA_ARGS__)
+
+
+#define DO_120(MACRO, ...) \
+MACRO(120, __VA_ARGS__) \
+DO_119(MACRO, __VA_ARGS__)
+
+
+#define DO_121(MACRO, ...) \
+MACRO(121, __VA_ARGS__) \
+DO_120(MACRO, __VA_ARGS__)
+
+
+#define DO_122(MACRO, ...) \
+MACRO(122, __VA_ARGS__) \
+DO_121(MACRO, __VA_ARGS__)
+
+
+#define DO_123(MACRO, ...) \
+MACRO(123, __VA_ARGS__) \
+DO_122(MACRO, __VA_ARGS__)
+
+
+#define DO_124(MACRO, ...) \
+MACRO(124, __VA_ARGS__) \
+DO_123(MACRO, __VA_ARGS__)
+
+
+#define DO_125(MACRO, ...) \
+MACRO(125, __VA_ARGS__) \
+DO_124(MACRO, __VA_ARGS__)
+
+
+#define DO_126(MACRO, ...) \
+MACRO(126, __VA_ARGS__) \
+DO_125(MACRO, __VA_ARGS__)
+
+
+#define DO_127(MACRO, ...) \
+MACRO(127, __VA_ARGS__) \
+DO_126(MACRO, __VA_ARGS__)
+
+
+#define DO_128(MACRO, ...) \
+MACRO(128, __VA_ARGS__) \
+DO_127(MACRO, __VA_ARGS__)
+
+
+#define DO_129(MACRO, ...) \
+MACRO(129, __VA_ARGS__) \
+DO_128(MACRO, __VA_ARGS__)
+
+
+#define DO_130(MACRO, ...) \
+MACRO(130, __VA_ARGS__) \
+DO_129(MACRO, __VA_ARGS__)
+
+
+#define DO_131(MACRO, ...) \
+MACRO(131, __VA_ARGS__) \
+DO_130(MACRO, __VA_ARGS__)
+
+
+#define DO_132(MACRO, ...) \
+MACRO(132, __VA_ARGS__) \
+DO_131(MACRO, __VA_ARGS__)
+
+
+#define DO_133(MACRO, ...) \
+MACRO(133, __VA_ARGS__) \
+DO_132(MACRO, __VA_ARGS__)
+
+
+#define DO_134(MACRO, ...) \
+MACRO(134, __VA_ARGS__) \
+DO_133(MACRO, __VA_ARGS__)
+
+
+#define DO_135(MACRO, ...) \
+MACRO(135, __VA_ARGS__) \
+DO_134(MACRO, __VA_ARGS__)
+
+
+#define DO_136(MACRO, ...) \
+MACRO(136, __VA_ARGS__) \
+DO_135(MACRO, __VA_ARGS__)
+
+
+#define DO_137(MACRO, ...) \
+MACRO(137, __VA_ARGS__) \
+DO_136(MACRO, __VA_ARGS__)
+
+
+#define DO_138(MACRO, ...) \
+MACRO(138, __VA_ARGS__) \
+DO_137(MACRO, __VA_ARGS__)
+
+
+#define DO_139(MACRO, ...) \
+MACRO(139, __VA_ARGS__) \
+DO_138(MACRO, __VA_ARGS__)
+
+
+#define DO_140(MACRO, ...) \
+MACRO(140, __VA_ARGS__) \
+DO_139(MACRO, __VA_ARGS__)
+
+
+#define DO_141(MACRO, ...) \
+MACRO(141, __VA_ARGS__) \
+DO_140(MACRO, __VA_ARGS__)
+
+
+#define DO_142(MACRO, ...) \
+MACRO(142, __VA_ARGS__) \
+DO_141(MACRO, __VA_ARGS__)
+
+
+#define DO_143(MACRO, ...) \
+MACRO(143, __VA_ARGS__) \
+DO_142(MACRO, __VA_ARGS__)
+
+
+#define DO_144(MACRO, ...) \
+MACRO(144, __VA_ARGS__) \
+DO_143(MACRO, __VA_ARGS__)
+
+
+#define DO_145(MACRO, ...) \
+MACRO(145, __VA_ARGS__) \
+DO_144(MACRO, __VA_ARGS__)
+
+
+#define DO_146(MACRO, ...) \
+MACRO(146, __VA_ARGS__) \
+DO_145(MACRO, __VA_ARGS__)
+
+
+#define DO_147(MACRO, ...) \
+MACRO(147, __VA_ARGS__) \
+DO_146(MACRO, __VA_ARGS__)
+
+
+#define DO_148(MACRO, ...) \
+MACRO(148, __VA_ARGS__) \
+DO_147(MACRO, __VA_ARGS__)
+
+
+#define DO_149(MACRO, ...) \
+MACRO(149, __VA_ARGS__) \
+DO_148(MACRO, __VA_ARGS__)
+
+
+#define DO_150(MACRO, ...) \
+MACRO(150, __VA_ARGS__) \
+DO_149(MACRO, __VA_ARGS__)
+
+
+#define DO_151(MACRO, ...) \
+MACRO(151, __VA_ARGS__) \
+DO_150(MACRO, __VA_ARGS__)
+
+
+#define DO_152(MACRO, ...) \
+MACRO(152, __VA_ARGS__) \
+DO_151(MACRO, __VA_ARGS__)
+
+
+#define DO_153(MACRO, ...) \
+MACRO(153, __VA_ARGS__) \
+DO_152(MACRO, __VA_ARGS__)
+
+
+#define DO_154(MACRO, ...) \
+MACRO(154, __VA_ARGS__) \
+DO_153(MACRO, __VA_ARGS__)
+
+
+#define DO_155(MACRO, ...) \
+MACRO(155, __VA_ARGS__) \
+DO_154(MACRO, __VA_ARGS__)
+
+
+#define DO_156(MACRO, ...) \
+MACRO(156, __VA_ARGS__) \
+DO_155(MACRO, __VA_ARGS__)
+
+
+#define DO_157(MACRO, ...) \
+MACRO(157, __VA_ARGS__) \
+DO_156(MACRO, __VA_ARGS__)
+
+
+#define DO_158(MACRO, ...) \
+MACRO(158, __VA_ARGS__) \
+DO_157(MACRO, __VA_ARGS__)
+
+
+#define DO_159(MACRO, ...) \
+MACRO(159, __VA_ARGS__) \
+DO_158(MACRO, __VA_ARGS__)
+
+
+#define DO_160(MACRO, ...) \
+MACRO(160, __VA_ARGS__) \
+DO_159(MACRO, __VA_ARGS__)
+
+
+#define DO_161(MACRO, ...) \
+MACRO(161, __VA_ARGS__) \
+DO_160(MACRO, __VA_ARGS__)
+
+
+#define DO_162(MACRO, ...) \
+MACRO(162, __VA_ARGS__) \
+DO_161(MACRO, __VA_ARGS__)
+
+
+#define DO_163(MACRO, ...) \
+MACRO(163, __VA_ARGS__) \
+DO_162(MACRO, __VA_ARGS__)
+
+
+#define DO_164(MACRO, ...) \
+MACRO(164, __VA_ARGS__) \
+DO_163(MACRO, __VA_ARGS__)
+
+
+#define DO_165(MACRO, ...) \
+MACRO(165, __VA_ARGS__) \
+DO_164(MACRO, __VA_ARGS__)
+
+
+#define DO_166(MACRO, ...) \
+MACRO(166, __VA_ARGS__) \
+DO_165(MACRO, __VA_ARGS__)
+
+
+#define DO_167(MACRO, ...) \
+MACRO(167, __VA_ARGS__) \
+DO_166(MACRO, __VA_ARGS__)
+
+
+#define DO_168(MACRO, ...) \
+MACRO(168, __VA_ARGS__) \
+DO_167(MACRO, __VA_ARGS__)
+
+
+#define DO_169(MACRO, ...) \
+MACRO(169, __VA_ARGS__) \
+DO_168(MACRO, __VA_ARGS__)
+
+
+#define DO_170(MACRO, ...) \
+MACRO(170, __VA_ARGS__) \
+DO_169(MACRO, __VA_ARGS__)
+
+
+#define DO_171(MACRO, ...) \
+MACRO(171, __VA_ARGS__) \
+DO_170(MACRO, __VA_ARGS__)
+
+
+#define DO_172(MACRO, ...) \
+MACRO(172, __VA_ARGS__) \
+DO_171(MACRO, __VA_ARGS__)
+
+
+#define DO_173(MACRO, ...) \
+MACRO(173, __VA_ARGS__) \
+DO_172(MACRO, __VA_ARGS__)
+
+
+#define DO_174(MACRO, ...) \
+MACRO(174, __VA_ARGS__) \
+DO_173(MACRO, __VA_ARGS__)
+
+
+#define DO_175(MACRO, ...) \
+MACRO(175, __VA_ARGS__) \
+DO_174(MACRO, __VA_ARGS__)
+
+
+#define DO_176(MACRO, ...) \
+MACRO(176, __VA_ARGS__) \
+DO_175(MACRO, __VA_ARGS__)
+
+
+#define DO_177(MACRO, ...) \
+MACRO(177, __VA_ARGS__) \
+DO_176(MACRO, __VA_ARGS__)
+
+
+#define DO_178(MACRO, ...) \
+MACRO(178, __VA_ARGS__) \
+DO_177(MACRO, __VA_ARGS__)
+
+
+#define DO_179(MACRO, ...) \
+MACRO(179, __VA_ARGS__) \
+DO_178(MACRO, __VA_ARGS__)
+
+
+#define DO_180(MACRO, ...) \
+MACRO(180, __VA_ARGS__) \
+DO_179(MACRO, __VA_ARGS__)
+
+
+#define DO_181(MACRO, ...) \
+MACRO(181, __VA_ARGS__) \
+DO_180(MACRO, __VA_ARGS__)
+
+
+#define DO_182(MACRO, ...) \
+MACRO(182, __VA_ARGS__) \
+DO_181(MACRO, __VA_ARGS__)
+
+
+#define DO_183(MACRO, ...) \
+MACRO(183, __VA_ARGS__) \
+DO_182(MACRO, __VA_ARGS__)
+
+
+#define DO_184(MACRO, ...) \
+MACRO(184, __VA_ARGS__) \
+DO_183(MACRO, __VA_ARGS__)
+
+
+#define DO_185(MACRO, ...) \
+MACRO(185, __VA_ARGS__) \
+DO_184(MACRO, __VA_ARGS__)
+
+
+#define DO_186(MACRO, ...) \
+MACRO(186, __VA_ARGS__) \
+DO_185(MACRO, __VA_ARGS__)
+
+
+#define DO_187(MACRO, ...) \
+MACRO(187, __VA_ARGS__) \
+DO_186(MACRO, __VA_ARGS__)
+
+
+#define DO_188(MACRO, ...) \
+MACRO(188, __VA_ARGS__) \
+DO_187(MACRO, __VA_ARGS__)
+
+
+#define DO_189(MACRO, ...) \
+MACRO(189, __VA_ARGS__) \
+DO_188(MACRO, __VA_ARGS__)
+
+
+#define DO_190(MACRO, ...) \
+MACRO(190, __VA_ARGS__) \
+DO_189(MACRO, __VA_ARGS__)
+
+
+#define DO_191(MACRO, ...) \
+MACRO(191, __VA_ARGS__) \
+DO_190(MACRO, __VA_ARGS__)
+
+
+#define DO_192(MACRO, ...) \
+MACRO(192, __VA_ARGS__) \
+DO_191(MACRO, __VA_ARGS__)
+
+
+#define DO_193(MACRO, ...) \
+MACRO(193, __VA_ARGS__) \
+DO_192(MACRO, __VA_ARGS__)
+
+
+#define DO_194(MACRO, ...) \
+MACRO(194, __VA_ARGS__) \
+DO_193(MACRO, __VA_ARGS__)
+
+
+#define DO_195(MACRO, ...) \
+MACRO(195, __VA_ARGS__) \
+DO_194(MACRO, __VA_ARGS__)
+
+
+#define DO_196(MACRO, ...) \
+MACRO(196, __VA_ARGS__) \
+DO_195(MACRO, __VA_ARGS__)
+
+
+#define DO_197(MACRO, ...) \
+MACRO(197, __VA_ARGS__) \
+DO_196(MACRO, __VA_ARGS__)
+
+
+#define DO_198(MACRO, ...) \
+MACRO(198, __VA_ARGS__) \
+DO_197(MACRO, __VA_ARGS__)
+
+
+#define DO_199(MACRO, ...) \
+MACRO(199, __VA_ARGS__) \
+DO_198(MACRO, __VA_ARGS__)
+
+
+#define DO_200(MACRO, ...) \
+MACRO(200, __VA_ARGS__) \
+DO_199(MACRO, __VA_ARGS__)
+
+
+#define DO_201(MACRO, ...) \
+MACRO(201, __VA_ARGS__) \
+DO_200(MACRO, __VA_ARGS__)
+
+
+#define DO_202(MACRO, ...) \
+MACRO(202, __VA_ARGS__) \
+DO_201(MACRO, __VA_ARGS__)
+
+
+#define DO_203(MACRO, ...) \
+MACRO(203, __VA_ARGS__) \
+DO_202(MACRO, __VA_ARGS__)
+
+
+#define DO_204(MACRO, ...) \
+MACRO(204, __VA_ARGS__) \
+DO_203(MACRO, __VA_ARGS__)
+
+
+#define DO_205(MACRO, ...) \
+MACRO(205, __VA_ARGS__) \
+DO_204(MACRO, __VA_ARGS__)
+
+
+#define DO_206(MACRO, ...) \
+MACRO(206, __VA_ARGS__) \
+DO_205(MACRO, __VA_ARGS__)
+
+
+#define DO_207(MACRO, ...) \
+MACRO(207, __VA_ARGS__) \
+DO_206(MACRO, __VA_ARGS__)
+
+
+#define DO_208(MACRO, ...) \
+MACRO(208, __VA_ARGS__) \
+DO_207(MACRO, __VA_ARGS__)
+
+
+#define DO_209(MACRO, ...) \
+MACRO(209, __VA_ARGS__) \
+DO_208(MACRO, __VA_ARGS__)
+
+
+#define DO_210(MACRO, ...) \
+MACRO(210, __VA_ARGS__) \
+DO_209(MACRO, __VA_ARGS__)
+
+
+#define DO_211(MACRO, ...) \
+MACRO(211, __VA_ARGS__) \
+DO_210(MACRO, __VA_ARGS__)
+
+
+#define DO_212(MACRO, ...) \
+MACRO(212, __VA_ARGS__) \
+DO_211(MACRO, __VA_ARGS__)
+
+
+#define DO_213(MACRO, ...) \
+MACRO(213, __VA_ARGS__) \
+DO_212(MACRO, __VA_ARGS__)
+
+
+#define DO_214(MACRO, ...) \
+MACRO(214, __VA_ARGS__) \
+DO_213(MACRO, __VA_ARGS__)
+
+
+#define DO_215(MACRO, ...) \
+MACRO(215, __VA_ARGS__) \
+DO_214(MACRO, __VA_ARGS__)
+
+
+#define DO_216(MACRO, ...) \
+MACRO(216, __VA_ARGS__) \
+DO_215(MACRO, __VA_ARGS__)
+
+
+#define DO_217(MACRO, ...) \
+MACRO(217, __VA_ARGS__) \
+DO_216(MACRO, __VA_ARGS__)
+
+
+#define DO_218(MACRO, ...) \
+MACRO(218, __VA_ARGS__) \
+DO_217(MACRO, __VA_ARGS__)
+
+
+#define DO_219(MACRO, ...) \
+MACRO(219, __VA_ARGS__) \
+DO_218(MACRO, __VA_ARGS__)
+
+
+#define DO_220(MACRO, ...) \
+MACRO(220, __VA_ARGS__) \
+DO_219(MACRO, __VA_ARGS__)
+
+
+#define DO_221(MACRO, ...) \
+MACRO(221, __VA_ARGS__) \
+DO_220(MACRO, __VA_ARGS__)
+
+
+#define DO_222(MACRO, ...) \
+MACRO(222, __VA_ARGS__) \
+DO_221(MACRO, __VA_ARGS__)
+
+
+#define DO_223(MACRO, ...) \
+MACRO(223, __VA_ARGS__) \
+DO_222(MACRO, __VA_ARGS__)
+
+
+#define DO_224(MACRO, ...) \
+MACRO(224, __VA_ARGS__) \
+DO_223(MACRO, __VA_ARGS__)
+
+
+#define DO_225(MACRO, ...) \
+MACRO(225, __VA_ARGS__) \
+DO_224(MACRO, __VA_ARGS__)
+
+
+#define DO_226(MACRO, ...) \
+MACRO(226, __VA_ARGS__) \
+DO_225(MACRO, __VA_ARGS__)
+
+
+#define DO_227(MACRO, ...) \
+MACRO(227, __VA_ARGS__) \
+DO_226(MACRO, __VA_ARGS__)
+
+
+#define DO_228(MACRO, ...) \
+MACRO(228, __VA_ARGS__) \
+DO_227(MACRO, __VA_ARGS__)
+
+
+#define DO_229(MACRO, ...) \
+MACRO(229, __VA_ARGS__) \
+DO_228(MACRO, __VA_ARGS__)
+
+
+#define DO_230(MACRO, ...) \
+MACRO(230, __VA_ARGS__) \
+DO_229(MACRO, __VA_ARGS__)
+
+
+#define DO_231(MACRO, ...) \
+MACRO(231, __VA_ARGS__) \
+DO_230(MACRO, __VA_ARGS__)
+
+
+#define DO_232(MACRO, ...) \
+MACRO(232, __VA_ARGS__) \
+DO_231(MACRO, __VA_ARGS__)
+
+
+#define DO_233(MACRO, ...) \
+MACRO(233, __VA_ARGS__) \
+DO_232(MACRO, __VA_ARGS__)
+
+
+#define DO_234(MACRO, ...) \
+MACRO(234, __VA_ARGS__) \
+DO_233(MACRO, __VA_ARGS__)
+
+
+#define DO_235(MACRO, ...) \
+MACRO(235, __VA_ARGS__) \
+DO_234(MACRO, __VA_ARGS__)
+
+
+#define DO_236(MACRO, ...) \
+MACRO(236, __VA_ARGS__) \
+DO_235(MACRO, __VA_ARGS__)
+
+
+#define DO_237(MACRO, ...) \
+MACRO(237, __VA_ARGS__) \
+DO_236(MACRO, __VA_ARGS__)
+
+
+#define DO_238(MACRO, ...) \
+MACRO(238, __VA_ARGS__) \
+DO_237(MACRO, __VA_ARGS__)
+
+
+#define DO_239(MACRO, ...) \
+MACRO(239, __VA_ARGS__) \
+DO_238(MACRO, __VA_ARGS__)
+
+
+#define DO_240(MACRO, ...) \
+MACRO(240, __VA_ARGS__) \
+DO_239(MACRO, __VA_ARGS__)
+
+
+#define DO_241(MACRO, ...) \
+MACRO(241, __VA_ARGS__) \
+DO_240(MACRO, __VA_ARGS__)
+
+
+#define DO_242(MACRO, ...) \
+MACRO(242, __VA_ARGS__) \
+DO_241(MACRO, __VA_ARGS__)
+
+
+#define DO_243(MACRO, ...) \
+MACRO(243, __VA_ARGS__) \
+DO_242(MACRO, __VA_ARGS__)
+
+
+#define DO_244(MACRO, ...) \
+MACRO(244, __VA_ARGS__) \
+DO_243(MACRO, __VA_ARGS__)
+
+
+#define DO_245(MACRO, ...) \
+MACRO(245, __VA_ARGS__) \
+DO_244(MACRO, __VA_ARGS__)
+
+
+#define DO_246(MACRO, ...) \
+MACRO(246, __VA_ARGS__) \
+DO_245(MACRO, __VA_ARGS__)
+
+
+#define DO_247(MACRO, ...) \
+MACRO(247, __VA_ARGS__) \
+DO_246(MACRO, __VA_ARGS__)
+
+
+#define DO_248(MACRO, ...) \
+MACRO(248, __VA_ARGS__) \
+DO_247(MACRO, __VA_ARGS__)
+
+
+#define DO_249(MACRO, ...) \
+MACRO(249, __VA_ARGS__) \
+DO_248(MACRO, __VA_ARGS__)
+
+
+#define DO_250(MACRO, ...) \
+MACRO(250, __VA_ARGS__) \
+DO_249(MACRO, __VA_ARGS__)
+
+
+#define DO_251(MACRO, ...) \
+MACRO(251, __VA_ARGS__) \
+DO_250(MACRO, __VA_ARGS__)
+
+
+#define DO_252(MACRO, ...) \
+MACRO(252, __VA_ARGS__) \
+DO_251(MACRO, __VA_ARGS__)
+
+
+#define DO_253(MACRO, ...) \
+MACRO(253, __VA_ARGS__) \
+DO_252(MACRO, __VA_ARGS__)
+
+
+#define DO_254(MACRO, ...) \
+MACRO(254, __VA_ARGS__) \
+DO_253(MACRO, __VA_ARGS__)
+
+
+#define DO_255(MACRO, ...) \
+MACRO(255, __VA_ARGS__) \
+DO_254(MACRO, __VA_ARGS__)
+
+
+#define DO_256(MACRO, ...) \
+MACRO(256, __VA_ARGS__) \
+DO_255(MACRO, __VA_ARGS__)
+
+
+#define DO_257(MACRO, ...) \
+MACRO(257, __VA_ARGS__) \
+DO_256(MACRO, __VA_ARGS__)
+
+
+#define DO_258(MACRO, ...) \
+MACRO(258, __VA_ARGS__) \
+DO_257(MACRO, __VA_ARGS__)
+
+
+#define DO_259(MACRO, ...) \
+MACRO(259, __VA_ARGS__) \
+DO_258(MACRO, __VA_ARGS__)
+
+
+#define DO_260(MACRO, ...) \
+MACRO(260, __VA_ARGS__) \
+DO_259(MACRO, __VA_ARGS__)
+
+
+#define DO_261(MACRO, ...) \
+MACRO(261, __VA_ARGS__) \
+DO_260(MACRO, __VA_ARGS__)
+
+
+#define DO_262(MACRO, ...) \
+MACRO(262, __VA_ARGS__) \
+DO_261(MACRO, __VA_ARGS__)
+
+
+#define DO_263(MACRO, ...) \
+MACRO(263, __VA_ARGS__) \
+DO_262(MACRO, __VA_ARGS__)
+
+
+#define DO_264(MACRO, ...) \
+MACRO(264, __VA_ARGS__) \
+DO_263(MACRO, __VA_ARGS__)
+
+
+#define DO_265(MACRO, ...) \
+MACRO(265, __VA_ARGS__) \
+DO_264(MACRO, __VA_ARGS__)
+
+
+#define DO_266(MACRO, ...) \
+MACRO(266, __VA_ARGS__) \
+DO_265(MACRO, __VA_ARGS__)
+
+
+#define DO_267(MACRO, ...) \
+MACRO(267, __VA_ARGS__) \
+DO_266(MACRO, __VA_ARGS__)
+
+
+#define DO_268(MACRO, ...) \
+MACRO(268, __VA_ARGS__) \
+DO_267(MACRO, __VA_ARGS__)
+
+
+#define DO_269(MACRO, ...) \
+MACRO(269, __VA_ARGS__) \
+DO_268(MACRO, __VA_ARGS__)
+
+
+#define DO_270(MACRO, ...) \
+MACRO(270, __VA_ARGS__) \
+DO_269(MACRO, __VA_ARGS__)
+
+
+#define DO_271(MACRO, ...) \
+MACRO(271, __VA_ARGS__) \
+DO_270(MACRO, __VA_ARGS__)
+
+
+#define DO_272(MACRO, ...) \
+MACRO(272, __VA_ARGS__) \
+DO_271(MACRO, __VA_ARGS__)
+
+
+#define DO_273(MACRO, ...) \
+MACRO(273, __VA_ARGS__) \
+DO_272(MACRO, __VA_ARGS__)
+
+
+#define DO_274(MACRO, ...) \
+MACRO(274, __VA_ARGS__) \
+DO_273(MACRO, __VA_ARGS__)
+
+
+#define DO_275(MACRO, ...) \
+MACRO(275, __VA_ARGS__) \
+DO_274(MACRO, __VA_ARGS__)
+
+
+#define DO_276(MACRO, ...) \
+MACRO(276, __VA_ARGS__) \
+DO_275(MACRO, __VA_ARGS__)
+
+
+#define DO_277(MACRO, ...) \
+MACRO(277, __VA_ARGS__) \
+DO_276(MACRO, __VA_ARGS__)
+
+
+#define DO_278(MACRO, ...) \
+MACRO(278, __VA_ARGS__) \
+DO_277(MACRO, __VA_ARGS__)
+
+
+#define DO_279(MACRO, ...) \
+MACRO(279, __VA_ARGS__) \
+DO_278(MACRO, __VA_ARGS__)
+
+
+#define DO_280(MACRO, ...) \
+MACRO(280, __VA_ARGS__) \
+DO_279(MACRO, __VA_ARGS__)
+
+
+#define DO_281(MACRO, ...) \
+MACRO(281, __VA_ARGS__) \
+DO_280(MACRO, __VA_ARGS__)
+
+
+#define DO_282(MACRO, ...) \
+MACRO(282, __VA_ARGS__) \
+DO_281(MACRO, __VA_ARGS__)
+
+
+#define DO_283(MACRO, ...) \
+MACRO(283, __VA_ARGS__) \
+DO_282(MACRO, __VA_ARGS__)
+
+
+#define DO_284(MACRO, ...) \
+MACRO(284, __VA_ARGS__) \
+DO_283(MACRO, __VA_ARGS__)
+
+
+#define DO_285(MACRO, ...) \
+MACRO(285, __VA_ARGS__) \
+DO_284(MACRO, __VA_ARGS__)
+
+
+#define DO_286(MACRO, ...) \
+MACRO(286, __VA_ARGS__) \
+DO_285(MACRO, __VA_ARGS__)
+
+
+#define DO_287(MACRO, ...) \
+MACRO(287, __VA_ARGS__) \
+DO_286(MACRO, __VA_ARGS__)
+
+
+#define DO_288(MACRO, ...) \
+MACRO(288, __VA_ARGS__) \
+DO_287(MACRO, __VA_ARGS__)
+
+
+#define DO_289(MACRO, ...) \
+MACRO(289, __VA_ARGS__) \
+DO_288(MACRO, __VA_ARGS__)
+
+
+#define DO_290(MACRO, ...) \
+MACRO(290, __VA_ARGS__) \
+DO_289(MACRO, __VA_ARGS__)
+
+
+#define DO_291(MACRO, ...) \
+MACRO(291, __VA_ARGS__) \
+DO_290(MACRO, __VA_ARGS__)
+
+
+#define DO_292(MACRO, ...) \
+MACRO(292, __VA_ARGS__) \
+DO_291(MACRO, __VA_ARGS__)
+
+
+#define DO_293(MACRO, ...) \
+MACRO(293, __VA_ARGS__) \
+DO_292(MACRO, __VA_ARGS__)
+
+
+#define DO_294(MACRO, ...) \
+MACRO(294, __VA_ARGS__) \
+DO_293(MACRO, __VA_ARGS__)
+
+
+#define DO_295(MACRO, ...) \
+MACRO(295, __VA_ARGS__) \
+DO_294(MACRO, __VA_ARGS__)
+
+
+#define DO_296(MACRO, ...) \
+MACRO(296, __VA_ARGS__) \
+DO_295(MACRO, __VA_ARGS__)
+
+
+#define DO_297(MACRO, ...) \
+MACRO(297, __VA_ARGS__) \
+DO_296(MACRO, __VA_ARGS__)
+
+
+#define DO_298(MACRO, ...) \
+MACRO(298, __VA_ARGS__) \
+DO_297(MACRO, __VA_ARGS__)
+
+
+#define DO_299(MACRO, ...) \
+MACRO(299, __VA_ARGS__) \
+DO_298(MACRO, __VA_ARGS__)
+
+
+#define DO_300(MACRO, ...) \
+MACRO(300, __VA_ARGS__) \
+DO_299(MACRO, __VA_ARGS__)
+
+
+#define DO_301(MACRO, ...) \
+MACRO(301, __VA_ARGS__) \
+DO_300(MACRO, __VA_ARGS__)
+
+
+#define DO_302(MACRO, ...) \
+MACRO(302, __VA_ARGS__) \
+DO_301(MACRO, __VA_ARGS__)
+
+
+#define DO_303(MACRO, ...) \
+MACRO(303, __VA_ARGS__) \
+DO_302(MACRO, __VA_ARGS__)
+
+
+#define DO_304(MACRO, ...) \
+MACRO(304, __VA_ARGS__) \
+DO_303(MACRO, __VA_ARGS__)
+
+
+#define DO_305(MACRO, ...) \
+MACRO(305, __VA_ARGS__) \
+DO_304(MACRO, __VA_ARGS__)
+
+
+#define DO_306(MACRO, ...) \
+MACRO(306, __VA_ARGS__) \
+DO_305(MACRO, __VA_ARGS__)
+
+
+#define DO_307(MACRO, ...) \
+MACRO(307, __VA_ARGS__) \
+DO_306(MACRO, __VA_ARGS__)
+
+
+#define DO_308(MACRO, ...) \
+MACRO(308, __VA_ARGS__) \
+DO_307(MACRO, __VA_ARGS__)
+
+
+#define DO_309(MACRO, ...) \
+MACRO(309, __VA_ARGS__) \
+DO_308(MACRO, __VA_ARGS__)
+
+
+#define DO_310(MACRO, ...) \
+MACRO(310, __VA_ARGS__) \
+DO_309(MACRO, __VA_ARGS__)
+
+
+#define DO_311(MACRO, ...) \
+MACRO(311, __VA_ARGS__) \
+DO_310(MACRO, __VA_ARGS__)
+
+
+#define DO_312(MACRO, ...) \
+MACRO(312, __VA_ARGS__) \
+DO_311(MACRO, __VA_ARGS__)
+
+
+#define DO_313(MACRO, ...) \
+MACRO(313, __VA_ARGS__) \
+DO_312(MACRO, __VA_ARGS__)
+
+
+#define DO_314(MACRO, ...) \
+MACRO(314, __VA_ARGS__) \
+DO_313(MACRO, __VA_ARGS__)
+
+
+#define DO_315(MACRO, ...) \
+MACRO(315, __VA_ARGS__) \
+DO_314(MACRO, __VA_ARGS__)
+
+
+#define DO_316(MACRO, ...) \
+MACRO(316, __VA_ARGS__) \
+DO_315(MACRO, __VA_ARGS__)
+
+
+#define DO_317(MACRO, ...) \
+MACRO(317, __VA_ARGS__) \
+DO_316(MACRO, __VA_ARGS__)
+
+
+#define DO_318(MACRO, ...) \
+MACRO(318, __VA_ARGS__) \
+DO_317(MACRO, __VA_ARGS__)
+
+
+#define DO_319(MACRO, ...) \
+MACRO(319, __VA_ARGS__) \
+DO_318(MACRO, __VA_ARGS__)
+
+
+#define DO_320(MACRO, ...) \
+MACRO(320, __VA_ARGS__) \
+DO_319(MACRO, __VA_ARGS__)
+
+
+#define DO_321(MACRO, ...) \
+MACRO(321, __VA_ARGS__) \
+DO_320(MACRO, __VA_ARGS__)
+
+
+#define DO_322(MACRO, ...) \
+MACRO(322, __VA_ARGS__) \
+DO_321(MACRO, __VA_ARGS__)
+
+
+#define DO_323(MACRO, ...) \
+MACRO(323, __VA_ARGS__) \
+DO_322(MACRO, __VA_ARGS__)
+
+
+#define DO_324(MACRO, ...) \
+MACRO(324, __VA_ARGS__) \
+DO_323(MACRO, __VA_ARGS__)
+
+
+#define DO_325(MACRO, ...) \
+MACRO(325, __VA_ARGS__) \
+DO_324(MACRO, __VA_ARGS__)
+
+
+#define DO_326(MACRO, ...) \
+MACRO(326, __VA_ARGS__) \
+DO_325(MACRO, __VA_ARGS__)
+
+
+#define DO_327(MACRO, ...) \
+MACRO(327, __VA_ARGS__) \
+DO_326(MACRO, __VA_ARGS__)
+
+
+#define DO_328(MACRO, ...) \
+MACRO(328, __VA_ARGS__) \
+DO_327(MACRO, __VA_ARGS__)
+
+
+#define DO_329(MACRO, ...) \
+MACRO(329, __VA_ARGS__) \
+DO_328(MACRO, __VA_ARGS__)
+
+
+#define DO_330(MACRO, ...) \
+MACRO(330, __VA_ARGS__) \
+DO_329(MACRO, __VA_ARGS__)
+
+
+#define DO_331(MACRO, ...) \
+MACRO(331, __VA_ARGS__) \
+DO_330(MACRO, __VA_ARGS__)
+
+
+#define DO_332(MACRO, ...) \
+MACRO(332, __VA_ARGS__) \
+DO_331(MACRO, __VA_ARGS__)
+
+
+#define DO_333(MACRO, ...) \
+MACRO(333, __VA_ARGS__) \
+DO_332(MACRO, __VA_ARGS__)
+
+
+#define DO_334(MACRO, ...) \
+MACRO(334, __VA_ARGS__) \
+DO_333(MACRO, __VA_ARGS__)
+
+
+#define DO_335(MACRO, ...) \
+MACRO(335, __VA_ARGS__) \
+DO_334(MACRO, __VA_ARGS__)
+
+
+#define DO_336(MACRO, ...) \
+MACRO(336, __VA_ARGS__) \
+DO_335(MACRO, __VA_ARGS__)
+
+
+#define DO_337(MACRO, ...) \
+MACRO(337, __VA_ARGS__) \
+DO_336(MACRO, __VA_ARGS__)
+
+
+#define DO_338(MACRO, ...) \
+MACRO(338, __VA_ARGS__) \
+DO_337(MACRO, __VA_ARGS__)
+
+
+#define DO_339(MACRO, ...) \
+MACRO(339, __VA_ARGS__) \
+DO_338(MACRO, __VA_ARGS__)
+
+
+#define DO_340(MACRO, ...) \
+MACRO(340, __VA_ARGS__) \
+DO_339(MACRO, __VA_ARGS__)
+
+
+#define DO_341(MACRO, ...) \
+MACRO(341, __VA_ARGS__) \
+DO_340(MACRO, __VA_ARGS__)
+
+
+#define DO_342(MACRO, ...) \
+MACRO(342, __VA_ARGS__) \
+DO_341(MACRO, __VA_ARGS__)
+
+
+#define DO_343(MACRO, ...) \
+MACRO(343, __VA_ARGS__) \
+DO_342(MACRO, __VA_ARGS__)
+
+
+#define DO_344(MACRO, ...) \
+MACRO(344, __VA_ARGS__) \
+DO_343(MACRO, __VA_ARGS__)
+
+
+#define DO_345(MACRO, ...) \
+MACRO(345, __VA_ARGS__) \
+DO_344(MACRO, __VA_ARGS__)
+
+
+#define DO_346(MACRO, ...) \
+MACRO(346, __VA_ARGS__) \
+DO_345(MACRO, __VA_ARGS__)
+
+
+#define DO_347(MACRO, ...) \
+MACRO(347, __VA_ARGS__) \
+DO_346(MACRO, __VA_ARGS__)
+
+
+#define DO_348(MACRO, ...) \
+MACRO(348, __VA_ARGS__) \
+DO_347(MACRO, __VA_ARGS__)
+
+
+#define DO_349(MACRO, ...) \
+MACRO(349, __VA_ARGS__) \
+DO_348(MACRO, __VA_ARGS__)
+
+
+#define DO_350(MACRO, ...) \
+MACRO(350, __VA_ARGS__) \
+DO_349(MACRO, __VA_ARGS__)
+
+
+#define DO_351(MACRO, ...) \
+MACRO(351, __VA_ARGS__) \
+DO_350(MACRO, __VA_ARGS__)
+
+
+#define DO_352(MACRO, ...) \
+MACRO(352, __VA_ARGS__) \
+DO_351(MACRO, __VA_ARGS__)
+
+
+#define DO_353(MACRO, ...) \
+MACRO(353, __VA_ARGS__) \
+DO_352(MACRO, __VA_ARGS__)
+
+
+#define DO_354(MACRO, ...) \
+MACRO(354, __VA_ARGS__) \
+DO_353(MACRO, __VA_ARGS__)
+
+
+#define DO_355(MACRO, ...) \
+MACRO(355, __VA_ARGS__) \
+DO_354(MACRO, __VA_ARGS__)
+
+
+#define DO_356(MACRO, ...) \
+MACRO(356, __VA_ARGS__) \
+DO_355(MACRO, __VA_ARGS__)
+
+
+#define DO_357(MACRO, ...) \
+MACRO(357, __VA_ARGS__) \
+DO_356(MACRO, __VA_ARGS__)
+
+
+#define DO_358(MACRO, ...) \
+MACRO(358, __VA_ARGS__) \
+DO_357(MACRO, __VA_ARGS__)
+
+
+#define DO_359(MACRO, ...) \
+MACRO(359, __VA_ARGS__) \
+DO_358(MACRO, __VA_ARGS__)
+
+
+#define DO_360(MACRO, ...) \
+MACRO(360, __VA_ARGS__) \
+DO_359(MACRO, __VA_ARGS__)
+
+
+#define DO_361(MACRO, ...) \
+MACRO(361, __VA_ARGS__) \
+DO_360(MACRO, __VA_ARGS__)
+
+
+#define DO_362(MACRO, ...) \
+MACRO(362, __VA_ARGS__) \
+DO_361(MACRO, __VA_ARGS__)
+
+
+#define DO_363(MACRO, ...) \
+MACRO(363, __VA_ARGS__) \
+DO_362(MACRO, __VA_ARGS__)
+
+
+#define DO_364(MACRO, ...) \
+MACRO(364, __VA_ARGS__) \
+DO_363(MACRO, __VA_ARGS__)
+
+
+#define DO_365(MACRO, ...) \
+MACRO(365, __VA_ARGS__) \
+DO_364(MACRO, __VA_ARGS__)
+
+
+#define DO_366(MACRO, ...) \
+MACRO(366, __VA_ARGS__) \
+DO_365(MACRO, __VA_ARGS__)
+
+
+#define DO_367(MACRO, ...) \
+MACRO(367, __VA_ARGS__) \
+DO_366(MACRO, __VA_ARGS__)
+
+
+#define DO_368(MACRO, ...) \
+MACRO(368, __VA_ARGS__) \
+DO_367(MACRO, __VA_ARGS__)
+
+
+#define DO_369(MACRO, ...) \
+MACRO(369, __VA_ARGS__) \
+DO_368(MACRO, __VA_ARGS__)
+
+
+#define DO_370(MACRO, ...) \
+MACRO(370, __VA_ARGS__) \
+DO_369(MACRO, __VA_ARGS__)
+
+
+#define DO_371(MACRO, ...) \
+MACRO(371, __VA_ARGS__) \
+DO_370(MACRO, __VA_ARGS__)
+
+
+#define DO_372(MACRO, ...) \
+MACRO(372, __VA_ARGS__) \
+DO_371(MACRO, __VA_ARGS__)
+
+
+#define DO_373(MACRO, ...) \
+MACRO(373, __VA_ARGS__) \
+DO_372(MACRO, __VA_ARGS__)
+
+
+#define DO_374(MACRO, ...) \
+MACRO(374, __VA_ARGS__) \
+DO_373(MACRO, __VA_ARGS__)
+
+
+#define DO_375(MACRO, ...) \
+MACRO(375, __VA_ARGS__) \
+DO_374(MACRO, __VA_ARGS__)
+
+
+#define DO_376(MACRO, ...) \
+MACRO(376, __VA_ARGS__) \
+DO_375(MACRO, __VA_ARGS__)
+
+
+#define DO_377(MACRO, ...) \
+MACRO(377, __VA_ARGS__) \
+DO_376(MACRO, __VA_ARGS__)
+
+
+#define DO_378(MACRO, ...) \
+MACRO(378, __VA_ARGS__) \
+DO_377(MACRO, __VA_ARGS__)
+
+
+#define DO_379(MACRO, ...) \
+MACRO(379, __VA_ARGS__) \
+DO_378(MACRO, __VA_ARGS__)
+
+
+#define DO_380(MACRO, ...) \
+MACRO(380, __VA_ARGS__) \
+DO_379(MACRO, __VA_ARGS__)
+
+
+#define DO_381(MACRO, ...) \
+MACRO(381, __VA_ARGS__) \
+DO_380(MACRO, __VA_ARGS__)
+
+
+#define DO_382(MACRO, ...) \
+MACRO(382, __VA_ARGS__) \
+DO_381(MACRO, __VA_ARGS__)
+
+
+#define DO_383(MACRO, ...) \
+MACRO(383, __VA_ARGS__) \
+DO_382(MACRO, __VA_ARGS__)
+
+
+#define DO_384(MACRO, ...) \
+MACRO(384, __VA_ARGS__) \
+DO_383(MACRO, __VA_ARGS__)
+
+
+#define DO_385(MACRO, ...) \
+MACRO(385, __VA_ARGS__) \
+DO_384(MACRO, __VA_ARGS__)
+
+
+#define DO_386(MACRO, ...) \
+MACRO(386, __VA_ARGS__) \
+DO_385(MACRO, __VA_ARGS__)
+
+
+#define DO_387(MACRO, ...) \
+MACRO(387, __VA_ARGS__) \
+DO_386(MACRO, __VA_ARGS__)
+
+
+#define DO_388(MACRO, ...) \
+MACRO(388, __VA_ARGS__) \
+DO_387(MACRO, __VA_ARGS__)
+
+
+#define DO_389(MACRO, ...) \
+MACRO(389, __VA_ARGS__) \
+DO_388(MACRO, __VA_ARGS__)
+
+
+#define DO_390(MACRO, ...) \
+MACRO(390, __VA_ARGS__) \
+DO_389(MACRO, __VA_ARGS__)
+
+
+#define DO_391(MACRO, ...) \
+MACRO(391, __VA_ARGS__) \
+DO_390(MACRO, __VA_ARGS__)
+
+
+#define DO_392(MACRO, ...) \
+MACRO(392, __VA_ARGS__) \
+DO_391(MACRO, __VA_ARGS__)
+
+
+#define DO_393(MACRO, ...) \
+MACRO(393, __VA_ARGS__) \
+DO_392(MACRO, __VA_ARGS__)
+
+
+#define DO_394(MACRO, ...) \
+MACRO(394, __VA_ARGS__) \
+DO_393(MACRO, __VA_ARGS__)
+
+
+#define DO_395(MACRO, ...) \
+MACRO(395, __VA_ARGS__) \
+DO_394(MACRO, __VA_ARGS__)
+
+
+#define DO_396(MACRO, ...) \
+MACRO(396, __VA_ARGS__) \
+DO_395(MACRO, __VA_ARGS__)
+
+
+#define DO_397(MACRO, ...) \
+MACRO(397, __VA_ARGS__) \
+DO_396(MACRO, __VA_ARGS__)
+
+
+#define DO_398(MACRO, ...) \
+MACRO(398, __VA_ARGS__) \
+DO_397(MACRO, __VA_ARGS__)
+
+
+#define DO_399(MACRO, ...) \
+MACRO(399, __VA_ARGS__) \
+DO_398(MACRO, __VA_ARGS__)
+
+
+#define DO_400(MACRO, ...) \
+MACRO(400, __VA_ARGS__) \
+DO_399(MACRO, __VA_ARGS__)
+
+
+#define DO_401(MACRO, ...) \
+MACRO(401, __VA_ARGS__) \
+DO_400(MACRO, __VA_ARGS__)
+
+
+#define DO_402(MACRO, ...) \
+MACRO(402, __VA_ARGS__) \
+DO_401(MACRO, __VA_ARGS__)
+
+
+#define DO_403(MACRO, ...) \
+MACRO(403, __VA_ARGS__) \
+DO_402(MACRO, __VA_ARGS__)
+
+
+#define DO_404(MACRO, ...) \
+MACRO(404, __VA_ARGS__) \
+DO_403(MACRO, __VA_ARGS__)
+
+
+#define DO_405(MACRO, ...) \
+MACRO(405, __VA_ARGS__) \
+DO_404(MACRO, __VA_ARGS__)
+
+
+#define DO_406(MACRO, ...) \
+MACRO(406, __VA_ARGS__) \
+DO_405(MACRO, __VA_ARGS__)
+
+
+#define DO_407(MACRO, ...) \
+MACRO(407, __VA_ARGS__) \
+DO_406(MACRO, __VA_ARGS__)
+
+
+#define DO_408(MACRO, ...) \
+MACRO(408, __VA_ARGS__) \
+DO_407(MACRO, __VA_ARGS__)
+
+
+#define DO_409(MACRO, ...) \
+MACRO(409, __VA_ARGS__) \
+DO_408(MACRO, __VA_ARGS__)
+
+
+#define DO_410(MACRO, ...) \
+MACRO(410, __VA_ARGS__) \
+DO_409(MACRO, __VA_ARGS__)
+
+
+#define DO_411(MACRO, ...) \
+MACRO(411, __VA_ARGS__) \
+DO_410(MACRO, __VA_ARGS__)
+
+
+#define DO_412(MACRO, ...) \
+MACRO(412, __VA_ARGS__) \
+DO_411(MACRO, __VA_ARGS__)
+
+
+#define DO_413(MACRO, ...) \
+MACRO(413, __VA_ARGS__) \
+DO_412(MACRO, __VA_ARGS__)
+
+
+#define DO_414(MACRO, ...) \
+MACRO(414, __VA_ARGS__) \
+DO_413(MACRO, __VA_ARGS__)
+
+
+#define DO_415(MACRO, ...) \
+MACRO(415, __VA_ARGS__) \
+DO_414(MACRO, __VA_ARGS__)
+
+
+#define DO_416(MACRO, ...) \
+MACRO(416, __VA_ARGS__) \
+DO_415(MACRO, __VA_ARGS__)
+
+
+#define DO_417(MACRO, ...) \
+MACRO(417, __VA_ARGS__) \
+DO_416(MACRO, __VA_ARGS__)
+
+
+#define DO_418(MACRO, ...) \
+MACRO(418, __VA_ARGS__) \
+DO_417(MACRO, __VA_ARGS__)
+
+
+#define DO_419(MACRO, ...) \
+MACRO(419, __VA_ARGS__) \
+DO_418(MACRO, __VA_ARGS__)
+
+
+#define DO_420(MACRO, ...) \
+MACRO(420, __VA_ARGS__) \
+DO_419(MACRO, __VA_ARGS__)
+
+
+#define DO_421(MACRO, ...) \
+MACRO(421, __VA_ARGS__) \
+DO_420(MACRO, __VA_ARGS__)
+
+
+#define DO_422(MACRO, ...) \
+MACRO(422, __VA_ARGS__) \
+DO_421(MACRO, __VA_ARGS__)
+
+
+#define DO_423(MACRO, ...) \
+MACRO(423, __VA_ARGS__) \
+DO_422(MACRO, __VA_ARGS__)
+
+
+#define DO_424(MACRO, ...) \
+MACRO(424, __VA_ARGS__) \
+DO_423(MACRO, __VA_ARGS__)
+
+
+#define DO_425(MACRO, ...) \
+MACRO(425, __VA_ARGS__) \
+DO_424(MACRO, __VA_ARGS__)
+
+
+#define DO_426(MACRO, ...) \
+MACRO(426, __VA_ARGS__) \
+DO_425(MACRO, __VA_ARGS__)
+
+
+#define DO_427(MACRO, ...) \
+MACRO(427, __VA_ARGS__) \
+DO_426(MACRO, __VA_ARGS__)
+
+
+#define DO_428(MACRO, ...) \
+MACRO(428, __VA_ARGS__) \
+DO_427(MACRO, __VA_ARGS__)
+
+
+#define DO_429(MACRO, ...) \
+MACRO(429, __VA_ARGS__) \
+DO_428(MACRO, __VA_ARGS__)
+
+
+#define DO_430(MACRO, ...) \
+MACRO(430, __VA_ARGS__) \
+DO_429(MACRO, __VA_ARGS__)
+
+
+#define DO_431(MACRO, ...) \
+MACRO(431, __VA_ARGS__) \
+DO_430(MACRO, __VA_ARGS__)
+
+
+#define DO_432(MACRO, ...) \
+MACRO(432, __VA_ARGS__) \
+DO_431(MACRO, __VA_ARGS__)
+
+
+#define DO_433(MACRO, ...) \
+MACRO(433, __VA_ARGS__) \
+DO_432(MACRO, __VA_ARGS__)
+
+
+#define DO_434(MACRO, ...) \
+MACRO(434, __VA_ARGS__) \
+DO_433(MACRO, __VA_ARGS__)
+
+
+#define DO_435(MACRO, ...) \
+MACRO(435, __VA_ARGS__) \
+DO_434(MACRO, __VA_ARGS__)
+
+
+#define DO_436(MACRO, ...) \
+MACRO(436, __VA_ARGS__) \
+DO_435(MACRO, __VA_ARGS__)
+
+
+#define DO_437(MACRO, ...) \
+MACRO(437, __VA_ARGS__) \
+DO_436(MACRO, __VA_ARGS__)
+
+
+#define DO_438(MACRO, ...) \
+MACRO(438, __VA_ARGS__) \
+DO_437(MACRO, __VA_ARGS__)
+
+
+#define DO_439(MACRO, ...) \
+MACRO(439, __VA_ARGS__) \
+DO_438(MACRO, __VA_ARGS__)
+
+
+#define DO_440(MACRO, ...) \
+MACRO(440, __VA_ARGS__) \
+DO_439(MACRO, __VA_ARGS__)
+
+
+#define DO_441(MACRO, ...) \
+MACRO(441, __VA_ARGS__) \
+DO_440(MACRO, __VA_ARGS__)
+
+
+#define DO_442(MACRO, ...) \
+MACRO(442, __VA_ARGS__) \
+DO_441(MACRO, __VA_ARGS__)
+
+
+#define DO_443(MACRO, ...) \
+MACRO(443, __VA_ARGS__) \
+DO_442(MACRO, __VA_ARGS__)
+
+
+#define DO_444(MACRO, ...) \
+MACRO(444, __VA_ARGS__) \
+DO_443(MACRO, __VA_ARGS__)
+
+
+#define DO_445(MACRO, ...) \
+MACRO(445, __VA_ARGS__) \
+DO_444(MACRO, __VA_ARGS__)
+
+
+#define DO_446(MACRO, ...) \
+MACRO(446, __VA_ARGS__) \
+DO_445(MACRO, __VA_ARGS__)
+
+
+#define DO_447(MACRO, ...) \
+MACRO(447, __VA_ARGS__) \
+DO_446(MACRO, __VA_ARGS__)
+
+
+#define DO_448(MACRO, ...) \
+MACRO(448, __VA_ARGS__) \
+DO_447(MACRO, __VA_ARGS__)
+
+
+#define DO_449(MACRO, ...) \
+MACRO(449, __VA_ARGS__) \
+DO_448(MACRO, __VA_ARGS__)
+
+
+#define DO_450(MACRO, ...) \
+MACRO(450, __VA_ARGS__) \
+DO_449(MACRO, __VA_ARGS__)
+
+
+#define DO_451(MACRO, ...) \
+MACRO(451, __VA_ARGS__) \
+DO_450(MACRO, __VA_ARGS__)
+
+
+#define DO_452(MACRO, ...) \
+MACRO(452, __VA_ARGS__) \
+DO_451(MACRO, __VA_ARGS__)
+
+
+#define DO_453(MACRO, ...) \
+MACRO(453, __VA_ARGS__) \
+DO_452(MACRO, __VA_ARGS__)
+
+
+#define DO_454(MACRO, ...) \
+MACRO(454, __VA_ARGS__) \
+DO_453(MACRO, __VA_ARGS__)
+
+
+#define DO_455(MACRO, ...) \
+MACRO(455, __VA_ARGS__) \
+DO_454(MACRO, __VA_ARGS__)
+
+
+#define DO_456(MACRO, ...) \
+MACRO(456, __VA_ARGS__) \
+DO_455(MACRO, __VA_ARGS__)
+
+
+#define DO_457(MACRO, ...) \
+MACRO(457, __VA_ARGS__) \
+DO_456(MACRO, __VA_ARGS__)
+
+
+#define DO_458(MACRO, ...) \
+MACRO(458, __VA_ARGS__) \
+DO_457(MACRO, __VA_ARGS__)
+
+
+#define DO_459(MACRO, ...) \
+MACRO(459, __VA_ARGS__) \
+DO_458(MACRO, __VA_ARGS__)
+
+
+#define DO_460(MACRO, ...) \
+MACRO(460, __VA_ARGS__) \
+DO_459(MACRO, __VA_ARGS__)
+
+
+#define DO_461(MACRO, ...) \
+MACRO(461, __VA_ARGS__) \
+DO_460(MACRO, __VA_ARGS__)
+
+
+#define DO_462(MACRO, ...) \
+MACRO(462, __VA_ARGS__) \
+DO_461(MACRO, __VA_ARGS__)
+
+
+#define DO_463(MACRO, ...) \
+MACRO(463, __VA_ARGS__) \
+DO_462(MACRO, __VA_ARGS__)
+
+
+#define DO_464(MACRO, ...) \
+MACRO(464, __VA_ARGS__) \
+DO_463(MACRO, __VA_ARGS__)
+
+
+#define DO_465(MACRO, ...) \
+MACRO(465, __VA_ARGS__) \
+DO_464(MACRO, __VA_ARGS__)
+
+
+#define DO_466(MACRO, ...) \
+MACRO(466, __VA_ARGS__) \
+DO_465(MACRO, __VA_ARGS__)
+
+
+#define DO_467(MACRO, ...) \
+MACRO(467, __VA_ARGS__) \
+DO_466(MACRO, __VA_ARGS__)
+
+
+#define DO_468(MACRO, ...) \
+MACRO(468, __VA_ARGS__) \
+DO_467(MACRO, __VA_ARGS__)
+
+
+#define DO_469(MACRO, ...) \
+MACRO(469, __VA_ARGS__) \
+DO_468(MACRO, __VA_ARGS__)
+
+
+#define DO_470(MACRO, ...) \
+MACRO(470, __VA_ARGS__) \
+DO_469(MACRO, __VA_ARGS__)
+
+
+#define DO_471(MACRO, ...) \
+MACRO(471, __VA_ARGS__) \
+DO_470(MACRO, __VA_ARGS__)
+
+
+#define DO_472(MACRO, ...) \
+MACRO(472, __VA_ARGS__) \
+DO_471(MACRO, __VA_ARGS__)
+
+
+#define DO_473(MACRO, ...) \
+MACRO(473, __VA_ARGS__) \
+DO_472(MACRO, __VA_ARGS__)
+
+
+#define DO_474(MACRO, ...) \
+MACRO(474, __VA_ARGS__) \
+DO_473(MACRO, __VA_ARGS__)
+
+
+#define DO_475(MACRO, ...) \
+MACRO(475, __VA_ARGS__) \
+DO_474(MACRO, __VA_ARGS__)
+
+
+#define DO_476(MACRO, ...) \
+MACRO(476, __VA_ARGS__) \
+DO_475(MACRO, __VA_ARGS__)
+
+
+#define DO_477(MACRO, ...) \
+MACRO(477, __VA_ARGS__) \
+DO_476(MACRO, __VA_ARGS__)
+
+
+#define DO_478(MACRO, ...) \
+MACRO(478, __VA_ARGS__) \
+DO_477(MACRO, __VA_ARGS__)
+
+
+#define DO_479(MACRO, ...) \
+MACRO(479, __VA_ARGS__) \
+DO_478(MACRO, __VA_ARGS__)
+
+
+#define DO_480(MACRO, ...) \
+MACRO(480, __VA_ARGS__) \
+DO_479(MACRO, __VA_ARGS__)
+
+
+#define DO_481(MACRO, ...) \
+MACRO(481, __VA_ARGS__) \
+DO_480(MACRO, __VA_ARGS__)
+
+
+#define DO_482(MACRO, ...) \
+MACRO(482, __VA_ARGS__) \
+DO_481(MACRO, __VA_ARGS__)
+
+
+#define DO_483(MACRO, ...) \
+MACRO(483, __VA_ARGS__) \
+DO_482(MACRO, __VA_ARGS__)
+
+
+#define DO_484(MACRO, ...) \
+MACRO(484, __VA_ARGS__) \
+DO_483(MACRO, __VA_ARGS__)
+
+
+#define DO_485(MACRO, ...) \
+MACRO(485, __VA_ARGS__) \
+DO_484(MACRO, __VA_ARGS__)
+
+
+#define DO_486(MACRO, ...) \
+MACRO(486, __VA_ARGS__) \
+DO_485(MACRO, __VA_ARGS__)
+
+
+#define DO_487(MACRO, ...) \
+MACRO(487, __VA_ARGS__) \
+DO_486(MACRO, __VA_ARGS__)
+
+
+#define DO_488(MACRO, ...) \
+MACRO(488, __VA_ARGS__) \
+DO_487(MACRO, __VA_ARGS__)
+
+
+#define DO_489(MACRO, ...) \
+MACRO(489, __VA_ARGS__) \
+DO_488(MACRO, __VA_ARGS__)
+
+
+#define DO_490(MACRO, ...) \
+MACRO(490, __VA_ARGS__) \
+DO_489(MACRO, __VA_ARGS__)
+
+
+#define DO_491(MACRO, ...) \
+MACRO(491, __VA_ARGS__) \
+DO_490(MACRO, __VA_ARGS__)
+
+
+#define DO_492(MACRO, ...) \
+MACRO(492, __VA_ARGS__) \
+DO_491(MACRO, __VA_ARGS__)
+
+
+#define DO_493(MACRO, ...) \
+MACRO(493, __VA_ARGS__) \
+DO_492(MACRO, __VA_ARGS__)
+
+
+#define DO_494(MACRO, ...) \
+MACRO(494, __VA_ARGS__) \
+DO_493(MACRO, __VA_ARGS__)
+
+
+#define DO_495(MACRO, ...) \
+MACRO(495, __VA_ARGS__) \
+DO_494(MACRO, __VA_ARGS__)
+
+
+#define DO_496(MACRO, ...) \
+MACRO(496, __VA_ARGS__) \
+DO_495(MACRO, __VA_ARGS__)
+
+
+#define DO_497(MACRO, ...) \
+MACRO(497, __VA_ARGS__) \
+DO_496(MACRO, __VA_ARGS__)
+
+
+#define DO_498(MACRO, ...) \
+MACRO(498, __VA_ARGS__) \
+DO_497(MACRO, __VA_ARGS__)
+
+
+#define DO_499(MACRO, ...) \
+MACRO(499, __VA_ARGS__) \
+DO_498(MACRO, __VA_ARGS__)
+
+
+#define DO_500(MACRO, ...) \
+MACRO(500, __VA_ARGS__) \
+DO_499(MACRO, __VA_ARGS__)
+
+
+#define DO_501(MACRO, ...) \
+MACRO(501, __VA_ARGS__) \
+DO_500(MACRO, __VA_ARGS__)
+
+
+#define DO_502(MACRO, ...) \
+MACRO(502, __VA_ARGS__) \
+DO_501(MACRO, __VA_ARGS__)
+
+
+#define DO_503(MACRO, ...) \
+MACRO(503, __VA_ARGS__) \
+DO_502(MACRO, __VA_ARGS__)
+
+
+#define DO_504(MACRO, ...) \
+MACRO(504, __VA_ARGS__) \
+DO_503(MACRO, __VA_ARGS__)
+
+
+#define DO_505(MACRO, ...) \
+MACRO(505, __VA_ARGS__) \
+DO_504(MACRO, __VA_ARGS__)
+
+
+#define DO_506(MACRO, ...) \
+MACRO(506, __VA_ARGS__) \
+DO_505(MACRO, __VA_ARGS__)
+
+
+#define DO_507(MACRO, ...) \
+MACRO(507, __VA_ARGS__) \
+DO_506(MACRO, __VA_ARGS__)
+
+
+#define DO_508(MACRO, ...) \
+MACRO(508, __VA_ARGS__) \
+DO_507(MACRO, __VA_ARGS__)
+
+
+#define DO_509(MACRO, ...) \
+MACRO(509, __VA_ARGS__) \
+DO_508(MACRO, __VA_ARGS__)
+
+
+#define DO_510(MACRO, ...) \
+MACRO(510, __VA_ARGS__) \
+DO_509(MACRO, __VA_ARGS__)
+
+
+#define DO_511(MACRO, ...) \
+MACRO(511, __VA_ARGS__) \
+DO_510(MACRO, __VA_ARGS__)
+
+
+#define DO_512(MACRO, ...) \
+MACRO(512, __VA_ARGS__) \
+DO_511(MACRO, __VA_ARGS__)
+
+
+#define DO_513(MACRO, ...) \
+MACRO(513, __VA_ARGS__) \
+DO_512(MACRO, __VA_ARGS__)
+
+
+#define DO_514(MACRO, ...) \
+MACRO(514, __VA_ARGS__) \
+DO_513(MACRO, __VA_ARGS__)
+
+
+#define DO_515(MACRO, ...) \
+MACRO(515, __VA_ARGS__) \
+DO_514(MACRO, __VA_ARGS__)
+
+
+#define DO_516(MACRO, ...) \
+MACRO(516, __VA_ARGS__) \
+DO_515(MACRO, __VA_ARGS__)
+
+
+#define DO_517(MACRO, ...) \
+MACRO(517, __VA_ARGS__) \
+DO_516(MACRO, __VA_ARGS__)
+
+
+#define DO_518(MACRO, ...) \
+MACRO(518, __VA_ARGS__) \
+DO_517(MACRO, __VA_ARGS__)
+
+
+#define DO_519(MACRO, ...) \
+MACRO(519, __VA_ARGS__) \
+DO_518(MACRO, __VA_ARGS__)
+
+
+#define DO_520(MACRO, ...) \
+MACRO(520, __VA_ARGS__) \
+DO_519(MACRO, __VA_ARGS__)
+
+
+#define DO_521(MACRO, ...) \
+MACRO(521, __VA_ARGS__) \
+DO_520(MACRO, __VA_ARGS__)
+
+
+#define DO_522(MACRO, ...) \
+MACRO(522, __VA_ARGS__) \
+DO_521(MACRO, __VA_ARGS__)
+
+
+#define DO_523(MACRO, ...) \
+MACRO(523, __VA_ARGS__) \
+DO_522(MACRO, __VA_ARGS__)
+
+
+#define DO_524(MACRO, ...) \
+MACRO(524, __VA_ARGS__) \
+DO_523(MACRO, __VA_ARGS__)
+
+
+#define DO_525(MACRO, ...) \
+MACRO(525, __VA_ARGS__) \
+DO_524(MACRO, __VA_ARGS__)
+
+
+#define DO_526(MACRO, ...) \
+MACRO(526, __VA_ARGS__) \
+DO_525(MACRO, __VA_ARGS__)
+
+
+#define DO_527(MACRO, ...) \
+MACRO(527, __VA_ARGS__) \
+DO_526(MACRO, __VA_ARGS__)
+
+
+#define DO_528(MACRO, ...) \
+MACRO(528, __VA_ARGS__) \
+DO_527(MACRO, __VA_ARGS__)
+
+
+#define DO_529(MACRO, ...) \
+MACRO(529, __VA_ARGS__) \
+DO_528(MACRO, __VA_ARGS__)
+
+
+#define DO_530(MACRO, ...) \
+MACRO(530, __VA_ARGS__) \
+DO_529(MACRO, __VA_ARGS__)
+
+
+#define DO_531(MACRO, ...) \
+MACRO(531, __VA_ARGS__) \
+DO_530(MACRO, __VA_ARGS__)
+
+
+#define DO_532(MACRO, ...) \
+MACRO(532, __VA_ARGS__) \
+DO_531(MACRO, __VA_ARGS__)
+
+
+#define DO_533(MACRO, ...) \
+MACRO(533, __VA_ARGS__) \
+DO_532(MACRO, __VA_ARGS__)
+
+
+#define DO_534(MACRO, ...) \
+MACRO(534, __VA_ARGS__) \
+DO_533(MACRO, __VA_ARGS__)
+
+
+#define DO_535(MACRO, ...) \
+MACRO(535, __VA_ARGS__) \
+DO_534(MACRO, __VA_ARGS__)
+
+
+#define DO_536(MACRO, ...) \
+MACRO(536, __VA_ARGS__) \
+DO_535(MACRO, __VA_ARGS__)
+
+
+#define DO_537(MACRO, ...) \
+MACRO(537, __VA_ARGS__) \
+DO_536(MACRO, __VA_ARGS__)
+
+
+#define DO_538(MACRO, ...) \
+MACRO(538, __VA_ARGS__) \
+DO_537(MACRO, __VA_ARGS__)
+
+
+#define DO_539(MACRO, ...) \
+MACRO(539, __VA_ARGS__) \
+DO_538(MACRO, __VA_ARGS__)
+
+
+#define DO_540(MACRO, ...) \
+MACRO(540, __VA_ARGS__) \
+DO_539(MACRO, __VA_ARGS__)
+
+
+#define DO_541(MACRO, ...) \
+MACRO(541, __VA_ARGS__) \
+DO_540(MACRO, __VA_ARGS__)
+
+
+#define DO_542(MACRO, ...) \
+MACRO(542, __VA_ARGS__) \
+DO_541(MACRO, __VA_ARGS__)
+
+
+#define DO_543(MACRO, ...) \
+MACRO(543, __VA_ARGS__) \
+DO_542(MACRO, __VA_ARGS__)
+
+
+#define DO_544(MACRO, ...) \
+MACRO(544, __VA_ARGS__) \
+DO_543(MACRO, __VA_ARGS__)
+
+
+#define DO_545(MACRO, ...) \
+MACRO(545, __VA_ARGS__) \
+DO_544(MACRO, __VA_ARGS__)
+
+
+#define DO_546(MACRO, ...) \
+MACRO(546, __VA_ARGS__) \
+DO_545(MACRO, __VA_ARGS__)
+
+
+#define DO_547(MACRO, ...) \
+MACRO(547, __VA_ARGS__) \
+DO_546(MACRO, __VA_ARGS__)
+
+
+#define DO_548(MACRO, ...) \
+MACRO(548, __VA_ARGS__) \
+DO_547(MACRO, __VA_ARGS__)
+
+
+#define DO_549(MACRO, ...) \
+MACRO(549, __VA_ARGS__) \
+DO_548(MACRO, __VA_ARGS__)
+
+
+#define DO_550(MACRO, ...) \
+MACRO(550, __VA_ARGS__) \
+DO_549(MACRO, __VA_ARGS__)
+
+
+#define DO_551(MACRO, ...) \
+MACRO(551, __VA_ARGS__) \
+DO_550(MACRO, __VA_ARGS__)
+
+
+#define DO_552(MACRO, ...) \
+MACRO(552, __VA_ARGS__) \
+DO_551(MACRO, __VA_ARGS__)
+
+
+#define DO_553(MACRO, ...) \
+MACRO(553, __VA_ARGS__) \
+DO_552(MACRO, __VA_ARGS__)
+
+
+#define DO_554(MACRO, ...) \
+MACRO(554, __VA_ARGS__) \
+DO_553(MACRO, __VA_ARGS__)
+
+
+#define DO_555(MACRO, ...) \
+MACRO(555, __VA_ARGS__) \
+DO_554(MACRO, __VA_ARGS__)
+
+
+#define DO_556(MACRO, ...) \
+MACRO(556, __VA_ARGS__) \
+DO_555(MACRO, __VA_ARGS__)
+
+
+#define DO_557(MACRO, ...) \
+MACRO(557, __VA_ARGS__) \
+DO_556(MACRO, __VA_ARGS__)
+
+
+#define DO_558(MACRO, ...) \
+MACRO(558, __VA_ARGS__) \
+DO_557(MACRO, __VA_ARGS__)
+
+
+#define DO_559(MACRO, ...) \
+MACRO(559, __VA_ARGS__) \
+DO_558(MACRO, __VA_ARGS__)
+
+
+#define DO_560(MACRO, ...) \
+MACRO(560, __VA_ARGS__) \
+DO_559(MACRO, __VA_ARGS__)
+
+
+#define DO_561(MACRO, ...) \
+MACRO(561, __VA_ARGS__) \
+DO_560(MACRO, __VA_ARGS__)
+
+
+#define DO_562(MACRO, ...) \
+MACRO(562, __VA_ARGS__) \
+DO_561(MACRO, __VA_ARGS__)
+
+
+#define DO_563(MACRO, ...) \
+MACRO(563, __VA_ARGS__) \
+DO_562(MACRO, __VA_ARGS__)
+
+
+#define DO_564(MACRO, ...) \
+MACRO(564, __VA_ARGS__) \
+DO_563(MACRO, __VA_ARGS__)
+
+
+#define DO_565(MACRO, ...) \
+MACRO(565, __VA_ARGS__) \
+DO_564(MACRO, __VA_ARGS__)
+
+
+#define DO_566(MACRO, ...) \
+MACRO(566, __VA_ARGS__) \
+DO_565(MACRO, __VA_ARGS__)
+
+
+#define DO_567(MACRO, ...) \
+MACRO(567, __VA_ARGS__) \
+DO_566(MACRO, __VA_ARGS__)
+
+
+#define DO_568(MACRO, ...) \
+MACRO(568, __VA_ARGS__) \
+DO_567(MACRO, __VA_ARGS__)
+
+
+#define DO_569(MACRO, ...) \
+MACRO(569, __VA_ARGS__) \
+DO_568(MACRO, __VA_ARGS__)
+
+
+#define DO_570(MACRO, ...) \
+MACRO(570, __VA_ARGS__) \
+DO_569(MACRO, __VA_ARGS__)
+
+
+#define DO_571(MACRO, ...) \
+MACRO(571, __VA_ARGS__) \
+DO_570(MACRO, __VA_ARGS__)
+
+
+#define DO_572(MACRO, ...) \
+MACRO(572, __VA_ARGS__) \
+DO_571(MACRO, __VA_ARGS__)
+
+
+#define DO_573(MACRO, ...) \
+MACRO(573, __VA_ARGS__) \
+DO_572(MACRO, __VA_ARGS__)
+
+
+#define DO_574(MACRO, ...) \
+MACRO(574, __VA_ARGS__) \
+DO_573(MACRO, __VA_ARGS__)
+
+
+#define DO_575(MACRO, ...) \
+MACRO(575, __VA_ARGS__) \
+DO_574(MACRO, __VA_ARGS__)
+
+
+#define DO_576(MACRO, ...) \
+MACRO(576, __VA_ARGS__) \
+DO_575(MACRO, __VA_ARGS__)
+
+
+#define DO_577(MACRO, ...) \
+MACRO(577, __VA_ARGS__) \
+DO_576(MACRO, __VA_ARGS__)
+
+
+#define DO_578(MACRO, ...) \
+MACRO(578, __VA_ARGS__) \
+DO_577(MACRO, __VA_ARGS__)
+
+
+#define DO_579(MACRO, ...) \
+MACRO(579, __VA_ARGS__) \
+DO_578(MACRO, __VA_ARGS__)
+
+
+#define DO_580(MACRO, ...) \
+MACRO(580, __VA_ARGS__) \
+DO_579(MACRO, __VA_ARGS__)
+
+
+#define DO_581(MACRO, ...) \
+MACRO(581, __VA_ARGS__) \
+DO_580(MACRO, __VA_ARGS__)
+
+
+#define DO_582(MACRO, ...) \
+MACRO(582, __VA_ARGS__) \
+DO_581(MACRO, __VA_ARGS__)
+
+
+#define DO_583(MACRO, ...) \
+MACRO(583, __VA_ARGS__) \
+DO_582(MACRO, __VA_ARGS__)
+
+
+#define DO_584(MACRO, ...) \
+MACRO(584, __VA_ARGS__) \
+DO_583(MACRO, __VA_ARGS__)
+
+
+#define DO_585(MACRO, ...) \
+MACRO(585, __VA_ARGS__) \
+DO_584(MACRO, __VA_ARGS__)
+
+
+#define DO_586(MACRO, ...) \
+MACRO(586, __VA_ARGS__) \
+DO_585(MACRO, __VA_ARGS__)
+
+
+#define DO_587(MACRO, ...) \
+MACRO(587, __VA_ARGS__) \
+DO_586(MACRO, __VA_ARGS__)
+
+
+#define DO_588(MACRO, ...) \
+MACRO(588, __VA_ARGS__) \
+DO_587(MACRO, __VA_ARGS__)
+
+
+#define DO_589(MACRO, ...) \
+MACRO(589, __VA_ARGS__) \
+DO_588(MACRO, __VA_ARGS__)
+
+
+#define DO_590(MACRO, ...) \
+MACRO(590, __VA_ARGS__) \
+DO_589(MACRO, __VA_ARGS__)
+
+
+#define DO_591(MACRO, ...) \
+MACRO(591, __VA_ARGS__) \
+DO_590(MACRO, __VA_ARGS__)
+
+
+#define DO_592(MACRO, ...) \
+MACRO(592, __VA_ARGS__) \
+DO_591(MACRO, __VA_ARGS__)
+
+
+#define DO_593(MACRO, ...) \
+MACRO(593, __VA_ARGS__) \
+DO_592(MACRO, __VA_ARGS__)
+
+
+#define DO_594(MACRO, ...) \
+MACRO(594, __VA_ARGS__) \
+DO_593(MACRO, __VA_ARGS__)
+
+
+#define DO_595(MACRO, ...) \
+MACRO(595, __VA_ARGS__) \
+DO_594(MACRO, __VA_ARGS__)
+
+
+#define DO_596(MACRO, ...) \
+MACRO(596, __VA_ARGS__) \
+DO_595(MACRO, __VA_ARGS__)
+
+
+#define DO_597(MACRO, ...) \
+MACRO(597, __VA_ARGS__) \
+DO_596(MACRO, __VA_ARGS__)
+
+
+#define DO_598(MACRO, ...) \
+MACRO(598, __VA_ARGS__) \
+DO_597(MACRO, __VA_ARGS__)
+
+
+#define DO_599(MACRO, ...) \
+MACRO(599, __VA_ARGS__) \
+DO_598(MACRO, __VA_ARGS__)
+
+
+#define DO_600(MACRO, ...) \
+MACRO(600, __VA_ARGS__) \
+DO_599(MACRO, __VA_ARGS__)
+
+
+#define DO_601(MACRO, ...) \
+MACRO(601, __VA_ARGS__) \
+DO_600(MACRO, __VA_ARGS__)
+
+
+#define DO_602(MACRO, ...) \
+MACRO(602, __VA_ARGS__) \
+DO_601(MACRO, __VA_ARGS__)
+
+
+#define DO_603(MACRO, ...) \
+MACRO(603, __VA_ARGS__) \
+DO_602(MACRO, __VA_ARGS__)
+
+
+#define DO_604(MACRO, ...) \
+MACRO(604, __VA_ARGS__) \
+DO_603(MACRO, __VA_ARGS__)
+
+
+#define DO_605(MACRO, ...) \
+MACRO(605, __VA_ARGS__) \
+DO_604(MACRO, __VA_ARGS__)
+
+
+#define DO_606(MACRO, ...) \
+MACRO(606, __VA_ARGS__) \
+DO_605(MACRO, __VA_ARGS__)
+
+
+#define DO_607(MACRO, ...) \
+MACRO(607, __VA_ARGS__) \
+DO_606(MACRO, __VA_ARGS__)
+
+
+#define DO_608(MACRO, ...) \
+MACRO(608, __VA_ARGS__) \
+DO_607(MACRO, __VA_ARGS__)
+
+
+#define DO_609(MACRO, ...) \
+MACRO(609, __VA_ARGS__) \
+DO_608(MACRO, __VA_ARGS__)
+
+
+#define DO_610(MACRO, ...) \
+MACRO(610, __VA_ARGS__) \
+DO_609(MACRO, __VA_ARGS__)
+
+
+#define DO_611(MACRO, ...) \
+MACRO(611, __VA_ARGS__) \
+DO_610(MACRO, __VA_ARGS__)
+
+
+#define DO_612(MACRO, ...) \
+MACRO(612, __VA_ARGS__) \
+DO_611(MACRO, __VA_ARGS__)
+
+
+#define DO_613(MACRO, ...) \
+MACRO(613, __VA_ARGS__) \
+DO_612(MACRO, __VA_ARGS__)
+
+
+#define DO_614(MACRO, ...) \
+MACRO(614, __VA_ARGS__) \
+DO_613(MACRO, __VA_ARGS__)
+
+
+#define DO_615(MACRO, ...) \
+MACRO(615, __VA_ARGS__) \
+DO_614(MACRO, __VA_ARGS__)
+
+
+#define DO_616(MACRO, ...) \
+MACRO(616, __VA_ARGS__) \
+DO_615(MACRO, __VA_ARGS__)
+
+
+#define DO_617(MACRO, ...) \
+MACRO(617, __VA_ARGS__) \
+DO_616(MACRO, __VA_ARGS__)
+
+
+#define DO_618(MACRO, ...) \
+MACRO(618, __VA_ARGS__) \
+DO_617(MACRO, __VA_ARGS__)
+
+
+#define DO_619(MACRO, ...) \
+MACRO(619, __VA_ARGS__) \
+DO_618(MACRO, __VA_ARGS__)
+
+
+#define DO_620(MACRO, ...) \
+MACRO(620, __VA_ARGS__) \
+DO_619(MACRO, __VA_ARGS__)
+
+
+#define DO_621(MACRO, ...) \
+MACRO(621, __VA_ARGS__) \
+DO_620(MACRO, __VA_ARGS__)
+
+
+#define DO_622(MACRO, ...) \
+MACRO(622, __VA_ARGS__) \
+DO_621(MACRO, __VA_ARGS__)
+
+
+#define DO_623(MACRO, ...) \
+MACRO(623, __VA_ARGS__) \
+DO_622(MACRO, __VA_ARGS__)
+
+
+#define DO_624(MACRO, ...) \
+MACRO(624, __VA_ARGS__) \
+DO_623(MACRO, __VA_ARGS__)
+
+
+#define DO_625(MACRO, ...) \
+MACRO(625, __VA_ARGS__) \
+DO_624(MACRO, __VA_ARGS__)
+
+
+#define DO_626(MACRO, ...) \
+MACRO(626, __VA_ARGS__) \
+DO_625(MACRO, __VA_ARGS__)
+
+
+#define DO_627(MACRO, ...) \
+MACRO(627, __VA_ARGS__) \
+DO_626(MACRO, __VA_ARGS__)
+
+
+#define DO_628(MACRO, ...) \
+MACRO(628, __VA_ARGS__) \
+DO_627(MACRO, __VA_ARGS__)
+
+
+#define DO_629(MACRO, ...) \
+MACRO(629, __VA_ARGS__) \
+DO_628(MACRO, __VA_ARGS__)
+
+
+#define DO_630(MACRO, ...) \
+MACRO(630, __VA_ARGS__) \
+DO_629(MACRO, __VA_ARGS__)
+
+
+#define DO_631(MACRO, ...) \
+MACRO(631, __VA_ARGS__) \
+DO_630(MACRO, __VA_ARGS__)
+
+
+#define DO_632(MACRO, ...) \
+MACRO(632, __VA_ARGS__) \
+DO_631(MACRO, __VA_ARGS__)
+
+
+#define DO_633(MACRO, ...) \
+MACRO(633, __VA_ARGS__) \
+DO_632(MACRO, __VA_ARGS__)
+
+
+#define DO_634(MACRO, ...) \
+MACRO(634, __VA_ARGS__) \
+DO_633(MACRO, __VA_ARGS__)
+
+
+#define DO_635(MACRO, ...) \
+MACRO(635, __VA_ARGS__) \
+DO_634(MACRO, __VA_ARGS__)
+
+
+#define DO_636(MACRO, ...) \
+MACRO(636, __VA_ARGS__) \
+DO_635(MACRO, __VA_ARGS__)
+
+
+#define DO_637(MACRO, ...) \
+MACRO(637, __VA_ARGS__) \
+DO_636(MACRO, __VA_ARGS__)
+
+
+#define DO_638(MACRO, ...) \
+MACRO(638, __VA_ARGS__) \
+DO_637(MACRO, __VA_ARGS__)
+
+
+#define DO_639(MACRO, ...) \
+MACRO(639, __VA_ARGS__) \
+DO_638(MACRO, __VA_ARGS__)
+
+
+#define DO_640(MACRO, ...) \
+MACRO(640, __VA_ARGS__) \
+DO_639(MACRO, __VA_ARGS__)
+
+
+#define DO_641(MACRO, ...) \
+MACRO(641, __VA_ARGS__) \
+DO_640(MACRO, __VA_ARGS__)
+
+
+#define DO_642(MACRO, ...) \
+MACRO(642, __VA_ARGS__) \
+DO_641(MACRO, __VA_ARGS__)
+
+
+#define DO_643(MACRO, ...) \
+MACRO(643, __VA_ARGS__) \
+DO_642(MACRO, __VA_ARGS__)
+
+
+#define DO_644(MACRO, ...) \
+MACRO(644, __VA_ARGS__) \
+DO_643(MACRO, __VA_ARGS__)
+
+
+#define DO_645(MACRO, ...) \
+MACRO(645, __VA_ARGS__) \
+DO_644(MACRO, __VA_ARGS__)
+
+
+#define DO_646(MACRO, ...) \
+MACRO(646, __VA_ARGS__) \
+DO_645(MACRO, __VA_ARGS__)
+
+
+#define DO_647(MACRO, ...) \
+MACRO(647, __VA_ARGS__) \
+DO_646(MACRO, __VA_ARGS__)
+
+
+#define DO_648(MACRO, ...) \
+MACRO(648, __VA_ARGS__) \
+DO_647(MACRO, __VA_ARGS__)
+
+
+#define DO_649(MACRO, ...) \
+MACRO(649, __VA_ARGS__) \
+DO_648(MACRO, __VA_ARGS__)
+
+
+#define DO_650(MACRO, ...) \
+MACRO(650, __VA_ARGS__) \
+DO_649(MACRO, __VA_ARGS__)
+
+
+#define DO_651(MACRO, ...) \
+MACRO(651, __VA_ARGS__) \
+DO_650(MACRO, __VA_ARGS__)
+
+
+#define DO_652(MACRO, ...) \
+MACRO(652, __VA_ARGS__) \
+DO_651(MACRO, __VA_ARGS__)
+
+
+#define DO_653(MACRO, ...) \
+MACRO(653, __VA_ARGS__) \
+DO_652(MACRO, __VA_ARGS__)
+
+
+#define DO_654(MACRO, ...) \
+MACRO(654, __VA_ARGS__) \
+DO_653(MACRO, __VA_ARGS__)
+
+
+#define DO_655(MACRO, ...) \
+MACRO(655, __VA_ARGS__) \
+DO_654(MACRO, __VA_ARGS__)
+
+
+#define DO_656(MACRO, ...) \
+MACRO(656, __VA_ARGS__) \
+DO_655(MACRO, __VA_ARGS__)
+
+
+#define DO_657(MACRO, ...) \
+MACRO(657, __VA_ARGS__) \
+DO_656(MACRO, __VA_ARGS__)
+
+
+#define DO_658(MACRO, ...) \
+MACRO(658, __VA_ARGS__) \
+DO_657(MACRO, __VA_ARGS__)
+
+
+#define DO_659(MACRO, ...) \
+MACRO(659, __VA_ARGS__) \
+DO_658(MACRO, __VA_ARGS__)
+
+
+#define DO_660(MACRO, ...) \
+MACRO(660, __VA_ARGS__) \
+DO_659(MACRO, __VA_ARGS__)
+
+
+#define DO_661(MACRO, ...) \
+MACRO(661, __VA_ARGS__) \
+DO_660(MACRO, __VA_ARGS__)
+
+
+#define DO_662(MACRO, ...) \
+MACRO(662, __VA_ARGS__) \
+DO_661(MACRO, __VA_ARGS__)
+
+
+#define DO_663(MACRO, ...) \
+MACRO(663, __VA_ARGS__) \
+DO_662(MACRO, __VA_ARGS__)
+
+
+#define DO_664(MACRO, ...) \
+MACRO(664, __VA_ARGS__) \
+DO_663(MACRO, __VA_ARGS__)
+
+
+#define DO_665(MACRO, ...) \
+MACRO(665, __VA_ARGS__) \
+DO_664(MACRO, __VA_ARGS__)
+
+
+#define DO_666(MACRO, ...) \
+MACRO(666, __VA_ARGS__) \
+DO_665(MACRO, __VA_ARGS__)
+
+
+#define DO_667(MACRO, ...) \
+MACRO(667, __VA_ARGS__) \
+DO_666(MACRO, __VA_ARGS__)
+
+
+#define DO_668(MACRO, ...) \
+MACRO(668, __VA_ARGS__) \
+DO_667(MACRO, __VA_ARGS__)
+
+
+#define DO_669(MACRO, ...) \
+MACRO(669, __VA_ARGS__) \
+DO_668(MACRO, __VA_ARGS__)
+
+
+#define DO_670(MACRO, ...) \
+MACRO(670, __VA_ARGS__) \
+DO_669(MACRO, __VA_ARGS__)
+
+
+#define DO_671(MACRO, ...) \
+MACRO(671, __VA_ARGS__) \
+DO_670(MACRO, __VA_ARGS__)
+
+
+#define DO_672(MACRO, ...) \
+MACRO(672, __VA_ARGS__) \
+DO_671(MACRO, __VA_ARGS__)
+
+
+#define DO_673(MACRO, ...) \
+MACRO(673, __VA_ARGS__) \
+DO_672(MACRO, __VA_ARGS__)
+
+
+#define DO_674(MACRO, ...) \
+MACRO(674, __VA_ARGS__) \
+DO_673(MACRO, __VA_ARGS__)
+
+
+#define DO_675(MACRO, ...) \
+MACRO(675, __VA_ARGS__) \
+DO_674(MACRO, __VA_ARGS__)
+
+
+#define DO_676(MACRO, ...) \
+MACRO(676, __VA_ARGS__) \
+DO_675(MACRO, __VA_ARGS__)
+
+
+#define DO_677(MACRO, ...) \
+MACRO(677, __VA_ARGS__) \
+DO_676(MACRO, __VA_ARGS__)
+
+
+#define DO_678(MACRO, ...) \
+MACRO(678, __VA_ARGS__) \
+DO_677(MACRO, __VA_ARGS__)
+
+
+#define DO_679(MACRO, ...) \
+MACRO(679, __VA_ARGS__) \
+DO_678(MACRO, __VA_ARGS__)
+
+
+#define DO_680(MACRO, ...) \
+MACRO(680, __VA_ARGS__) \
+DO_679(MACRO, __VA_ARGS__)
+
+
+#define DO_681(MACRO, ...) \
+MACRO(681, __VA_ARGS__) \
+DO_680(MACRO, __VA_ARGS__)
+
+
+#define DO_682(MACRO, ...) \
+MACRO(682, __VA_ARGS__) \
+DO_681(MACRO, __VA_ARGS__)
+
+
+#define DO_683(MACRO, ...) \
+MACRO(683, __VA_ARGS__) \
+DO_682(MACRO, __VA_ARGS__)
+
+
+#define DO_684(MACRO, ...) \
+MACRO(684, __VA_ARGS__) \
+DO_683(MACRO, __VA_ARGS__)
+
+
+#define DO_685(MACRO, ...) \
+MACRO(685, __VA_ARGS__) \
+DO_684(MACRO, __VA_ARGS__)
+
+
+#define DO_686(MACRO, ...) \
+MACRO(686, __VA_ARGS__) \
+DO_685(MACRO, __VA_ARGS__)
+
+
+#define DO_687(MACRO, ...) \
+MACRO(687, __VA_ARGS__) \
+DO_686(MACRO, __VA_ARGS__)
+
+
+#define DO_688(MACRO, ...) \
+MACRO(688, __VA_ARGS__) \
+DO_687(MACRO, __VA_ARGS__)
+
+
+#define DO_689(MACRO, ...) \
+MACRO(689, __VA_ARGS__) \
+DO_688(MACRO, __VA_ARGS__)
+
+
+#define DO_690(MACRO, ...) \
+MACRO(690, __VA_ARGS__) \
+DO_689(MACRO, __VA_ARGS__)
+
+
+#define DO_691(MACRO, ...) \
+MACRO(691, __VA_ARGS__) \
+DO_690(MACRO, __VA_ARGS__)
+
+
+#define DO_692(MACRO, ...) \
+MACRO(692, __VA_ARGS__) \
+DO_691(MACRO, __VA_ARGS__)
+
+
+#define DO_693(MACRO, ...) \
+MACRO(693, __VA_ARGS__) \
+DO_692(MACRO, __VA_ARGS__)
+
+
+#define DO_694(MACRO, ...) \
+MACRO(694, __VA_ARGS__) \
+DO_693(MACRO, __VA_ARGS__)
+
+
+#define DO_695(MACRO, ...) \
+MACRO(695, __VA_ARGS__) \
+DO_694(MACRO, __VA_ARGS__)
+
+
+#define DO_696(MACRO, ...) \
+MACRO(696, __VA_ARGS__) \
+DO_695(MACRO, __VA_ARGS__)
+
+
+#define DO_697(MACRO, ...) \
+MACRO(697, __VA_ARGS__) \
+DO_696(MACRO, __VA_ARGS__)
+
+
+#define DO_698(MACRO, ...) \
+MACRO(698, __VA_ARGS__) \
+DO_697(MACRO, __VA_ARGS__)
+
+
+#define DO_699(MACRO, ...) \
+MACRO(699, __VA_ARGS__) \
+DO_698(MACRO, __VA_ARGS__)
+
+
+#define DO_700(MACRO, ...) \
+MACRO(700, __VA_ARGS__) \
+DO_699(MACRO, __VA_ARGS__)
+
+
+#define DO_701(MACRO, ...) \
+MACRO(701, __VA_ARGS__) \
+DO_700(MACRO, __VA_ARGS__)
+
+
+#define DO_702(MACRO, ...) \
+MACRO(702, __VA_ARGS__) \
+DO_701(MACRO, __VA_ARGS__)
+
+
+#define DO_703(MACRO, ...) \
+MACRO(703, __VA_ARGS__) \
+DO_702(MACRO, __VA_ARGS__)
+
+
+#define DO_704(MACRO, ...) \
+MACRO(704, __VA_ARGS__) \
+DO_703(MACRO, __VA_ARGS__)
+
+
+#define DO_705(MACRO, ...) \
+MACRO(705, __VA_ARGS__) \
+DO_704(MACRO, __VA_ARGS__)
+
+
+#define DO_706(MACRO, ...) \
+MACRO(706, __VA_ARGS__) \
+DO_705(MACRO, __VA_ARGS__)
+
+
+#define DO_707(MACRO, ...) \
+MACRO(707, __VA_ARGS__) \
+DO_706(MACRO, __VA_ARGS__)
+
+
+#define DO_708(MACRO, ...) \
+MACRO(708, __VA_ARGS__) \
+DO_707(MACRO, __VA_ARGS__)
+
+
+#define DO_709(MACRO, ...) \
+MACRO(709, __VA_ARGS__) \
+DO_708(MACRO, __VA_ARGS__)
+
+
+#define DO_710(MACRO, ...) \
+MACRO(710, __VA_ARGS__) \
+DO_709(MACRO, __VA_ARGS__)
+
+
+#define DO_711(MACRO, ...) \
+MACRO(711, __VA_ARGS__) \
+DO_710(MACRO, __VA_ARGS__)
+
+
+#define DO_712(MACRO, ...) \
+MACRO(712, __VA_ARGS__) \
+DO_711(MACRO, __VA_ARGS__)
+
+
+#define DO_713(MACRO, ...) \
+MACRO(713, __VA_ARGS__) \
+DO_712(MACRO, __VA_ARGS__)
+
+
+#define DO_714(MACRO, ...) \
+MACRO(714, __VA_ARGS__) \
+DO_713(MACRO, __VA_ARGS__)
+
+
+#define DO_715(MACRO, ...) \
+MACRO(715, __VA_ARGS__) \
+DO_714(MACRO, __VA_ARGS__)
+
+
+#define DO_716(MACRO, ...) \
+MACRO(716, __VA_ARGS__) \
+DO_715(MACRO, __VA_ARGS__)
+
+
+#define DO_717(MACRO, ...) \
+MACRO(717, __VA_ARGS__) \
+DO_716(MACRO, __VA_ARGS__)
+
+
+#define DO_718(MACRO, ...) \
+MACRO(718, __VA_ARGS__) \
+DO_717(MACRO, __VA_ARGS__)
+
+
+#define DO_719(MACRO, ...) \
+MACRO(719, __VA_ARGS__) \
+DO_718(MACRO, __VA_ARGS__)
+
+
+#define DO_720(MACRO, ...) \
+MACRO(720, __VA_ARGS__) \
+DO_719(MACRO, __VA_ARGS__)
+
+
+#define DO_721(MACRO, ...) \
+MACRO(721, __VA_ARGS__) \
+DO_720(MACRO, __VA_ARGS__)
+
+
+#define DO_722(MACRO, ...) \
+MACRO(722, __VA_ARGS__) \
+DO_721(MACRO, __VA_ARGS__)
+
+
+#define DO_723(MACRO, ...) \
+MACRO(723, __VA_ARGS__) \
+DO_722(MACRO, __VA_ARGS__)
+
+
+#define DO_724(MACRO, ...) \
+MACRO(724, __VA_ARGS__) \
+DO_723(MACRO, __VA_ARGS__)
+
+
+#define DO_725(MACRO, ...) \
+MACRO(725, __VA_ARGS__) \
+DO_724(MACRO, __VA_ARGS__)
+
+
+#define DO_726(MACRO, ...) \
+MACRO(726, __VA_ARGS__) \
+DO_725(MACRO, __VA_ARGS__)
+
+
+#define DO_727(MACRO, ...) \
+MACRO(727, __VA_ARGS__) \
+DO_726(MACRO, __VA_ARGS__)
+
+
+#define DO_728(MACRO, ...) \
+MACRO(728, __VA_ARGS__) \
+DO_727(MACRO, __VA_ARGS__)
+
+
+#define DO_729(MACRO, ...) \
+MACRO(729, __VA_ARGS__) \
+DO_728(MACRO, __VA_ARGS__)
+
+
+#define DO_730(MACRO, ...) \
+MACRO(730, __VA_ARGS__) \
+DO_729(MACRO, __VA_ARGS__)
+
+
+#define DO_731(MACRO, ...) \
+MACRO(731, __VA_ARGS__) \
+DO_730(MACRO, __VA_ARGS__)
+
+
+#define DO_732(MACRO, ...) \
+MACRO(732, __VA_ARGS__) \
+DO_731(MACRO, __VA_ARGS__)
+
+
+#define DO_733(MACRO, ...) \
+MACRO(733, __VA_ARGS__) \
+DO_732(MACRO, __VA_ARGS__)
+
+
+#define DO_734(MACRO, ...) \
+MACRO(734, __VA_ARGS__) \
+DO_733(MACRO, __VA_ARGS__)
+
+
+#define DO_735(MACRO, ...) \
+MACRO(735, __VA_ARGS__) \
+DO_734(MACRO, __VA_ARGS__)
+
+
+#define DO_736(MACRO, ...) \
+MACRO(736, __VA_ARGS__) \
+DO_735(MACRO, __VA_ARGS__)
+
+
+#define DO_737(MACRO, ...) \
+MACRO(737, __VA_ARGS__) \
+DO_736(MACRO, __VA_ARGS__)
+
+
+#define DO_738(MACRO, ...) \
+MACRO(738, __VA_ARGS__) \
+DO_737(MACRO, __VA_ARGS__)
+
+
+#define DO_739(MACRO, ...) \
+MACRO(739, __VA_ARGS__) \
+DO_738(MACRO, __VA_ARGS__)
+
+
+#define DO_740(MACRO, ...) \
+MACRO(740, __VA_ARGS__) \
+DO_739(MACRO, __VA_ARGS__)
+
+
+#define DO_741(MACRO, ...) \
+MACRO(741, __VA_ARGS__) \
+DO_740(MACRO, __VA_ARGS__)
+
+
+#define DO_742(MACRO, ...) \
+MACRO(742, __VA_ARGS__) \
+DO_741(MACRO, __VA_ARGS__)
+
+
+#define DO_743(MACRO, ...) \
+MACRO(743, __VA_ARGS__) \
+DO_742(MACRO, __VA_ARGS__)
+
+
+#define DO_744(MACRO, ...) \
+MACRO(744, __VA_ARGS__) \
+DO_743(MACRO, __VA_ARGS__)
+
+
+#define DO_745(MACRO, ...) \
+MACRO(745, __VA_ARGS__) \
+DO_744(MACRO, __VA_ARGS__)
+
+
+#define DO_746(MACRO, ...) \
+MACRO(746, __VA_ARGS__) \
+DO_745(MACRO, __VA_ARGS__)
+
+
+#define DO_747(MACRO, ...) \
+MACRO(747, __VA_ARGS__) \
+DO_746(MACRO, __VA_ARGS__)
+
+
+#define DO_748(MACRO, ...) \
+MACRO(748, __VA_ARGS__) \
+DO_747(MACRO, __VA_ARGS__)
+
+
+#define DO_749(MACRO, ...) \
+MACRO(749, __VA_ARGS__) \
+DO_748(MACRO, __VA_ARGS__)
+
+
+#define DO_750(MACRO, ...) \
+MACRO(750, __VA_ARGS__) \
+DO_749(MACRO, __VA_ARGS__)
+
+
+#define DO_751(MACRO, ...) \
+MACRO(751, __VA_ARGS__) \
+DO_750(MACRO, __VA_ARGS__)
+
+
+#define DO_752(MACRO, ...) \
+MACRO(752, __VA_ARGS__) \
+DO_751(MACRO, __VA_ARGS__)
+
+
+#define DO_753(MACRO, ...) \
+MACRO(753, __VA_ARGS__) \
+DO_752(MACRO, __VA_ARGS__)
+
+
+#define DO_754(MACRO, ...) \
+MACRO(754, __VA_ARGS__) \
+DO_753(MACRO, __VA_ARGS__)
+
+
+#define DO_755(MACRO, ...) \
+MACRO(755, __VA_ARGS__) \
+DO_754(MACRO, __VA_ARGS__)
+
+
+#define DO_756(MACRO, ...) \
+MACRO(756, __VA_ARGS__) \
+DO_755(MACRO, __VA_ARGS__)
+
+
+#define DO_757(MACRO, ...) \
+MACRO(757, __VA_ARGS__) \
+DO_756(MACRO, __VA_ARGS__)
+
+
+#define DO_758(MACRO, ...) \
+MACRO(758, __VA_ARGS__) \
+DO_757(MACRO, __VA_ARGS__)
+
+
+#define DO_759(MACRO, ...) \
+MACRO(759, __VA_ARGS__) \
+DO_758(MACRO, __VA_ARGS__)
+
+
+#define DO_760(MACRO, ...) \
+MACRO(760, __VA_ARGS__) \
+DO_759(MACRO, __VA_ARGS__)
+
+
+#define DO_761(MACRO, ...) \
+MACRO(761, __VA_ARGS__) \
+DO_760(MACRO, __VA_ARGS__)
+
+
+#define DO_762(MACRO, ...) \
+MACRO(762, __VA_ARGS__) \
+DO_761(MACRO, __VA_ARGS__)
+
+
+#define DO_763(MACRO, ...) \
+MACRO(763, __VA_ARGS__) \
+DO_762(MACRO, __VA_ARGS__)
+
+
+#define DO_764(MACRO, ...) \
+MACRO(764, __VA_ARGS__) \
+DO_763(MACRO, __VA_ARGS__)
+
+
+#define DO_765(MACRO, ...) \
+MACRO(765, __VA_ARGS__) \
+DO_764(MACRO, __VA_ARGS__)
+
+
+#define DO_766(MACRO, ...) \
+MACRO(766, __VA_ARGS__) \
+DO_765(MACRO, __VA_ARGS__)
+
+
+#define DO_767(MACRO, ...) \
+MACRO(767, __VA_ARGS__) \
+DO_766(MACRO, __VA_ARGS__)
+
+
+#define DO_768(MACRO, ...) \
+MACRO(768, __VA_ARGS__) \
+DO_767(MACRO, __VA_ARGS__)
+
+
+#define DO_769(MACRO, ...) \
+MACRO(769, __VA_ARGS__) \
+DO_768(MACRO, __VA_ARGS__)
+
+
+#define DO_770(MACRO, ...) \
+MACRO(770, __VA_ARGS__) \
+DO_769(MACRO, __VA_ARGS__)
+
+
+#define DO_771(MACRO, ...) \
+MACRO(771, __VA_ARGS__) \
+DO_770(MACRO, __VA_ARGS__)
+
+
+#define DO_772(MACRO, ...) \
+MACRO(772, __VA_ARGS__) \
+DO_771(MACRO, __VA_ARGS__)
+
+
+#define DO_773(MACRO, ...) \
+MACRO(773, __VA_ARGS__) \
+DO_772(MACRO, __VA_ARGS__)
+
+
+#define DO_774(MACRO, ...) \
+MACRO(774, __VA_ARGS__) \
+DO_773(MACRO, __VA_ARGS__)
+
+
+#define DO_775(MACRO, ...) \
+MACRO(775, __VA_ARGS__) \
+DO_774(MACRO, __VA_ARGS__)
+
+
+#define DO_776(MACRO, ...) \
+MACRO(776, __VA_ARGS__) \
+DO_775(MACRO, __VA_ARGS__)
+
+
+#define DO_777(MACRO, ...) \
+MACRO(777, __VA_ARGS__) \
+DO_776(MACRO, __VA_ARGS__)
+
+
+#define DO_778(MACRO, ...) \
+MACRO(778, __VA_ARGS__) \
+DO_777(MACRO, __VA_ARGS__)
+
+
+#define DO_779(MACRO, ...) \
+MACRO(779, __VA_ARGS__) \
+DO_778(MACRO, __VA_ARGS__)
+
+
+#define DO_780(MACRO, ...) \
+MACRO(780, __VA_ARGS__) \
+DO_779(MACRO, __VA_ARGS__)
+
+
+#define DO_781(MACRO, ...) \
+MACRO(781, __VA_ARGS__) \
+DO_780(MACRO, __VA_ARGS__)
+
+
+#define DO_782(MACRO, ...) \
+MACRO(782, __VA_ARGS__) \
+DO_781(MACRO, __VA_ARGS__)
+
+
+#define DO_783(MACRO, ...) \
+MACRO(783, __VA_ARGS__) \
+DO_782(MACRO, __VA_ARGS__)
+
+
+#define DO_784(MACRO, ...) \
+MACRO(784, __VA_ARGS__) \
+DO_783(MACRO, __VA_ARGS__)
+
+
+#define DO_785(MACRO, ...) \
+MACRO(785, __VA_ARGS__) \
+DO_784(MACRO, __VA_ARGS__)
+
+
+#define DO_786(MACRO, ...) \
+MACRO(786, __VA_ARGS__) \
+DO_785(MACRO, __VA_ARGS__)
+
+
+#define DO_787(MACRO, ...) \
+MACRO(787, __VA_ARGS__) \
+DO_786(MACRO, __VA_ARGS__)
+
+
+#define DO_788(MACRO, ...) \
+MACRO(788, __VA_ARGS__) \
+DO_787(MACRO, __VA_ARGS__)
+
+
+#define DO_789(MACRO, ...) \
+MACRO(789, __VA_ARGS__) \
+DO_788(MACRO, __VA_ARGS__)
+
+
+#define DO_790(MACRO, ...) \
+MACRO(790, __VA_ARGS__) \
+DO_789(MACRO, __VA_ARGS__)
+
+
+#define DO_791(MACRO, ...) \
+MACRO(791, __VA_ARGS__) \
+DO_790(MACRO, __VA_ARGS__)
+
+
+#define DO_792(MACRO, ...) \
+MACRO(792, __VA_ARGS__) \
+DO_791(MACRO, __VA_ARGS__)
+
+
+#define DO_793(MACRO, ...) \
+MACRO(793, __VA_ARGS__) \
+DO_792(MACRO, __VA_ARGS__)
+
+
+#define DO_794(MACRO, ...) \
+MACRO(794, __VA_ARGS__) \
+DO_793(MACRO, __VA_ARGS__)
+
+
+#define DO_795(MACRO, ...) \
+MACRO(795, __VA_ARGS__) \
+DO_794(MACRO, __VA_ARGS__)
+
+
+#define DO_796(MACRO, ...) \
+MACRO(796, __VA_ARGS__) \
+DO_795(MACRO, __VA_ARGS__)
+
+
+#define DO_797(MACRO, ...) \
+MACRO(797, __VA_ARGS__) \
+DO_796(MACRO, __VA_ARGS__)
+
+
+#define DO_798(MACRO, ...) \
+MACRO(798, __VA_ARGS__) \
+DO_797(MACRO, __VA_ARGS__)
+
+
+#define DO_799(MACRO, ...) \
+MACRO(799, __VA_ARGS__) \
+DO_798(MACRO, __VA_ARGS__)
+
+
+#define DO_800(MACRO, ...) \
+MACRO(800, __VA_ARGS__) \
+DO_799(MACRO, __VA_ARGS__)
+
+
+#define DO_801(MACRO, ...) \
+MACRO(801, __VA_ARGS__) \
+DO_800(MACRO, __VA_ARGS__)
+
+
+#define DO_802(MACRO, ...) \
+MACRO(802, __VA_ARGS__) \
+DO_801(MACRO, __VA_ARGS__)
+
+
+#define DO_803(MACRO, ...) \
+MACRO(803, __VA_ARGS__) \
+DO_802(MACRO, __VA_ARGS__)
+
+
+#define DO_804(MACRO, ...) \
+MACRO(804, __VA_ARGS__) \
+DO_803(MACRO, __VA_ARGS__)
+
+
+#define DO_805(MACRO, ...) \
+MACRO(805, __VA_ARGS__) \
+DO_804(MACRO, __VA_ARGS__)
+
+
+#define DO_806(MACRO, ...) \
+MACRO(806, __VA_ARGS__) \
+DO_805(MACRO, __VA_ARGS__)
+
+
+#define DO_807(MACRO, ...) \
+MACRO(807, __VA_ARGS__) \
+DO_806(MACRO, __VA_ARGS__)
+
+
+#define DO_808(MACRO, ...) \
+MACRO(808, __VA_ARGS__) \
+DO_807(MACRO, __VA_ARGS__)
+
+
+#define DO_809(MACRO, ...) \
+MACRO(809, __VA_ARGS__) \
+DO_808(MACRO, __VA_ARGS__)
+
+
+#define DO_810(MACRO, ...) \
+MACRO(810, __VA_ARGS__) \
+DO_809(MACRO, __VA_ARGS__)
+
+
+#define DO_811(MACRO, ...) \
+MACRO(811, __VA_ARGS__) \
+DO_810(MACRO, __VA_ARGS__)
+
+
+#define DO_812(MACRO, ...) \
+MACRO(812, __VA_ARGS__) \
+DO_811(MACRO, __VA_ARGS__)
+
+
+#define DO_813(MACRO, ...) \
+MACRO(813, __VA_ARGS__) \
+DO_812(MACRO, __VA_ARGS__)
+
+
+#define DO_814(MACRO, ...) \
+MACRO(814, __VA_ARGS__) \
+DO_813(MACRO, __VA_ARGS__)
+
+
+#define DO_815(MACRO, ...) \
+MACRO(815, __VA_ARGS__) \
+DO_814(MACRO, __VA_ARGS__)
+
+
+#define DO_816(MACRO, ...) \
+MACRO(816, __VA_ARGS__) \
+DO_815(MACRO, __VA_ARGS__)
+
+
+#define DO_817(MACRO, ...) \
+MACRO(817, __VA_ARGS__) \
+DO_816(MACRO, __VA_ARGS__)
+
+
+#define DO_818(MACRO, ...) \
+MACRO(818, __VA_ARGS__) \
+DO_817(MACRO, __VA_ARGS__)
+
+
+#define DO_819(MACRO, ...) \
+MACRO(819, __VA_ARGS__) \
+DO_818(MACRO, __VA_ARGS__)
+
+
+#define DO_820(MACRO, ...) \
+MACRO(820, __VA_ARGS__) \
+DO_819(MACRO, __VA_ARGS__)
+
+
+#define DO_821(MACRO, ...) \
+MACRO(821, __VA_ARGS__) \
+DO_820(MACRO, __VA_ARGS__)
+
+
+#define DO_822(MACRO, ...) \
+MACRO(822, __VA_ARGS__) \
+DO_821(MACRO, __VA_ARGS__)
+
+
+#define DO_823(MACRO, ...) \
+MACRO(823, __VA_ARGS__) \
+DO_822(MACRO, __VA_ARGS__)
+
+
+#define DO_824(MACRO, ...) \
+MACRO(824, __VA_ARGS__) \
+DO_823(MACRO, __VA_ARGS__)
+
+
+#define DO_825(MACRO, ...) \
+MACRO(825, __VA_ARGS__) \
+DO_824(MACRO, __VA_ARGS__)
+
+
+#define DO_826(MACRO, ...) \
+MACRO(826, __VA_ARGS__) \
+DO_825(MACRO, __VA_ARGS__)
+
+
+#define DO_827(MACRO, ...) \
+MACRO(827, __VA_ARGS__) \
+DO_826(MACRO, __VA_ARGS__)
+
+
+#define DO_828(MACRO, ...) \
+MACRO(828, __VA_ARGS__) \
+DO_827(MACRO, __VA_ARGS__)
+
+
+#define DO_829(MACRO, ...) \
+MACRO(829, __VA_ARGS__) \
+DO_828(MACRO, __VA_ARGS__)
+
+
+#define DO_830(MACRO, ...) \
+MACRO(830, __VA_ARGS__) \
+DO_829(MACRO, __VA_ARGS__)
+
+
+#define DO_831(MACRO, ...) \
+MACRO(831, __VA_ARGS__) \
+DO_830(MACRO, __VA_ARGS__)
+
+
+#define DO_832(MACRO, ...) \
+MACRO(832, __VA_ARGS__) \
+DO_831(MACRO, __VA_ARGS__)
+
+
+#define DO_833(MACRO, ...) \
+MACRO(833, __VA_ARGS__) \
+DO_832(MACRO, __VA_ARGS__)
+
+
+#define DO_834(MACRO, ...) \
+MACRO(834, __VA_ARGS__) \
+DO_833(MACRO, __VA_ARGS__)
+
+
+#define DO_835(MACRO, ...) \
+MACRO(835, __VA_ARGS__) \
+DO_834(MACRO, __VA_ARGS__)
+
+
+#define DO_836(MACRO, ...) \
+MACRO(836, __VA_ARGS__) \
+DO_835(MACRO, __VA_ARGS__)
+
+
+#define DO_837(MACRO, ...) \
+MACRO(837, __VA_ARGS__) \
+DO_836(MACRO, __VA_ARGS__)
+
+
+#define DO_838(MACRO, ...) \
+MACRO(838, __VA_ARGS__) \
+DO_837(MACRO, __VA_ARGS__)
+
+
+#define DO_839(MACRO, ...) \
+MACRO(839, __VA_ARGS__) \
+DO_838(MACRO, __VA_ARGS__)
+
+
+#define DO_840(MACRO, ...) \
+MACRO(840, __VA_ARGS__) \
+DO_839(MACRO, __VA_ARGS__)
+
+
+#define DO_841(MACRO, ...) \
+MACRO(841, __VA_ARGS__) \
+DO_840(MACRO, __VA_ARGS__)
+
+
+#define DO_842(MACRO, ...) \
+MACRO(842, __VA_ARGS__) \
+DO_841(MACRO, __VA_ARGS__)
+
+
+#define DO_843(MACRO, ...) \
+MACRO(843, __VA_ARGS__) \
+DO_842(MACRO, __VA_ARGS__)
+
+
+#define DO_844(MACRO, ...) \
+MACRO(844, __VA_ARGS__) \
+DO_843(MACRO, __VA_ARGS__)
+
+
+#define DO_845(MACRO, ...) \
+MACRO(845, __VA_ARGS__) \
+DO_844(MACRO, __VA_ARGS__)
+
+
+#define DO_846(MACRO, ...) \
+MACRO(846, __VA_ARGS__) \
+DO_845(MACRO, __VA_ARGS__)
+
+
+#define DO_847(MACRO, ...) \
+MACRO(847, __VA_ARGS__) \
+DO_846(MACRO, __VA_ARGS__)
+
+
+#define DO_848(MACRO, ...) \
+MACRO(848, __VA_ARGS__) \
+DO_847(MACRO, __VA_ARGS__)
+
+
+#define DO_849(MACRO, ...) \
+MACRO(849, __VA_ARGS__) \
+DO_848(MACRO, __VA_ARGS__)
+
+
+#define DO_850(MACRO, ...) \
+MACRO(850, __VA_ARGS__) \
+DO_849(MACRO, __VA_ARGS__)
+
+
+#define DO_851(MACRO, ...) \
+MACRO(851, __VA_ARGS__) \
+DO_850(MACRO, __VA_ARGS__)
+
+
+#define DO_852(MACRO, ...) \
+MACRO(852, __VA_ARGS__) \
+DO_851(MACRO, __VA_ARGS__)
+
+
+#define DO_853(MACRO, ...) \
+MACRO(853, __VA_ARGS__) \
+DO_852(MACRO, __VA_ARGS__)
+
+
+#define DO_854(MACRO, ...) \
+MACRO(854, __VA_ARGS__) \
+DO_853(MACRO, __VA_ARGS__)
+
+
+#define DO_855(MACRO, ...) \
+MACRO(855, __VA_ARGS__) \
+DO_854(MACRO, __VA_ARGS__)
+
+
+#define DO_856(MACRO, ...) \
+MACRO(856, __VA_ARGS__) \
+DO_855(MACRO, __VA_ARGS__)
+
+
+#define DO_857(MACRO, ...) \
+MACRO(857, __VA_ARGS__) \
+DO_856(MACRO, __VA_ARGS__)
+
+
+#define DO_858(MACRO, ...) \
+MACRO(858, __VA_ARGS__) \
+DO_857(MACRO, __VA_ARGS__)
+
+
+#define DO_859(MACRO, ...) \
+MACRO(859, __VA_ARGS__) \
+DO_858(MACRO, __VA_ARGS__)
+
+
+#define DO_860(MACRO, ...) \
+MACRO(860, __VA_ARGS__) \
+DO_859(MACRO, __VA_ARGS__)
+
+
+#define DO_861(MACRO, ...) \
+MACRO(861, __VA_ARGS__) \
+DO_860(MACRO, __VA_ARGS__)
+
+
+#define DO_862(MACRO, ...) \
+MACRO(862, __VA_ARGS__) \
+DO_861(MACRO, __VA_ARGS__)
+
+
+#define DO_863(MACRO, ...) \
+MACRO(863, __VA_ARGS__) \
+DO_862(MACRO, __VA_ARGS__)
+
+
+#define DO_864(MACRO, ...) \
+MACRO(864, __VA_ARGS__) \
+DO_863(MACRO, __VA_ARGS__)
+
+
+#define DO_865(MACRO, ...) \
+MACRO(865, __VA_ARGS__) \
+DO_864(MACRO, __VA_ARGS__)
+
+
+#define DO_866(MACRO, ...) \
+MACRO(866, __VA_ARGS__) \
+DO_865(MACRO, __VA_ARGS__)
+
+
+#define DO_867(MACRO, ...) \
+MACRO(867, __VA_ARGS__) \
+DO_866(MACRO, __VA_ARGS__)
+
+
+#define DO_868(MACRO, ...) \
+MACRO(868, __VA_ARGS__) \
+DO_867(MACRO, __VA_ARGS__)
+
+
+#define DO_869(MACRO, ...) \
+MACRO(869, __VA_ARGS__) \
+DO_868(MACRO, __VA_ARGS__)
+
+
+#define DO_870(MACRO, ...) \
+MACRO(870, __VA_ARGS__) \
+DO_869(MACRO, __VA_ARGS__)
+
+
+#define DO_871(MACRO, ...) \
+MACRO(871, __VA_ARGS__) \
+DO_870(MACRO, __VA_ARGS__)
+
+
+#define DO_872(MACRO, ...) \
+MACRO(872, __VA_ARGS__) \
+DO_871(MACRO, __VA_ARGS__)
+
+
+#define DO_873(MACRO, ...) \
+MACRO(873, __VA_ARGS__) \
+DO_872(MACRO, __VA_ARGS__)
+
+
+#define DO_874(MACRO, ...) \
+MACRO(874, __VA_ARGS__) \
+DO_873(MACRO, __VA_ARGS__)
+
+
+#define DO_875(MACRO, ...) \
+MACRO(875, __VA_ARGS__) \
+DO_874(MACRO, __VA_ARGS__)
+
+
+#define DO_876(MACRO, ...) \
+MACRO(876, __VA_ARGS__) \
+DO_875(MACRO, __VA_ARGS__)
+
+
+#define DO_877(MACRO, ...) \
+MACRO(877, __VA_ARGS__) \
+DO_876(MACRO, __VA_ARGS__)
+
+
+#define DO_878(MACRO, ...) \
+MACRO(878, __VA_ARGS__) \
+DO_877(MACRO, __VA_ARGS__)
+
+
+#define DO_879(MACRO, ...) \
+MACRO(879, __VA_ARGS__) \
+DO_878(MACRO, __VA_ARGS__)
+
+
+#define DO_880(MACRO, ...) \
+MACRO(880, __VA_ARGS__) \
+DO_879(MACRO, __VA_ARGS__)
+
+
+#define DO_881(MACRO, ...) \
+MACRO(881, __VA_ARGS__) \
+DO_880(MACRO, __VA_ARGS__)
+
+
+#define DO_882(MACRO, ...) \
+MACRO(882, __VA_ARGS__) \
+DO_881(MACRO, __VA_ARGS__)
+
+
+#define DO_883(MACRO, ...) \
+MACRO(883, __VA_ARGS__) \
+DO_882(MACRO, __VA_ARGS__)
+
+
+#define DO_884(MACRO, ...) \
+MACRO(884, __VA_ARGS__) \
+DO_883(MACRO, __VA_ARGS__)
+
+
+#define DO_885(MACRO, ...) \
+MACRO(885, __VA_ARGS__) \
+DO_884(MACRO, __VA_ARGS__)
+
+
+#define DO_886(MACRO, ...) \
+MACRO(886, __VA_ARGS__) \
+DO_885(MACRO, __VA_ARGS__)
+
+
+#define DO_887(MACRO, ...) \
+MACRO(887, __VA_ARGS__) \
+DO_886(MACRO, __VA_ARGS__)
+
+
+#define DO_888(MACRO, ...) \
+MACRO(888, __VA_ARGS__) \
+DO_887(MACRO, __VA_ARGS__)
+
+
+#define DO_889(MACRO, ...) \
+MACRO(889, __VA_ARGS__) \
+DO_888(MACRO, __VA_ARGS__)
+
+
+#define DO_890(MACRO, ...) \
+MACRO(890, __VA_ARGS__) \
+DO_889(MACRO, __VA_ARGS__)
+
+
+#define DO_891(MACRO, ...) \
+MACRO(891, __VA_ARGS__) \
+DO_890(MACRO, __VA_ARGS__)
+
+
+#define DO_892(MACRO, ...) \
+MACRO(892, __VA_ARGS__) \
+DO_891(MACRO, __VA_ARGS__)
+
+
+#define DO_893(MACRO, ...) \
+MACRO(893, __VA_ARGS__) \
+DO_892(MACRO, __VA_ARGS__)
+
+
+#define DO_894(MACRO, ...) \
+MACRO(894, __VA_ARGS__) \
+DO_893(MACRO, __VA_ARGS__)
+
+
+#define DO_895(MACRO, ...) \
+MACRO(895, __VA_ARGS__) \
+DO_894(MACRO, __VA_ARGS__)
+
+
+#define DO_896(MACRO, ...) \
+MACRO(896, __VA_ARGS__) \
+DO_895(MACRO, __VA_ARGS__)
+
+
+#define DO_897(MACRO, ...) \
+MACRO(897, __VA_ARGS__) \
+DO_896(MACRO, __VA_ARGS__)
+
+
+#define DO_898(MACRO, ...) \
+MACRO(898, __VA_ARGS__) \
+DO_897(MACRO, __VA_ARGS__)
+
+
+#define DO_899(MACRO, ...) \
+MACRO(899, __VA_ARGS__) \
+DO_898(MACRO, __VA_ARGS__)
+
+
+#define DO_900(MACRO, ...) \
+MACRO(900, __VA_ARGS__) \
+DO_899(MACRO, __VA_ARGS__)
+
+
+#define DO_901(MACRO, ...) \
+MACRO(901, __VA_ARGS__) \
+DO_900(MACRO, __VA_ARGS__)
+
+
+#define DO_902(MACRO, ...) \
+MACRO(902, __VA_ARGS__) \
+DO_901(MACRO, __VA_ARGS__)
+
+
+#define DO_903(MACRO, ...) \
+MACRO(903, __VA_ARGS__) \
+DO_902(MACRO, __VA_ARGS__)
+
+
+#define DO_904(MACRO, ...) \
+MACRO(904, __VA_ARGS__) \
+DO_903(MACRO, __VA_ARGS__)
+
+
+#define DO_905(MACRO, ...) \
+MACRO(905, __VA_ARGS__) \
+DO_904(MACRO, __VA_ARGS__)
+
+
+#define DO_906(MACRO, ...) \
+MACRO(906, __VA_ARGS__) \
+DO_905(MACRO, __VA_ARGS__)
+
+
+#define DO_907(MACRO, ...) \
+MACRO(907, __VA_ARGS__) \
+DO_906(MACRO, __VA_ARGS__)
+
+
+#define DO_908(MACRO, ...) \
+MACRO(908, __VA_ARGS__) \
+DO_907(MACRO, __VA_ARGS__)
+
+
+#define DO_909(MACRO, ...) \
+MACRO(909, __VA_ARGS__) \
+DO_908(MACRO, __VA_ARGS__)
+
+
+#define DO_910(MACRO, ...) \
+MACRO(910, __VA_ARGS__) \
+DO_909(MACRO, __VA_ARGS__)
+
+
+#define DO_911(MACRO, ...) \
+MACRO(911, __VA_ARGS__) \
+DO_910(MACRO, __VA_ARGS__)
+
+
+#define DO_912(MACRO, ...) \
+MACRO(912, __VA_ARGS__) \
+DO_911(MACRO, __VA_ARGS__)
+
+
+#define DO_913(MACRO, ...) \
+MACRO(913, __VA_ARGS__) \
+DO_912(MACRO, __VA_ARGS__)
+
+
+#define DO_914(MACRO, ...) \
+MACRO(914, __VA_ARGS__) \
+DO_913(MACRO, __VA_ARGS__)
+
+
+#define DO_915(MACRO, ...) \
+MACRO(915, __VA_ARGS__) \
+DO_914(MACRO, __VA_ARGS__)
+
+
+#define DO_916(MACRO, ...) \
+MACRO(916, __VA_ARGS__) \
+DO_915(MACRO, __VA_ARGS__)
+
+
+#define DO_917(MACRO, ...) \
+MACRO(917, __VA_ARGS__) \
+DO_916(MACRO, __VA_ARGS__)
+
+
+#define DO_918(MACRO, ...) \
+MACRO(918, __VA_ARGS__) \
+DO_917(MACRO, __VA_ARGS__)
+
+
+#define DO_919(MACRO, ...) \
+MACRO(919, __VA_ARGS__) \
+DO_918(MACRO, __VA_ARGS__)
+
+
+#define DO_920(MACRO, ...) \
+MACRO(920, __VA_ARGS__) \
+DO_919(MACRO, __VA_ARGS__)
+
+
+#define DO_921(MACRO, ...) \
+MACRO(921, __VA_ARGS__) \
+DO_920(MACRO, __VA_ARGS__)
+
+
+#define DO_922(MACRO, ...) \
+MACRO(922, __VA_ARGS__) \
+DO_921(MACRO, __VA_ARGS__)
+
+
+#define DO_923(MACRO, ...) \
+MACRO(923, __VA_ARGS__) \
+DO_922(MACRO, __VA_ARGS__)
+
+
+#define DO_924(MACRO, ...) \
+MACRO(924, __VA_ARGS__) \
+DO_923(MACRO, __VA_ARGS__)
+
+
+#define DO_925(MACRO, ...) \
+MACRO(925, __VA_ARGS__) \
+DO_924(MACRO, __VA_ARGS__)
+
+
+#define DO_926(MACRO, ...) \
+MACRO(926, __VA_ARGS__) \
+DO_925(MACRO, __VA_ARGS__)
+
+
+#define DO_927(MACRO, ...) \
+MACRO(927, __VA_ARGS__) \
+DO_926(MACRO, __VA_ARGS__)
+
+
+#define DO_928(MACRO, ...) \
+MACRO(928, __VA_ARGS__) \
+DO_927(MACRO, __VA_ARGS__)
+
+
+#define DO_929(MACRO, ...) \
+MACRO(929, __VA_ARGS__) \
+DO_928(MACRO, __VA_ARGS__)
+
+
+#define DO_930(MACRO, ...) \
+MACRO(930, __VA_ARGS__) \
+DO_929(MACRO, __VA_ARGS__)
+
+
+#define DO_931(MACRO, ...) \
+MACRO(931, __VA_ARGS__) \
+DO_930(MACRO, __VA_ARGS__)
+
+
+#define DO_932(MACRO, ...) \
+MACRO(932, __VA_ARGS__) \
+DO_931(MACRO, __VA_ARGS__)
+
+
+#define DO_933(MACRO, ...) \
+MACRO(933, __VA_ARGS__) \
+DO_932(MACRO, __VA_ARGS__)
+
+
+#define DO_934(MACRO, ...) \
+MACRO(934, __VA_ARGS__) \
+DO_933(MACRO, __VA_ARGS__)
+
+
+#define DO_935(MACRO, ...) \
+MACRO(935, __VA_ARGS__) \
+DO_934(MACRO, __VA_ARGS__)
+
+
+#define DO_936(MACRO, ...) \
+MACRO(936, __VA_ARGS__) \
+DO_935(MACRO, __VA_ARGS__)
+
+
+#define DO_937(MACRO, ...) \
+MACRO(937, __VA_ARGS__) \
+DO_936(MACRO, __VA_ARGS__)
+
+
+#define DO_938(MACRO, ...) \
+MACRO(938, __VA_ARGS__) \
+DO_937(MACRO, __VA_ARGS__)
+
+
+#define DO_939(MACRO, ...) \
+MACRO(939, __VA_ARGS__) \
+DO_938(MACRO, __VA_ARGS__)
+
+
+#define DO_940(MACRO, ...) \
+MACRO(940, __VA_ARGS__) \
+DO_939(MACRO, __VA_ARGS__)
+
+
+#define DO_941(MACRO, ...) \
+MACRO(941, __VA_ARGS__) \
+DO_940(MACRO, __VA_ARGS__)
+
+
+#define DO_942(MACRO, ...) \
+MACRO(942, __VA_ARGS__) \
+DO_941(MACRO, __VA_ARGS__)
+
+
+#define DO_943(MACRO, ...) \
+MACRO(943, __VA_ARGS__) \
+DO_942(MACRO, __VA_ARGS__)
+
+
+#define DO_944(MACRO, ...) \
+MACRO(944, __VA_ARGS__) \
+DO_943(MACRO, __VA_ARGS__)
+
+
+#define DO_945(MACRO, ...) \
+MACRO(945, __VA_ARGS__) \
+DO_944(MACRO, __VA_ARGS__)
+
+
+#define DO_946(MACRO, ...) \
+MACRO(946, __VA_ARGS__) \
+DO_945(MACRO, __VA_ARGS__)
+
+
+#define DO_947(MACRO, ...) \
+MACRO(947, __VA_ARGS__) \
+DO_946(MACRO, __VA_ARGS__)
+
+
+#define DO_948(MACRO, ...) \
+MACRO(948, __VA_ARGS__) \
+DO_947(MACRO, __VA_ARGS__)
+
+
+#define DO_949(MACRO, ...) \
+MACRO(949, __VA_ARGS__) \
+DO_948(MACRO, __VA_ARGS__)
+
+
+#define DO_950(MACRO, ...) \
+MACRO(950, __VA_ARGS__) \
+DO_949(MACRO, __VA_ARGS__)
+
+
+#define DO_951(MACRO, ...) \
+MACRO(951, __VA_ARGS__) \
+DO_950(MACRO, __VA_ARGS__)
+
+
+#define DO_952(MACRO, ...) \
+MACRO(952, __VA_ARGS__) \
+DO_951(MACRO, __VA_ARGS__)
+
+
+#define DO_953(MACRO, ...) \
+MACRO(953, __VA_ARGS__) \
+DO_952(MACRO, __VA_ARGS__)
+
+
+#define DO_954(MACRO, ...) \
+MACRO(954, __VA_ARGS__) \
+DO_953(MACRO, __VA_ARGS__)
+
+
+#define DO_955(MACRO, ...) \
+MACRO(955, __VA_ARGS__) \
+DO_954(MACRO, __VA_ARGS__)
+
+
+#define DO_956(MACRO, ...) \
+MACRO(956, __VA_ARGS__) \
+DO_955(MACRO, __VA_ARGS__)
+
+
+#define DO_957(MACRO, ...) \
+MACRO(957, __VA_ARGS__) \
+DO_956(MACRO, __VA_ARGS__)
+
+
+#define DO_958(MACRO, ...) \
+MACRO(958, __VA_ARGS__) \
+DO_957(MACRO, __VA_ARGS__)
+
+
+#define DO_959(MACRO, ...) \
+MACRO(959, __VA_ARGS__) \
+DO_958(MACRO, __VA_ARGS__)
+
+
+#define DO_960(MACRO, ...) \
+MACRO(960, __VA_ARGS__) \
+DO_959(MACRO, __VA_ARGS__)
+
+
+#define DO_961(MACRO, ...) \
+MACRO(961, __VA_ARGS__) \
+DO_960(MACRO, __VA_ARGS__)
+
+
+#define DO_962(MACRO, ...) \
+MACRO(962, __VA_ARGS__) \
+DO_961(MACRO, __VA_ARGS__)
+
+
+#define DO_963(MACRO, ...) \
+MACRO(963, __VA_ARGS__) \
+DO_962(MACRO, __VA_ARGS__)
+
+
+#define DO_964(MACRO, ...) \
+MACRO(964, __VA_ARGS__) \
+DO_963(MACRO, __VA_ARGS__)
+
+
+#define DO_965(MACRO, ...) \
+MACRO(965, __VA_ARGS__) \
+DO_964(MACRO, __VA_ARGS__)
+
+
+#define DO_966(MACRO, ...) \
+MACRO(966, __VA_ARGS__) \
+DO_965(MACRO, __VA_ARGS__)
+
+
+#define DO_967(MACRO, ...) \
+MACRO(967, __VA_ARGS__) \
+DO_966(MACRO, __VA_ARGS__)
+
+
+#define DO_968(MACRO, ...) \
+MACRO(968, __VA_ARGS__) \
+DO_967(MACRO, __VA_ARGS__)
+
+
+#define DO_969(MACRO, ...) \
+MACRO(969, __VA_ARGS__) \
+DO_968(MACRO, __VA_ARGS__)
+
+
+#define DO_970(MACRO, ...) \
+MACRO(970, __VA_ARGS__) \
+DO_969(MACRO, __VA_ARGS__)
+
+
+#define DO_971(MACRO, ...) \
+MACRO(971, __VA_ARGS__) \
+DO_970(MACRO, __VA_ARGS__)
+
+
+#define DO_972(MACRO, ...) \
+MACRO(972, __VA_ARGS__) \
+DO_971(MACRO, __VA_ARGS__)
+
+
+#define DO_973(MACRO, ...) \
+MACRO(973, __VA_ARGS__) \
+DO_972(MACRO, __VA_ARGS__)
+
+
+#define DO_974(MACRO, ...) \
+MACRO(974, __VA_ARGS__) \
+DO_973(MACRO, __VA_ARGS__)
+
+
+#define DO_975(MACRO, ...) \
+MACRO(975, __VA_ARGS__) \
+DO_974(MACRO, __VA_ARGS__)
+
+
+#define DO_976(MACRO, ...) \
+MACRO(976, __VA_ARGS__) \
+DO_975(MACRO, __VA_ARGS__)
+
+
+#define DO_977(MACRO, ...) \
+MACRO(977, __VA_ARGS__) \
+DO_976(MACRO, __VA_ARGS__)
+
+
+#define DO_978(MACRO, ...) \
+MACRO(978, __VA_ARGS__) \
+DO_977(MACRO, __VA_ARGS__)
+
+
+#define DO_979(MACRO, ...) \
+MACRO(979, __VA_ARGS__) \
+DO_978(MACRO, __VA_ARGS__)
+
+
+#define DO_980(MACRO, ...) \
+MACRO(980, __VA_ARGS__) \
+DO_979(MACRO, __VA_ARGS__)
+
+
+#define DO_981(MACRO, ...) \
+MACRO(981, __VA_ARGS__) \
+DO_980(MACRO, __VA_ARGS__)
+
+
+#define DO_982(MACRO, ...) \
+MACRO(982, __VA_ARGS__) \
+DO_981(MACRO, __VA_ARGS__)
+
+
+#define DO_983(MACRO, ...) \
+MACRO(983, __VA_ARGS__) \
+DO_982(MACRO, __VA_ARGS__)
+
+
+#define DO_984(MACRO, ...) \
+MACRO(984, __VA_ARGS__) \
+DO_983(MACRO, __VA_ARGS__)
+
+
+#define DO_985(MACRO, ...) \
+MACRO(985, __VA_ARGS__) \
+DO_984(MACRO, __VA_ARGS__)
+
+
+#define DO_986(MACRO, ...) \
+MACRO(986, __VA_ARGS__) \
+DO_985(MACRO, __VA_ARGS__)
+
+
+#define DO_987(MACRO, ...) \
+MACRO(987, __VA_ARGS__) \
+DO_986(MACRO, __VA_ARGS__)
+
+
+#define DO_988(MACRO, ...) \
+MACRO(988, __VA_ARGS__) \
+DO_987(MACRO, __VA_ARGS__)
+
+
+#define DO_989(MACRO, ...) \
+MACRO(989, __VA_ARGS__) \
+DO_988(MACRO, __VA_ARGS__)
+
+
+#define DO_990(MACRO, ...) \
+MACRO(990, __VA_ARGS__) \
+DO_989(MACRO, __VA_ARGS__)
+
+
+#define DO_991(MACRO, ...) \
+MACRO(991, __VA_ARGS__) \
+DO_990(MACRO, __VA_ARGS__)
+
+
+#define DO_992(MACRO, ...) \
+MACRO(992, __VA_ARGS__) \
+DO_991(MACRO, __VA_ARGS__)
+
+
+#define DO_993(MACRO, ...) \
+MACRO(993, __VA_ARGS__) \
+DO_992(MACRO, __VA_ARGS__)
+
+
+#define DO_994(MACRO, ...) \
+MACRO(994, __VA_ARGS__) \
+DO_993(MACRO, __VA_ARGS__)
+
+
+#define DO_995(MACRO, ...) \
+MACRO(995, __VA_ARGS__) \
+DO_994(MACRO, __VA_ARGS__)
+
+
+#define DO_996(MACRO, ...) \
+MACRO(996, __VA_ARGS__) \
+DO_995(MACRO, __VA_ARGS__)
+
+
+#define DO_997(MACRO, ...) \
+MACRO(997, __VA_ARGS__) \
+DO_996(MACRO, __VA_ARGS__)
+
+
+#define DO_998(MACRO, ...) \
+MACRO(998, __VA_ARGS__) \
+DO_997(MACRO, __VA_ARGS__)
+
+
+#define DO_999(MACRO, ...) \
+MACRO(999, __VA_ARGS__) \
+DO_998(MACRO, __VA_ARGS__)
+
+
+#define DO_1000(MACRO, ...) \
+MACRO(1000, __VA_ARGS__) \
+DO_999(MACRO, __VA_ARGS__)
+
+
+#define DO_1001(MACRO, ...) \
+MACRO(1001, __VA_ARGS__) \
+DO_1000(MACRO, __VA_ARGS__)
+
+
+#define DO_1002(MACRO, ...) \
+MACRO(1002, __VA_ARGS__) \
+DO_1001(MACRO, __VA_ARGS__)
+
+
+#define DO_1003(MACRO, ...) \
+MACRO(1003, __VA_ARGS__) \
+DO_1002(MACRO, __VA_ARGS__)
+
+
+#define DO_1004(MACRO, ...) \
+MACRO(1004, __VA_ARGS__) \
+DO_1003(MACRO, __VA_ARGS__)
+
+
+#define DO_1005(MACRO, ...) \
+MACRO(1005, __VA_ARGS__) \
+DO_1004(MACRO, __VA_ARGS__)
+
+
+#define DO_1006(MACRO, ...) \
+MACRO(1006, __VA_ARGS__) \
+DO_1005(MACRO, __VA_ARGS__)
+
+
+#define DO_1007(MACRO, ...) \
+MACRO(1007, __VA_ARGS__) \
+DO_1006(MACRO, __VA_ARGS__)
+
+
+#define DO_1008(MACRO, ...) \
+MACRO(1008, __VA_ARGS__) \
+DO_1007(MACRO, __VA_ARGS__)
+
+
+#define DO_1009(MACRO, ...) \
+MACRO(1009, __VA_ARGS__) \
+DO_1008(MACRO, __VA_ARGS__)
+
+
+#define DO_1010(MACRO, ...) \
+MACRO(1010, __VA_ARGS__) \
+DO_1009(MACRO, __VA_ARGS__)
+
+
+#define DO_1011(MACRO, ...) \
+MACRO(1011, __VA_ARGS__) \
+DO_1010(MACRO, __VA_ARGS__)
+
+
+#define DO_1012(MACRO, ...) \
+MACRO(1012, __VA_ARGS__) \
+DO_1011(MACRO, __VA_ARGS__)
+
+
+#define DO_1013(MACRO, ...) \
+MACRO(1013, __VA_ARGS__) \
+DO_1012(MACRO, __VA_ARGS__)
+
+
+#define DO_1014(MACRO, ...) \
+MACRO(1014, __VA_ARGS__) \
+DO_1013(MACRO, __VA_ARGS__)
+
+
+#define DO_1015(MACRO, ...) \
+MACRO(1015, __VA_ARGS__) \
+DO_1014(MACRO, __VA_ARGS__)
+
+
+#define DO_1016(MACRO, ...) \
+MACRO(1016, __VA_ARGS__) \
+DO_1015(MACRO, __VA_ARGS__)
+
+
+#define DO_1017(MACRO, ...) \
+MACRO(1017, __VA_ARGS__) \
+DO_1016(MACRO, __VA_ARGS__)
+
+
+#define DO_1018(MACRO, ...) \
+MACRO(1018, __VA_ARGS__) \
+DO_1017(MACRO, __VA_ARGS__)
+
+
+#define DO_1019(MACRO, ...) \
+MACRO(1019, __VA_ARGS__) \
+DO_1018(MACRO, __VA_ARGS__)
+
+
+#define DO_1020(MACRO, ...) \
+MACRO(1020, __VA_ARGS__) \
+DO_1019(MACRO, __VA_ARGS__)
+
+
+#define DO_1021(MACRO, ...) \
+MACRO(1021, __VA_ARGS__) \
+DO_1020(MACRO, __VA_ARGS__)
+
+
+#define DO_1022(MACRO, ...) \
+MACRO(1022, __VA_ARGS__) \
+DO_1021(MACRO, __VA_ARGS__)
+
+
+#define DO_1023(MACRO, ...) \
+MACRO(1023, __VA_ARGS__) \
+DO_1022(MACRO, __VA_ARGS__)
+
+
+#define DO_1024(MACRO, ...) \
+MACRO(1024, __VA_ARGS__) \
+DO_1023(MACRO, __VA_ARGS__)
+
+
+
+#define DO(TIMES, MACRO, ...) C2(DO_, TIMES)(MACRO, __VA_ARGS__)
+
+
+/* we need some sort of macro that does:
+IF(0, "true", "false") => "false"
+IF(1, "true", "false") => "true"
+IF(X, "true", "false") => "true"
+*/
+
+#define INTERNALIF(x) INTERNALIF##x
+#define INTERNALIF0
+
+#define ISZERO(x) COUNT_ARG(INTERNALIF(x))
+
+#define IF(condition, trueBranch, falseBranch) C2(IF,ISZERO(condition))(trueBranch, falseBranch)
+#define IF0(trueBranch, falseBranch) falseBranch
+#define IF1(trueBranch, falseBranch) trueBranch
+
+
+
+#define DEFINE_ENUMERATION_CONSTANT(x) x,
+/*DEFINE_ENUM goes to header*/
+#define DEFINE_ENUM(enumName, ...) typedef enum C2(enumName, _TAG) { FOR_EACH_1(DEFINE_ENUMERATION_CONSTANT, __VA_ARGS__)} enumName; \
+    extern const char* C2(enumName,Strings)(enumName value); \
+    extern int C2(enumName, _FromString)(const char* enumAsString, enumName* destination);
+
+
+#define DEFINE_ENUMERATION_CONSTANT_AS_WIDESTRING(x) C2(L, TOSTRING(x)) , 
+#define DEFINE_ENUMERATION_CONSTANT_AS_STRING(x) TOSTRING(x) , 
+/*DEFINE_ENUM_STRINGS goes to .c*/
+#define DEFINE_ENUM_STRINGS(enumName, ...) const char* C2(enumName, StringStorage)[COUNT_ARG(__VA_ARGS__)] = {FOR_EACH_1(DEFINE_ENUMERATION_CONSTANT_AS_STRING, __VA_ARGS__)}; \
+const char* C2(enumName,Strings)(enumName value)                   \
+{                                                                  \
+    if((int)value<0 || (int)value>=COUNT_ARG(__VA_ARGS__))                         \
+    {                                                              \
+        /*this is an error case*/                                  \
+        return NULL;                                               \
+    }                                                              \
+    else                                                           \
+    {                                                              \
+        return C2(enumName, StringStorage)[value];                 \
+    }                                                              \
+}                                                                  \
+int C2(enumName, _FromString)(const char* enumAsString, enumName* destination)  \
+{                                                                               \
+    if(                                                                         \
+        (enumAsString==NULL) || (destination==NULL)                             \
+    )                                                                           \
+    {                                                                           \
+        return __FAILURE__;                                                     \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        size_t i;                                                               \
+        for(i=0;i<COUNT_ARG(__VA_ARGS__);i++)                                   \
+        {                                                                       \
+            if(strcmp(enumAsString, C2(enumName, StringStorage)[i])==0)         \
+            {                                                                   \
+                *destination = (enumName)i;                                     \
+                return 0;                                                       \
+            }                                                                   \
+        }                                                                       \
+        return __FAILURE__;                                                     \
+    }                                                                           \
+}                                                                               \
+
+#define DEFINE_LOCAL_ENUM(enumName, ...) typedef enum C2(enumName, _TAG) { FOR_EACH_1(DEFINE_ENUMERATION_CONSTANT, __VA_ARGS__)} enumName; \
+static const char* C2(enumName, StringStorage)[COUNT_ARG(__VA_ARGS__)] = {FOR_EACH_1(DEFINE_ENUMERATION_CONSTANT_AS_STRING, __VA_ARGS__)}; \
+static const char* C2(enumName,Strings)(enumName value)                   \
+{                                                                  \
+    if((int)value<0 || (int)value>=COUNT_ARG(__VA_ARGS__))                         \
+    {                                                              \
+        /*this is an error case*/                                  \
+        return NULL;                                               \
+    }                                                              \
+    else                                                           \
+    {                                                              \
+        return C2(enumName, StringStorage)[value];                 \
+    }                                                              \
+}
+
+#define ENUM_TO_STRING(enumName, enumValue) C2(enumName, Strings)(enumValue)
+#define STRING_TO_ENUM(stringValue, enumName, addressOfEnumVariable) C2(enumName, _FromString)(stringValue, addressOfEnumVariable)
+
+#define DEFINE_MICROMOCK_ENUM_TO_STRING(type, ...) MICROMOCK_ENUM_TO_STRING(type, FOR_EACH_1(DEFINE_ENUMERATION_CONSTANT_AS_WIDESTRING, __VA_ARGS__));
+
+#define EMPTY()
+#define DELAY(id) id EMPTY LPAREN )
+
+#endif /*MACRO_UTILS_H*/
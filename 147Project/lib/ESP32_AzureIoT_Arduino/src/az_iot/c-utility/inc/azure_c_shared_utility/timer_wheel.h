@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#include <cstdbool>
+#else
+#include <stdbool.h>
+#endif /* __cplusplus */
+
+#include "doublylinkedlist.h"
+#include "tickcounter.h"
+#include "umock_c_prod.h"
+
+typedef struct TIMER_WHEEL_TAG* TIMER_WHEEL_HANDLE;
+
+/**
+* @brief                Function called by timer_wheel_advance when a timer expires. The timer is no longer armed
+*                       when it runs, so it may arm the timer again or free the memory the timer lives in.
+* @param context        Context passed to timer_wheel_timer_init.
+*/
+typedef void(*TIMER_WHEEL_CALLBACK)(void* context);
+
+/**
+* @brief                A timer, embedded in the structure it times out. The wheel links the timer itself, so arming
+*                       and cancelling it allocate nothing. A timer without a callback only marks a deadline
+*                       for timer_wheel_get_next_deadline.
+*/
+typedef struct TIMER_WHEEL_TIMER_TAG
+{
+    DLIST_ENTRY entry;
+    tickcounter_ms_t expiry;
+    TIMER_WHEEL_CALLBACK callback;
+    void* context;
+    unsigned char level;
+    bool armed;
+} TIMER_WHEEL_TIMER;
+
+/**
+* @brief                Creates a wheel whose time starts at now_ms.
+* @returns              The wheel, or NULL on failure.
+*/
+MOCKABLE_FUNCTION(, TIMER_WHEEL_HANDLE, timer_wheel_create, tickcounter_ms_t, now_ms);
+/**
+* @brief                Destroys the wheel. Timers still armed are left disarmed and their callbacks are not called.
+*/
+MOCKABLE_FUNCTION(, void, timer_wheel_destroy, TIMER_WHEEL_HANDLE, timer_wheel);
+/**
+* @brief                Prepares a timer for timer_wheel_arm; callback may be NULL.
+*/
+MOCKABLE_FUNCTION(, void, timer_wheel_timer_init, TIMER_WHEEL_TIMER*, timer, TIMER_WHEEL_CALLBACK, callback, void*, context);
+/**
+* @brief                Arms the timer to expire delay_ms after the wheel's current time, re-arming it if it is
+*                       already armed. A delay of 0 expires once the wheel's time moves on. O(1).
+* @returns              0 on success, non-zero if an argument is NULL.
+*/
+MOCKABLE_FUNCTION(, int, timer_wheel_arm, TIMER_WHEEL_HANDLE, timer_wheel, TIMER_WHEEL_TIMER*, timer, tickcounter_ms_t, delay_ms);
+/**
+* @brief                Disarms the timer; does nothing if it is not armed. O(1).
+*/
+MOCKABLE_FUNCTION(, void, timer_wheel_cancel, TIMER_WHEEL_HANDLE, timer_wheel, TIMER_WHEEL_TIMER*, timer);
+/**
+* @brief                Moves the wheel's time forward to now_ms and calls the callback of every timer that expired,
+*                       in order of expiry. Empty stretches of the wheel are skipped a whole slot span at a time.
+*/
+MOCKABLE_FUNCTION(, void, timer_wheel_advance, TIMER_WHEEL_HANDLE, timer_wheel, tickcounter_ms_t, now_ms);
+/**
+* @brief                The time the wheel was last advanced to, i.e. the tick sampled by its owner.
+*/
+MOCKABLE_FUNCTION(, tickcounter_ms_t, timer_wheel_now, TIMER_WHEEL_HANDLE, timer_wheel);
+/**
+* @brief                Sets ms_to_deadline to the time from the wheel's current time until the earliest armed
+*                       timer expires, so the owner can sleep until then instead of polling.
+* @returns              0 on success, non-zero if no timer is armed or an argument is NULL.
+*/
+MOCKABLE_FUNCTION(, int, timer_wheel_get_next_deadline, TIMER_WHEEL_HANDLE, timer_wheel, tickcounter_ms_t*, ms_to_deadline);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* TIMER_WHEEL_H */
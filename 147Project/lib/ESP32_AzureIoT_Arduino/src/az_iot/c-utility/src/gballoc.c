@@ -0,0 +1,831 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc_backend.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc_profile.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/lock.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/optimize_size.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/xlogging.h"
+
+#ifndef SIZE_MAX
+#define SIZE_MAX ((size_t)~(size_t)0)
+#endif
+
+/* the tracked blocks live in an open addressed table keyed by address, so finding the one to free or
+   reallocate takes the same time however many are live */
+typedef struct ALLOCATION_TAG
+{
+    void* ptr;
+    size_t size;
+    unsigned short site;
+    unsigned char subsystem;    /* GBALLOC_SUBSYSTEM_COUNT while profiling was off */
+} ALLOCATION;
+
+typedef enum GBALLOC_STATE_TAG
+{
+    GBALLOC_STATE_INIT,
+    GBALLOC_STATE_NOT_INIT
+} GBALLOC_STATE;
+
+typedef struct PROFILE_COUNTERS_TAG
+{
+    size_t liveBytes;
+    size_t peakBytes;
+    size_t allocations;
+    size_t bytesAllocated;
+} PROFILE_COUNTERS;
+
+typedef struct CALL_SITE_TAG
+{
+    const char* file;
+    int line;
+    GBALLOC_SUBSYSTEM subsystem;
+    PROFILE_COUNTERS counters;
+} CALL_SITE;
+
+#define ALLOCATIONS_MIN_CAPACITY 256
+
+/* call sites are kept in a fixed table; one that finds no free slot within a few probes only counts for its subsystem */
+#define CALL_SITES 128
+#define CALL_SITE_PROBES 8
+#define NO_CALL_SITE 0xFFFF
+
+static const char* const subsystemNames[GBALLOC_SUBSYSTEM_COUNT] = { "app", "umqtt", "transport", "tlsio", "client", "utility" };
+
+static const GBALLOC_BACKEND heapBackend = { malloc, realloc, free };
+static const GBALLOC_BACKEND* backend = &heapBackend;
+
+static ALLOCATION* allocations = NULL;
+static size_t allocationsCapacity = 0;
+static size_t allocationsInUse = 0;
+static size_t totalSize = 0;
+static size_t maxSize = 0;
+static size_t allocationCount = 0;
+static size_t totalAllocated = 0;
+static GBALLOC_STATE gballocState = GBALLOC_STATE_NOT_INIT;
+
+static int profiling = 0;
+static PROFILE_COUNTERS subsystemCounters[GBALLOC_SUBSYSTEM_COUNT];
+static CALL_SITE callSites[CALL_SITES];
+static unsigned short callSiteOrder[CALL_SITES];    /* the slots of callSites in the order the sites were first seen */
+static size_t callSiteCount = 0;
+
+static LOCK_HANDLE gballocThreadSafeLock = NULL;
+
+static size_t get_home_slot(const void* ptr, size_t capacity)
+{
+    /* blocks are aligned, so the low bits say nothing; mixing the rest spreads neighbouring blocks apart */
+    size_t hash = (size_t)((uintptr_t)ptr >> 4);
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+    return hash & (capacity - 1);
+}
+
+static ALLOCATION* find_allocation(const void* ptr)
+{
+    ALLOCATION* result = NULL;
+    if (allocationsInUse != 0)
+    {
+        size_t slot = get_home_slot(ptr, allocationsCapacity);
+        while (allocations[slot].ptr != NULL)
+        {
+            if (allocations[slot].ptr == ptr)
+            {
+                result = &allocations[slot];
+                break;
+            }
+            slot = (slot + 1) & (allocationsCapacity - 1);
+        }
+    }
+    return result;
+}
+
+static void insert_allocation(ALLOCATION* table, size_t capacity, const ALLOCATION* allocation)
+{
+    size_t slot = get_home_slot(allocation->ptr, capacity);
+    while (table[slot].ptr != NULL)
+    {
+        slot = (slot + 1) & (capacity - 1);
+    }
+    table[slot] = *allocation;
+}
+
+/* makes room for one more block, keeping the table at most three quarters full */
+static int reserve_allocation(void)
+{
+    int result;
+    if ((allocationsInUse + 1) * 4 <= allocationsCapacity * 3)
+    {
+        result = 0;
+    }
+    else
+    {
+        size_t capacity = allocationsCapacity == 0 ? ALLOCATIONS_MIN_CAPACITY : allocationsCapacity * 2;
+        ALLOCATION* table = (ALLOCATION*)calloc(capacity, sizeof(ALLOCATION));
+        if (table == NULL)
+        {
+            result = __FAILURE__;
+        }
+        else
+        {
+            size_t slot;
+            for (slot = 0; slot < allocationsCapacity; slot++)
+            {
+                if (allocations[slot].ptr != NULL)
+                {
+                    insert_allocation(table, capacity, &allocations[slot]);
+                }
+            }
+            free(allocations);
+            allocations = table;
+            allocationsCapacity = capacity;
+            result = 0;
+        }
+    }
+    return result;
+}
+
+static void count_allocation(size_t size)
+{
+    totalSize += size;
+    allocationCount++;
+    totalAllocated += size;
+    /* Codes_SRS_GBALLOC_01_011: [The maximum total memory used shall be the maximum of the total memory used at any point.] */
+    if (maxSize < totalSize)
+    {
+        maxSize = totalSize;
+    }
+}
+
+static GBALLOC_SUBSYSTEM classify_file(const char* file)
+{
+    GBALLOC_SUBSYSTEM result;
+    if (file == NULL)
+    {
+        result = GBALLOC_SUBSYSTEM_APP;
+    }
+    else if (strstr(file, "umqtt") != NULL)
+    {
+        result = GBALLOC_SUBSYSTEM_UMQTT;
+    }
+    else if (strstr(file, "iothubtransport") != NULL)
+    {
+        result = GBALLOC_SUBSYSTEM_TRANSPORT;
+    }
+    else if (strstr(file, "tlsio") != NULL)
+    {
+        result = GBALLOC_SUBSYSTEM_TLSIO;
+    }
+    else if (strstr(file, "iothub_client") != NULL)
+    {
+        result = GBALLOC_SUBSYSTEM_CLIENT;
+    }
+    else if (strstr(file, "c-utility") != NULL)
+    {
+        result = GBALLOC_SUBSYSTEM_UTILITY;
+    }
+    else
+    {
+        result = GBALLOC_SUBSYSTEM_APP;
+    }
+    return result;
+}
+
+/* the slot of a call site, taking a free one the first time it allocates; file is a string literal, so its
+   address tells call sites apart without comparing paths */
+static unsigned short find_call_site(const char* file, int line)
+{
+    unsigned short result = NO_CALL_SITE;
+    if (file != NULL)
+    {
+        size_t hash = (size_t)((uintptr_t)file >> 2) ^ ((size_t)line * 0x9E3779B1u);
+        size_t probe;
+        hash ^= hash >> 15;
+        for (probe = 0; probe < CALL_SITE_PROBES; probe++)
+        {
+            size_t slot = (hash + probe) & (CALL_SITES - 1);
+            if (callSites[slot].file == NULL)
+            {
+                callSites[slot].file = file;
+                callSites[slot].line = line;
+                callSites[slot].subsystem = classify_file(file);
+                callSiteOrder[callSiteCount++] = (unsigned short)slot;
+                result = (unsigned short)slot;
+                break;
+            }
+            else if (callSites[slot].file == file && callSites[slot].line == line)
+            {
+                result = (unsigned short)slot;
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+static void attribute_allocation(ALLOCATION* allocation, const char* file, int line)
+{
+    if (!profiling)
+    {
+        allocation->site = NO_CALL_SITE;
+        allocation->subsystem = GBALLOC_SUBSYSTEM_COUNT;
+    }
+    else
+    {
+        allocation->site = find_call_site(file, line);
+        allocation->subsystem = (unsigned char)(allocation->site != NO_CALL_SITE ? callSites[allocation->site].subsystem : classify_file(file));
+    }
+}
+
+static void count_profile(PROFILE_COUNTERS* counters, size_t size)
+{
+    counters->liveBytes += size;
+    counters->allocations++;
+    counters->bytesAllocated += size;
+    if (counters->peakBytes < counters->liveBytes)
+    {
+        counters->peakBytes = counters->liveBytes;
+    }
+}
+
+static void profile_add(const ALLOCATION* allocation)
+{
+    if (allocation->subsystem < GBALLOC_SUBSYSTEM_COUNT)
+    {
+        count_profile(&subsystemCounters[allocation->subsystem], allocation->size);
+        if (allocation->site != NO_CALL_SITE)
+        {
+            count_profile(&callSites[allocation->site].counters, allocation->size);
+        }
+    }
+}
+
+static void profile_remove(const ALLOCATION* allocation)
+{
+    if (allocation->subsystem < GBALLOC_SUBSYSTEM_COUNT)
+    {
+        subsystemCounters[allocation->subsystem].liveBytes -= allocation->size;
+        if (allocation->site != NO_CALL_SITE)
+        {
+            callSites[allocation->site].counters.liveBytes -= allocation->size;
+        }
+    }
+}
+
+/* takes the block out of the table, moving back every block of the probe run behind it that may live in its
+   slot, so that lookups never need tombstones */
+static void unlink_allocation(ALLOCATION* allocation)
+{
+    size_t hole = (size_t)(allocation - allocations);
+    size_t slot = hole;
+
+    for (;;)
+    {
+        size_t home;
+        slot = (slot + 1) & (allocationsCapacity - 1);
+        if (allocations[slot].ptr == NULL)
+        {
+            break;
+        }
+        home = get_home_slot(allocations[slot].ptr, allocationsCapacity);
+        if (((slot - home) & (allocationsCapacity - 1)) >= ((slot - hole) & (allocationsCapacity - 1)))
+        {
+            allocations[hole] = allocations[slot];
+            hole = slot;
+        }
+    }
+    allocations[hole].ptr = NULL;
+    allocations[hole].size = 0;
+}
+
+/* the caller has made room with reserve_allocation */
+static void add_allocation(void* ptr, size_t size, const char* file, int line)
+{
+    ALLOCATION allocation;
+    allocation.ptr = ptr;
+    allocation.size = size;
+    attribute_allocation(&allocation, file, line);
+    insert_allocation(allocations, allocationsCapacity, &allocation);
+    allocationsInUse++;
+    count_allocation(size);
+    profile_add(&allocation);
+}
+
+static void remove_allocation(ALLOCATION* allocation)
+{
+    totalSize -= allocation->size;
+    profile_remove(allocation);
+    unlink_allocation(allocation);
+    allocationsInUse--;
+}
+
+static void fill_statistics(GBALLOC_PROFILE_STATISTICS* statistics, const char* name, int line, GBALLOC_SUBSYSTEM subsystem, const PROFILE_COUNTERS* counters)
+{
+    statistics->name = name;
+    statistics->line = line;
+    statistics->subsystem = subsystem;
+    statistics->liveBytes = counters->liveBytes;
+    statistics->peakBytes = counters->peakBytes;
+    statistics->allocations = counters->allocations;
+    statistics->bytesAllocated = counters->bytesAllocated;
+}
+
+int gballoc_init(void)
+{
+    int result;
+
+    if (gballocState != GBALLOC_STATE_NOT_INIT)
+    {
+        /* Codes_SRS_GBALLOC_01_025: [Init after Init shall fail and return a non-zero value.] */
+        result = __FAILURE__;
+    }
+    /* Codes_SRS_GBALLOC_01_026: [gballoc_Init shall create a lock handle that will be used to make the other gballoc APIs thread-safe.] */
+    else if ((gballocThreadSafeLock = Lock_Init()) == NULL)
+    {
+        /* Codes_SRS_GBALLOC_01_027: [If the Lock creation fails, gballoc_init shall return a non-zero value.]*/
+        result = __FAILURE__;
+    }
+    else
+    {
+        gballocState = GBALLOC_STATE_INIT;
+
+        /* Codes_ SRS_GBALLOC_01_002: [Upon initialization the total memory used and maximum total memory used tracked by the module shall be set to 0.] */
+        totalSize = 0;
+        maxSize = 0;
+        allocationCount = 0;
+        totalAllocated = 0;
+        profiling = 0;
+        (void)memset(subsystemCounters, 0, sizeof(subsystemCounters));
+        (void)memset(callSites, 0, sizeof(callSites));
+        callSiteCount = 0;
+
+        /* Codes_SRS_GBALLOC_01_024: [gballoc_init shall initialize the gballoc module and return 0 upon success.] */
+        result = 0;
+    }
+
+    return result;
+}
+
+void gballoc_deinit(void)
+{
+    if (gballocState == GBALLOC_STATE_INIT)
+    {
+        /* Codes_SRS_GBALLOC_01_028: [gballoc_deinit shall free all resources allocated by gballoc_init.] */
+        (void)Lock_Deinit(gballocThreadSafeLock);
+        free(allocations);
+        allocations = NULL;
+        allocationsCapacity = 0;
+        allocationsInUse = 0;
+    }
+
+    gballocState = GBALLOC_STATE_NOT_INIT;
+}
+
+int gballoc_setBackend(const GBALLOC_BACKEND* newBackend)
+{
+    int result;
+
+    if (newBackend != NULL &&
+        (newBackend->allocate == NULL || newBackend->reallocate == NULL || newBackend->release == NULL))
+    {
+        LogError("Invalid argument: the backend is missing a function");
+        result = __FAILURE__;
+    }
+    else if (gballocState != GBALLOC_STATE_INIT)
+    {
+        backend = newBackend == NULL ? &heapBackend : newBackend;
+        result = 0;
+    }
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        LogError("Failed to get the Lock.");
+        result = __FAILURE__;
+    }
+    else
+    {
+        backend = newBackend == NULL ? &heapBackend : newBackend;
+        (void)Unlock(gballocThreadSafeLock);
+        result = 0;
+    }
+
+    return result;
+}
+
+const GBALLOC_BACKEND* gballoc_getBackend(void)
+{
+    return backend;
+}
+
+void* gballoc_malloc_at(size_t size, const char* file, int line)
+{
+    void* result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        /* Codes_SRS_GBALLOC_01_039: [If gballoc was not initialized gballoc_malloc shall simply call malloc without any memory tracking being performed.] */
+        result = backend->allocate(size);
+    }
+    /* Codes_SRS_GBALLOC_01_030: [gballoc_malloc shall ensure thread safety by using the lock created by gballoc_Init.] */
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        /* Codes_SRS_GBALLOC_01_048: [If acquiring the lock fails, gballoc_malloc shall return NULL.] */
+        LogError("Failed to get the Lock.");
+        result = NULL;
+    }
+    else
+    {
+        if (reserve_allocation() != 0)
+        {
+            result = NULL;
+        }
+        /* Codes_SRS_GBALLOC_01_003: [gb_malloc shall call the C99 malloc function and return its result.] */
+        else if ((result = backend->allocate(size)) != NULL)
+        {
+            /* Codes_SRS_GBALLOC_01_004: [If the underlying malloc call is successful, gb_malloc shall increment the total memory used with the amount indicated by size.] */
+            add_allocation(result, size, file, line);
+        }
+        /* Codes_SRS_GBALLOC_01_012: [When the underlying malloc call fails, gballoc_malloc shall return NULL and size should not be counted towards total memory used.] */
+
+        (void)Unlock(gballocThreadSafeLock);
+    }
+    
+    return result;
+}
+
+void* gballoc_calloc_at(size_t nmemb, size_t size, const char* file, int line)
+{
+    void* result;
+
+    if (nmemb != 0 && size > SIZE_MAX / nmemb)
+    {
+        LogError("Invalid argument: %lu elements of %lu bytes overflow", (unsigned long)nmemb, (unsigned long)size);
+        result = NULL;
+    }
+    else if (gballocState != GBALLOC_STATE_INIT)
+    {
+        /* Codes_SRS_GBALLOC_01_040: [If gballoc was not initialized gballoc_calloc shall simply call calloc without any memory tracking being performed.] */
+        if ((result = backend->allocate(nmemb * size)) != NULL)
+        {
+            (void)memset(result, 0, nmemb * size);
+        }
+    }
+    /* Codes_SRS_GBALLOC_01_031: [gballoc_calloc shall ensure thread safety by using the lock created by gballoc_Init]  */
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        /* Codes_SRS_GBALLOC_01_046: [If acquiring the lock fails, gballoc_calloc shall return NULL.] */
+        LogError("Failed to get the Lock.");
+        result = NULL;
+    }
+    else
+    {
+        if (reserve_allocation() != 0)
+        {
+            result = NULL;
+        }
+        /* Codes_SRS_GBALLOC_01_020: [gballoc_calloc shall call the C99 calloc function and return its result.] */
+        else if ((result = backend->allocate(nmemb * size)) != NULL)
+        {
+            /* Codes_SRS_GBALLOC_01_021: [If the underlying calloc call is successful, gballoc_calloc shall increment the total memory used with nmemb*size.] */
+            (void)memset(result, 0, nmemb * size);
+            add_allocation(result, nmemb * size, file, line);
+        }
+        /* Codes_SRS_GBALLOC_01_022: [When the underlying calloc call fails, gballoc_calloc shall return NULL and size should not be counted towards total memory used.] */
+
+        (void)Unlock(gballocThreadSafeLock);
+    }
+
+    return result;
+}
+
+void* gballoc_realloc_at(void* ptr, size_t size, const char* file, int line)
+{
+    void* result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        /* Codes_SRS_GBALLOC_01_041: [If gballoc was not initialized gballoc_realloc shall shall simply call realloc without any memory tracking being performed.] */
+        result = backend->reallocate(ptr, size);
+    }
+    /* Codes_SRS_GBALLOC_01_032: [gballoc_realloc shall ensure thread safety by using the lock created by gballoc_Init.] */
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        /* Codes_SRS_GBALLOC_01_047: [If acquiring the lock fails, gballoc_realloc shall return NULL.] */
+        LogError("Failed to get the Lock.");
+        result = NULL;
+    }
+    else
+    {
+        if (ptr == NULL)
+        {
+            /* Codes_SRS_GBALLOC_01_017: [When ptr is NULL, gballoc_realloc shall call the underlying realloc with ptr being NULL and the realloc result shall be tracked by gballoc.] */
+            /* Codes_SRS_GBALLOC_01_015: [When allocating memory used for tracking by gballoc_realloc fails, gballoc_realloc shall return NULL and no change should be made to the counted total memory usage.] */
+            if (reserve_allocation() != 0)
+            {
+                result = NULL;
+            }
+            else if ((result = backend->reallocate(NULL, size)) != NULL)
+            {
+                add_allocation(result, size, file, line);
+            }
+        }
+        else
+        {
+            ALLOCATION* allocation = find_allocation(ptr);
+            if (allocation == NULL)
+            {
+                /* Codes_SRS_GBALLOC_01_016: [When the ptr pointer cannot be found in the pointers tracked by gballoc, gballoc_realloc shall return NULL and the underlying realloc shall not be called.] */
+                result = NULL;
+            }
+            else
+            {
+                /* Codes_SRS_GBALLOC_01_014: [When the underlying realloc call fails, gballoc_realloc shall return NULL and no change should be made to the counted total memory usage.] */
+                if ((result = backend->reallocate(ptr, size)) != NULL)
+                {
+                    /* Codes_SRS_GBALLOC_01_006: [If the underlying realloc call is successful, gballoc_realloc shall look up the size associated with the pointer ptr and decrease the total memory used with that size.] */
+                    /* the block stays with the call site that first allocated it */
+                    ALLOCATION moved = *allocation;
+                    totalSize -= allocation->size;
+                    profile_remove(&moved);
+                    moved.ptr = result;
+                    moved.size = size;
+                    if (result == ptr)
+                    {
+                        *allocation = moved;
+                    }
+                    else
+                    {
+                        /* the number of blocks stays the same, so there is room for the new address */
+                        unlink_allocation(allocation);
+                        insert_allocation(allocations, allocationsCapacity, &moved);
+                    }
+                    /* Codes_SRS_GBALLOC_01_007: [If realloc is successful, gballoc_realloc shall also increment the total memory used value tracked by this module.] */
+                    count_allocation(size);
+                    profile_add(&moved);
+                }
+            }
+        }
+
+        (void)Unlock(gballocThreadSafeLock);
+    }
+
+    return result;
+}
+
+void* gballoc_malloc(size_t size)
+{
+    return gballoc_malloc_at(size, NULL, 0);
+}
+
+void* gballoc_calloc(size_t nmemb, size_t size)
+{
+    return gballoc_calloc_at(nmemb, size, NULL, 0);
+}
+
+void* gballoc_realloc(void* ptr, size_t size)
+{
+    return gballoc_realloc_at(ptr, size, NULL, 0);
+}
+
+void gballoc_free(void* ptr)
+{
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        /* Codes_SRS_GBALLOC_01_042: [If gballoc was not initialized gballoc_free shall shall simply call free.] */
+        backend->release(ptr);
+    }
+    /* Codes_SRS_GBALLOC_01_033: [gballoc_free shall ensure thread safety by using the lock created by gballoc_Init.] */
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        /* Codes_SRS_GBALLOC_01_049: [If acquiring the lock fails, gballoc_free shall do nothing.] */
+        LogError("Failed to get the Lock.");
+    }
+    else
+    {
+        if (ptr != NULL)
+        {
+            /* Codes_SRS_GBALLOC_01_009: [gballoc_free shall also look up the size associated with the ptr pointer and decrease the total memory used with the associated size amount.] */
+            ALLOCATION* allocation = find_allocation(ptr);
+            if (allocation == NULL)
+            {
+                /* Codes_SRS_GBALLOC_01_019: [When the ptr pointer cannot be found in the pointers tracked by gballoc, gballoc_free shall not free any memory.] */
+                LogError("Could not free allocation for address %p (not found)", ptr);
+            }
+            else
+            {
+                remove_allocation(allocation);
+                /* Codes_SRS_GBALLOC_01_008: [gballoc_free shall call the C99 free function.] */
+                backend->release(ptr);
+            }
+        }
+        (void)Unlock(gballocThreadSafeLock);
+    }
+}
+
+size_t gballoc_getMaximumMemoryUsed(void)
+{
+    size_t result;
+
+    /* Codes_SRS_GBALLOC_01_038: [If gballoc was not initialized gballoc_getMaximumMemoryUsed shall return MAX_INT_SIZE.] */
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = SIZE_MAX;
+    }
+    /* Codes_SRS_GBALLOC_01_034: [gballoc_getMaximumMemoryUsed shall ensure thread safety by using the lock created by gballoc_Init.]  */
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        /* Codes_SRS_GBALLOC_01_050: [If the lock cannot be acquired, gballoc_getMaximumMemoryUsed shall return SIZE_MAX.]  */
+        LogError("Failed to get the Lock.");
+        result = SIZE_MAX;
+    }
+    else
+    {
+        /* Codes_SRS_GBALLOC_01_010: [gballoc_getMaximumMemoryUsed shall return the maximum amount of total memory used recorded since the module initialization.] */
+        result = maxSize;
+        (void)Unlock(gballocThreadSafeLock);
+    }
+
+    return result;
+}
+
+size_t gballoc_getCurrentMemoryUsed(void)
+{
+    size_t result;
+
+    /* Codes_SRS_GBALLOC_01_044: [If gballoc was not initialized gballoc_getCurrentMemoryUsed shall return SIZE_MAX.] */
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = SIZE_MAX;
+    }
+    /* Codes_SRS_GBALLOC_01_036: [gballoc_getCurrentMemoryUsed shall ensure thread safety by using the lock created by gballoc_Init.]*/
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        /* Codes_SRS_GBALLOC_01_051: [If the lock cannot be acquired, gballoc_getCurrentMemoryUsed shall return SIZE_MAX.] */
+        LogError("Failed to get the Lock.");
+        result = SIZE_MAX;
+    }
+    else
+    {
+        /*Codes_SRS_GBALLOC_02_001: [gballoc_getCurrentMemoryUsed shall return the currently used memory size.] */
+        result = totalSize;
+        (void)Unlock(gballocThreadSafeLock);
+    }
+
+    return result;
+}
+
+size_t gballoc_getAllocationCount(void)
+{
+    size_t result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = SIZE_MAX;
+    }
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        LogError("Failed to get the Lock.");
+        result = SIZE_MAX;
+    }
+    else
+    {
+        /* every successful malloc, calloc and realloc counts, a realloc that moves nothing included */
+        result = allocationCount;
+        (void)Unlock(gballocThreadSafeLock);
+    }
+
+    return result;
+}
+
+size_t gballoc_getTotalMemoryAllocated(void)
+{
+    size_t result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = SIZE_MAX;
+    }
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        LogError("Failed to get the Lock.");
+        result = SIZE_MAX;
+    }
+    else
+    {
+        /* the sum of the sizes asked for, whether or not they were freed since */
+        result = totalAllocated;
+        (void)Unlock(gballocThreadSafeLock);
+    }
+
+    return result;
+}
+
+void gballoc_resetMetrics(void)
+{
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+    }
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        LogError("Failed to get the Lock.");
+    }
+    else
+    {
+        /* start a new measurement from what is allocated right now, the tracked blocks are kept */
+        maxSize = totalSize;
+        allocationCount = 0;
+        totalAllocated = 0;
+        (void)Unlock(gballocThreadSafeLock);
+    }
+}
+
+void gballoc_setProfiling(int enabled)
+{
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+    }
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        LogError("Failed to get the Lock.");
+    }
+    else
+    {
+        /* blocks allocated while it was off are not attributed to anything, now or when they are freed */
+        profiling = enabled;
+        (void)Unlock(gballocThreadSafeLock);
+    }
+}
+
+int gballoc_getSubsystemStatistics(GBALLOC_SUBSYSTEM subsystem, GBALLOC_PROFILE_STATISTICS* statistics)
+{
+    int result;
+
+    if ((int)subsystem < 0 || subsystem >= GBALLOC_SUBSYSTEM_COUNT || statistics == NULL)
+    {
+        result = __FAILURE__;
+    }
+    else if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = __FAILURE__;
+    }
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        LogError("Failed to get the Lock.");
+        result = __FAILURE__;
+    }
+    else
+    {
+        fill_statistics(statistics, subsystemNames[subsystem], 0, subsystem, &subsystemCounters[subsystem]);
+        (void)Unlock(gballocThreadSafeLock);
+        result = 0;
+    }
+
+    return result;
+}
+
+int gballoc_getCallSiteStatistics(size_t index, GBALLOC_PROFILE_STATISTICS* statistics)
+{
+    int result;
+
+    if (statistics == NULL)
+    {
+        result = __FAILURE__;
+    }
+    else if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = __FAILURE__;
+    }
+    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    {
+        LogError("Failed to get the Lock.");
+        result = __FAILURE__;
+    }
+    else
+    {
+        if (index >= callSiteCount)
+        {
+            result = __FAILURE__;
+        }
+        else
+        {
+            const CALL_SITE* site = &callSites[callSiteOrder[index]];
+            fill_statistics(statistics, site->file, site->line, site->subsystem, &site->counters);
+            result = 0;
+        }
+        (void)Unlock(gballocThreadSafeLock);
+    }
+
+    return result;
+}
@@ -0,0 +1,758 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/map.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/optimize_size.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/xlogging.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/strings.h"
+
+DEFINE_ENUM_STRINGS(MAP_RESULT, MAP_RESULT_VALUES);
+
+/* Up to MAP_INLINE_CAPACITY entries, the few properties a message carries say, are kept in the handle itself. Up to
+   MAP_INDEX_THRESHOLD entries a key is looked for by comparing the stored hashes, which is quicker than an index. */
+#ifndef MAP_INLINE_CAPACITY
+#define MAP_INLINE_CAPACITY 4
+#endif
+#define MAP_INDEX_THRESHOLD 8
+#define MAP_INDEX_MIN_CAPACITY 32
+
+typedef struct MAP_HANDLE_DATA_TAG
+{
+    /* the entries in the order they were added, as Map_GetInternals hands them out */
+    char** keys;
+    char** values;
+    size_t* hashes;
+    size_t count;
+    size_t capacity;
+    /* open addressing over the entries once there are more than MAP_INDEX_THRESHOLD: a slot holds the position of
+       an entry plus 1, 0 when it is free. indexCapacity is a power of 2 and at least twice count */
+    size_t* index;
+    size_t indexCapacity;
+    MAP_FILTER_CALLBACK mapFilterCallback;
+    char* inlineKeys[MAP_INLINE_CAPACITY];
+    char* inlineValues[MAP_INLINE_CAPACITY];
+    size_t inlineHashes[MAP_INLINE_CAPACITY];
+}MAP_HANDLE_DATA;
+
+#define LOG_MAP_ERROR LogError("result = %s", ENUM_TO_STRING(MAP_RESULT, result));
+
+/*FNV-1a*/
+static size_t hashKey(const char* key)
+{
+    uint32_t result = 2166136261u;
+    while (*key != '\0')
+    {
+        result = (result ^ (unsigned char)*key++) * 16777619u;
+    }
+    return result;
+}
+
+static MAP_HANDLE_DATA* Map_Allocate(MAP_FILTER_CALLBACK mapFilterFunc)
+{
+    MAP_HANDLE_DATA* result = (MAP_HANDLE_DATA*)malloc(sizeof(MAP_HANDLE_DATA));
+    if (result != NULL)
+    {
+        result->keys = result->inlineKeys;
+        result->values = result->inlineValues;
+        result->hashes = result->inlineHashes;
+        result->count = 0;
+        result->capacity = MAP_INLINE_CAPACITY;
+        result->index = NULL;
+        result->indexCapacity = 0;
+        result->mapFilterCallback = mapFilterFunc;
+    }
+    return result;
+}
+
+/*gives the entries back to the handle, the map is empty*/
+static void Map_ReleaseStorage(MAP_HANDLE_DATA* handleData)
+{
+    if (handleData->keys != handleData->inlineKeys)
+    {
+        /*the values and hashes share the block of the keys*/
+        free(handleData->keys);
+        handleData->keys = handleData->inlineKeys;
+        handleData->values = handleData->inlineValues;
+        handleData->hashes = handleData->inlineHashes;
+        handleData->capacity = MAP_INLINE_CAPACITY;
+    }
+    free(handleData->index);
+    handleData->index = NULL;
+    handleData->indexCapacity = 0;
+}
+
+MAP_HANDLE Map_Create(MAP_FILTER_CALLBACK mapFilterFunc)
+{
+    /*Codes_SRS_MAP_02_001: [Map_Create shall create a new, empty map.]*/
+    /*Codes_SRS_MAP_02_002: [If during creation there are any error, then Map_Create shall return NULL.]*/
+    /*Codes_SRS_MAP_02_003: [Otherwise, it shall return a non-NULL handle that can be used in subsequent calls.] */
+    return (MAP_HANDLE)Map_Allocate(mapFilterFunc);
+}
+
+void Map_Destroy(MAP_HANDLE handle)
+{
+    /*Codes_SRS_MAP_02_005: [If parameter handle is NULL then Map_Destroy shall take no action.] */
+    if (handle != NULL)
+    {
+        /*Codes_SRS_MAP_02_004: [Map_Destroy shall release all resources associated with the map.] */
+        MAP_HANDLE_DATA* handleData = (MAP_HANDLE_DATA*)handle;
+        size_t i;
+      
+        for (i = 0; i < handleData->count; i++)
+        {
+            free(handleData->keys[i]);
+            free(handleData->values[i]);
+        }
+        Map_ReleaseStorage(handleData);
+        free(handleData);
+    }
+}
+
+/*makes room for count entries, at least doubling what there is so that adding n entries moves them O(n) times*/
+static int Map_ReserveEntries(MAP_HANDLE_DATA* handleData, size_t count)
+{
+    int result;
+    if (count <= handleData->capacity)
+    {
+        result = 0;
+    }
+    else
+    {
+        size_t capacity = handleData->capacity * 2;
+        char** block;
+        if (capacity < count)
+        {
+            capacity = count;
+        }
+
+        if (capacity > SIZE_MAX / (2 * sizeof(char*) + sizeof(size_t)) ||
+            (block = (char**)malloc(capacity * (2 * sizeof(char*) + sizeof(size_t)))) == NULL)
+        {
+            LogError("unable to malloc");
+            result = __FAILURE__;
+        }
+        else
+        {
+            char** values = block + capacity;
+            size_t* hashes = (size_t*)(values + capacity);
+            (void)memcpy(block, handleData->keys, handleData->count * sizeof(char*));
+            (void)memcpy(values, handleData->values, handleData->count * sizeof(char*));
+            (void)memcpy(hashes, handleData->hashes, handleData->count * sizeof(size_t));
+            if (handleData->keys != handleData->inlineKeys)
+            {
+                free(handleData->keys);
+            }
+            handleData->keys = block;
+            handleData->values = values;
+            handleData->hashes = hashes;
+            handleData->capacity = capacity;
+            result = 0;
+        }
+    }
+    return result;
+}
+
+static void Map_IndexEntry(MAP_HANDLE_DATA* handleData, size_t position)
+{
+    size_t mask = handleData->indexCapacity - 1;
+    size_t slot = handleData->hashes[position] & mask;
+    while (handleData->index[slot] != 0)
+    {
+        slot = (slot + 1) & mask;
+    }
+    handleData->index[slot] = position + 1;
+}
+
+/*takes the entry at position out of the index, before the entries after it move down. The slots after it in its
+  run that would no longer be reached from their home slot are shifted back, so no tombstones are left*/
+static void Map_UnindexEntry(MAP_HANDLE_DATA* handleData, size_t position)
+{
+    size_t mask = handleData->indexCapacity - 1;
+    size_t hole = handleData->hashes[position] & mask;
+    size_t slot;
+    while (handleData->index[hole] != position + 1)
+    {
+        hole = (hole + 1) & mask;
+    }
+    for (slot = (hole + 1) & mask; handleData->index[slot] != 0; slot = (slot + 1) & mask)
+    {
+        size_t home = handleData->hashes[handleData->index[slot] - 1] & mask;
+        /*the slot can move to the hole unless its home lies cyclically in (hole, slot]*/
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            handleData->index[hole] = handleData->index[slot];
+            hole = slot;
+        }
+    }
+    handleData->index[hole] = 0;
+}
+
+/*once the entries after position moved down by one, points their slots at where they are now*/
+static void Map_RenumberEntries(MAP_HANDLE_DATA* handleData, size_t position)
+{
+    size_t mask = handleData->indexCapacity - 1;
+    size_t i;
+    for (i = position; i < handleData->count; i++)
+    {
+        size_t slot = handleData->hashes[i] & mask;
+        while (handleData->index[slot] != i + 2)
+        {
+            slot = (slot + 1) & mask;
+        }
+        handleData->index[slot] = i + 1;
+    }
+}
+
+static int Map_ResizeIndex(MAP_HANDLE_DATA* handleData, size_t indexCapacity)
+{
+    int result;
+    size_t* index;
+    size_t i;
+    if (indexCapacity > SIZE_MAX / sizeof(size_t) ||
+        (index = (size_t*)malloc(indexCapacity * sizeof(size_t))) == NULL)
+    {
+        LogError("unable to malloc");
+        result = __FAILURE__;
+    }
+    else
+    {
+        free(handleData->index);
+        handleData->index = index;
+        handleData->indexCapacity = indexCapacity;
+        (void)memset(index, 0, indexCapacity * sizeof(size_t));
+        for (i = 0; i < handleData->count; i++)
+        {
+            Map_IndexEntry(handleData, i);
+        }
+        result = 0;
+    }
+    return result;
+}
+
+/*Codes_SRS_MAP_02_039: [Map_Clone shall make a copy of the map indicated by parameter handle and return a non-NULL handle to it.]*/
+MAP_HANDLE Map_Clone(MAP_HANDLE handle)
+{
+    MAP_HANDLE_DATA* result;
+    if (handle == NULL)
+    {
+        /*Codes_SRS_MAP_02_038: [Map_Clone returns NULL if parameter handle is NULL.]*/
+        result = NULL;
+        LogError("invalid arg to Map_Clone (NULL)");
+    }
+    else
+    {
+        MAP_HANDLE_DATA * handleData = (MAP_HANDLE_DATA *)handle;
+        result = Map_Allocate(handleData->count == 0 ? NULL : handleData->mapFilterCallback);
+        if (result == NULL)
+        {
+            /*Codes_SRS_MAP_02_047: [If during cloning, any operation fails, then Map_Clone shall return NULL.] */
+            /*do nothing, proceed to return it, this is an error case*/
+            LogError("unable to malloc");
+        }
+        else if (Map_ReserveEntries(result, handleData->count) != 0)
+        {
+            /*Codes_SRS_MAP_02_047: [If during cloning, any operation fails, then Map_Clone shall return NULL.] */
+            LogError("unable to clone the entries");
+            Map_Destroy((MAP_HANDLE)result);
+            result = NULL;
+        }
+        else
+        {
+            size_t i;
+            for (i = 0; i < handleData->count; i++)
+            {
+                if (mallocAndStrcpy_s(result->keys + i, handleData->keys[i]) != 0)
+                {
+                    break;
+                }
+                else if (mallocAndStrcpy_s(result->values + i, handleData->values[i]) != 0)
+                {
+                    free(result->keys[i]);
+                    break;
+                }
+                result->hashes[i] = handleData->hashes[i];
+                result->count++;
+            }
+
+            if (result->count != handleData->count ||
+                (handleData->index != NULL && Map_ResizeIndex(result, handleData->indexCapacity) != 0))
+            {
+                /*Codes_SRS_MAP_02_047: [If during cloning, any operation fails, then Map_Clone shall return NULL.] */
+                LogError("unable to clone the entries");
+                Map_Destroy((MAP_HANDLE)result);
+                result = NULL;
+            }
+        }
+    }
+    return (MAP_HANDLE)result;
+}
+
+static char** findKey(MAP_HANDLE_DATA* handleData, const char* key, size_t hash)
+{
+    char** result = NULL;
+    if (handleData->index == NULL)
+    {
+        size_t i;
+        for (i = 0; i < handleData->count; i++)
+        {
+            if (handleData->hashes[i] == hash && strcmp(handleData->keys[i], key) == 0)
+            {
+                result = handleData->keys + i;
+                break;
+            }
+        }
+    }
+    else
+    {
+        size_t mask = handleData->indexCapacity - 1;
+        size_t slot;
+        for (slot = hash & mask; handleData->index[slot] != 0; slot = (slot + 1) & mask)
+        {
+            size_t position = handleData->index[slot] - 1;
+            if (handleData->hashes[position] == hash && strcmp(handleData->keys[position], key) == 0)
+            {
+                result = handleData->keys + position;
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+static char** findValue(MAP_HANDLE_DATA* handleData, const char* value)
+{
+    char** result = NULL;
+    size_t i;
+    for (i = 0; i < handleData->count; i++)
+    {
+        if (strcmp(handleData->values[i], value) == 0)
+        {
+            result = handleData->values + i;
+            break;
+        }
+    }
+    return result;
+}
+
+static int insertNewKeyValue(MAP_HANDLE_DATA* handleData, const char* key, const char* value, size_t hash)
+{
+    int result;
+    size_t position = handleData->count;
+    if (Map_ReserveEntries(handleData, position + 1) != 0)
+    {
+        result = __FAILURE__;
+    }
+    else if (mallocAndStrcpy_s(&(handleData->keys[position]), key) != 0)
+    {
+        LogError("unable to mallocAndStrcpy_s");
+        result = __FAILURE__;
+    }
+    else if (mallocAndStrcpy_s(&(handleData->values[position]), value) != 0)
+    {
+        free(handleData->keys[position]);
+        LogError("unable to mallocAndStrcpy_s");
+        result = __FAILURE__;
+    }
+    else
+    {
+        handleData->hashes[position] = hash;
+        handleData->count++;
+        result = 0;
+
+        if (handleData->count <= MAP_INDEX_THRESHOLD)
+        {
+            /*small enough to be searched without an index*/
+        }
+        else if (handleData->count * 2 <= handleData->indexCapacity)
+        {
+            Map_IndexEntry(handleData, position);
+        }
+        else if (Map_ResizeIndex(handleData, handleData->indexCapacity == 0 ? MAP_INDEX_MIN_CAPACITY : handleData->indexCapacity * 2) != 0)
+        {
+            handleData->count--;
+            free(handleData->keys[position]);
+            free(handleData->values[position]);
+            result = __FAILURE__;
+        }
+    }
+    return result; 
+}
+
+MAP_RESULT Map_Add(MAP_HANDLE handle, const char* key, const char* value)
+{
+    MAP_RESULT result;
+    /*Codes_SRS_MAP_02_006: [If parameter handle is NULL then Map_Add shall return MAP_INVALID_ARG.] */
+    /*Codes_SRS_MAP_02_007: [If parameter key is NULL then Map_Add shall return MAP_INVALID_ARG.]*/
+    /*Codes_SRS_MAP_02_008: [If parameter value is NULL then Map_Add shall return MAP_INVALID_ARG.] */
+    if (
+        (handle == NULL) ||
+        (key == NULL) ||
+        (value == NULL)
+        )
+    {
+        result = MAP_INVALIDARG;
+        LOG_MAP_ERROR; 
+    }
+    else
+    {
+        MAP_HANDLE_DATA* handleData = (MAP_HANDLE_DATA*)handle;
+        size_t hash = hashKey(key);
+        /*Codes_SRS_MAP_02_009: [If the key already exists, then Map_Add shall return MAP_KEYEXISTS.] */
+        if (findKey(handleData, key, hash) != NULL)
+        {
+            result = MAP_KEYEXISTS;
+        }
+        else
+        {
+            /* Codes_SRS_MAP_07_009: [If the mapFilterCallback function is not NULL, then the return value will be check and if it is not zero then Map_Add shall return MAP_FILTER_REJECT.] */
+            if ( (handleData->mapFilterCallback != NULL) && (handleData->mapFilterCallback(key, value) != 0) )
+            {
+                result = MAP_FILTER_REJECT;
+            }
+            else
+            {
+                /*Codes_SRS_MAP_02_010: [Otherwise, Map_Add shall add the pair <key,value> to the map.] */
+                if (insertNewKeyValue(handleData, key, value, hash) != 0)
+                {
+                    /*Codes_SRS_MAP_02_011: [If adding the pair <key,value> fails then Map_Add shall return MAP_ERROR.] */
+                    result = MAP_ERROR;
+                    LOG_MAP_ERROR;
+                }
+                else
+                {
+                    /*Codes_SRS_MAP_02_012: [Otherwise, Map_Add shall return MAP_OK.] */
+                    result = MAP_OK;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+MAP_RESULT Map_AddOrUpdate(MAP_HANDLE handle, const char* key, const char* value)
+{
+    MAP_RESULT result;
+    /*Codes_SRS_MAP_02_013: [If parameter handle is NULL then Map_AddOrUpdate shall return MAP_INVALID_ARG.]*/
+    /*Codes_SRS_MAP_02_014: [If parameter key is NULL then Map_AddOrUpdate shall return MAP_INVALID_ARG.]*/
+    /*Codes_SRS_MAP_02_015: [If parameter value is NULL then Map_AddOrUpdate shall return MAP_INVALID_ARG.] */
+    if (
+        (handle == NULL) ||
+        (key == NULL) ||
+        (value == NULL)
+        )
+    {
+        result = MAP_INVALIDARG;
+        LOG_MAP_ERROR;
+    }
+    else
+    {
+        MAP_HANDLE_DATA* handleData = (MAP_HANDLE_DATA*)handle;
+
+        /* Codes_SRS_MAP_07_008: [If the mapFilterCallback function is not NULL, then the return value will be check and if it is not zero then Map_AddOrUpdate shall return MAP_FILTER_REJECT.] */
+        if (handleData->mapFilterCallback != NULL && handleData->mapFilterCallback(key, value) != 0)
+        {
+            result = MAP_FILTER_REJECT;
+        }
+        else
+        {
+            size_t hash = hashKey(key);
+            char** whereIsIt = findKey(handleData, key, hash);
+            if (whereIsIt == NULL)
+            {
+                /*Codes_SRS_MAP_02_017: [Otherwise, Map_AddOrUpdate shall add the pair <key,value> to the map.]*/
+                if (insertNewKeyValue(handleData, key, value, hash) != 0)
+                {
+                    result = MAP_ERROR;
+                    LOG_MAP_ERROR;
+                }
+                else
+                {
+                    result = MAP_OK;
+                }
+            }
+            else
+            {
+                /*Codes_SRS_MAP_02_016: [If the key already exists, then Map_AddOrUpdate shall overwrite the value of the existing key with parameter value.]*/
+                size_t index = whereIsIt - handleData->keys;
+                size_t valueLength = strlen(value);
+                /*try to realloc value of this key*/
+                char* newValue = (char*)realloc(handleData->values[index],valueLength  + 1);
+                if (newValue == NULL)
+                {
+                    result = MAP_ERROR;
+                    LOG_MAP_ERROR;
+                }
+                else
+                {
+                    (void)memcpy(newValue, value, valueLength + 1);
+                    handleData->values[index] = newValue;
+                    /*Codes_SRS_MAP_02_019: [Otherwise, Map_AddOrUpdate shall return MAP_OK.] */
+                    result = MAP_OK;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+MAP_RESULT Map_Delete(MAP_HANDLE handle, const char* key)
+{
+    MAP_RESULT result;
+    /*Codes_SRS_MAP_02_020: [If parameter handle is NULL then Map_Delete shall return MAP_INVALIDARG.]*/
+    /*Codes_SRS_MAP_02_021: [If parameter key is NULL then Map_Delete shall return MAP_INVALIDARG.]*/
+    if (
+        (handle == NULL) ||
+        (key == NULL)
+        )
+    {
+        result = MAP_INVALIDARG;
+        LOG_MAP_ERROR;
+    }
+    else
+    {
+        MAP_HANDLE_DATA* handleData = (MAP_HANDLE_DATA*)handle;
+        char** whereIsIt = findKey(handleData, key, hashKey(key));
+        if (whereIsIt == NULL)
+        {
+            /*Codes_SRS_MAP_02_022: [If key does not exist then Map_Delete shall return MAP_KEYNOTFOUND.]*/
+            result = MAP_KEYNOTFOUND;
+        }
+        else
+        {
+            /*Codes_SRS_MAP_02_023: [Otherwise, Map_Delete shall remove the key and its associated value from the map and return MAP_OK.]*/
+            size_t index = whereIsIt - handleData->keys;
+            free(handleData->keys[index]);
+            free(handleData->values[index]);
+            if (handleData->index != NULL)
+            {
+                Map_UnindexEntry(handleData, index);
+            }
+            /*the entries after it move down to keep the order Map_GetInternals hands out*/
+            memmove(handleData->keys + index, handleData->keys + index + 1, (handleData->count - index - 1)*sizeof(char*));
+            memmove(handleData->values + index, handleData->values + index + 1, (handleData->count - index - 1)*sizeof(char*));
+            memmove(handleData->hashes + index, handleData->hashes + index + 1, (handleData->count - index - 1)*sizeof(size_t));
+            handleData->count--;
+            if (handleData->count == 0)
+            {
+                Map_ReleaseStorage(handleData);
+                handleData->mapFilterCallback = NULL;
+            }
+            else if (handleData->count <= MAP_INDEX_THRESHOLD)
+            {
+                free(handleData->index);
+                handleData->index = NULL;
+                handleData->indexCapacity = 0;
+            }
+            else if (handleData->index != NULL)
+            {
+                Map_RenumberEntries(handleData, index);
+            }
+            result = MAP_OK;
+        }
+
+    }
+    return result;
+}
+
+MAP_RESULT Map_ContainsKey(MAP_HANDLE handle, const char* key, bool* keyExists)
+{
+    MAP_RESULT result;
+    /*Codes_SRS_MAP_02_024: [If parameter handle, key or keyExists are NULL then Map_ContainsKey shall return MAP_INVALIDARG.]*/
+    if (
+        (handle ==NULL) ||
+        (key == NULL) ||
+        (keyExists == NULL)
+        )
+    {
+        result = MAP_INVALIDARG;
+        LOG_MAP_ERROR;
+    }
+    else
+    {
+        MAP_HANDLE_DATA* handleData = (MAP_HANDLE_DATA*)handle;
+        /*Codes_SRS_MAP_02_025: [Otherwise if a key exists then Map_ContainsKey shall return MAP_OK and shall write in keyExists "true".]*/
+        /*Codes_SRS_MAP_02_026: [If a key doesn't exist, then Map_ContainsKey shall return MAP_OK and write in keyExists "false".] */
+        *keyExists = (findKey(handleData, key, hashKey(key)) != NULL) ? true: false;
+        result = MAP_OK;
+    }
+    return result;
+}
+
+MAP_RESULT Map_ContainsValue(MAP_HANDLE handle, const char* value, bool* valueExists)
+{
+    MAP_RESULT result;
+    /*Codes_SRS_MAP_02_027: [If parameter handle, value or valueExists is NULL then Map_ContainsValue shall return MAP_INVALIDARG.] */
+    if (
+        (handle == NULL) ||
+        (value == NULL) ||
+        (valueExists == NULL)
+        )
+    {
+        result = MAP_INVALIDARG;
+        LOG_MAP_ERROR;
+    }
+    else
+    {
+        MAP_HANDLE_DATA* handleData = (MAP_HANDLE_DATA*)handle;
+        /*Codes_SRS_MAP_02_028: [Otherwise, if a pair <key, value> has its value equal to the parameter value, the Map_ContainsValue shall return MAP_OK and shall write in valueExists "true".]*/
+        /*Codes_SRS_MAP_02_029: [Otherwise, if such a <key, value> does not exist, then Map_ContainsValue shall return MAP_OK and shall write in valueExists "false".] */
+        *valueExists = (findValue(handleData, value) != NULL) ? true : false;
+        result = MAP_OK;
+    }
+    return result;
+}
+
+const char* Map_GetValueFromKey(MAP_HANDLE handle, const char* key)
+{
+    const char* result;
+    /*Codes_SRS_MAP_02_040: [If parameter handle or key is NULL then Map_GetValueFromKey returns NULL.]*/
+    if (
+        (handle == NULL) ||
+        (key == NULL)
+        )
+    {
+        result = NULL;
+        LogError("invalid parameter to Map_GetValueFromKey");
+    }
+    else
+    {
+        MAP_HANDLE_DATA * handleData = (MAP_HANDLE_DATA *)handle;
+        char** whereIsIt = findKey(handleData, key, hashKey(key));
+        if(whereIsIt == NULL)
+        {
+            /*Codes_SRS_MAP_02_041: [If the key is not found, then Map_GetValueFromKey returns NULL.]*/
+            result = NULL;
+        }
+        else
+        {
+            /*Codes_SRS_MAP_02_042: [Otherwise, Map_GetValueFromKey returns the key's value.] */
+            size_t index = whereIsIt - handleData->keys;
+            result = handleData->values[index];
+        }
+    }
+    return result;
+}
+
+MAP_RESULT Map_GetInternals(MAP_HANDLE handle, const char*const** keys, const char*const** values, size_t* count)
+{
+    MAP_RESULT result;
+    /*Codes_SRS_MAP_02_046: [If parameter handle, keys, values or count is NULL then Map_GetInternals shall return MAP_INVALIDARG.] */
+    if (
+        (handle == NULL) ||
+        (keys == NULL) ||
+        (values == NULL) ||
+        (count == NULL)
+        )
+    {
+        result = MAP_INVALIDARG;
+        LOG_MAP_ERROR;
+    }
+    else
+    {
+        /*Codes_SRS_MAP_02_043: [Map_GetInternals shall produce in *keys an pointer to an array of const char* having all the keys stored so far by the map.]*/
+        /*Codes_SRS_MAP_02_044: [Map_GetInternals shall produce in *values a pointer to an array of const char* having all the values stored so far by the map.]*/
+        /*Codes_SRS_MAP_02_045: [  Map_GetInternals shall produce in *count the number of stored keys and values.]*/
+        MAP_HANDLE_DATA * handleData = (MAP_HANDLE_DATA *)handle;
+        *keys =(const char* const*)(handleData->keys);
+        *values = (const char* const*)(handleData->values);
+        *count = handleData->count;
+        result = MAP_OK;
+    }
+    return result;
+}
+
+STRING_HANDLE Map_ToJSON(MAP_HANDLE handle)
+{
+    STRING_HANDLE result;
+    /*Codes_SRS_MAP_02_052: [If parameter handle is NULL then Map_ToJSON shall return NULL.] */
+    if (handle == NULL)
+    {
+        result = NULL;
+        LogError("invalid arg (NULL)");
+    }
+    else
+    {
+        /*Codes_SRS_MAP_02_048: [Map_ToJSON shall produce a STRING_HANDLE representing the content of the MAP.] */
+        result = STRING_construct("{");
+        if (result == NULL)
+        {
+            LogError("STRING_construct failed");
+        }
+        else
+        {
+            size_t i;
+            MAP_HANDLE_DATA* handleData = (MAP_HANDLE_DATA *)handle;
+            /*Codes_SRS_MAP_02_049: [If the MAP is empty, then Map_ToJSON shall produce the string "{}".*/
+            bool breakFor = false; /*used to break out of for*/
+            for (i = 0; (i < handleData->count) && (!breakFor); i++)
+            {
+                /*add one entry to the JSON*/
+                /*Codes_SRS_MAP_02_050: [If the map has properties then Map_ToJSON shall produce the following string:{"name1":"value1", "name2":"value2" ...}]*/
+                STRING_HANDLE key = STRING_new_JSON(handleData->keys[i]);
+                if (key == NULL)
+                {
+                    LogError("STRING_new_JSON failed");
+                    STRING_delete(result);
+                    result = NULL;
+                    breakFor = true;
+                }
+                else
+                {
+                    STRING_HANDLE value = STRING_new_JSON(handleData->values[i]);
+                    if (value == NULL)
+                    {
+                        LogError("STRING_new_JSON failed");
+                        STRING_delete(result);
+                        result = NULL;
+                        breakFor = true;
+                    }
+                    else
+                    {
+                        if (!(
+                            ((i>0) ? (STRING_concat(result, ",") == 0) : 1) &&
+                            (STRING_concat_with_STRING(result, key) == 0) &&
+                            (STRING_concat(result, ":") == 0) &&
+                            (STRING_concat_with_STRING(result, value) == 0)
+                            ))
+                        {
+                            LogError("failed to build the JSON");
+                            STRING_delete(result);
+                            result = NULL;
+                            breakFor = true;
+                        }
+                        else
+                        {
+                            /*all nice, go to the next element in the map*/
+                        }
+                        STRING_delete(value);
+                    }
+                    STRING_delete(key);
+                }
+            }
+                
+            if (breakFor)
+            {
+                LogError("error happened during JSON string builder");
+            }
+            else
+            {
+                if (STRING_concat(result, "}") != 0)
+                {
+                    LogError("failed to build the JSON");
+                    STRING_delete(result);
+                    result = NULL;
+                }
+                else
+                {
+                    /*return as is, JSON has been build*/
+                }
+            }
+        }
+    }
+    return result;
+
+}
\ No newline at end of file
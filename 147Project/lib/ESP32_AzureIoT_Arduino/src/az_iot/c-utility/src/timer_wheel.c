@@ -0,0 +1,260 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/timer_wheel.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/optimize_size.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/xlogging.h"
+
+/* Level 0 has one slot per millisecond and every level above it one slot per turn of the level below, so
+   4 levels of 32 slots reach 2^20 ms (about 17 minutes) in 1 KB of list heads on a 32 bit target. A timer
+   further out than that waits in the farthest slot and is placed again when that slot cascades. */
+#define TIMER_WHEEL_LEVELS      4
+#define TIMER_WHEEL_SLOT_BITS   5
+#define TIMER_WHEEL_SLOTS       (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_SLOT_MASK   (TIMER_WHEEL_SLOTS - 1)
+#define TIMER_WHEEL_SPAN(level) ((tickcounter_ms_t)1 << (TIMER_WHEEL_SLOT_BITS * (level)))
+#define TIMER_WHEEL_RANGE       TIMER_WHEEL_SPAN(TIMER_WHEEL_LEVELS)
+
+typedef struct TIMER_WHEEL_TAG
+{
+    tickcounter_ms_t now;
+    size_t armed[TIMER_WHEEL_LEVELS];
+    DLIST_ENTRY slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+} TIMER_WHEEL;
+
+static DLIST_ENTRY* get_slot(TIMER_WHEEL* timer_wheel, unsigned int level, tickcounter_ms_t when)
+{
+    return &timer_wheel->slots[level][(when >> (TIMER_WHEEL_SLOT_BITS * level)) & TIMER_WHEEL_SLOT_MASK];
+}
+
+static void insert_timer(TIMER_WHEEL* timer_wheel, TIMER_WHEEL_TIMER* timer)
+{
+    tickcounter_ms_t delta = timer->expiry - timer_wheel->now;
+    tickcounter_ms_t when = timer->expiry;
+    unsigned int level = 0;
+
+    if (delta >= TIMER_WHEEL_RANGE)
+    {
+        delta = TIMER_WHEEL_RANGE - 1;
+        when = timer_wheel->now + delta;
+    }
+    while (delta >= TIMER_WHEEL_SPAN(level + 1))
+    {
+        level++;
+    }
+
+    timer->level = (unsigned char)level;
+    DList_InsertTailList(get_slot(timer_wheel, level, when), &timer->entry);
+    timer_wheel->armed[level]++;
+}
+
+/* hands the timers of a slot above level 0 down to the levels below, now that the wheel has reached the slot */
+static void cascade(TIMER_WHEEL* timer_wheel, unsigned int level)
+{
+    DLIST_ENTRY* slot = get_slot(timer_wheel, level, timer_wheel->now);
+    PDLIST_ENTRY entry;
+    while ((entry = DList_RemoveHeadList(slot)) != slot)
+    {
+        timer_wheel->armed[level]--;
+        insert_timer(timer_wheel, containingRecord(entry, TIMER_WHEEL_TIMER, entry));
+    }
+}
+
+static void expire(TIMER_WHEEL* timer_wheel)
+{
+    DLIST_ENTRY* slot = get_slot(timer_wheel, 0, timer_wheel->now);
+    PDLIST_ENTRY entry;
+    while ((entry = DList_RemoveHeadList(slot)) != slot)
+    {
+        TIMER_WHEEL_TIMER* timer = containingRecord(entry, TIMER_WHEEL_TIMER, entry);
+        timer_wheel->armed[0]--;
+        timer->armed = false;
+        if (timer->callback != NULL)
+        {
+            timer->callback(timer->context);
+        }
+    }
+}
+
+TIMER_WHEEL_HANDLE timer_wheel_create(tickcounter_ms_t now_ms)
+{
+    TIMER_WHEEL* result = (TIMER_WHEEL*)malloc(sizeof(TIMER_WHEEL));
+    if (result == NULL)
+    {
+        LogError("Failed allocating timer wheel");
+    }
+    else
+    {
+        unsigned int level;
+        unsigned int index;
+        result->now = now_ms;
+        for (level = 0; level < TIMER_WHEEL_LEVELS; level++)
+        {
+            result->armed[level] = 0;
+            for (index = 0; index < TIMER_WHEEL_SLOTS; index++)
+            {
+                DList_InitializeListHead(&result->slots[level][index]);
+            }
+        }
+    }
+    return result;
+}
+
+void timer_wheel_destroy(TIMER_WHEEL_HANDLE timer_wheel)
+{
+    if (timer_wheel != NULL)
+    {
+        unsigned int level;
+        unsigned int index;
+        for (level = 0; level < TIMER_WHEEL_LEVELS; level++)
+        {
+            for (index = 0; index < TIMER_WHEEL_SLOTS; index++)
+            {
+                PDLIST_ENTRY entry;
+                while ((entry = DList_RemoveHeadList(&timer_wheel->slots[level][index])) != &timer_wheel->slots[level][index])
+                {
+                    containingRecord(entry, TIMER_WHEEL_TIMER, entry)->armed = false;
+                }
+            }
+        }
+        free(timer_wheel);
+    }
+}
+
+void timer_wheel_timer_init(TIMER_WHEEL_TIMER* timer, TIMER_WHEEL_CALLBACK callback, void* context)
+{
+    if (timer != NULL)
+    {
+        timer->expiry = 0;
+        timer->callback = callback;
+        timer->context = context;
+        timer->level = 0;
+        timer->armed = false;
+    }
+}
+
+int timer_wheel_arm(TIMER_WHEEL_HANDLE timer_wheel, TIMER_WHEEL_TIMER* timer, tickcounter_ms_t delay_ms)
+{
+    int result;
+    if (timer_wheel == NULL || timer == NULL)
+    {
+        LogError("Invalid argument (timer_wheel=%p, timer=%p)", timer_wheel, timer);
+        result = __FAILURE__;
+    }
+    else
+    {
+        timer_wheel_cancel(timer_wheel, timer);
+        /* the slot of the current time has already run, so the earliest a timer can expire is the next tick */
+        timer->expiry = timer_wheel->now + (delay_ms == 0 ? 1 : delay_ms);
+        timer->armed = true;
+        insert_timer(timer_wheel, timer);
+        result = 0;
+    }
+    return result;
+}
+
+void timer_wheel_cancel(TIMER_WHEEL_HANDLE timer_wheel, TIMER_WHEEL_TIMER* timer)
+{
+    if (timer_wheel != NULL && timer != NULL && timer->armed)
+    {
+        (void)DList_RemoveEntryList(&timer->entry);
+        timer_wheel->armed[timer->level]--;
+        timer->armed = false;
+    }
+}
+
+void timer_wheel_advance(TIMER_WHEEL_HANDLE timer_wheel, tickcounter_ms_t now_ms)
+{
+    if (timer_wheel == NULL)
+    {
+        LogError("Invalid argument: timer_wheel is NULL");
+    }
+    else
+    {
+        while (timer_wheel->now != now_ms)
+        {
+            tickcounter_ms_t remaining = now_ms - timer_wheel->now;
+            tickcounter_ms_t step;
+            unsigned int level = 0;
+
+            /* the levels below the lowest one holding a timer are empty, so the wheel can move a whole slot of
+               that level at once: nothing expires or cascades before its next slot boundary */
+            while (level < TIMER_WHEEL_LEVELS && timer_wheel->armed[level] == 0)
+            {
+                level++;
+            }
+            if (level == TIMER_WHEEL_LEVELS)
+            {
+                timer_wheel->now = now_ms;
+                break;
+            }
+            step = TIMER_WHEEL_SPAN(level) - (timer_wheel->now & (TIMER_WHEEL_SPAN(level) - 1));
+            while (step > remaining)
+            {
+                level--;
+                step = TIMER_WHEEL_SPAN(level) - (timer_wheel->now & (TIMER_WHEEL_SPAN(level) - 1));
+            }
+            timer_wheel->now += step;
+
+            for (level = 1; level < TIMER_WHEEL_LEVELS && (timer_wheel->now & (TIMER_WHEEL_SPAN(level) - 1)) == 0; level++)
+            {
+                cascade(timer_wheel, level);
+            }
+            expire(timer_wheel);
+        }
+    }
+}
+
+tickcounter_ms_t timer_wheel_now(TIMER_WHEEL_HANDLE timer_wheel)
+{
+    return timer_wheel == NULL ? 0 : timer_wheel->now;
+}
+
+int timer_wheel_get_next_deadline(TIMER_WHEEL_HANDLE timer_wheel, tickcounter_ms_t* ms_to_deadline)
+{
+    int result;
+    if (timer_wheel == NULL || ms_to_deadline == NULL)
+    {
+        LogError("Invalid argument (timer_wheel=%p, ms_to_deadline=%p)", timer_wheel, ms_to_deadline);
+        result = __FAILURE__;
+    }
+    else
+    {
+        unsigned int level;
+        result = __FAILURE__;
+        /* the slots of a level cover consecutive stretches of time starting after the current one, so the
+           first occupied slot of each level holds that level's earliest timer; the outermost level also holds
+           the timers parked beyond the wheel's reach out of order, so all of its slots are looked at */
+        for (level = 0; level < TIMER_WHEEL_LEVELS; level++)
+        {
+            if (timer_wheel->armed[level] != 0)
+            {
+                unsigned int offset;
+                for (offset = 1; offset <= TIMER_WHEEL_SLOTS; offset++)
+                {
+                    DLIST_ENTRY* slot = get_slot(timer_wheel, level, timer_wheel->now + offset * TIMER_WHEEL_SPAN(level));
+                    if (!DList_IsListEmpty(slot))
+                    {
+                        PDLIST_ENTRY entry;
+                        for (entry = slot->Flink; entry != slot; entry = entry->Flink)
+                        {
+                            tickcounter_ms_t delta = containingRecord(entry, TIMER_WHEEL_TIMER, entry)->expiry - timer_wheel->now;
+                            if (result != 0 || delta < *ms_to_deadline)
+                            {
+                                *ms_to_deadline = delta;
+                                result = 0;
+                            }
+                        }
+                        if (level != TIMER_WHEEL_LEVELS - 1)
+                        {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,753 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/macro_utils.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/umock_c_prod.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/crt_abstractions.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/agenttime.h" 
+#include "az_iot/c-utility/inc/azure_c_shared_utility/xlogging.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/strings.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/sastoken.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/base64.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/buffer_.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/sha.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/shared_util_options.h"
+
+#ifdef USE_DPS_MODULE
+#include "azure_hub_modules/iothub_device_auth.h"
+#endif
+
+#include "../inc/iothub_client_authorization.h"
+
+#define DEFAULT_SAS_TOKEN_EXPIRY_TIME_SECS          3600
+#define INDEFINITE_TIME                             ((time_t)(-1))
+/* "SharedAccessSignature sr=" scope "&sig=" at most 96 characters of signature "&se=" expiry "&skn=", for a scope
+   as long as <hub name>.<suffix>/devices/<device id> can get */
+#define SAS_TOKEN_MAX_LEN                           512
+#define SAS_SIGNATURE_MAX_LEN                       96
+
+typedef struct SAS_TOKEN_SLOT_TAG
+{
+    char token[SAS_TOKEN_MAX_LEN];
+    size_t expiry;                                  /* seconds since the epoch, 0 while the slot is empty */
+} SAS_TOKEN_SLOT;
+
+typedef struct IOTHUB_AUTHORIZATION_DATA_TAG
+{
+    char* device_sas_token;
+    char* device_key;
+    char* device_id;
+    size_t token_expiry_time_sec;
+    IOTHUB_CREDENTIAL_TYPE cred_type;
+#ifdef USE_DPS_MODULE
+    IOTHUB_SECURITY_HANDLE device_auth_handle;
+#endif
+    /* device key tokens, signed without going through the heap: the key decoded once, the token in use and the
+       one that takes over when that expires */
+    unsigned char* decoded_key;
+    size_t decoded_key_length;
+    char* token_scope;
+    SAS_TOKEN_SLOT* token_slots;                    /* two of them, allocated with the first cached token */
+    int current_slot;
+} IOTHUB_AUTHORIZATION_DATA;
+
+static int get_seconds_since_epoch(size_t* seconds)
+{
+    int result;
+    time_t current_time;
+    if ((current_time = get_time(NULL)) == INDEFINITE_TIME)
+    {
+        LogError("Failed getting the current local time (get_time() failed)");
+        result = __FAILURE__;
+    }
+    else
+    {
+        *seconds = (size_t)get_difftime(current_time, (time_t)0);
+        result = 0;
+    }
+    return result;
+}
+
+static int decode_device_key(IOTHUB_AUTHORIZATION_DATA* handle)
+{
+    int result;
+    BUFFER_HANDLE decoded;
+    if ((decoded = Base64_Decoder(handle->device_key)) == NULL)
+    {
+        LogError("Unable to decode the device key");
+        result = __FAILURE__;
+    }
+    else
+    {
+        size_t length = BUFFER_length(decoded);
+        if (length == 0 || (handle->decoded_key = (unsigned char*)malloc(length)) == NULL)
+        {
+            LogError("Failed allocating the decoded device key");
+            result = __FAILURE__;
+        }
+        else
+        {
+            (void)memcpy(handle->decoded_key, BUFFER_u_char(decoded), length);
+            handle->decoded_key_length = length;
+            result = 0;
+        }
+        BUFFER_delete(decoded);
+    }
+    return result;
+}
+
+static size_t append_text(char* token, size_t length, const char* text)
+{
+    size_t text_length = strlen(text);
+    if (length + text_length < SAS_TOKEN_MAX_LEN)
+    {
+        (void)memcpy(token + length, text, text_length + 1);
+    }
+    return length + text_length;
+}
+
+/* The same token SASToken_CreateString makes from the device key, with the signature URL encoded as it is base64
+   encoded; all on the stack */
+static int sign_sas_token(IOTHUB_AUTHORIZATION_DATA* handle, const char* scope, size_t expiry, SAS_TOKEN_SLOT* slot)
+{
+    static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    int result;
+    char expiry_text[32];
+    HMACContext context;
+    uint8_t digest[USHAMaxHashSize];
+
+    if (handle->decoded_key == NULL && decode_device_key(handle) != 0)
+    {
+        result = __FAILURE__;
+    }
+    else if (size_tToString(expiry_text, sizeof(expiry_text), expiry) != 0)
+    {
+        LogError("Failed converting the token expiry to a string");
+        result = __FAILURE__;
+    }
+    else if (hmacReset(&context, SHA256, handle->decoded_key, (int)handle->decoded_key_length) != 0 ||
+        hmacInput(&context, (const unsigned char*)scope, (int)strlen(scope)) != 0 ||
+        hmacInput(&context, (const unsigned char*)"\n", 1) != 0 ||
+        hmacInput(&context, (const unsigned char*)expiry_text, (int)strlen(expiry_text)) != 0 ||
+        hmacResult(&context, digest) != 0)
+    {
+        LogError("Failed signing the SAS token");
+        result = __FAILURE__;
+    }
+    else
+    {
+        char signature[SAS_SIGNATURE_MAX_LEN + 1];
+        size_t length = 0;
+        size_t i;
+        for (i = 0; i < SHA256HashSize; i += 3)
+        {
+            uint32_t group = (uint32_t)digest[i] << 16;
+            size_t j;
+            if (i + 1 < SHA256HashSize)
+            {
+                group |= (uint32_t)digest[i + 1] << 8;
+            }
+            if (i + 2 < SHA256HashSize)
+            {
+                group |= digest[i + 2];
+            }
+            for (j = 0; j < 4; j++)
+            {
+                char c = (i + j <= SHA256HashSize) ? base64_chars[(group >> (18 - 6 * j)) & 0x3F] : '=';
+                /* URL_Encode writes everything but letters, digits and a few marks as %xx in lower case */
+                if (c == '+' || c == '/' || c == '=')
+                {
+                    signature[length++] = '%';
+                    signature[length++] = c == '+' ? '2' : c == '/' ? '2' : '3';
+                    signature[length++] = c == '+' ? 'b' : c == '/' ? 'f' : 'd';
+                }
+                else
+                {
+                    signature[length++] = c;
+                }
+            }
+        }
+        signature[length] = '\0';
+
+        length = append_text(slot->token, 0, "SharedAccessSignature sr=");
+        length = append_text(slot->token, length, scope);
+        length = append_text(slot->token, length, "&sig=");
+        length = append_text(slot->token, length, signature);
+        length = append_text(slot->token, length, "&se=");
+        length = append_text(slot->token, length, expiry_text);
+        length = append_text(slot->token, length, "&skn=");
+        if (length >= SAS_TOKEN_MAX_LEN)
+        {
+            LogError("SAS token for scope %s does not fit in %d characters", scope, SAS_TOKEN_MAX_LEN);
+            slot->expiry = 0;
+            result = __FAILURE__;
+        }
+        else
+        {
+            slot->expiry = expiry;
+            result = 0;
+        }
+    }
+    return result;
+}
+
+/* Makes sure the cache is there and belongs to scope, which drops the tokens of another one */
+static int prepare_token_cache(IOTHUB_AUTHORIZATION_DATA* handle, const char* scope)
+{
+    int result;
+    if (handle->token_slots == NULL &&
+        (handle->token_slots = (SAS_TOKEN_SLOT*)calloc(2, sizeof(SAS_TOKEN_SLOT))) == NULL)
+    {
+        LogError("Failed allocating the SAS token cache");
+        result = __FAILURE__;
+    }
+    else if (handle->token_scope != NULL && strcmp(handle->token_scope, scope) == 0)
+    {
+        result = 0;
+    }
+    else
+    {
+        free(handle->token_scope);
+        handle->token_slots[0].expiry = 0;
+        handle->token_slots[1].expiry = 0;
+        if (mallocAndStrcpy_s(&handle->token_scope, scope) != 0)
+        {
+            LogError("Failed allocating the SAS token scope");
+            handle->token_scope = NULL;
+            result = __FAILURE__;
+        }
+        else
+        {
+            result = 0;
+        }
+    }
+    return result;
+}
+
+IOTHUB_AUTHORIZATION_HANDLE IoTHubClient_Auth_Create(const char* device_key, const char* device_id, const char* device_sas_token)
+{
+    IOTHUB_AUTHORIZATION_DATA* result;
+    /* Codes_SRS_IoTHub_Authorization_07_001: [if device_id is NULL IoTHubClient_Auth_Create, shall return NULL. ] */
+    if (device_id == NULL)
+    {
+        LogError("Invalid Parameter device_id: %p", device_id);
+        result = NULL;
+    }
+    else
+    {
+        /* Codes_SRS_IoTHub_Authorization_07_002: [IoTHubClient_Auth_Create shall allocate a IOTHUB_AUTHORIZATION_HANDLE that is needed for subsequent calls. ] */
+        result = (IOTHUB_AUTHORIZATION_DATA*)malloc(sizeof(IOTHUB_AUTHORIZATION_DATA) );
+        if (result == NULL)
+        {
+            /* Codes_SRS_IoTHub_Authorization_07_019: [ On error IoTHubClient_Auth_Create shall return NULL. ] */
+            LogError("Failed allocating IOTHUB_AUTHORIZATION_DATA");
+            result = NULL;
+        }
+        else
+        {
+            memset(result, 0, sizeof(IOTHUB_AUTHORIZATION_DATA) );
+            result->token_expiry_time_sec = DEFAULT_SAS_TOKEN_EXPIRY_TIME_SECS;
+
+            if (device_key != NULL && mallocAndStrcpy_s(&result->device_key, device_key) != 0)
+            {
+                /* Codes_SRS_IoTHub_Authorization_07_019: [ On error IoTHubClient_Auth_Create shall return NULL. ] */
+                LogError("Failed allocating device_key");
+                free(result);
+                result = NULL;
+            }
+            else if (mallocAndStrcpy_s(&result->device_id, device_id) != 0)
+            {
+                /* Codes_SRS_IoTHub_Authorization_07_019: [ On error IoTHubClient_Auth_Create shall return NULL. ] */
+                LogError("Failed allocating device_key");
+                free(result->device_key);
+                free(result);
+                result = NULL;
+            }
+            else
+            {
+                if (device_key != NULL)
+                {
+                    /* Codes_SRS_IoTHub_Authorization_07_003: [ IoTHubClient_Auth_Create shall set the credential type to IOTHUB_CREDENTIAL_TYPE_DEVICE_KEY if the device_sas_token is NULL. ]*/
+                    result->cred_type = IOTHUB_CREDENTIAL_TYPE_DEVICE_KEY;
+                }
+                else if (device_sas_token != NULL)
+                {
+                    /* Codes_SRS_IoTHub_Authorization_07_020: [ else IoTHubClient_Auth_Create shall set the credential type to IOTHUB_CREDENTIAL_TYPE_SAS_TOKEN. ] */
+                    result->cred_type = IOTHUB_CREDENTIAL_TYPE_SAS_TOKEN;
+                    if (mallocAndStrcpy_s(&result->device_sas_token, device_sas_token) != 0)
+                    {
+                        /* Codes_SRS_IoTHub_Authorization_07_019: [ On error IoTHubClient_Auth_Create shall return NULL. ] */
+                        LogError("Failed allocating device_key");
+                        free(result->device_key);
+                        free(result->device_id);
+                        free(result);
+                        result = NULL;
+                    }
+                }
+                else
+                {
+                    /* Codes_SRS_IoTHub_Authorization_07_024: [ if device_sas_token and device_key are NULL IoTHubClient_Auth_Create shall set the credential type to IOTHUB_CREDENTIAL_TYPE_UNKNOWN. ] */
+                    result->cred_type = IOTHUB_CREDENTIAL_TYPE_UNKNOWN;
+                }
+            }
+        }
+    }
+    /* Codes_SRS_IoTHub_Authorization_07_004: [ If successful IoTHubClient_Auth_Create shall return a IOTHUB_AUTHORIZATION_HANDLE value. ] */
+    return result;
+}
+
+IOTHUB_AUTHORIZATION_HANDLE IoTHubClient_Auth_CreateFromDeviceAuth(const char* device_id)
+{
+    IOTHUB_AUTHORIZATION_DATA* result;
+    if (device_id == NULL)
+    {
+        LogError("Invalid Parameter device_id: %p", device_id);
+        result = NULL;
+    }
+    else
+    {
+#ifdef USE_DPS_MODULE
+        result = (IOTHUB_AUTHORIZATION_DATA*)malloc(sizeof(IOTHUB_AUTHORIZATION_DATA));
+        if (result == NULL)
+        {
+            LogError("Failed allocating IOTHUB_AUTHORIZATION_DATA");
+            result = NULL;
+        }
+        else
+        {
+            memset(result, 0, sizeof(IOTHUB_AUTHORIZATION_DATA));
+
+            result->device_auth_handle = iothub_device_auth_create();
+            if (result->device_auth_handle == NULL)
+            {
+                LogError("Failed allocating IOTHUB_AUTHORIZATION_DATA");
+                free(result);
+                result = NULL;
+            }
+            else if (mallocAndStrcpy_s(&result->device_id, device_id) != 0)
+            {
+                LogError("Failed allocating device_key");
+                iothub_device_auth_destroy(result->device_auth_handle);
+                free(result);
+                result = NULL;
+            }
+            else
+            {
+                if (iothub_device_auth_get_auth_type(result->device_auth_handle) == AUTH_TYPE_SAS)
+                {
+                    result->cred_type = IOTHUB_CREDENTIAL_TYPE_DEVICE_AUTH;
+                }
+                else
+                {
+                    result->cred_type = IOTHUB_CREDENTIAL_TYPE_X509_ECC;
+                }
+            }
+        }
+#else
+        LogError("Failed DPS module is not supported");
+        result = NULL;
+#endif
+    }
+    return result;
+}
+
+void IoTHubClient_Auth_Destroy(IOTHUB_AUTHORIZATION_HANDLE handle)
+{
+    /* Codes_SRS_IoTHub_Authorization_07_005: [ if handle is NULL IoTHubClient_Auth_Destroy shall do nothing. ] */
+    if (handle != NULL)
+    {
+        /* Codes_SRS_IoTHub_Authorization_07_006: [ IoTHubClient_Auth_Destroy shall free all resources associated with the IOTHUB_AUTHORIZATION_HANDLE handle. ] */
+#ifdef USE_DPS_MODULE
+        iothub_device_auth_destroy(handle->device_auth_handle);
+#endif
+        free(handle->device_key);
+        free(handle->device_id);
+        free(handle->device_sas_token);
+        free(handle->decoded_key);
+        free(handle->token_scope);
+        free(handle->token_slots);
+        free(handle);
+    }
+}
+
+IOTHUB_CREDENTIAL_TYPE IoTHubClient_Auth_Set_x509_Type(IOTHUB_AUTHORIZATION_HANDLE handle, bool enable_x509)
+{
+    IOTHUB_CREDENTIAL_TYPE result;
+    if (handle != NULL)
+    {
+        if (enable_x509)
+        {
+            result = handle->cred_type = IOTHUB_CREDENTIAL_TYPE_X509;
+        }
+        else
+        {
+            if (handle->device_sas_token == NULL)
+            {
+                result = handle->cred_type = IOTHUB_CREDENTIAL_TYPE_DEVICE_KEY;
+            }
+            else if (handle->device_key == NULL)
+            {
+                result = handle->cred_type = IOTHUB_CREDENTIAL_TYPE_SAS_TOKEN;
+            }
+            else
+            {
+                result = handle->cred_type = IOTHUB_CREDENTIAL_TYPE_UNKNOWN;
+            }
+        }
+    }
+    else
+    {
+        result = IOTHUB_CREDENTIAL_TYPE_UNKNOWN;
+    }
+    return result;
+}
+
+int IoTHubClient_Auth_Set_xio_Certificate(IOTHUB_AUTHORIZATION_HANDLE handle, XIO_HANDLE xio)
+{
+    int result;
+    if (handle == NULL || xio == NULL)
+    {
+        LogError("Invalid Parameter handle: %p xio: %p", handle, xio);
+        result = __FAILURE__;
+    }
+    else if (handle->cred_type != IOTHUB_CREDENTIAL_TYPE_X509_ECC)
+    {
+        LogError("Invalid credential types for this operation");
+        result = __FAILURE__;
+    }
+    else
+    {
+#ifdef USE_DPS_MODULE
+        CREDENTIAL_RESULT* cred_result = iothub_device_auth_generate_credentials(handle->device_auth_handle, NULL);
+        if (cred_result == NULL)
+        {
+            LogError("Failure generating credentials");
+            result = __FAILURE__;
+        }
+        else
+        {
+            if (xio_setoption(xio, OPTION_X509_ECC_CERT, cred_result->auth_cred_result.x509_result.x509_cert) != 0)
+            {
+                LogError("Failure setting x509 cert on xio");
+                result = __FAILURE__;
+            }
+            else if (xio_setoption(xio, OPTION_X509_ECC_KEY, cred_result->auth_cred_result.x509_result.x509_alias_key) != 0)
+            {
+                LogError("Failure setting x509 key on xio");
+                result = __FAILURE__;
+            }
+            else
+            {
+                result = 0;
+            }
+            free(cred_result);
+        }
+#else
+        LogError("Failed DPS module is not supported");
+        result = __FAILURE__;
+#endif
+    }
+    return result;
+}
+
+IOTHUB_CREDENTIAL_TYPE IoTHubClient_Auth_Get_Credential_Type(IOTHUB_AUTHORIZATION_HANDLE handle)
+{
+    IOTHUB_CREDENTIAL_TYPE result;
+    /* Codes_SRS_IoTHub_Authorization_07_007: [ if handle is NULL IoTHub_Auth_Get_Credential_Type shall return IOTHUB_CREDENTIAL_TYPE_UNKNOWN. ] */
+    if (handle == NULL)
+    {
+        LogError("Invalid Parameter handle: %p", handle);
+        result = IOTHUB_CREDENTIAL_TYPE_UNKNOWN;
+    }
+    else
+    {
+        /* Codes_SRS_IoTHub_Authorization_07_008: [ IoTHub_Auth_Get_Credential_Type shall return the credential type that is set upon creation. ] */
+        result = handle->cred_type;
+    }
+    return result;
+}
+
+char* IoTHubClient_Auth_Get_SasToken(IOTHUB_AUTHORIZATION_HANDLE handle, const char* scope, size_t expire_time)
+{
+    char* result;
+    /* Codes_SRS_IoTHub_Authorization_07_009: [ if handle or scope are NULL, IoTHubClient_Auth_Get_SasToken shall return NULL. ] */
+    if (handle == NULL)
+    {
+        LogError("Invalid Parameter handle: %p", handle);
+        result = NULL;
+    }
+    else
+    {
+        if (handle->cred_type == IOTHUB_CREDENTIAL_TYPE_DEVICE_AUTH)
+        {
+#ifdef USE_DPS_MODULE
+            DEVICE_AUTH_CREDENTIAL_INFO dev_auth_cred;
+            size_t sec_since_epoch;
+
+            if (get_seconds_since_epoch(&sec_since_epoch) != 0)
+            {
+                LogError("failure getting seconds from epoch");
+                result = NULL;
+            }
+            else 
+            {
+                size_t expiry_time = sec_since_epoch+expire_time;
+                dev_auth_cred.sas_info.expiry_seconds = expiry_time;
+                dev_auth_cred.sas_info.token_scope = scope;
+                dev_auth_cred.dev_auth_type = AUTH_TYPE_SAS;
+
+                CREDENTIAL_RESULT* cred_result = iothub_device_auth_generate_credentials(handle->device_auth_handle, &dev_auth_cred);
+                if (cred_result == NULL)
+                {
+                    LogError("failure getting credentials from device auth module");
+                    result = NULL;
+                }
+                else
+                {
+                    if (mallocAndStrcpy_s(&result, cred_result->auth_cred_result.sas_result.sas_token) != 0)
+                    {
+                        LogError("failure allocating Sas Token");
+                        result = NULL;
+                    }
+                    free(cred_result->auth_cred_result.sas_result.sas_token);
+                    free(cred_result);
+                }
+            }
+#else
+            LogError("Failed DPS module is not supported");
+            result = NULL;
+#endif
+        }
+        else if (handle->cred_type == IOTHUB_CREDENTIAL_TYPE_SAS_TOKEN)
+        {
+            /* Codes_SRS_IoTHub_Authorization_07_021: [If the device_sas_token is NOT NULL IoTHubClient_Auth_Get_SasToken shall return a copy of the device_sas_token. ] */
+            if (handle->device_sas_token != NULL)
+            {
+                if (mallocAndStrcpy_s(&result, handle->device_sas_token) != 0)
+                {
+                    LogError("failure allocating sas token");
+                    result = NULL;
+                }
+            }
+            else
+            {
+                LogError("failure device sas token is NULL");
+                result = NULL;
+            }
+        }
+        else if (handle->cred_type == IOTHUB_CREDENTIAL_TYPE_DEVICE_KEY)
+        {
+            /* Codes_SRS_IoTHub_Authorization_07_009: [ if handle or scope are NULL, IoTHubClient_Auth_Get_SasToken shall return NULL. ] */
+            if (scope == NULL)
+            {
+                LogError("Invalid Parameter scope: %p", scope);
+                result = NULL;
+            }
+            else
+            {
+                size_t sec_since_epoch;
+
+                /* Codes_SRS_IoTHub_Authorization_07_010: [ IoTHubClient_Auth_Get_ConnString shall construct the expiration time using the expire_time. ] */
+                if (get_seconds_since_epoch(&sec_since_epoch) != 0)
+                {
+                    /* Codes_SRS_IoTHub_Authorization_07_020: [ If any error is encountered IoTHubClient_Auth_Get_ConnString shall return NULL. ] */
+                    LogError("failure getting seconds from epoch");
+                    result = NULL;
+                }
+                else 
+                {
+                    /* Codes_SRS_IoTHub_Authorization_07_011: [ IoTHubClient_Auth_Get_ConnString shall call SASToken_CreateString to construct the sas token. ] */
+                    size_t expiry_time = sec_since_epoch+expire_time;
+                    SAS_TOKEN_SLOT* sas_token = (SAS_TOKEN_SLOT*)malloc(sizeof(SAS_TOKEN_SLOT));
+                    if (sas_token == NULL || sign_sas_token(handle, scope, expiry_time, sas_token) != 0)
+                    {
+                        /* Codes_SRS_IoTHub_Authorization_07_020: [ If any error is encountered IoTHubClient_Auth_Get_ConnString shall return NULL. ] */
+                        LogError("Failed creating sas_token");
+                        result = NULL;
+                    }
+                    else
+                    {
+                        /* Codes_SRS_IoTHub_Authorization_07_012: [ On success IoTHubClient_Auth_Get_ConnString shall allocate and return the sas token in a char*. ] */
+                        if (mallocAndStrcpy_s(&result, sas_token->token) != 0)
+                        {
+                            /* Codes_SRS_IoTHub_Authorization_07_020: [ If any error is encountered IoTHubClient_Auth_Get_ConnString shall return NULL. ] */
+                            LogError("Failed copying result");
+                            result = NULL;
+                        }
+                    }
+                    free(sas_token);
+                }
+            }
+        }
+        else
+        {
+            LogError("Failed getting sas token invalid credential type");
+            result = NULL;
+        }
+    }
+    return result;
+}
+
+const char* IoTHubClient_Auth_Get_Cached_SasToken(IOTHUB_AUTHORIZATION_HANDLE handle, const char* scope, size_t lifetime, size_t min_remaining, size_t* expiry)
+{
+    const char* result;
+    size_t sec_since_epoch;
+    if (handle == NULL || scope == NULL || expiry == NULL || min_remaining >= lifetime)
+    {
+        LogError("Invalid Parameter handle: %p scope: %p expiry: %p", handle, scope, expiry);
+        result = NULL;
+    }
+    else if (handle->cred_type != IOTHUB_CREDENTIAL_TYPE_DEVICE_KEY)
+    {
+        LogError("Only tokens signed with the device key are cached");
+        result = NULL;
+    }
+    else if (get_seconds_since_epoch(&sec_since_epoch) != 0 || prepare_token_cache(handle, scope) != 0)
+    {
+        result = NULL;
+    }
+    else
+    {
+        SAS_TOKEN_SLOT* current = &handle->token_slots[handle->current_slot];
+        SAS_TOKEN_SLOT* next = &handle->token_slots[1 - handle->current_slot];
+        /* the token renewed ahead of time takes over as soon as it is asked for, the clock might have jumped since */
+        if (next->expiry > sec_since_epoch + min_remaining && next->expiry <= sec_since_epoch + lifetime)
+        {
+            current->expiry = 0;
+            handle->current_slot = 1 - handle->current_slot;
+            current = next;
+        }
+        if ((current->expiry > sec_since_epoch + min_remaining && current->expiry <= sec_since_epoch + lifetime) ||
+            sign_sas_token(handle, scope, sec_since_epoch + lifetime, current) == 0)
+        {
+            *expiry = current->expiry;
+            result = current->token;
+        }
+        else
+        {
+            result = NULL;
+        }
+    }
+    return result;
+}
+
+int IoTHubClient_Auth_Renew_SasToken(IOTHUB_AUTHORIZATION_HANDLE handle, const char* scope, size_t lifetime)
+{
+    int result;
+    size_t sec_since_epoch;
+    if (handle == NULL || scope == NULL)
+    {
+        LogError("Invalid Parameter handle: %p scope: %p", handle, scope);
+        result = __FAILURE__;
+    }
+    else if (handle->cred_type != IOTHUB_CREDENTIAL_TYPE_DEVICE_KEY)
+    {
+        LogError("Only tokens signed with the device key are cached");
+        result = __FAILURE__;
+    }
+    else if (get_seconds_since_epoch(&sec_since_epoch) != 0 || prepare_token_cache(handle, scope) != 0)
+    {
+        result = __FAILURE__;
+    }
+    else
+    {
+        SAS_TOKEN_SLOT* next = &handle->token_slots[1 - handle->current_slot];
+        if (next->expiry > handle->token_slots[handle->current_slot].expiry && next->expiry > sec_since_epoch)
+        {
+            /* renewed already */
+            result = 0;
+        }
+        else
+        {
+            result = sign_sas_token(handle, scope, sec_since_epoch + lifetime, next);
+        }
+    }
+    return result;
+}
+
+const char* IoTHubClient_Auth_Get_DeviceId(IOTHUB_AUTHORIZATION_HANDLE handle)
+{
+    const char* result;
+    if (handle == NULL)
+    {
+        /* Codes_SRS_IoTHub_Authorization_07_013: [ if handle is NULL, IoTHubClient_Auth_Get_DeviceId shall return NULL. ] */
+        LogError("Invalid Parameter handle: %p", handle);
+        result = NULL;
+    }
+    else
+    {
+        /* Codes_SRS_IoTHub_Authorization_07_014: [ IoTHubClient_Auth_Get_DeviceId shall return the device_id specified upon creation. ] */
+        result = handle->device_id;
+    }
+    return result;
+}
+
+const char* IoTHubClient_Auth_Get_DeviceKey(IOTHUB_AUTHORIZATION_HANDLE handle)
+{
+    const char* result;
+    if (handle == NULL)
+    {
+        /* Codes_SRS_IoTHub_Authorization_07_022: [ if handle is NULL, IoTHubClient_Auth_Get_DeviceKey shall return NULL. ] */
+        LogError("Invalid Parameter handle: %p", handle);
+        result = NULL;
+    }
+    else
+    {
+        /* Codes_SRS_IoTHub_Authorization_07_023: [ IoTHubClient_Auth_Get_DeviceKey shall return the device_key specified upon creation. ] */
+        result = handle->device_key;
+    }
+    return result;
+}
+
+SAS_TOKEN_STATUS IoTHubClient_Auth_Is_SasToken_Valid(IOTHUB_AUTHORIZATION_HANDLE handle)
+{
+    SAS_TOKEN_STATUS result;
+    if (handle == NULL)
+    {
+        /* Codes_SRS_IoTHub_Authorization_07_015: [ if handle is NULL, IoTHubClient_Auth_Is_SasToken_Valid shall return false. ] */
+        LogError("Invalid Parameter handle: %p", handle);
+        result = SAS_TOKEN_STATUS_FAILED;
+    }
+    else
+    {
+        if (handle->cred_type == IOTHUB_CREDENTIAL_TYPE_SAS_TOKEN)
+        {
+            if (handle->device_sas_token == NULL)
+            {
+                /* Codes_SRS_IoTHub_Authorization_07_017: [ If the sas_token is NULL IoTHubClient_Auth_Is_SasToken_Valid shall return false. ] */
+                LogError("Failure: device_sas_toke is NULL");
+                result = SAS_TOKEN_STATUS_FAILED;
+            }
+            else
+            {
+                /* Codes_SRS_IoTHub_Authorization_07_018: [ otherwise IoTHubClient_Auth_Is_SasToken_Valid shall return the value returned by SASToken_Validate. ] */
+                STRING_HANDLE strSasToken = STRING_construct(handle->device_sas_token);
+                if (strSasToken != NULL)
+                {
+                    if (!SASToken_Validate(strSasToken))
+                    {
+                        result = SAS_TOKEN_STATUS_INVALID;
+                    }
+                    else
+                    {
+                        result = SAS_TOKEN_STATUS_VALID;
+                    }
+                    STRING_delete(strSasToken);
+                }
+                else
+                {
+                    LogError("Failure constructing SAS Token");
+                    result = SAS_TOKEN_STATUS_FAILED;
+                }
+            }
+        }
+        else
+        {
+            /* Codes_SRS_IoTHub_Authorization_07_016: [ if credential type is not IOTHUB_CREDENTIAL_TYPE_SAS_TOKEN IoTHubClient_Auth_Is_SasToken_Valid shall return true. ] */
+            result = true;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,37 @@
+#include "HX711Array.h"
+
+// HX711 circuit wiring: one clock line shared by all load cells
+const byte LOADCELL_DOUT_PINS[] = { 2, 4, 5, 6 };
+const int LOADCELL_SCK_PIN = 3;
+const byte LOADCELLS = sizeof(LOADCELL_DOUT_PINS);
+
+HX711Array scales;
+
+void setup() {
+  Serial.begin(57600);
+  scales.begin(LOADCELL_DOUT_PINS, LOADCELLS, LOADCELL_SCK_PIN);
+  for (byte i = 0; i < LOADCELLS; i++) {
+    scales.set_scale(i, 2280.f);    // calibrate every load cell on its own
+  }
+  scales.tare();
+}
+
+void loop() {
+  float units[LOADCELLS];
+  float total = 0;
+
+  if (scales.wait_ready_timeout(1000)) {
+    scales.get_units(units, 5);
+    for (byte i = 0; i < LOADCELLS; i++) {
+      Serial.print(units[i], 1);
+      Serial.print("\t");
+      total += units[i];
+    }
+    Serial.print("| total:\t");
+    Serial.println(total, 1);
+  } else {
+    Serial.println("HX711 not found.");
+  }
+
+  delay(1500);
+}
@@ -0,0 +1,53 @@
+/**
+ *
+ * HX711 library for Arduino - example file
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+// Compares the CPU cycles spent clocking out one conversion by HX711::read()
+// and by HX711Fast on an ESP32. Both drivers talk to the same chip, so only
+// the time after the chip signals ready is counted.
+#include "HX711.h"
+#include "HX711Fast.h"
+
+// HX711 circuit wiring
+const int LOADCELL_DOUT_PIN = 15;
+const int LOADCELL_SCK_PIN = 13;
+const int ROUNDS = 50;
+
+HX711 scale;
+HX711Fast<LOADCELL_DOUT_PIN, LOADCELL_SCK_PIN> fast;
+
+void setup() {
+  Serial.begin(115200);
+  scale.begin(LOADCELL_DOUT_PIN, LOADCELL_SCK_PIN);
+  fast.begin();
+}
+
+void loop() {
+  uint32_t slow_cycles = 0;
+  uint32_t fast_cycles = 0;
+  long slow_value = 0;
+  long fast_value = 0;
+
+  for (int i = 0; i < ROUNDS; i++) {
+    scale.wait_ready();
+    uint32_t start = ESP.getCycleCount();
+    slow_value = scale.read();
+    slow_cycles += ESP.getCycleCount() - start;
+
+    while (!fast.is_ready()) {
+      delay(0);
+    }
+    start = ESP.getCycleCount();
+    fast_value = fast.read_conversion();
+    fast_cycles += ESP.getCycleCount() - start;
+  }
+
+  Serial.printf("HX711::read()  %6u cycles  value %ld\n", slow_cycles / ROUNDS, slow_value);
+  Serial.printf("HX711Fast      %6u cycles  value %ld\n", fast_cycles / ROUNDS, fast_value);
+  delay(2000);
+}
@@ -0,0 +1,393 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#include <Arduino.h>
+#include "HX711.h"
+#include "HX711Platform.h"
+
+#if IS_FREE_RTOS
+// Stack and priority of the task clocking out conversions in acquisition mode.
+#define ACQUISITION_TASK_STACK 2048
+#define ACQUISITION_TASK_PRIORITY (configMAX_PRIORITIES - 1)
+#endif
+
+
+HX711::HX711() {
+}
+
+HX711::~HX711() {
+}
+
+void HX711::begin(byte dout, byte pd_sck, byte gain, HX711Gpio& gpio) {
+	PD_SCK = pd_sck;
+	DOUT = dout;
+	this->gpio = &gpio;
+
+	gpio.pin_mode(PD_SCK, OUTPUT);
+	gpio.pin_mode(DOUT, DOUT_MODE);
+
+	set_gain(gain);
+}
+
+bool HX711::is_ready() {
+	return gpio->read(DOUT) == LOW;
+}
+
+void HX711::set_gain(byte gain) {
+	switch (gain) {
+		case 128:		// channel A, gain factor 128
+			GAIN = 1;
+			break;
+		case 64:		// channel A, gain factor 64
+			GAIN = 3;
+			break;
+		case 32:		// channel B, gain factor 32
+			GAIN = 2;
+			break;
+	}
+
+}
+
+uint8_t HX711::shift_in() {
+	uint8_t value = 0;
+
+	for (uint8_t i = 0; i < 8; ++i) {
+		gpio->write(PD_SCK, HIGH);
+		SHIFTIN_DELAY();
+		value |= gpio->read(DOUT) << (7 - i);
+		gpio->write(PD_SCK, LOW);
+		SHIFTIN_DELAY();
+	}
+	return value;
+}
+
+long HX711::read() {
+	if (acquiring) {
+		long value;
+		while (!try_read(value)) {
+			// Probably will do no harm on AVR but will feed the Watchdog Timer (WDT) on ESP.
+			// https://github.com/bogde/HX711/issues/73
+			delay(0);
+		}
+		return value;
+	}
+
+	// Wait for the chip to become ready.
+	wait_ready();
+
+	return read_conversion();
+}
+
+long HX711::read_conversion() {
+	// Define structures for reading data into.
+	unsigned long value = 0;
+	uint8_t data[3] = { 0 };
+
+	// Protect the read sequence from system interrupts.  If an interrupt occurs during
+	// the time the PD_SCK signal is high it will stretch the length of the clock pulse.
+	// If the total pulse time exceeds 60 uSec this will cause the HX711 to enter
+	// power down mode during the middle of the read sequence.  While the device will
+	// wake up when PD_SCK goes low again, the reset starts a new conversion cycle which
+	// forces DOUT high until that cycle is completed.
+	//
+	// The result is that all subsequent bits read by shiftIn() will read back as 1,
+	// corrupting the value returned by read().  The ATOMIC_BLOCK macro disables
+	// interrupts during the sequence and then restores the interrupt mask to its previous
+	// state after the sequence completes, insuring that the entire read-and-gain-set
+	// sequence is not interrupted.  The macro has a few minor advantages over bracketing
+	// the sequence between `noInterrupts()` and `interrupts()` calls.
+	#if HAS_ATOMIC_BLOCK
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+
+	#elif IS_FREE_RTOS
+	// Begin of critical section.
+	// Critical sections are used as a valid protection method
+	// against simultaneous access in vanilla FreeRTOS.
+	// Disable the scheduler and call portDISABLE_INTERRUPTS. This prevents
+	// context switches and servicing of ISRs during a critical section.
+	portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+	portENTER_CRITICAL(&mux);
+
+	#else
+	// Disable interrupts.
+	noInterrupts();
+	#endif
+
+	// Pulse the clock pin 24 times to read the data.
+	data[2] = shift_in();
+	data[1] = shift_in();
+	data[0] = shift_in();
+
+	// Set the channel and the gain factor for the next reading using the clock pin.
+	for (unsigned int i = 0; i < GAIN; i++) {
+		gpio->write(PD_SCK, HIGH);
+		#if ARCH_ESPRESSIF
+		gpio->delay_us(1);
+		#endif
+		gpio->write(PD_SCK, LOW);
+		#if ARCH_ESPRESSIF
+		gpio->delay_us(1);
+		#endif
+	}
+
+	#if IS_FREE_RTOS
+	// End of critical section.
+	portEXIT_CRITICAL(&mux);
+
+	#elif HAS_ATOMIC_BLOCK
+	}
+
+	#else
+	// Enable interrupts again.
+	interrupts();
+	#endif
+
+	// Construct the 24-bit two's complement reading, then sign extend it. Subtracting
+	// 2^24 rather than padding with 0xFF keeps it right where long is 64 bits wide.
+	value = ( static_cast<unsigned long>(data[2]) << 16
+			| static_cast<unsigned long>(data[1]) << 8
+			| static_cast<unsigned long>(data[0]) );
+	long result = static_cast<long>(value);
+	if (value & 0x800000UL) {
+		result -= 0x1000000L;
+	}
+
+	if (filter) {
+		filtered = filter->apply(result);
+	}
+
+	return result;
+}
+
+void HX711::push_conversion() {
+	// Clocking out the conversion toggles DOUT and fires the falling edge
+	// handler again; those edges are ignored while the read is in progress.
+	clocking = true;
+	if (is_ready()) {
+		long value = read_conversion();
+		uint8_t next = (ring_head + 1) & (HX711_RING_SIZE - 1);
+		if (next == ring_tail) {
+			// The consumer owns ring_tail, so drop the newest reading.
+			overruns++;
+		} else {
+			ring[ring_head] = value;
+			ring_head = next;
+		}
+	}
+	clocking = false;
+}
+
+#if IS_FREE_RTOS
+void HX711::acquisition_loop(void* arg) {
+	HX711* self = static_cast<HX711*>(arg);
+	while (true) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		self->push_conversion();
+	}
+}
+
+void IRAM_ATTR HX711::data_ready(void* arg) {
+	HX711* self = static_cast<HX711*>(arg);
+	if (self->clocking) {
+		return;
+	}
+	BaseType_t woken = pdFALSE;
+	vTaskNotifyGiveFromISR(static_cast<TaskHandle_t>(self->acquisition_task), &woken);
+	if (woken == pdTRUE) {
+		portYIELD_FROM_ISR();
+	}
+}
+#else
+void HX711::data_ready(void* arg) {
+	HX711* self = static_cast<HX711*>(arg);
+	if (self->clocking) {
+		return;
+	}
+	self->push_conversion();
+}
+#endif
+
+bool HX711::start_acquisition() {
+	if (acquiring) {
+		return true;
+	}
+	ring_head = ring_tail = 0;
+	overruns = 0;
+
+	#if IS_FREE_RTOS
+	TaskHandle_t task = NULL;
+	if (xTaskCreate(acquisition_loop, "hx711", ACQUISITION_TASK_STACK, this,
+			ACQUISITION_TASK_PRIORITY, &task) != pdPASS) {
+		return false;
+	}
+	acquisition_task = task;
+	#endif
+
+	acquiring = true;
+	if (!gpio->attach_falling(DOUT, data_ready, this)) {
+		stop_acquisition();
+		return false;
+	}
+
+	// A conversion may already be waiting, in which case DOUT is low and no edge will come.
+	#if IS_FREE_RTOS
+	xTaskNotifyGive(static_cast<TaskHandle_t>(acquisition_task));
+	#else
+	push_conversion();
+	#endif
+	return true;
+}
+
+void HX711::stop_acquisition() {
+	if (!acquiring) {
+		return;
+	}
+	gpio->detach(DOUT);
+	#if IS_FREE_RTOS
+	if (acquisition_task != NULL) {
+		vTaskDelete(static_cast<TaskHandle_t>(acquisition_task));
+		acquisition_task = NULL;
+	}
+	#endif
+	acquiring = false;
+	ring_head = ring_tail = 0;
+}
+
+byte HX711::available() {
+	if (!acquiring) {
+		return is_ready() ? 1 : 0;
+	}
+	return (ring_head - ring_tail) & (HX711_RING_SIZE - 1);
+}
+
+bool HX711::try_read(long& value) {
+	if (!acquiring) {
+		if (!is_ready()) {
+			return false;
+		}
+		value = read_conversion();
+		return true;
+	}
+	uint8_t tail = ring_tail;
+	if (tail == ring_head) {
+		return false;
+	}
+	value = ring[tail];
+	ring_tail = (tail + 1) & (HX711_RING_SIZE - 1);
+	return true;
+}
+
+unsigned long HX711::get_overruns() {
+	return overruns;
+}
+
+void HX711::set_filter(HX711Filter* filter) {
+	if (filter) {
+		filter->reset_all();
+	}
+	// Until the first conversion reaches the filter, read as the tare weight rather than 0 raw counts.
+	filtered = OFFSET;
+	this->filter = filter;
+}
+
+long HX711::get_filtered() {
+	return filtered;
+}
+
+float HX711::get_filtered_units() {
+	return (get_filtered() - OFFSET) / SCALE;
+}
+
+void HX711::wait_ready(unsigned long delay_ms) {
+	// Wait for the chip to become ready.
+	// This is a blocking implementation and will
+	// halt the sketch until a load cell is connected.
+	while (!is_ready()) {
+		// Probably will do no harm on AVR but will feed the Watchdog Timer (WDT) on ESP.
+		// https://github.com/bogde/HX711/issues/73
+		delay(delay_ms);
+	}
+}
+
+bool HX711::wait_ready_retry(int retries, unsigned long delay_ms) {
+	// Wait for the chip to become ready by
+	// retrying for a specified amount of attempts.
+	// https://github.com/bogde/HX711/issues/76
+	int count = 0;
+	while (count < retries) {
+		if (is_ready()) {
+			return true;
+		}
+		delay(delay_ms);
+		count++;
+	}
+	return false;
+}
+
+bool HX711::wait_ready_timeout(unsigned long timeout, unsigned long delay_ms) {
+	// Wait for the chip to become ready until timeout.
+	// https://github.com/bogde/HX711/pull/96
+	unsigned long millisStarted = millis();
+	while (millis() - millisStarted < timeout) {
+		if (is_ready()) {
+			return true;
+		}
+		delay(delay_ms);
+	}
+	return false;
+}
+
+long HX711::read_average(byte times) {
+	long sum = 0;
+	for (byte i = 0; i < times; i++) {
+		sum += read();
+		// Probably will do no harm on AVR but will feed the Watchdog Timer (WDT) on ESP.
+		// https://github.com/bogde/HX711/issues/73
+		delay(0);
+	}
+	return sum / times;
+}
+
+double HX711::get_value(byte times) {
+	return read_average(times) - OFFSET;
+}
+
+float HX711::get_units(byte times) {
+	return get_value(times) / SCALE;
+}
+
+void HX711::tare(byte times) {
+	double sum = read_average(times);
+	set_offset(sum);
+}
+
+void HX711::set_scale(float scale) {
+	SCALE = scale;
+}
+
+float HX711::get_scale() {
+	return SCALE;
+}
+
+void HX711::set_offset(long offset) {
+	OFFSET = offset;
+}
+
+long HX711::get_offset() {
+	return OFFSET;
+}
+
+void HX711::power_down() {
+	gpio->write(PD_SCK, LOW);
+	gpio->write(PD_SCK, HIGH);
+}
+
+void HX711::power_up() {
+	gpio->write(PD_SCK, LOW);
+}
@@ -0,0 +1,155 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#ifndef HX711_h
+#define HX711_h
+
+#if ARDUINO >= 100
+#include "Arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "HX711Gpio.h"
+#include "HX711Filter.h"
+
+// Number of conversions buffered in acquisition mode; must be a power of two.
+#ifndef HX711_RING_SIZE
+#define HX711_RING_SIZE 16
+#endif
+// The ring indices are bytes wrapped with a mask.
+static_assert(HX711_RING_SIZE >= 2 && HX711_RING_SIZE <= 256 && (HX711_RING_SIZE & (HX711_RING_SIZE - 1)) == 0,
+	"HX711_RING_SIZE must be a power of two from 2 to 256");
+
+class HX711
+{
+	private:
+		byte PD_SCK;	// Power Down and Serial Clock Input Pin
+		byte DOUT;		// Serial Data Output Pin
+		byte GAIN;		// amplification factor
+		long OFFSET = 0;	// used for tare weight
+		float SCALE = 1;	// used to return weight in grams, kg, ounces, whatever
+		HX711Gpio* gpio = &HX711Gpio::arduino();	// pin access, replaceable for host builds
+
+		// Conversions clocked out in acquisition mode, written by the data ready
+		// handler and consumed by try_read()/read().
+		volatile long ring[HX711_RING_SIZE];
+		volatile uint8_t ring_head = 0;
+		volatile uint8_t ring_tail = 0;
+		volatile unsigned long overruns = 0;
+		volatile bool acquiring = false;
+		volatile bool clocking = false;
+		void* acquisition_task = NULL;
+
+		// Streaming filter fed with every conversion clocked out, and its latest output.
+		HX711Filter* filter = NULL;
+		volatile long filtered = 0;
+
+		uint8_t shift_in();
+		long read_conversion();
+		void push_conversion();
+		static void data_ready(void* arg);
+		#if defined(ARDUINO_ARCH_ESP32)
+		static void acquisition_loop(void* arg);
+		#endif
+
+	public:
+
+		HX711();
+
+		virtual ~HX711();
+
+		// Initialize library with data output pin, clock input pin and gain factor.
+		// Channel selection is made by passing the appropriate gain:
+		// - With a gain factor of 64 or 128, channel A is selected
+		// - With a gain factor of 32, channel B is selected
+		// The library default is "128" (Channel A).
+		void begin(byte dout, byte pd_sck, byte gain = 128, HX711Gpio& gpio = HX711Gpio::arduino());
+
+		// Check if HX711 is ready
+		// from the datasheet: When output data is not ready for retrieval, digital output pin DOUT is high. Serial clock
+		// input PD_SCK should be low. When DOUT goes to low, it indicates data is ready for retrieval.
+		bool is_ready();
+
+		// Wait for the HX711 to become ready
+		void wait_ready(unsigned long delay_ms = 0);
+		bool wait_ready_retry(int retries = 3, unsigned long delay_ms = 0);
+		bool wait_ready_timeout(unsigned long timeout = 1000, unsigned long delay_ms = 0);
+
+		// set the gain factor; takes effect only after a call to read()
+		// channel A can be set for a 128 or 64 gain; channel B has a fixed 32 gain
+		// depending on the parameter, the channel is also set to either A or B
+		void set_gain(byte gain = 128);
+
+		// waits for the chip to be ready and returns a reading
+		// in acquisition mode, waits for and returns the oldest buffered conversion instead
+		long read();
+
+		// Start interrupt-driven acquisition: every falling edge on DOUT clocks out the
+		// conversion into a ring buffer of HX711_RING_SIZE readings. On FreeRTOS the
+		// edge only wakes a high priority task which does the clocking.
+		// Returns false if DOUT cannot deliver interrupts on this platform.
+		bool start_acquisition();
+
+		// Stop acquisition mode and drop buffered conversions.
+		void stop_acquisition();
+
+		// number of conversions that can be taken by try_read() without waiting
+		byte available();
+
+		// non-blocking read: stores a reading in value and returns true if one was ready
+		bool try_read(long& value);
+
+		// number of conversions dropped because the ring buffer was full
+		unsigned long get_overruns();
+
+		// Attach a filter pipeline (see HX711Filter.h) which is fed every conversion as
+		// soon as it is clocked out, including in acquisition mode. Pass NULL to detach.
+		// Call it after tare(): get_filtered() starts out at the tare offset.
+		void set_filter(HX711Filter* filter);
+
+		// latest output of the filter; does not start a conversion
+		long get_filtered();
+
+		// returns (get_filtered() - OFFSET) / SCALE, the filtered weight in measure units
+		float get_filtered_units();
+
+		// returns an average reading; times = how many times to read
+		long read_average(byte times = 10);
+
+		// returns (read_average() - OFFSET), that is the current value without the tare weight; times = how many readings to do
+		double get_value(byte times = 1);
+
+		// returns get_value() divided by SCALE, that is the raw value divided by a value obtained via calibration
+		// times = how many readings to do
+		float get_units(byte times = 1);
+
+		// set the OFFSET value for tare weight; times = how many times to read the tare value
+		void tare(byte times = 10);
+
+		// set the SCALE value; this value is used to convert the raw data to "human readable" data (measure units)
+		void set_scale(float scale = 1.f);
+
+		// get the current SCALE
+		float get_scale();
+
+		// set OFFSET, the value that's subtracted from the actual reading (tare weight)
+		void set_offset(long offset = 0);
+
+		// get the current OFFSET
+		long get_offset();
+
+		// puts the chip into power down mode
+		void power_down();
+
+		// wakes up the chip after power down mode
+		void power_up();
+};
+
+#endif /* HX711_h */
@@ -0,0 +1,195 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#include <Arduino.h>
+#include "HX711Array.h"
+#include "HX711Platform.h"
+
+HX711Array::HX711Array() {
+	for (byte i = 0; i < HX711_ARRAY_MAX_CHANNELS; i++) {
+		OFFSET[i] = 0;
+		SCALE[i] = 1;
+	}
+}
+
+bool HX711Array::begin(const byte* dout, byte channels, byte pd_sck, byte gain, HX711Gpio& gpio) {
+	if (channels > HX711_ARRAY_MAX_CHANNELS) {
+		return false;
+	}
+	PD_SCK = pd_sck;
+	CHANNELS = channels;
+	this->gpio = &gpio;
+
+	gpio.pin_mode(PD_SCK, OUTPUT);
+	for (byte i = 0; i < CHANNELS; i++) {
+		DOUT[i] = dout[i];
+		gpio.pin_mode(DOUT[i], DOUT_MODE);
+	}
+
+	set_gain(gain);
+	return true;
+}
+
+byte HX711Array::channels() {
+	return CHANNELS;
+}
+
+bool HX711Array::is_ready() {
+	// Every DOUT must be low; chips finish their conversions a few cycles apart.
+	return gpio->read_pins(DOUT, CHANNELS) == 0;
+}
+
+void HX711Array::wait_ready(unsigned long delay_ms) {
+	while (!is_ready()) {
+		delay(delay_ms);
+	}
+}
+
+bool HX711Array::wait_ready_timeout(unsigned long timeout, unsigned long delay_ms) {
+	unsigned long millisStarted = millis();
+	while (millis() - millisStarted < timeout) {
+		if (is_ready()) {
+			return true;
+		}
+		delay(delay_ms);
+	}
+	return false;
+}
+
+void HX711Array::set_gain(byte gain) {
+	switch (gain) {
+		case 128:		// channel A, gain factor 128
+			GAIN = 1;
+			break;
+		case 64:		// channel A, gain factor 64
+			GAIN = 3;
+			break;
+		case 32:		// channel B, gain factor 32
+			GAIN = 2;
+			break;
+	}
+}
+
+void HX711Array::read(long* values) {
+	unsigned long raw[HX711_ARRAY_MAX_CHANNELS] = { 0 };
+
+	wait_ready();
+
+	// See HX711::read_conversion() for why the clock train must not be interrupted.
+	#if HAS_ATOMIC_BLOCK
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+
+	#elif IS_FREE_RTOS
+	portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+	portENTER_CRITICAL(&mux);
+
+	#else
+	noInterrupts();
+	#endif
+
+	// Pulse the shared clock 24 times and sample all DOUT pins on every pulse.
+	for (byte bit = 0; bit < 24; bit++) {
+		gpio->write(PD_SCK, HIGH);
+		SHIFTIN_DELAY();
+		uint32_t levels = gpio->read_pins(DOUT, CHANNELS);
+		gpio->write(PD_SCK, LOW);
+		SHIFTIN_DELAY();
+
+		for (byte i = 0; i < CHANNELS; i++) {
+			raw[i] = (raw[i] << 1) | ((levels >> i) & 1);
+		}
+	}
+
+	// Set the channel and the gain factor for the next reading using the clock pin.
+	for (unsigned int i = 0; i < GAIN; i++) {
+		gpio->write(PD_SCK, HIGH);
+		#if ARCH_ESPRESSIF
+		gpio->delay_us(1);
+		#endif
+		gpio->write(PD_SCK, LOW);
+		#if ARCH_ESPRESSIF
+		gpio->delay_us(1);
+		#endif
+	}
+
+	#if IS_FREE_RTOS
+	portEXIT_CRITICAL(&mux);
+
+	#elif HAS_ATOMIC_BLOCK
+	}
+
+	#else
+	interrupts();
+	#endif
+
+	for (byte i = 0; i < CHANNELS; i++) {
+		// Sign-extend the 24-bit two's complement value, whatever the width of long.
+		if (raw[i] & 0x800000UL) {
+			values[i] = static_cast<long>(raw[i]) - 0x1000000L;
+		} else {
+			values[i] = static_cast<long>(raw[i]);
+		}
+	}
+}
+
+void HX711Array::read_average(long* values, byte times) {
+	long sample[HX711_ARRAY_MAX_CHANNELS];
+	long sum[HX711_ARRAY_MAX_CHANNELS] = { 0 };
+
+	for (byte t = 0; t < times; t++) {
+		read(sample);
+		for (byte i = 0; i < CHANNELS; i++) {
+			sum[i] += sample[i];
+		}
+		// Probably will do no harm on AVR but will feed the Watchdog Timer (WDT) on ESP.
+		// https://github.com/bogde/HX711/issues/73
+		delay(0);
+	}
+	for (byte i = 0; i < CHANNELS; i++) {
+		values[i] = sum[i] / times;
+	}
+}
+
+void HX711Array::get_units(float* units, byte times) {
+	long values[HX711_ARRAY_MAX_CHANNELS];
+
+	read_average(values, times);
+	for (byte i = 0; i < CHANNELS; i++) {
+		units[i] = (values[i] - OFFSET[i]) / SCALE[i];
+	}
+}
+
+void HX711Array::tare(byte times) {
+	read_average(OFFSET, times);
+}
+
+void HX711Array::set_scale(byte channel, float scale) {
+	SCALE[channel] = scale;
+}
+
+float HX711Array::get_scale(byte channel) {
+	return SCALE[channel];
+}
+
+void HX711Array::set_offset(byte channel, long offset) {
+	OFFSET[channel] = offset;
+}
+
+long HX711Array::get_offset(byte channel) {
+	return OFFSET[channel];
+}
+
+void HX711Array::power_down() {
+	gpio->write(PD_SCK, LOW);
+	gpio->write(PD_SCK, HIGH);
+}
+
+void HX711Array::power_up() {
+	gpio->write(PD_SCK, LOW);
+}
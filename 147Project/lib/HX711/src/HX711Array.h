@@ -0,0 +1,88 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#ifndef HX711Array_h
+#define HX711Array_h
+
+#if ARDUINO >= 100
+#include "Arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "HX711Gpio.h"
+
+// Largest number of HX711 chips sharing one clock line.
+#ifndef HX711_ARRAY_MAX_CHANNELS
+#define HX711_ARRAY_MAX_CHANNELS 4
+#endif
+
+// Several HX711 chips wired to one PD_SCK pin, each with its own DOUT pin.
+// One clock train reads all of them: every bit is sampled from all DOUT pins
+// with a single port read, so the channels of a reading belong to the same
+// conversion and the critical section is as long as for a single chip.
+// All arrays passed in and out hold one entry per channel.
+class HX711Array
+{
+	private:
+		byte PD_SCK;	// Shared Power Down and Serial Clock Input Pin
+		byte DOUT[HX711_ARRAY_MAX_CHANNELS];	// Serial Data Output Pin of every chip
+		byte CHANNELS = 0;	// number of chips
+		byte GAIN;		// amplification factor, the same for all chips
+		long OFFSET[HX711_ARRAY_MAX_CHANNELS];	// used for tare weight
+		float SCALE[HX711_ARRAY_MAX_CHANNELS];	// used to return weight in grams, kg, ounces, whatever
+		HX711Gpio* gpio = &HX711Gpio::arduino();
+
+	public:
+
+		HX711Array();
+
+		// Initialize library with the data output pins, the shared clock input pin and gain factor.
+		// Returns false if more than HX711_ARRAY_MAX_CHANNELS pins are given.
+		bool begin(const byte* dout, byte channels, byte pd_sck, byte gain = 128, HX711Gpio& gpio = HX711Gpio::arduino());
+
+		// number of chips
+		byte channels();
+
+		// Check if all chips are ready
+		bool is_ready();
+
+		// Wait for all chips to become ready
+		void wait_ready(unsigned long delay_ms = 0);
+		bool wait_ready_timeout(unsigned long timeout = 1000, unsigned long delay_ms = 0);
+
+		// set the gain factor of all chips; takes effect only after a call to read()
+		void set_gain(byte gain = 128);
+
+		// waits for all chips to be ready and reads one conversion of every chip into values
+		void read(long* values);
+
+		// average of times conversions of every chip
+		void read_average(long* values, byte times = 10);
+
+		// (read_average() - OFFSET) / SCALE of every chip
+		void get_units(float* units, byte times = 1);
+
+		// set the OFFSET of every chip to its current reading
+		void tare(byte times = 10);
+
+		void set_scale(byte channel, float scale = 1.f);
+		float get_scale(byte channel);
+
+		void set_offset(byte channel, long offset = 0);
+		long get_offset(byte channel);
+
+		// puts all chips into power down mode
+		void power_down();
+
+		// wakes up all chips after power down mode
+		void power_up();
+};
+
+#endif /* HX711Array_h */
@@ -0,0 +1,23 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#include <Arduino.h>
+#include "HX711Fast.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+portMUX_TYPE HX711RegisterPort::mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+unsigned long HX711RecordingPort::data = 0;
+bool HX711RecordingPort::ready = false;
+byte HX711RecordingPort::pulses = 0;
+byte HX711RecordingPort::locks = 0;
+uint16_t* HX711RecordingPort::log = NULL;
+uint16_t HX711RecordingPort::log_capacity = 0;
+uint16_t HX711RecordingPort::log_length = 0;
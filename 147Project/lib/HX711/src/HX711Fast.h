@@ -0,0 +1,270 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#ifndef HX711Fast_h
+#define HX711Fast_h
+
+#if ARDUINO >= 100
+#include "Arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include "soc/gpio_reg.h"
+#endif
+
+// A port access policy provides the static functions used by HX711Fast:
+//   output(pin), input(pin)   configure a pin
+//   high(pin), low(pin)       drive the clock pin
+//   read(pin)                 sample the data pin, 0 or 1
+//   settle()                  wait out the datasheet minimum of 0.2 us between clock edges
+//   lock(), unlock()          enter and leave the critical section around the clock train
+// The pin numbers are compile-time constants, so a policy can resolve
+// registers and masks at compile time.
+
+// Portable policy built on the Arduino core; as slow as HX711::read().
+struct HX711ArduinoPort
+{
+	static void output(byte pin) { pinMode(pin, OUTPUT); }
+	#if defined(ARDUINO_ARCH_ESP8266)
+	static void input(byte pin) { pinMode(pin, INPUT); }
+	#else
+	static void input(byte pin) { pinMode(pin, INPUT_PULLUP); }
+	#endif
+	static void high(byte pin) { digitalWrite(pin, HIGH); }
+	static void low(byte pin) { digitalWrite(pin, LOW); }
+	static byte read(byte pin) { return digitalRead(pin) == HIGH; }
+	static void settle() { delayMicroseconds(1); }
+	static void lock() { noInterrupts(); }
+	static void unlock() { interrupts(); }
+};
+
+#if defined(ARDUINO_ARCH_ESP32)
+// CPU cycles of 0.2 us at the fastest ESP32 clock (240 MHz).
+#ifndef HX711_FAST_SETTLE_CYCLES
+#define HX711_FAST_SETTLE_CYCLES 48
+#endif
+
+// Writes the ESP32 set/clear registers directly. A clock pulse costs a few
+// dozen cycles instead of two digitalWrite() calls and two 1 us delays.
+struct HX711RegisterPort
+{
+	static portMUX_TYPE mux;
+
+	static void output(byte pin) { pinMode(pin, OUTPUT); }
+	static void input(byte pin) { pinMode(pin, INPUT); }
+
+	static inline __attribute__((always_inline)) void high(byte pin) {
+		if (pin < 32) {
+			REG_WRITE(GPIO_OUT_W1TS_REG, 1UL << pin);
+		} else {
+			REG_WRITE(GPIO_OUT1_W1TS_REG, 1UL << (pin - 32));
+		}
+	}
+
+	static inline __attribute__((always_inline)) void low(byte pin) {
+		if (pin < 32) {
+			REG_WRITE(GPIO_OUT_W1TC_REG, 1UL << pin);
+		} else {
+			REG_WRITE(GPIO_OUT1_W1TC_REG, 1UL << (pin - 32));
+		}
+	}
+
+	static inline __attribute__((always_inline)) byte read(byte pin) {
+		if (pin < 32) {
+			return (REG_READ(GPIO_IN_REG) >> pin) & 1;
+		}
+		return (REG_READ(GPIO_IN1_REG) >> (pin - 32)) & 1;
+	}
+
+	static inline __attribute__((always_inline)) void settle() {
+		uint32_t start = ESP.getCycleCount();
+		while (ESP.getCycleCount() - start < HX711_FAST_SETTLE_CYCLES) {
+		}
+	}
+
+	static void lock() { portENTER_CRITICAL(&mux); }
+	static void unlock() { portEXIT_CRITICAL(&mux); }
+};
+
+typedef HX711RegisterPort HX711DefaultPort;
+#else
+typedef HX711ArduinoPort HX711DefaultPort;
+#endif
+
+// Records the clock train and replays one conversion on the data pin, for
+// checking HX711Fast on the host. load() arms the next conversion, which pulls
+// the data pin low; the 25th clock pulse sets it high again until the next
+// load(). Every write is appended to the log given to record() as
+// (pin << 1) | level.
+struct HX711RecordingPort
+{
+	static unsigned long data;		// 24-bit conversion shifted out on the data pin
+	static bool ready;
+	static byte pulses;				// rising clock edges since load()
+	static byte locks;				// critical sections entered and not left
+	static uint16_t* log;
+	static uint16_t log_capacity;
+	static uint16_t log_length;
+
+	static void load(long value) {
+		data = static_cast<unsigned long>(value) & 0xFFFFFFUL;
+		ready = true;
+		pulses = 0;
+	}
+
+	static void record(uint16_t* buffer, uint16_t capacity) {
+		log = buffer;
+		log_capacity = capacity;
+		log_length = 0;
+	}
+
+	static void output(byte) {}
+	static void input(byte) {}
+
+	static void write(byte pin, byte level) {
+		if (log && log_length < log_capacity) {
+			log[log_length++] = (pin << 1) | level;
+		}
+	}
+
+	static void high(byte pin) {
+		write(pin, 1);
+		if (++pulses > 24) {
+			ready = false;
+		}
+	}
+
+	static void low(byte pin) {
+		write(pin, 0);
+	}
+
+	static byte read(byte) {
+		if (!ready) {
+			return 1;
+		}
+		if (pulses == 0) {
+			return 0;
+		}
+		return (data >> (24 - pulses)) & 1;
+	}
+
+	static void settle() {}
+	static void lock() { locks++; }
+	static void unlock() { locks--; }
+};
+
+// HX711 driver with pins and gain fixed at compile time.
+// All pin access is inlined through Port, so the clock train compiles down to
+// straight register writes and the critical section lasts only as long as the
+// datasheet timing requires.
+template <byte DOUT, byte PD_SCK, byte GAIN = 128, class Port = HX711DefaultPort>
+class HX711Fast
+{
+	private:
+		// Number of extra clock pulses selecting channel and gain of the next conversion.
+		static const byte GAIN_PULSES = GAIN == 128 ? 1 : GAIN == 64 ? 3 : 2;
+
+		long OFFSET = 0;	// used for tare weight
+		float SCALE = 1;	// used to return weight in grams, kg, ounces, whatever
+
+	public:
+
+		void begin() {
+			Port::output(PD_SCK);
+			Port::input(DOUT);
+			Port::low(PD_SCK);
+		}
+
+		bool is_ready() {
+			return Port::read(DOUT) == 0;
+		}
+
+		// clock out a conversion; the chip must be ready
+		long read_conversion() {
+			unsigned long value = 0;
+
+			Port::lock();
+			for (byte i = 0; i < 24; i++) {
+				Port::high(PD_SCK);
+				Port::settle();
+				value = (value << 1) | Port::read(DOUT);
+				Port::low(PD_SCK);
+				Port::settle();
+			}
+			for (byte i = 0; i < GAIN_PULSES; i++) {
+				Port::high(PD_SCK);
+				Port::settle();
+				Port::low(PD_SCK);
+				Port::settle();
+			}
+			Port::unlock();
+
+			// Sign-extend the 24-bit two's complement value, whatever the width of long.
+			if (value & 0x800000UL) {
+				return static_cast<long>(value) - 0x1000000L;
+			}
+			return static_cast<long>(value);
+		}
+
+		// waits for the chip to be ready and returns a reading
+		long read() {
+			while (!is_ready()) {
+				// Feed the Watchdog Timer (WDT) on ESP.
+				delay(0);
+			}
+			return read_conversion();
+		}
+
+		// non-blocking read: stores a reading in value and returns true if one was ready
+		bool try_read(long& value) {
+			if (!is_ready()) {
+				return false;
+			}
+			value = read_conversion();
+			return true;
+		}
+
+		long read_average(byte times = 10) {
+			long sum = 0;
+			for (byte i = 0; i < times; i++) {
+				sum += read();
+			}
+			return sum / times;
+		}
+
+		double get_value(byte times = 1) {
+			return read_average(times) - OFFSET;
+		}
+
+		float get_units(byte times = 1) {
+			return get_value(times) / SCALE;
+		}
+
+		void tare(byte times = 10) {
+			OFFSET = read_average(times);
+		}
+
+		void set_scale(float scale = 1.f) { SCALE = scale; }
+		float get_scale() { return SCALE; }
+		void set_offset(long offset = 0) { OFFSET = offset; }
+		long get_offset() { return OFFSET; }
+
+		void power_down() {
+			Port::low(PD_SCK);
+			Port::high(PD_SCK);
+		}
+
+		void power_up() {
+			Port::low(PD_SCK);
+		}
+};
+
+#endif /* HX711Fast_h */
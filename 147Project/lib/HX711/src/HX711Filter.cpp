@@ -0,0 +1,66 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#include "HX711Filter.h"
+
+// Round a fixed point value back to raw counts.
+static long to_counts(int64_t value) {
+	return static_cast<long>((value + (1 << (HX711_FILTER_FRAC_BITS - 1))) >> HX711_FILTER_FRAC_BITS);
+}
+
+IirFilter::IirFilter(uint8_t shift) : shift(shift) {
+	reset();
+}
+
+void IirFilter::reset() {
+	state = 0;
+	primed = false;
+}
+
+long IirFilter::update(long sample) {
+	int64_t input = static_cast<int64_t>(sample) << HX711_FILTER_FRAC_BITS;
+	if (!primed) {
+		// Start at the first sample instead of ramping up from zero.
+		state = input;
+		primed = true;
+	} else {
+		state += (input - state) >> shift;
+	}
+	return to_counts(state);
+}
+
+KalmanFilter::KalmanFilter(uint32_t process_noise, uint32_t measurement_noise)
+	: process_noise(process_noise), measurement_noise(measurement_noise) {
+	reset();
+}
+
+void KalmanFilter::reset() {
+	estimate = 0;
+	error = measurement_noise;
+	primed = false;
+}
+
+long KalmanFilter::update(long sample) {
+	int64_t input = static_cast<int64_t>(sample) << HX711_FILTER_FRAC_BITS;
+	if (!primed) {
+		estimate = input;
+		primed = true;
+		return sample;
+	}
+
+	// Predict: the weight is assumed constant, only the uncertainty grows.
+	error += process_noise;
+
+	// Update with the gain as a 16 bit fraction.
+	uint32_t gain = static_cast<uint32_t>((static_cast<uint64_t>(error) << 16) / (static_cast<uint64_t>(error) + measurement_noise));
+	estimate += ((input - estimate) * gain) >> 16;
+	error = static_cast<uint32_t>((static_cast<uint64_t>(error) * (65536 - gain)) >> 16);
+
+	return to_counts(estimate);
+}
@@ -0,0 +1,183 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#ifndef HX711Filter_h
+#define HX711Filter_h
+
+#include <stdint.h>
+
+// Fractional bits kept by the IIR and Kalman stages on top of the raw counts.
+#define HX711_FILTER_FRAC_BITS 8
+
+// A stage of the streaming filter attached to an HX711 with set_filter().
+// Every stage updates in constant time per conversion and keeps all of its
+// state inline, so a pipeline never allocates. Stages are chained with then():
+//
+//   MedianFilter<5> median;
+//   IirFilter smooth(3);
+//   median.then(smooth);
+//   scale.set_filter(&median);
+class HX711Filter
+{
+	private:
+		HX711Filter* next = 0;
+
+	protected:
+		// Feed one sample and return the output of this stage.
+		virtual long update(long sample) = 0;
+
+	public:
+
+		virtual ~HX711Filter() {}
+
+		// Forget all history.
+		virtual void reset() = 0;
+
+		// Append a stage after this one; returns that stage so calls can be chained.
+		HX711Filter& then(HX711Filter& stage) {
+			next = &stage;
+			return stage;
+		}
+
+		// Run a sample through this stage and all stages after it.
+		long apply(long sample) {
+			long value = update(sample);
+			return next ? next->apply(value) : value;
+		}
+
+		// Reset this stage and all stages after it.
+		void reset_all() {
+			reset();
+			if (next) {
+				next->reset_all();
+			}
+		}
+};
+
+// Mean of the last N samples, kept as a running sum.
+template <uint8_t N>
+class MovingAverageFilter : public HX711Filter
+{
+	private:
+		long window[N];
+		long sum;
+		uint8_t pos;
+		uint8_t count;
+
+	protected:
+		long update(long sample) {
+			if (count == N) {
+				sum -= window[pos];
+			} else {
+				count++;
+			}
+			window[pos] = sample;
+			sum += sample;
+			pos = (pos + 1) % N;
+			return sum / count;
+		}
+
+	public:
+		MovingAverageFilter() {
+			reset();
+		}
+
+		void reset() {
+			sum = 0;
+			pos = 0;
+			count = 0;
+		}
+};
+
+// Median of the last N samples; rejects single conversion spikes.
+// The window is kept sorted, so each update moves at most N entries.
+template <uint8_t N>
+class MedianFilter : public HX711Filter
+{
+	private:
+		long window[N];		// samples in arrival order
+		long sorted[N];
+		uint8_t pos;
+		uint8_t count;
+
+	protected:
+		long update(long sample) {
+			uint8_t i;
+			if (count == N) {
+				// Drop the oldest sample from the sorted copy.
+				long oldest = window[pos];
+				for (i = 0; sorted[i] != oldest; i++) {
+				}
+				for (; i + 1 < count; i++) {
+					sorted[i] = sorted[i + 1];
+				}
+				count--;
+			}
+			window[pos] = sample;
+			pos = (pos + 1) % N;
+
+			for (i = count; i > 0 && sorted[i - 1] > sample; i--) {
+				sorted[i] = sorted[i - 1];
+			}
+			sorted[i] = sample;
+			count++;
+			return sorted[count / 2];
+		}
+
+	public:
+		MedianFilter() {
+			reset();
+		}
+
+		void reset() {
+			pos = 0;
+			count = 0;
+		}
+};
+
+// First order low pass: y += (x - y) / 2^shift.
+// The state carries HX711_FILTER_FRAC_BITS extra bits so small steps are not lost.
+class IirFilter : public HX711Filter
+{
+	private:
+		int64_t state;
+		uint8_t shift;
+		bool primed;
+
+	protected:
+		long update(long sample);
+
+	public:
+		IirFilter(uint8_t shift = 3);
+
+		void reset();
+};
+
+// Scalar Kalman filter for a weight which is constant between load changes.
+// process_noise and measurement_noise are variances in raw counts squared;
+// a larger measurement_noise trusts new conversions less.
+class KalmanFilter : public HX711Filter
+{
+	private:
+		int64_t estimate;		// fixed point, HX711_FILTER_FRAC_BITS
+		uint32_t error;			// estimate variance in raw counts squared
+		uint32_t process_noise;
+		uint32_t measurement_noise;
+		bool primed;
+
+	protected:
+		long update(long sample);
+
+	public:
+		KalmanFilter(uint32_t process_noise = 4, uint32_t measurement_noise = 400);
+
+		void reset();
+};
+
+#endif /* HX711Filter_h */
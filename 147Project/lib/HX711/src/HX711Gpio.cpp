@@ -0,0 +1,106 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#include <Arduino.h>
+#include "HX711Gpio.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include "soc/gpio_reg.h"
+#endif
+
+#if !defined(ARDUINO_ARCH_ESP32)
+// Cores without attachInterruptArg() only deliver plain function pointers,
+// so a single falling-edge handler is supported there.
+static void (*edge_handler)(void*) = NULL;
+static void* edge_arg = NULL;
+
+static void edge_trampoline() {
+	if (edge_handler) {
+		edge_handler(edge_arg);
+	}
+}
+#endif
+
+uint32_t HX711Gpio::read_pins(const byte* pins, byte count) {
+	uint32_t levels = 0;
+	for (byte i = 0; i < count; i++) {
+		if (read(pins[i]) == HIGH) {
+			levels |= 1UL << i;
+		}
+	}
+	return levels;
+}
+
+class ArduinoGpio : public HX711Gpio
+{
+	public:
+
+		void pin_mode(byte pin, byte mode) {
+			pinMode(pin, mode);
+		}
+
+		void write(byte pin, byte level) {
+			digitalWrite(pin, level);
+		}
+
+		int read(byte pin) {
+			return digitalRead(pin);
+		}
+
+		#if defined(ARDUINO_ARCH_ESP32)
+		uint32_t read_pins(const byte* pins, byte count) {
+			// GPIO 0-31 and 32-39 each live in one input register.
+			uint32_t in = REG_READ(GPIO_IN_REG);
+			uint32_t in1 = REG_READ(GPIO_IN1_REG);
+			uint32_t levels = 0;
+			for (byte i = 0; i < count; i++) {
+				uint32_t level = pins[i] < 32 ? in >> pins[i] : in1 >> (pins[i] - 32);
+				levels |= (level & 1) << i;
+			}
+			return levels;
+		}
+		#endif
+
+		void delay_us(unsigned int us) {
+			delayMicroseconds(us);
+		}
+
+		bool attach_falling(byte pin, void (*handler)(void*), void* arg) {
+			#if defined(ARDUINO_ARCH_ESP32)
+			attachInterruptArg(digitalPinToInterrupt(pin), handler, arg, FALLING);
+			return true;
+			#else
+			if (edge_handler != NULL) {
+				return false;
+			}
+			#ifdef NOT_AN_INTERRUPT
+			if (digitalPinToInterrupt(pin) == NOT_AN_INTERRUPT) {
+				return false;
+			}
+			#endif
+			edge_handler = handler;
+			edge_arg = arg;
+			attachInterrupt(digitalPinToInterrupt(pin), edge_trampoline, FALLING);
+			return true;
+			#endif
+		}
+
+		void detach(byte pin) {
+			detachInterrupt(digitalPinToInterrupt(pin));
+			#if !defined(ARDUINO_ARCH_ESP32)
+			edge_handler = NULL;
+			edge_arg = NULL;
+			#endif
+		}
+};
+
+HX711Gpio& HX711Gpio::arduino() {
+	static ArduinoGpio gpio;
+	return gpio;
+}
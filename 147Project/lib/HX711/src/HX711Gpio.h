@@ -0,0 +1,50 @@
+/**
+ *
+ * HX711 library for Arduino
+ * https://github.com/bogde/HX711
+ *
+ * MIT License
+ * (c) 2018 Bogdan Necula
+ *
+**/
+#ifndef HX711Gpio_h
+#define HX711Gpio_h
+
+#if ARDUINO >= 100
+#include "Arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+// Pin access used by the HX711 driver.
+// The default implementation forwards to the Arduino core; a host build can
+// provide its own implementation to replay a simulated HX711 waveform.
+class HX711Gpio
+{
+	public:
+
+		virtual ~HX711Gpio() {}
+
+		virtual void pin_mode(byte pin, byte mode) = 0;
+
+		virtual void write(byte pin, byte level) = 0;
+
+		virtual int read(byte pin) = 0;
+
+		// Sample several pins at the same instant; bit i of the result is the level of pins[i].
+		// The default reads the pins one after another.
+		virtual uint32_t read_pins(const byte* pins, byte count);
+
+		virtual void delay_us(unsigned int us) = 0;
+
+		// Call handler(arg) on every falling edge of pin.
+		// Returns false if the platform cannot deliver pin interrupts.
+		virtual bool attach_falling(byte pin, void (*handler)(void*), void* arg) = 0;
+
+		virtual void detach(byte pin) = 0;
+
+		// The GPIO implementation backed by the Arduino core.
+		static HX711Gpio& arduino();
+};
+
+#endif /* HX711Gpio_h */
@@ -0,0 +1,115 @@
+#include "HeapProfile.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
+
+#if defined(GB_DEBUG_ALLOC) && defined(GB_PROFILE_ALLOC)
+#define HEAP_PROFILER 1
+#else
+#define HEAP_PROFILER 0
+#endif
+
+//appends to a JSON text, remembering if anything did not fit instead of checking every call
+struct JsonText
+{
+  char* buffer;
+  size_t capacity;
+  size_t used;
+  bool overflow;
+
+  void append(const char* format, ...)
+  {
+    va_list args;
+    va_start(args, format);
+    int written = overflow ? -1 : vsnprintf(buffer + used, capacity - used, format, args);
+    va_end(args);
+    if (written < 0 || (size_t)written >= capacity - used)
+    {
+      overflow = true;
+    }
+    else
+    {
+      used += written;
+    }
+  }
+};
+
+static const char* BaseName(const char* path)
+{
+  const char* slash = strrchr(path, '/');
+  return slash != NULL ? slash + 1 : path;
+}
+
+HeapProfile::HeapProfile() : running(false), lastMs(0)
+{
+  memset(lastAllocations, 0, sizeof(lastAllocations));
+  memset(lastBytes, 0, sizeof(lastBytes));
+}
+
+bool HeapProfile::begin()
+{
+#if HEAP_PROFILER
+  if (!running && gballoc_init() == 0)
+  {
+    gballoc_setProfiling(1);
+    running = true;
+  }
+#endif
+  return running;
+}
+
+size_t HeapProfile::snapshot(unsigned long nowMs, char* buffer, size_t capacity)
+{
+  if (!running || buffer == NULL || capacity == 0)
+  {
+    return 0;
+  }
+
+  JsonText json = { buffer, capacity, 0, false };
+  json.append("{\"heapProfile\":{\"ms\":%lu", nowMs - lastMs);
+  lastMs = nowMs;
+#if HEAP_PROFILER
+  GBALLOC_PROFILE_STATISTICS statistics;
+  for (int subsystem = 0; subsystem < GBALLOC_SUBSYSTEM_COUNT; subsystem++)
+  {
+    if (gballoc_getSubsystemStatistics((GBALLOC_SUBSYSTEM)subsystem, &statistics) == 0)
+    {
+      json.append(",\"%s\":{\"live\":%u,\"peak\":%u,\"allocs\":%u,\"bytes\":%u}", statistics.name,
+                  (unsigned)statistics.liveBytes, (unsigned)statistics.peakBytes,
+                  (unsigned)(statistics.allocations - lastAllocations[subsystem]),
+                  (unsigned)(statistics.bytesAllocated - lastBytes[subsystem]));
+      lastAllocations[subsystem] = statistics.allocations;
+      lastBytes[subsystem] = statistics.bytesAllocated;
+    }
+  }
+
+  //the call sites holding the most, largest first
+  GBALLOC_PROFILE_STATISTICS top[HEAP_PROFILE_TOP_SITES];
+  int count = 0;
+  for (size_t index = 0; gballoc_getCallSiteStatistics(index, &statistics) == 0; index++)
+  {
+    int at = count < HEAP_PROFILE_TOP_SITES ? count++ : HEAP_PROFILE_TOP_SITES;
+    while (at > 0 && top[at - 1].liveBytes < statistics.liveBytes)
+    {
+      if (at < HEAP_PROFILE_TOP_SITES)
+      {
+        top[at] = top[at - 1];
+      }
+      at--;
+    }
+    if (at < HEAP_PROFILE_TOP_SITES)
+    {
+      top[at] = statistics;
+    }
+  }
+  json.append(",\"top\":{");
+  for (int i = 0; i < count; i++)
+  {
+    json.append("%s\"%s:%d\":%u", i > 0 ? "," : "", BaseName(top[i].name), top[i].line, (unsigned)top[i].liveBytes);
+  }
+  json.append("}");
+#endif
+  json.append("}}");
+  return json.overflow ? 0 : json.used;
+}
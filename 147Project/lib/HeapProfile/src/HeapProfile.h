@@ -0,0 +1,33 @@
+#ifndef HEAP_PROFILE_H
+#define HEAP_PROFILE_H
+
+#include <stddef.h>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc_profile.h"
+
+#define HEAP_PROFILE_TOP_SITES 5       //call sites listed in a snapshot, those with the most live bytes
+
+//Where the heap goes, from gballoc's profiler: live and peak bytes and allocations per subsystem (umqtt, transport,
+//tlsio, client, utility, app) plus the call sites holding the most, as JSON for a direct method or a reported twin
+//property. The profiler is only there in builds with GB_DEBUG_ALLOC, GB_MEASURE_MEMORY_FOR_THIS and GB_PROFILE_ALLOC;
+//it then tracks every SDK allocation in gballoc's table, which costs a lock and a hash lookup per call.
+class HeapProfile
+{
+public:
+  HeapProfile();
+
+  //start gballoc and its profiler; call before the IoT Hub client allocates anything. false without the profiler
+  bool begin();
+
+  //{"heapProfile":{"ms":..,"umqtt":{"live":..,"peak":..,"allocs":..,"bytes":..},...,"top":{"mqtt_client.c:123":..,...}}}
+  //allocs and bytes count since the previous snapshot, ms long, so they are the rate; top has the live bytes.
+  //Returns the length written, NUL terminated, or 0 if it does not fit or there is no profiler
+  size_t snapshot(unsigned long nowMs, char* buffer, size_t capacity);
+
+private:
+  bool running;
+  unsigned long lastMs;
+  size_t lastAllocations[GBALLOC_SUBSYSTEM_COUNT];
+  size_t lastBytes[GBALLOC_SUBSYSTEM_COUNT];
+};
+
+#endif /* HEAP_PROFILE_H */
@@ -0,0 +1,120 @@
+#include "Mailbox.h"
+
+Mailbox::Mailbox(const MailboxConfig& config)
+  : config(config), current(MAILBOX_CLOSED), open(false), started(false),
+    baseline(0), candidate(0), candidateSince(0), lastEvent(0)
+{
+}
+
+MailboxEvent Mailbox::update(unsigned long now, int light, float weight)
+{
+  if (!started)                   //the first readings only set the starting point
+  {
+    started = true;
+    open = light > config.lightOpen;
+    current = open ? MAILBOX_OPEN : MAILBOX_CLOSED;
+    baseline = candidate = weight;
+    candidateSince = now;
+    lastEvent = now;
+    return MAILBOX_NO_EVENT;
+  }
+
+  //hysteresis: the door only flips state once the light crosses the threshold on the far side
+  if (!open && light > config.lightOpen)
+  {
+    open = true;
+    current = MAILBOX_OPEN;
+    return emit(now, MAILBOX_EVENT_OPENED);
+  }
+  if (open && light < config.lightClosed)
+  {
+    open = false;
+    candidate = weight;           //the weight is only judged once it has settled after closing
+    candidateSince = now;
+  }
+
+  if (!open)
+  {
+    float drift = weight - candidate;
+    if (drift > config.weightDelta || drift < -config.weightDelta)
+    {
+      candidate = weight;         //still moving, start settling again
+      candidateSince = now;
+    }
+    else if (now - candidateSince >= config.settleMs)
+    {
+      float change = candidate - baseline;   //a change while closed means mail came in through the slot
+      if (change > config.weightDelta)
+      {
+        baseline = candidate;
+        current = MAILBOX_MAIL_DELIVERED;
+        return emit(now, MAILBOX_EVENT_DELIVERED);
+      }
+      if (change < -config.weightDelta)
+      {
+        baseline = candidate;
+        current = MAILBOX_MAIL_COLLECTED;
+        return emit(now, MAILBOX_EVENT_COLLECTED);
+      }
+      if (current == MAILBOX_OPEN)
+      {
+        baseline = candidate;
+        current = MAILBOX_CLOSED;
+        return emit(now, MAILBOX_EVENT_CLOSED);
+      }
+    }
+  }
+
+  if (now - lastEvent >= config.heartbeatMs)
+  {
+    return emit(now, MAILBOX_EVENT_HEARTBEAT);
+  }
+  return MAILBOX_NO_EVENT;
+}
+
+MailboxEvent Mailbox::emit(unsigned long now, MailboxEvent event)
+{
+  lastEvent = now;
+  return event;
+}
+
+MailboxState Mailbox::state() const
+{
+  return current;
+}
+
+bool Mailbox::doorOpen() const
+{
+  return open;
+}
+
+float Mailbox::weight() const
+{
+  return baseline;
+}
+
+const char* Mailbox::stateName(MailboxState state)
+{
+  switch (state)
+  {
+    case MAILBOX_CLOSED: return "closed";
+    case MAILBOX_OPEN: return "open";
+    case MAILBOX_MAIL_DELIVERED: return "mailDelivered";
+    case MAILBOX_MAIL_COLLECTED: return "mailCollected";
+  }
+  return "unknown";
+}
+
+const char* Mailbox::eventName(MailboxEvent event)
+{
+  switch (event)
+  {
+    case MAILBOX_NO_EVENT: return "none";
+    case MAILBOX_EVENT_OPENED: return "opened";
+    case MAILBOX_EVENT_CLOSED: return "closed";
+    case MAILBOX_EVENT_DELIVERED: return "delivered";
+    case MAILBOX_EVENT_COLLECTED: return "collected";
+    case MAILBOX_EVENT_HEARTBEAT: return "heartbeat";
+  }
+  return "unknown";
+}
@@ -0,0 +1,63 @@
+#ifndef MAILBOX_H           //inclusion guard, only define this stuff one time
+#define MAILBOX_H
+
+//State engine for the smart post. It is fed raw sensor readings and decides when something happened
+//that is worth telling Azure IoT Hub about. It has no Arduino dependencies, so recorded sensor traces
+//can be replayed through it on a PC.
+
+enum MailboxState
+{
+  MAILBOX_CLOSED,           //door closed, weight unchanged since the last check
+  MAILBOX_OPEN,             //door open, weight is not trusted while someone is reaching in
+  MAILBOX_MAIL_DELIVERED,   //door closed, weight went up
+  MAILBOX_MAIL_COLLECTED    //door closed, weight went down
+};
+
+enum MailboxEvent
+{
+  MAILBOX_NO_EVENT,
+  MAILBOX_EVENT_OPENED,
+  MAILBOX_EVENT_CLOSED,     //closed again without a weight change
+  MAILBOX_EVENT_DELIVERED,
+  MAILBOX_EVENT_COLLECTED,
+  MAILBOX_EVENT_HEARTBEAT   //nothing changed for heartbeatMs, report anyway so the cloud knows we are alive
+};
+
+struct MailboxConfig
+{
+  int lightOpen;                  //light reading above which the door counts as open
+  int lightClosed;                //light reading below which the door counts as closed again, lower than lightOpen
+  float weightDelta;              //smallest weight change (in scale units) that counts as mail
+  unsigned long settleMs;         //how long the weight has to stay put before it is compared
+  unsigned long heartbeatMs;      //longest time without any event
+};
+
+class Mailbox
+{
+public:
+  Mailbox(const MailboxConfig& config);
+
+  //feed one set of readings taken at time now (in ms); returns what happened, if anything
+  MailboxEvent update(unsigned long now, int light, float weight);
+
+  MailboxState state() const;
+  bool doorOpen() const;
+  float weight() const;           //last settled weight
+
+  static const char* stateName(MailboxState state);
+  static const char* eventName(MailboxEvent event);
+
+private:
+  MailboxConfig config;
+  MailboxState current;
+  bool open;
+  bool started;
+  float baseline;                 //settled weight the next change is compared against
+  float candidate;                //weight that is currently settling
+  unsigned long candidateSince;
+  unsigned long lastEvent;
+
+  MailboxEvent emit(unsigned long now, MailboxEvent event);
+};
+
+#endif /* MAILBOX_H */
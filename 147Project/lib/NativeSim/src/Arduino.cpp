@@ -0,0 +1,251 @@
+#include "Arduino.h"
+#include "SimBoard.h"
+#include <stdarg.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+typedef std::chrono::steady_clock Clock;
+
+static const Clock::time_point startTime = Clock::now();
+
+//held by noInterrupts() and by a device running an interrupt handler, so the two never overlap
+static std::recursive_mutex interruptLock;
+
+struct SimPin
+{
+  SimPinDevice* device;
+  std::atomic<uint8_t> level;     //last level written, read back when no device drives the pin
+  std::atomic<uint16_t> analog;
+  void (*handler)(void*);         //guarded by interruptLock
+  void (*plainHandler)(void);
+  void* arg;
+  int mode;
+};
+
+static SimPin pins[SIM_PIN_COUNT];
+
+static void CallPlainHandler(void* arg)
+{
+  ((void (*)(void))arg)();
+}
+
+unsigned long millis()
+{
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startTime).count();
+}
+
+unsigned long micros()
+{
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime).count();
+}
+
+void delay(unsigned long ms)
+{
+  if (ms == 0)
+  {
+    std::this_thread::yield();
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  //spins like the core does; sleeping for a microsecond costs the host far longer than that
+  Clock::time_point until = Clock::now() + std::chrono::microseconds(us);
+  while (Clock::now() < until)
+  {
+  }
+}
+
+void yield()
+{
+  std::this_thread::yield();
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  if (pin < SIM_PIN_COUNT && mode == INPUT_PULLUP && pins[pin].device == NULL)
+  {
+    pins[pin].level = HIGH;
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+  if (pin >= SIM_PIN_COUNT)
+  {
+    return;
+  }
+  pins[pin].level = level;
+  if (pins[pin].device != NULL)
+  {
+    pins[pin].device->pinWritten(pin, level);
+  }
+}
+
+int digitalRead(uint8_t pin)
+{
+  if (pin >= SIM_PIN_COUNT)
+  {
+    return LOW;
+  }
+  return pins[pin].device != NULL ? pins[pin].device->pinLevel(pin) : pins[pin].level.load();
+}
+
+uint16_t analogRead(uint8_t pin)
+{
+  return pin < SIM_PIN_COUNT ? pins[pin].analog.load() : 0;
+}
+
+void attachInterruptArg(uint8_t interrupt, void (*handler)(void*), void* arg, int mode)
+{
+  if (interrupt >= SIM_PIN_COUNT)
+  {
+    return;
+  }
+  std::lock_guard<std::recursive_mutex> lock(interruptLock);
+  pins[interrupt].handler = handler;
+  pins[interrupt].arg = arg;
+  pins[interrupt].mode = mode;
+}
+
+void attachInterrupt(uint8_t interrupt, void (*handler)(void), int mode)
+{
+  attachInterruptArg(interrupt, CallPlainHandler, (void*)handler, mode);
+}
+
+void detachInterrupt(uint8_t interrupt)
+{
+  if (interrupt >= SIM_PIN_COUNT)
+  {
+    return;
+  }
+  std::lock_guard<std::recursive_mutex> lock(interruptLock);
+  pins[interrupt].handler = NULL;
+  pins[interrupt].arg = NULL;
+}
+
+void noInterrupts()
+{
+  interruptLock.lock();
+}
+
+void interrupts()
+{
+  interruptLock.unlock();
+}
+
+void SimBoard::connect(uint8_t pin, SimPinDevice& device)
+{
+  if (pin < SIM_PIN_COUNT)
+  {
+    pins[pin].device = &device;
+  }
+}
+
+void SimBoard::setAnalog(uint8_t pin, uint16_t value)
+{
+  if (pin < SIM_PIN_COUNT)
+  {
+    pins[pin].analog = value;
+  }
+}
+
+void SimBoard::edge(uint8_t pin, uint8_t level)
+{
+  if (pin >= SIM_PIN_COUNT)
+  {
+    return;
+  }
+  std::lock_guard<std::recursive_mutex> lock(interruptLock);
+  SimPin& p = pins[pin];
+  bool matches = p.mode == CHANGE || (p.mode == FALLING && level == LOW) || (p.mode == RISING && level == HIGH);
+  if (p.handler != NULL && matches)
+  {
+    p.handler(p.arg);
+  }
+}
+
+size_t Print::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+  size_t n = 0;
+  while (n < size && write(buffer[n]) == 1)
+  {
+    n++;
+  }
+  return n;
+}
+
+size_t Print::printf(const char* format, ...)
+{
+  char text[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  if (length < 0)
+  {
+    return 0;
+  }
+  return write((const uint8_t*)text, (size_t)length < sizeof(text) ? (size_t)length : sizeof(text) - 1);
+}
+
+size_t Print::print(const char* str)
+{
+  return write(str);
+}
+
+size_t Print::print(char c)
+{
+  return write((uint8_t)c);
+}
+
+size_t Print::print(int value, int base)
+{
+  return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base)
+{
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base)
+{
+  return base == HEX ? printf("%lX", (unsigned long)value) : printf("%ld", value);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+  return base == HEX ? printf("%lX", value) : printf("%lu", value);
+}
+
+size_t Print::print(double value, int digits)
+{
+  return printf("%.*f", digits, value);
+}
+
+size_t Print::println()
+{
+  return write("\r\n");
+}
+
+void HardwareSerial::flush()
+{
+  fflush(stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size)
+{
+  return fwrite(buffer, 1, size, stdout);
+}
+
+HardwareSerial Serial;
@@ -0,0 +1,100 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+//The parts of the ESP32 Arduino core the firmware uses, on top of the C++ standard library, so the
+//sketch runs as a program on a PC. Pins are served by the simulated devices in SimBoard.h, Serial is
+//stdout, and like on the ESP32 the FreeRTOS task API comes with Arduino.h.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define DEC 10
+#define HEX 16
+
+#define IRAM_ATTR
+#define NOT_AN_INTERRUPT -1
+#define digitalPinToInterrupt(pin) ((int)(pin) < SIM_PIN_COUNT ? (int)(pin) : NOT_AN_INTERRUPT)
+
+#define SIM_PIN_COUNT 40          //GPIO 0 to 39, like the ESP32
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+//only one handler per pin, and it runs on the thread of the device that drove the edge
+void attachInterrupt(uint8_t interrupt, void (*handler)(void), int mode);
+void attachInterruptArg(uint8_t interrupt, void (*handler)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t interrupt);
+
+//hold off pin interrupts; nests, and only keeps out handlers, not other tasks
+void noInterrupts();
+void interrupts();
+
+class Print
+{
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c);
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+  size_t print(const char* str);
+  size_t print(char c);
+  size_t print(int value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC);
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(double value, int digits = 2);
+
+  size_t println();
+  template <typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+  template <typename T> size_t println(T value, int format) { size_t n = print(value, format); return n + println(); }
+};
+
+//Serial goes to stdout; stdio writes each call in one piece, but tasks printing at once may still interleave calls
+class HardwareSerial : public Print
+{
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+  void flush();
+
+  using Print::write;
+  size_t write(const uint8_t* buffer, size_t size);
+};
+
+extern HardwareSerial Serial;
+
+#endif /* ARDUINO_H */
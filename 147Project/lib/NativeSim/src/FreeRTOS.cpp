@@ -0,0 +1,133 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "Arduino.h"
+#include <pthread.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct SimTask
+{
+  TaskFunction_t function;
+  void* parameter;
+  std::mutex lock;
+  std::condition_variable notified;
+  uint32_t notifications;
+};
+
+//the task running on this thread; setup() and loop() run outside any task and get one on first use
+static thread_local SimTask* currentTask = NULL;
+
+static void RunTask(SimTask* task)
+{
+  currentTask = task;
+  task->function(task->parameter);
+  //a FreeRTOS task must not return, vTaskDelete(NULL) ends it; a returning one just ends its thread here
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth, void* parameter,
+                                   UBaseType_t priority, TaskHandle_t* created, BaseType_t core)
+{
+  (void)name;
+  (void)stackDepth;
+  (void)priority;
+  (void)core;
+  SimTask* task = new SimTask();
+  task->function = function;
+  task->parameter = parameter;
+  task->notifications = 0;
+  if (created != NULL)
+  {
+    *created = task;              //before the task runs, like on FreeRTOS where a higher priority task starts at once
+  }
+  std::thread(RunTask, task).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth, void* parameter,
+                       UBaseType_t priority, TaskHandle_t* created)
+{
+  return xTaskCreatePinnedToCore(function, name, stackDepth, parameter, priority, created, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+  if (task == NULL || task == currentTask)
+  {
+    //the task object stays, another task may still hold its handle to notify it
+    pthread_exit(NULL);
+  }
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  delay(ticks * portTICK_PERIOD_MS);
+}
+
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment)
+{
+  *previousWake += increment;
+  TickType_t now = xTaskGetTickCount();
+  if ((int32_t)(*previousWake - now) > 0)
+  {
+    vTaskDelay(*previousWake - now);
+  }
+}
+
+TickType_t xTaskGetTickCount()
+{
+  return (TickType_t)(millis() / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+  if (currentTask == NULL)
+  {
+    currentTask = new SimTask();
+    currentTask->function = NULL;
+    currentTask->parameter = NULL;
+    currentTask->notifications = 0;
+  }
+  return currentTask;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait)
+{
+  SimTask* task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->lock);
+  if (ticksToWait == portMAX_DELAY)
+  {
+    task->notified.wait(lock, [task] { return task->notifications > 0; });
+  }
+  else
+  {
+    task->notified.wait_for(lock, std::chrono::milliseconds(ticksToWait * portTICK_PERIOD_MS),
+                            [task] { return task->notifications > 0; });
+  }
+  uint32_t count = task->notifications;
+  if (count > 0)
+  {
+    task->notifications = clearOnExit ? 0 : count - 1;
+  }
+  return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+  {
+    std::lock_guard<std::mutex> lock(task->lock);
+    task->notifications++;
+  }
+  task->notified.notify_one();
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken)
+{
+  xTaskNotifyGive(task);
+  if (higherPriorityTaskWoken != NULL)
+  {
+    *higherPriorityTaskWoken = pdFALSE;
+  }
+}
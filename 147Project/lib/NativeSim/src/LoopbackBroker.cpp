@@ -0,0 +1,608 @@
+#include "LoopbackBroker.h"
+#include "Arduino.h"
+#include "WiFi.h"
+#include <algorithm>
+#include <deque>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/tlsio.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/tlsio_options.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/xlogging.h"
+
+//MQTT 3.1.1 control packet types, the high nibble of the first byte
+#define MQTT_CONNECT 1
+#define MQTT_CONNACK 2
+#define MQTT_PUBLISH 3
+#define MQTT_PUBACK 4
+#define MQTT_SUBSCRIBE 8
+#define MQTT_SUBACK 9
+#define MQTT_UNSUBSCRIBE 10
+#define MQTT_UNSUBACK 11
+#define MQTT_PINGREQ 12
+#define MQTT_PINGRESP 13
+#define MQTT_DISCONNECT 14
+
+#define TWIN_GET_TOPIC "$iothub/twin/GET/?$rid="
+#define TWIN_PATCH_TOPIC "$iothub/twin/PATCH/properties/reported/?$rid="
+#define TWIN_DOCUMENT "{\"desired\":{\"$version\":1},\"reported\":{\"$version\":1}}"
+#define METHOD_RESPONSE_TOPIC "$iothub/methods/res/"
+
+enum ConnectionState { CONNECTION_CLOSED, CONNECTION_OPEN, CONNECTION_ERROR };
+
+struct PendingPacket
+{
+  unsigned long dueUs;
+  std::string bytes;
+};
+
+struct LoopbackBroker::Connection
+{
+  ConnectionState state;
+  bool opening;                   //open completes from the first dowork, like a real socket
+  bool dropped;                   //reports an error from the next dowork, guarded by the broker's lock
+  bool silenced;                  //the broker ignores what arrives, until the connection is opened again
+  ON_IO_OPEN_COMPLETE onOpenComplete;
+  void* onOpenCompleteContext;
+  ON_BYTES_RECEIVED onBytesReceived;
+  void* onBytesReceivedContext;
+  ON_IO_ERROR onError;
+  void* onErrorContext;
+  TLSIO_OPTIONS options;
+  std::string inbound;            //bytes of a packet not complete yet
+  std::deque<PendingPacket> outbound;   //guarded by the broker's lock
+};
+
+static void AppendLength(std::string& packet, size_t length)
+{
+  do
+  {
+    uint8_t digit = length % 128;
+    length /= 128;
+    packet += (char)(length > 0 ? digit | 0x80 : digit);
+  } while (length > 0);
+}
+
+static void AppendString(std::string& packet, const std::string& text)
+{
+  packet += (char)(text.size() >> 8);
+  packet += (char)(text.size() & 0xFF);
+  packet += text;
+}
+
+static std::string Packet(uint8_t first, const std::string& body)
+{
+  std::string packet(1, (char)first);
+  AppendLength(packet, body.size());
+  return packet + body;
+}
+
+static std::string PublishPacket(const std::string& topic, const std::string& payload)
+{
+  std::string body;
+  AppendString(body, topic);
+  return Packet(MQTT_PUBLISH << 4, body + payload);
+}
+
+//"...?$rid=12&..." -> "12"
+static std::string RequestId(const std::string& topic)
+{
+  size_t start = topic.find("$rid=");
+  if (start == std::string::npos)
+  {
+    return "0";
+  }
+  start += 5;
+  return topic.substr(start, topic.find('&', start) - start);
+}
+
+LoopbackBroker::LoopbackBroker()
+  : roundTripUs(0), recording(true), publishHook(NULL), publishContext(NULL),
+    connectCount(0), subscribeCount(0), publishTotal(0), byteTotal(0), methodId(0)
+{
+}
+
+LoopbackBroker& LoopbackBroker::instance()
+{
+  static LoopbackBroker broker;
+  return broker;
+}
+
+void LoopbackBroker::setRoundTripUs(unsigned long us)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  roundTripUs = us;
+}
+
+void LoopbackBroker::setRecording(bool on)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  recording = on;
+}
+
+void LoopbackBroker::setPublishHook(void (*hook)(const LoopbackPublish&, void*), void* context)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  publishHook = hook;
+  publishContext = context;
+}
+
+void LoopbackBroker::invokeMethod(const char* name, const char* payload)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  std::string topic = std::string("$iothub/methods/POST/") + name + "/?$rid=" + std::to_string(++methodId);
+  for (Connection* connection : connections)
+  {
+    if (connection->state == CONNECTION_OPEN)
+    {
+      connection->outbound.push_back({ micros(), PublishPacket(topic, payload) });
+    }
+  }
+}
+
+void LoopbackBroker::sendCloudToDevice(const char* deviceId, const char* properties, const char* payload)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  std::string topic = std::string("devices/") + deviceId + "/messages/devicebound/" + properties;
+  for (Connection* connection : connections)
+  {
+    if (connection->state == CONNECTION_OPEN)
+    {
+      connection->outbound.push_back({ micros(), PublishPacket(topic, payload) });
+    }
+  }
+}
+
+void LoopbackBroker::dropConnections()
+{
+  std::lock_guard<std::mutex> guard(lock);
+  for (Connection* connection : connections)
+  {
+    connection->dropped = connection->state == CONNECTION_OPEN;
+  }
+}
+
+void LoopbackBroker::silenceConnections()
+{
+  std::lock_guard<std::mutex> guard(lock);
+  for (Connection* connection : connections)
+  {
+    connection->silenced = connection->state == CONNECTION_OPEN;
+  }
+}
+
+bool LoopbackBroker::takeDropped(Connection* connection)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  bool dropped = connection->dropped;
+  connection->dropped = false;
+  return dropped;
+}
+
+uint32_t LoopbackBroker::connects()
+{
+  std::lock_guard<std::mutex> guard(lock);
+  return connectCount;
+}
+
+uint32_t LoopbackBroker::subscribes()
+{
+  std::lock_guard<std::mutex> guard(lock);
+  return subscribeCount;
+}
+
+uint32_t LoopbackBroker::publishCount()
+{
+  std::lock_guard<std::mutex> guard(lock);
+  return publishTotal;
+}
+
+uint64_t LoopbackBroker::bytesReceived()
+{
+  std::lock_guard<std::mutex> guard(lock);
+  return byteTotal;
+}
+
+std::vector<LoopbackPublish> LoopbackBroker::publishes()
+{
+  std::lock_guard<std::mutex> guard(lock);
+  return recorded;
+}
+
+size_t LoopbackBroker::countInPayloads(const char* text)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  size_t count = 0;
+  size_t length = strlen(text);
+  for (const LoopbackPublish& publish : recorded)
+  {
+    for (size_t pos = publish.payload.find(text); pos != std::string::npos; pos = publish.payload.find(text, pos + length))
+    {
+      count++;
+    }
+  }
+  return count;
+}
+
+void LoopbackBroker::reset()
+{
+  std::lock_guard<std::mutex> guard(lock);
+  recorded.clear();
+  connectCount = 0;
+  subscribeCount = 0;
+  publishTotal = 0;
+  byteTotal = 0;
+}
+
+void LoopbackBroker::attach(Connection* connection)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  connections.push_back(connection);
+}
+
+void LoopbackBroker::detach(Connection* connection)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  for (size_t i = 0; i < connections.size(); i++)
+  {
+    if (connections[i] == connection)
+    {
+      connections.erase(connections.begin() + i);
+      break;
+    }
+  }
+}
+
+bool LoopbackBroker::takeDue(Connection* connection, std::string& packet)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  if (connection->outbound.empty() || (long)(micros() - connection->outbound.front().dueUs) < 0)
+  {
+    return false;
+  }
+  packet.swap(connection->outbound.front().bytes);
+  connection->outbound.pop_front();
+  return true;
+}
+
+void LoopbackBroker::drop(Connection* connection)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  connection->outbound.clear();
+  connection->silenced = false;
+}
+
+//called with the lock held
+void LoopbackBroker::reply(Connection* connection, const std::string& packet)
+{
+  connection->outbound.push_back({ micros() + roundTripUs, packet });
+}
+
+void LoopbackBroker::receive(Connection* connection, const uint8_t* data, size_t size)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  if (connection->silenced)
+  {
+    return;
+  }
+  byteTotal += size;
+  connection->inbound.append((const char*)data, size);
+
+  //take every complete packet off the front of the buffer
+  while (connection->inbound.size() >= 2)
+  {
+    const uint8_t* bytes = (const uint8_t*)connection->inbound.data();
+    size_t length = 0;
+    size_t header = 1;
+    int shift = 0;
+    bool complete = false;
+    while (header < connection->inbound.size() && header <= 4)
+    {
+      uint8_t digit = bytes[header++];
+      length |= (size_t)(digit & 0x7F) << shift;
+      shift += 7;
+      if ((digit & 0x80) == 0)
+      {
+        complete = true;
+        break;
+      }
+    }
+    if (!complete || connection->inbound.size() < header + length)
+    {
+      return;
+    }
+    handle(connection, bytes[0] >> 4, bytes[0] & 0x0F, bytes + header, length);
+    connection->inbound.erase(0, header + length);
+  }
+}
+
+void LoopbackBroker::handle(Connection* connection, uint8_t type, uint8_t flags, const uint8_t* body, size_t length)
+{
+  switch (type)
+  {
+  case MQTT_CONNECT:
+  {
+    //protocol name, level, flags, keep alive, then the client id
+    connectCount++;
+    bool sessionPresent = false;
+    size_t pos = length >= 2 ? 2 + (((size_t)body[0] << 8) | body[1]) : length;
+    if (pos + 6 <= length)
+    {
+      bool cleanSession = (body[pos + 1] & 0x02) != 0;
+      size_t idLength = ((size_t)body[pos + 4] << 8) | body[pos + 5];
+      std::string clientId((const char*)body + pos + 6, std::min(idLength, length - pos - 6));
+      if (cleanSession)
+      {
+        sessions.erase(clientId);
+      }
+      else
+      {
+        sessionPresent = !sessions.insert(clientId).second;
+      }
+    }
+    reply(connection, Packet(MQTT_CONNACK << 4, std::string(sessionPresent ? "\x01\x00" : "\x00\x00", 2)));
+    break;
+  }
+  case MQTT_PUBLISH:
+    handlePublish(connection, flags, body, length);
+    break;
+  case MQTT_SUBSCRIBE:
+  {
+    //packet id, then topic filters each followed by the QoS asked for, which is granted as is
+    subscribeCount++;
+    std::string ack((const char*)body, 2);
+    for (size_t pos = 2; pos + 2 < length;)
+    {
+      size_t topicLength = ((size_t)body[pos] << 8) | body[pos + 1];
+      pos += 2 + topicLength;
+      ack += (char)(pos < length ? body[pos] & 0x03 : 0);
+      pos++;
+    }
+    reply(connection, Packet(MQTT_SUBACK << 4, ack));
+    break;
+  }
+  case MQTT_UNSUBSCRIBE:
+    reply(connection, Packet(MQTT_UNSUBACK << 4, std::string((const char*)body, 2)));
+    break;
+  case MQTT_PINGREQ:
+    reply(connection, Packet(MQTT_PINGRESP << 4, std::string()));
+    break;
+  case MQTT_PUBACK:               //for a cloud-to-device message
+  case MQTT_DISCONNECT:
+  default:
+    break;
+  }
+}
+
+void LoopbackBroker::handlePublish(Connection* connection, uint8_t flags, const uint8_t* body, size_t length)
+{
+  uint8_t qos = (flags >> 1) & 0x03;
+  if (length < 2)
+  {
+    return;
+  }
+  size_t topicLength = ((size_t)body[0] << 8) | body[1];
+  size_t pos = 2 + topicLength + (qos > 0 ? 2 : 0);
+  if (pos > length)
+  {
+    return;
+  }
+  LoopbackPublish publish;
+  publish.topic.assign((const char*)body + 2, topicLength);
+  publish.payload.assign((const char*)body + pos, length - pos);
+  publish.qos = qos;
+  publish.receivedUs = micros();
+
+  if (qos > 0)
+  {
+    reply(connection, Packet(MQTT_PUBACK << 4, std::string((const char*)body + 2 + topicLength, 2)));
+  }
+
+  if (publish.topic.compare(0, sizeof(TWIN_GET_TOPIC) - 1, TWIN_GET_TOPIC) == 0)
+  {
+    reply(connection, PublishPacket("$iothub/twin/res/200/?$rid=" + RequestId(publish.topic), TWIN_DOCUMENT));
+    return;
+  }
+  if (publish.topic.compare(0, sizeof(TWIN_PATCH_TOPIC) - 1, TWIN_PATCH_TOPIC) == 0)
+  {
+    reply(connection, PublishPacket("$iothub/twin/res/204/?$rid=" + RequestId(publish.topic) + "&$version=2", ""));
+    return;
+  }
+
+  if (publish.topic.compare(0, sizeof(METHOD_RESPONSE_TOPIC) - 1, METHOD_RESPONSE_TOPIC) != 0)
+  {
+    publishTotal++;
+    if (publishHook != NULL)
+    {
+      publishHook(publish, publishContext);
+    }
+  }
+  if (recording)
+  {
+    recorded.push_back(publish);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// tlsio
+
+static int loopback_setoption(CONCRETE_IO_HANDLE handle, const char* name, const void* value);
+
+static CONCRETE_IO_HANDLE loopback_create(void* parameters)
+{
+  if (parameters == NULL)
+  {
+    LogError("NULL tls_io_config");
+    return NULL;
+  }
+  LoopbackBroker::Connection* connection = new LoopbackBroker::Connection();
+  connection->state = CONNECTION_CLOSED;
+  connection->opening = false;
+  connection->dropped = false;
+  connection->silenced = false;
+  tlsio_options_initialize(&connection->options, TLSIO_OPTION_BIT_TRUSTED_CERTS);
+  LoopbackBroker::instance().attach(connection);
+  return connection;
+}
+
+static void loopback_destroy(CONCRETE_IO_HANDLE handle)
+{
+  LoopbackBroker::Connection* connection = (LoopbackBroker::Connection*)handle;
+  if (connection != NULL)
+  {
+    LoopbackBroker::instance().detach(connection);
+    tlsio_options_release_resources(&connection->options);
+    delete connection;
+  }
+}
+
+static int loopback_open(CONCRETE_IO_HANDLE handle, ON_IO_OPEN_COMPLETE onOpenComplete, void* onOpenCompleteContext,
+                         ON_BYTES_RECEIVED onBytesReceived, void* onBytesReceivedContext, ON_IO_ERROR onError, void* onErrorContext)
+{
+  LoopbackBroker::Connection* connection = (LoopbackBroker::Connection*)handle;
+  if (connection == NULL || onOpenComplete == NULL || onBytesReceived == NULL || onError == NULL
+      || connection->state == CONNECTION_OPEN || connection->opening)
+  {
+    LogError("Invalid loopback open");
+    return __FAILURE__;
+  }
+  connection->onOpenComplete = onOpenComplete;
+  connection->onOpenCompleteContext = onOpenCompleteContext;
+  connection->onBytesReceived = onBytesReceived;
+  connection->onBytesReceivedContext = onBytesReceivedContext;
+  connection->onError = onError;
+  connection->onErrorContext = onErrorContext;
+  connection->inbound.clear();
+  connection->opening = true;
+  LoopbackBroker::instance().drop(connection);   //whatever was on the way belonged to the last connection
+  return 0;
+}
+
+static int loopback_close(CONCRETE_IO_HANDLE handle, ON_IO_CLOSE_COMPLETE onCloseComplete, void* context)
+{
+  LoopbackBroker::Connection* connection = (LoopbackBroker::Connection*)handle;
+  if (connection == NULL)
+  {
+    return __FAILURE__;
+  }
+  connection->state = CONNECTION_CLOSED;
+  connection->opening = false;
+  LoopbackBroker::instance().drop(connection);
+  if (onCloseComplete != NULL)
+  {
+    onCloseComplete(context);
+  }
+  return 0;
+}
+
+static int loopback_send(CONCRETE_IO_HANDLE handle, const void* buffer, size_t size, ON_SEND_COMPLETE onSendComplete, void* context)
+{
+  LoopbackBroker::Connection* connection = (LoopbackBroker::Connection*)handle;
+  if (connection == NULL || buffer == NULL || size == 0 || connection->state != CONNECTION_OPEN)
+  {
+    LogError("Loopback send on a connection that is not open");
+    return __FAILURE__;
+  }
+  LoopbackBroker::instance().receive(connection, (const uint8_t*)buffer, size);
+  if (onSendComplete != NULL)
+  {
+    onSendComplete(context, IO_SEND_OK);
+  }
+  return 0;
+}
+
+//the broker reassembles packets from the byte stream, so the buffers go to it one by one like a writev() on a socket
+static int loopback_sendv(CONCRETE_IO_HANDLE handle, const IO_BUFFER* buffers, size_t count, ON_SEND_COMPLETE onSendComplete, void* context)
+{
+  LoopbackBroker::Connection* connection = (LoopbackBroker::Connection*)handle;
+  if (connection == NULL || buffers == NULL || count == 0 || connection->state != CONNECTION_OPEN)
+  {
+    LogError("Loopback send on a connection that is not open");
+    return __FAILURE__;
+  }
+  for (size_t i = 0; i < count; i++)
+  {
+    LoopbackBroker::instance().receive(connection, (const uint8_t*)buffers[i].buffer, buffers[i].size);
+  }
+  if (onSendComplete != NULL)
+  {
+    onSendComplete(context, IO_SEND_OK);
+  }
+  return 0;
+}
+
+static void loopback_dowork(CONCRETE_IO_HANDLE handle)
+{
+  LoopbackBroker::Connection* connection = (LoopbackBroker::Connection*)handle;
+  if (connection == NULL)
+  {
+    return;
+  }
+  bool linkUp = WiFi.status() == WL_CONNECTED;
+  if (connection->opening)
+  {
+    connection->opening = false;
+    connection->state = linkUp ? CONNECTION_OPEN : CONNECTION_CLOSED;
+    connection->onOpenComplete(connection->onOpenCompleteContext, linkUp ? IO_OPEN_OK : IO_OPEN_ERROR);
+    return;
+  }
+  if (connection->state != CONNECTION_OPEN)
+  {
+    return;
+  }
+  if (!linkUp || LoopbackBroker::instance().takeDropped(connection))
+  {
+    connection->state = CONNECTION_ERROR;
+    connection->onError(connection->onErrorContext);
+    return;
+  }
+
+  //hand over the answers that are due, one at a time, since the device may send again from the callback
+  while (connection->state == CONNECTION_OPEN)
+  {
+    std::string packet;
+    if (!LoopbackBroker::instance().takeDue(connection, packet))
+    {
+      break;
+    }
+    connection->onBytesReceived(connection->onBytesReceivedContext, (const unsigned char*)packet.data(), packet.size());
+  }
+}
+
+static OPTIONHANDLER_HANDLE loopback_retrieveoptions(CONCRETE_IO_HANDLE handle)
+{
+  LoopbackBroker::Connection* connection = (LoopbackBroker::Connection*)handle;
+  if (connection == NULL)
+  {
+    LogError("NULL tlsio");
+    return NULL;
+  }
+  return tlsio_options_retrieve_options(&connection->options, loopback_setoption);
+}
+
+static int loopback_setoption(CONCRETE_IO_HANDLE handle, const char* name, const void* value)
+{
+  LoopbackBroker::Connection* connection = (LoopbackBroker::Connection*)handle;
+  if (connection == NULL || name == NULL)
+  {
+    return __FAILURE__;
+  }
+  //kept so they survive a reconnect like with a real tlsio; options it does not know are accepted and ignored
+  (void)tlsio_options_set(&connection->options, name, value);
+  return 0;
+}
+
+static const IO_INTERFACE_DESCRIPTION loopback_interface_description =
+{
+  loopback_retrieveoptions,
+  loopback_create,
+  loopback_destroy,
+  loopback_open,
+  loopback_close,
+  loopback_send,
+  loopback_dowork,
+  loopback_setoption,
+  loopback_sendv
+};
+
+const IO_INTERFACE_DESCRIPTION* loopback_get_interface_description(void)
+{
+  return &loopback_interface_description;
+}
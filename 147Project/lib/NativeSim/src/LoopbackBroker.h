@@ -0,0 +1,109 @@
+#ifndef LOOPBACK_BROKER_H
+#define LOOPBACK_BROKER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/xio.h"
+
+//A message a device published to the broker
+struct LoopbackPublish
+{
+  std::string topic;
+  std::string payload;
+  uint8_t qos;
+  unsigned long receivedUs;       //micros() when the broker took it
+};
+
+//In-process stand-in for IoT Hub's MQTT endpoint, behind the tlsio the SDK gets from platform_get_default_tlsio().
+//
+//Every packet the device sends is parsed when xio_send() is called and answered the way IoT Hub would:
+//CONNACK, SUBACK, PUBACK for QoS 1, PINGRESP, UNSUBACK, and the twin responses for GET and reported
+//PATCH requests. Answers are held back for the round trip time and handed to the device from xio_dowork().
+//While WiFi.status() is not WL_CONNECTED opening fails and open connections report an error.
+//Like IoT Hub the broker keeps the session of a client that connects without clean session, so a device coming
+//back gets session present in its CONNACK and does not have to subscribe again.
+//
+//The broker is driven from the thread calling into the IoT Hub client; the statistics can be read from any thread.
+class LoopbackBroker
+{
+public:
+  static LoopbackBroker& instance();
+
+  //delay between a packet reaching the broker and its answer reaching the device
+  void setRoundTripUs(unsigned long us);
+
+  //keep every publish for publishes(); off for benchmarks, which only need the counters
+  void setRecording(bool on);
+
+  //called with every device-to-cloud message as it arrives, on the thread that sent it and with the broker
+  //locked, so the hook must not call back into the broker
+  void setPublishHook(void (*hook)(const LoopbackPublish& publish, void* context), void* context);
+
+  //call a direct method on every connected device; the response shows up in publishes()
+  void invokeMethod(const char* name, const char* payload);
+
+  //send a cloud-to-device message to every connected device; properties are the URL encoded "name=value&..."
+  //IoT Hub puts behind the topic, system properties like %24.mid included
+  void sendCloudToDevice(const char* deviceId, const char* properties, const char* payload);
+
+  //break every open connection, as when IoT Hub or a NAT on the way drops it; the devices see an IO error
+  void dropConnections();
+
+  //stop answering on every open connection, as when a NAT forgot it: packets vanish and no error shows up
+  void silenceConnections();
+
+  uint32_t connects();
+  uint32_t subscribes();          //SUBSCRIBE packets, which a device resuming its session does not send
+  uint32_t publishCount();        //device-to-cloud messages, not counting twin and method traffic
+  uint64_t bytesReceived();
+  std::vector<LoopbackPublish> publishes();
+  size_t countInPayloads(const char* text); //times text appears in the recorded messages, batches included
+  void reset();                   //drop the recorded messages and zero the counters
+
+  //the connection behind one tlsio instance, used by the xio functions in LoopbackBroker.cpp
+  struct Connection;
+  void receive(Connection* connection, const uint8_t* data, size_t size);
+  void attach(Connection* connection);
+  void detach(Connection* connection);
+  bool takeDue(Connection* connection, std::string& packet);   //the oldest answer, once its round trip is over
+  void drop(Connection* connection);                           //the connection closed or opened again, its answers are lost
+  bool takeDropped(Connection* connection);                    //dropConnections() hit it since the last call
+
+private:
+  LoopbackBroker();
+
+  std::mutex lock;
+  unsigned long roundTripUs;
+  bool recording;
+  void (*publishHook)(const LoopbackPublish&, void*);
+  void* publishContext;
+  uint32_t connectCount;
+  uint32_t subscribeCount;
+  uint32_t publishTotal;
+  uint64_t byteTotal;
+  uint32_t methodId;
+  std::vector<LoopbackPublish> recorded;
+  std::vector<Connection*> connections;
+  std::set<std::string> sessions; //client ids that connected without clean session
+
+  void handle(Connection* connection, uint8_t type, uint8_t flags, const uint8_t* body, size_t length);
+  void handlePublish(Connection* connection, uint8_t flags, const uint8_t* body, size_t length);
+  void reply(Connection* connection, const std::string& packet);
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//the tlsio of the native build, takes a TLSIO_CONFIG like the real ones and ignores host and port
+const IO_INTERFACE_DESCRIPTION* loopback_get_interface_description(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOOPBACK_BROKER_H */
@@ -0,0 +1,36 @@
+#ifndef SIM_BOARD_H
+#define SIM_BOARD_H
+
+#include <stdint.h>
+
+//Something wired to one or more pins of the simulated board. digitalWrite() and digitalRead() on a
+//connected pin end up here, on the thread of the task that called them.
+class SimPinDevice
+{
+public:
+  virtual ~SimPinDevice() {}
+
+  virtual void pinWritten(uint8_t pin, uint8_t level) = 0;
+  virtual int pinLevel(uint8_t pin) = 0;
+};
+
+//Wiring and stimulus of the simulated board, used by the devices and by the scenario driving a run.
+class SimBoard
+{
+public:
+  //route a pin to a device; pins left unconnected read back the last level written, or LOW
+  static void connect(uint8_t pin, SimPinDevice& device);
+
+  //what analogRead() returns for a pin, for example the light sensor
+  static void setAnalog(uint8_t pin, uint16_t value);
+
+  //a device changed the level it drives on pin; runs the attached interrupt handler if the edge
+  //matches, waiting while a task has interrupts disabled, like the real core would
+  static void edge(uint8_t pin, uint8_t level);
+};
+
+//Called by main() before setup(), so the scenario can connect its devices before the sketch uses them.
+//The default does nothing; define it in the project to run a scenario.
+void simBegin();
+
+#endif /* SIM_BOARD_H */
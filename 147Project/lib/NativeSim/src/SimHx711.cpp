@@ -0,0 +1,125 @@
+#include "SimHx711.h"
+#include "Arduino.h"
+#include <chrono>
+
+SimHx711::SimHx711(uint8_t dout, uint8_t sck, long offset, float countsPerGram, long noise)
+  : dout(dout), sck(sck), offset(offset), countsPerGram(countsPerGram), noise(noise),
+    grams(0.0f), converted(0), running(false), sample(0), ready(false), sckLevel(LOW), pulses(0), seed(12345)
+{
+}
+
+SimHx711::~SimHx711()
+{
+  end();
+}
+
+void SimHx711::begin()
+{
+  SimBoard::connect(dout, *this);
+  SimBoard::connect(sck, *this);
+  running = true;
+  converter = std::thread(&SimHx711::convert, this);
+}
+
+void SimHx711::end()
+{
+  running = false;
+  if (converter.joinable())
+  {
+    converter.join();
+  }
+}
+
+void SimHx711::setGrams(float value)
+{
+  grams = value;
+}
+
+uint32_t SimHx711::conversions() const
+{
+  return converted;
+}
+
+long SimHx711::nextSample()
+{
+  //uniform noise from a small LCG, so runs repeat exactly
+  seed = seed * 1103515245UL + 12345UL;
+  long jitter = noise > 0 ? (long)((seed >> 8) % (uint32_t)(2 * noise + 1)) - noise : 0;
+  long value = offset + (long)(grams.load() * countsPerGram) + jitter;
+  if (value > 0x7FFFFF)
+  {
+    value = 0x7FFFFF;             //the HX711 saturates instead of wrapping
+  }
+  else if (value < -0x800000)
+  {
+    value = -0x800000;
+  }
+  return value;
+}
+
+void SimHx711::convert()
+{
+  std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+  while (running)
+  {
+    next += std::chrono::microseconds(SIM_HX711_PERIOD_US);
+    std::this_thread::sleep_until(next);
+
+    bool fell = false;
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      if (pulses == 0)
+      {
+        sample = (uint32_t)nextSample() & 0xFFFFFF;
+        fell = !ready;
+        ready = true;
+      }
+    }
+    converted++;
+    if (fell)
+    {
+      //outside the lock: the handler clocks the conversion out through pinWritten()
+      SimBoard::edge(dout, LOW);
+    }
+  }
+}
+
+void SimHx711::pinWritten(uint8_t pin, uint8_t level)
+{
+  if (pin != sck)
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(lock);
+  bool rising = sckLevel == LOW && level == HIGH;
+  sckLevel = level;
+  if (!rising || !ready)
+  {
+    return;
+  }
+  pulses++;
+  if (pulses > 24)
+  {
+    //the gain pulses: DOUT goes high, the next conversion starts
+    ready = false;
+    pulses = 0;
+  }
+}
+
+int SimHx711::pinLevel(uint8_t pin)
+{
+  if (pin != dout)
+  {
+    return sckLevel;
+  }
+  std::lock_guard<std::mutex> guard(lock);
+  if (!ready)
+  {
+    return HIGH;
+  }
+  if (pulses == 0)
+  {
+    return LOW;
+  }
+  return (sample >> (24 - pulses)) & 1 ? HIGH : LOW;
+}
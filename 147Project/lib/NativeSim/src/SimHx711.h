@@ -0,0 +1,55 @@
+#ifndef SIM_HX711_H
+#define SIM_HX711_H
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "SimBoard.h"
+
+#define SIM_HX711_PERIOD_US 12500  //80 samples per second, the HX711 with RATE tied high
+
+//An HX711 on the simulated board, seen by the driver through its DOUT and PD_SCK pins only.
+//
+//A conversion is ready every SIM_HX711_PERIOD_US: DOUT goes low, which fires the falling edge interrupt.
+//Each rising edge on PD_SCK then shifts out the next of the 24 bits, most significant first, and the pulse
+//after the 24th sets DOUT high again until the next conversion. A new conversion does not overwrite
+//one that is being clocked out. The reading is offset + grams * countsPerGram plus a little noise.
+class SimHx711 : public SimPinDevice
+{
+public:
+  SimHx711(uint8_t dout, uint8_t sck, long offset, float countsPerGram, long noise = 20);
+  ~SimHx711();
+
+  void begin();                   //connect the pins and start converting
+  void end();
+
+  void setGrams(float grams);     //load on the cell, from the next conversion on
+  uint32_t conversions() const;   //conversions completed, read out or not
+
+  void pinWritten(uint8_t pin, uint8_t level);
+  int pinLevel(uint8_t pin);
+
+private:
+  uint8_t dout;
+  uint8_t sck;
+  long offset;
+  float countsPerGram;
+  long noise;
+  std::atomic<float> grams;
+  std::atomic<uint32_t> converted;
+  std::atomic<bool> running;
+  std::thread converter;
+
+  std::mutex lock;                //guards the shift register below
+  uint32_t sample;                //24-bit two's complement
+  bool ready;
+  uint8_t sckLevel;
+  int pulses;                     //rising edges on PD_SCK since DOUT went low
+  uint32_t seed;
+
+  void convert();
+  long nextSample();
+};
+
+#endif /* SIM_HX711_H */
@@ -0,0 +1,24 @@
+#include "Arduino.h"
+#include "SimBoard.h"
+
+void setup();
+void loop();
+
+__attribute__((weak)) void simBegin()
+{
+}
+
+//what the Arduino core does, after giving the scenario a chance to wire up its devices
+int main(int argc, char** argv)
+{
+  (void)argc;
+  (void)argv;
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  simBegin();
+  setup();
+  while (true)
+  {
+    loop();                       //vTaskDelete(NULL) in loop() ends this thread, the tasks carry on
+  }
+  return 0;
+}
@@ -0,0 +1,191 @@
+//The platform adapter of the Azure IoT C SDK for the native build: locks, threads and the tick counter on
+//the C++ standard library, and the loopback broker as the default tlsio. This takes the place of the
+//FreeRTOS, lwIP and TLS files under az_iot/c-utility/pal, which only build for the ESP32.
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "Arduino.h"
+#include "LoopbackBroker.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/platform.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/lock.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/threadapi.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/tickcounter.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/httpapi.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/socketio.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/strings.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/xlogging.h"
+
+struct TICK_COUNTER_INSTANCE_TAG
+{
+  std::chrono::steady_clock::time_point start;
+};
+
+extern "C" {
+
+int platform_init(void)
+{
+  return 0;
+}
+
+void platform_deinit(void)
+{
+}
+
+const IO_INTERFACE_DESCRIPTION* platform_get_default_tlsio(void)
+{
+  return loopback_get_interface_description();
+}
+
+STRING_HANDLE platform_get_platform_info(void)
+{
+  return STRING_construct("(native; loopback)");
+}
+
+LOCK_HANDLE Lock_Init(void)
+{
+  //not recursive, like the FreeRTOS binary semaphore the ESP32 build uses
+  return new std::mutex();
+}
+
+LOCK_RESULT Lock(LOCK_HANDLE handle)
+{
+  if (handle == NULL)
+  {
+    LogError("Invalid argument; handle is NULL.");
+    return LOCK_ERROR;
+  }
+  ((std::mutex*)handle)->lock();
+  return LOCK_OK;
+}
+
+LOCK_RESULT Unlock(LOCK_HANDLE handle)
+{
+  if (handle == NULL)
+  {
+    LogError("Invalid argument; handle is NULL.");
+    return LOCK_ERROR;
+  }
+  ((std::mutex*)handle)->unlock();
+  return LOCK_OK;
+}
+
+LOCK_RESULT Lock_Deinit(LOCK_HANDLE handle)
+{
+  if (handle == NULL)
+  {
+    LogError("Invalid argument; handle is NULL.");
+    return LOCK_ERROR;
+  }
+  delete (std::mutex*)handle;
+  return LOCK_OK;
+}
+
+THREADAPI_RESULT ThreadAPI_Create(THREAD_HANDLE* threadHandle, THREAD_START_FUNC func, void* arg)
+{
+  if (threadHandle == NULL || func == NULL)
+  {
+    LogError("Invalid argument");
+    return THREADAPI_INVALID_ARG;
+  }
+  *threadHandle = new std::thread(func, arg);
+  return THREADAPI_OK;
+}
+
+THREADAPI_RESULT ThreadAPI_Join(THREAD_HANDLE threadHandle, int* res)
+{
+  if (threadHandle == NULL)
+  {
+    LogError("Invalid argument");
+    return THREADAPI_INVALID_ARG;
+  }
+  std::thread* thread = (std::thread*)threadHandle;
+  thread->join();
+  delete thread;
+  if (res != NULL)
+  {
+    *res = 0;                     //the result of the thread function is not kept
+  }
+  return THREADAPI_OK;
+}
+
+void ThreadAPI_Exit(int res)
+{
+  (void)res;
+}
+
+void ThreadAPI_Sleep(unsigned int milliseconds)
+{
+  delay(milliseconds);
+}
+
+TICK_COUNTER_HANDLE tickcounter_create(void)
+{
+  TICK_COUNTER_HANDLE result = new TICK_COUNTER_INSTANCE_TAG();
+  result->start = std::chrono::steady_clock::now();
+  return result;
+}
+
+void tickcounter_destroy(TICK_COUNTER_HANDLE tick_counter)
+{
+  delete tick_counter;
+}
+
+int tickcounter_get_current_ms(TICK_COUNTER_HANDLE tick_counter, tickcounter_ms_t* current_ms)
+{
+  if (tick_counter == NULL || current_ms == NULL)
+  {
+    LogError("Invalid argument");
+    return __FAILURE__;
+  }
+  *current_ms = (tickcounter_ms_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - tick_counter->start).count();
+  return 0;
+}
+
+//The MQTT transport never talks HTTP or plain sockets, but the SDK sources that do are built all the same.
+
+const IO_INTERFACE_DESCRIPTION* socketio_get_interface_description(void)
+{
+  return NULL;
+}
+
+HTTPAPI_RESULT HTTPAPI_Init(void)
+{
+  return HTTPAPI_ERROR;
+}
+
+void HTTPAPI_Deinit(void)
+{
+}
+
+HTTP_HANDLE HTTPAPI_CreateConnection(const char* hostName)
+{
+  (void)hostName;
+  return NULL;
+}
+
+void HTTPAPI_CloseConnection(HTTP_HANDLE handle)
+{
+  (void)handle;
+}
+
+HTTPAPI_RESULT HTTPAPI_ExecuteRequest(HTTP_HANDLE handle, HTTPAPI_REQUEST_TYPE requestType, const char* relativePath,
+                                      HTTP_HEADERS_HANDLE httpHeadersHandle, const unsigned char* content,
+                                      size_t contentLength, unsigned int* statusCode,
+                                      HTTP_HEADERS_HANDLE responseHeadersHandle, BUFFER_HANDLE responseContent)
+{
+  return HTTPAPI_ERROR;
+}
+
+HTTPAPI_RESULT HTTPAPI_SetOption(HTTP_HANDLE handle, const char* optionName, const void* value)
+{
+  return HTTPAPI_ERROR;
+}
+
+HTTPAPI_RESULT HTTPAPI_CloneOption(const char* optionName, const void* value, const void** savedValue)
+{
+  return HTTPAPI_ERROR;
+}
+
+}
@@ -0,0 +1,51 @@
+#include "WiFi.h"
+#include "Arduino.h"
+
+WiFiClass::WiFiClass() : started(false), linkUp(true), connectAt(0)
+{
+}
+
+bool WiFiClass::mode(wifi_mode_t mode)
+{
+  (void)mode;
+  return true;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* password)
+{
+  (void)ssid;
+  (void)password;
+  started = true;
+  connectAt = millis() + SIM_WIFI_CONNECT_MS;
+  return WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect()
+{
+  started = false;
+  return true;
+}
+
+wl_status_t WiFiClass::status()
+{
+  if (!started)
+  {
+    return WL_IDLE_STATUS;
+  }
+  if (!linkUp)
+  {
+    return WL_CONNECTION_LOST;
+  }
+  return (long)(millis() - connectAt) >= 0 ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+void WiFiClass::setLinkUp(bool up)
+{
+  if (up && !linkUp)
+  {
+    connectAt = millis() + SIM_WIFI_CONNECT_MS;   //the station has to join again
+  }
+  linkUp = up;
+}
+
+WiFiClass WiFi;
@@ -0,0 +1,49 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+#include <stdint.h>
+
+typedef enum
+{
+  WIFI_OFF,
+  WIFI_STA,
+  WIFI_AP,
+  WIFI_AP_STA
+} wifi_mode_t;
+
+typedef enum
+{
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+#define SIM_WIFI_CONNECT_MS 300   //time the simulated access point takes to let the board in
+
+//A WiFi station that joins any network after SIM_WIFI_CONNECT_MS. The scenario takes the link away and
+//gives it back with setLinkUp(); the loopback broker drops its connections while the link is down.
+class WiFiClass
+{
+public:
+  WiFiClass();
+
+  bool mode(wifi_mode_t mode);
+  wl_status_t begin(const char* ssid, const char* password = 0);
+  bool disconnect();
+  wl_status_t status();
+  bool isConnected() { return status() == WL_CONNECTED; }
+
+  void setLinkUp(bool up);
+
+private:
+  volatile bool started;
+  volatile bool linkUp;
+  volatile unsigned long connectAt;
+};
+
+extern WiFiClass WiFi;
+
+#endif /* SIM_WIFI_H */
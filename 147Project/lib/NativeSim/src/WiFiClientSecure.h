@@ -0,0 +1,18 @@
+#ifndef SIM_WIFI_CLIENT_SECURE_H
+#define SIM_WIFI_CLIENT_SECURE_H
+
+#include "WiFi.h"
+
+//The IoT Hub client does not go through WiFiClientSecure but through the SDK's tlsio, which the
+//native build replaces with the loopback broker (see LoopbackBroker.h). This client never connects.
+class WiFiClientSecure
+{
+public:
+  void setCACert(const char* rootCA) { (void)rootCA; }
+  void setInsecure() {}
+  int connect(const char* host, uint16_t port) { (void)host; (void)port; return 0; }
+  bool connected() { return false; }
+  void stop() {}
+};
+
+#endif /* SIM_WIFI_CLIENT_SECURE_H */
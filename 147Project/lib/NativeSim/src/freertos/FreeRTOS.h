@@ -0,0 +1,27 @@
+#ifndef SIM_FREERTOS_H
+#define SIM_FREERTOS_H
+
+//The FreeRTOS types and constants the firmware uses. Tasks are threads of the host, scheduled by the
+//host; priorities and core affinity are accepted and ignored, so timing is only as good as the PC's.
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int32_t BaseType_t;
+typedef uint32_t UBaseType_t;
+
+#define configTICK_RATE_HZ 1000
+#define configMAX_PRIORITIES 25
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+#endif /* SIM_FREERTOS_H */
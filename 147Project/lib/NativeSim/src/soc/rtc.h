@@ -0,0 +1,43 @@
+#ifndef SIM_SOC_RTC_H
+#define SIM_SOC_RTC_H
+
+#include <stdint.h>
+
+//CPU clock switching; the host runs at its own speed, so the calls only keep the requested setting.
+
+typedef enum
+{
+  RTC_CPU_FREQ_XTAL = 0,
+  RTC_CPU_FREQ_80M = 1,
+  RTC_CPU_FREQ_160M = 2,
+  RTC_CPU_FREQ_240M = 3,
+  RTC_CPU_FREQ_2M = 4
+} rtc_cpu_freq_t;
+
+typedef struct
+{
+  uint32_t source_freq_mhz;
+  uint32_t div;
+  uint32_t freq_mhz;
+} rtc_cpu_freq_config_t;
+
+static inline void rtc_clk_cpu_freq_get_config(rtc_cpu_freq_config_t* config)
+{
+  config->source_freq_mhz = 480;
+  config->div = 2;
+  config->freq_mhz = 240;
+}
+
+static inline void rtc_clk_cpu_freq_to_config(rtc_cpu_freq_t freq, rtc_cpu_freq_config_t* config)
+{
+  static const uint32_t mhz[] = { 40, 80, 160, 240, 2 };
+  config->freq_mhz = mhz[freq];
+  config->div = config->source_freq_mhz / config->freq_mhz;
+}
+
+static inline void rtc_clk_cpu_freq_set_config_fast(const rtc_cpu_freq_config_t* config)
+{
+  (void)config;
+}
+
+#endif /* SIM_SOC_RTC_H */
@@ -0,0 +1,69 @@
+//Host check and benchmark of SpscQueue under std::thread: one producer pushes numbered items as fast as it can,
+//one consumer checks they arrive complete and in order, and the throughput is reported for a few capacities.
+//
+//  g++ -O2 -pthread -I../../src spsc_benchmark.cpp -o spsc_benchmark
+#include <stdio.h>
+#include <chrono>
+#include <thread>
+#include "SpscQueue.h"
+
+#define ITEMS 20000000UL
+
+struct Sample                     //about the size of the messages main.cpp passes between its tasks
+{
+  uint32_t seq;
+  uint32_t timestamp;
+  float weight;
+  int light;
+};
+
+template <size_t Capacity>
+static bool Run()
+{
+  static SpscQueue<Sample, Capacity> queue;
+  bool ordered = true;
+  unsigned long received = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  std::thread consumer([&]() {
+    Sample sample;
+    while (received < ITEMS)
+    {
+      if (queue.pop(sample))
+      {
+        if (sample.seq != received || sample.light != (int)(received & 0xFFF))
+        {
+          ordered = false;
+        }
+        received++;
+      }
+      else
+      {
+        std::this_thread::yield();  //lets the producer run on a single core host
+      }
+    }
+  });
+
+  unsigned long retries = 0;
+  for (uint32_t seq = 0; seq < ITEMS; seq++)
+  {
+    Sample sample = { seq, seq * 100, seq * 0.5f, (int)(seq & 0xFFF) };
+    while (!queue.push(sample))
+    {
+      retries++;                  //full: a real producer would drop, the benchmark wants every item through
+      std::this_thread::yield();
+    }
+  }
+  consumer.join();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printf("capacity %5u: %6.1f M items/s, full %lu times, max used %u, %s\n", (unsigned)Capacity,
+         ITEMS / seconds / 1e6, retries, (unsigned)queue.maxUsed(), ordered ? "in order" : "OUT OF ORDER");
+  return ordered && queue.dropped() == retries;
+}
+
+int main()
+{
+  bool ok = Run<4>() & Run<64>() & Run<1024>();
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+//keeps the producer's and the consumer's index apart, so they do not bounce one cache line between cores
+#ifndef SPSC_CACHE_LINE
+#define SPSC_CACHE_LINE 64
+#endif
+
+//Fixed capacity queue from exactly one producer task to exactly one consumer task, without locks.
+//
+//The producer only writes tail and the consumer only writes head; each publishes its index with release
+//order after touching the slot, and reads the other's with acquire order. Capacity must be a power of two.
+//When the queue is full push() fails and counts the item as dropped, the producer never waits.
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+  SpscQueue() : head(0), tail(0), droppedItems(0), highWater(0) {}
+
+  //producer side
+  bool push(const T& item)
+  {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t used = t - head.load(std::memory_order_acquire);
+    if (used >= Capacity)
+    {
+      droppedItems.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    slots[t & (Capacity - 1)] = item;
+    tail.store(t + 1, std::memory_order_release);
+    if (used + 1 > highWater.load(std::memory_order_relaxed))
+    {
+      highWater.store(used + 1, std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  //consumer side
+  bool pop(T& item)
+  {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    item = slots[h & (Capacity - 1)];
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  //either side; only a snapshot, the other side may have moved on already
+  size_t size() const
+  {
+    return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+  }
+
+  size_t capacity() const
+  {
+    return Capacity;
+  }
+
+  //back pressure: items the producer had to drop, and the fullest the queue has been
+  uint32_t dropped() const
+  {
+    return droppedItems.load(std::memory_order_relaxed);
+  }
+
+  uint32_t maxUsed() const
+  {
+    return highWater.load(std::memory_order_relaxed);
+  }
+
+private:
+  alignas(SPSC_CACHE_LINE) std::atomic<uint32_t> head;   //next slot to pop, written by the consumer
+  alignas(SPSC_CACHE_LINE) std::atomic<uint32_t> tail;   //next slot to push, written by the producer
+  std::atomic<uint32_t> droppedItems;                    //producer side counters share its line
+  std::atomic<uint32_t> highWater;
+  alignas(SPSC_CACHE_LINE) T slots[Capacity];
+};
+
+#endif /* SPSC_QUEUE_H */
@@ -0,0 +1,69 @@
+//Host benchmark: bytes on the wire and encode time of the old snprintf format string against
+//TelemetryEncoder's JSON and CBOR output. Build it on a PC against the Azure SDK for C sources:
+//
+//  SDK="../../../../.pio/libdeps/esp32dev/Azure SDK for C/src"
+//  for f in "$SDK"/*.c; do gcc -O2 -c -I"$SDK" "$f"; done
+//  g++ -O2 -I../../src -I"$SDK" encoder_benchmark.cpp ../../src/TelemetryEncoder.cpp *.o -o encoder_benchmark
+#include <stdio.h>
+#include <time.h>
+#include "TelemetryEncoder.h"
+
+#define ROUNDS 200000
+#define MESSAGE_MAX_LEN 256
+
+//the format string main.cpp used before TelemetryEncoder
+static const char* messageData = "{\"messageId\":%d, \"Weight\":%f, \"OpenStatus\":%d, \"State\":\"%s\", \"Event\":\"%s\"}";
+
+static volatile size_t sink;      //keeps the compiler from dropping the loops
+
+static double Seconds()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void Report(const char* name, size_t bytes, double start)
+{
+  printf("%-10s %4u bytes %8.1f ns/message\n", name, (unsigned)bytes, (Seconds() - start) * 1e9 / ROUNDS);
+}
+
+int main()
+{
+  MailboxTelemetry telemetry = { 0, 123.45f, false, 1700000000, "mailDelivered", "delivered" };
+  char text[MESSAGE_MAX_LEN];
+  uint8_t buffer[MESSAGE_MAX_LEN];
+  size_t bytes = 0;
+
+  double start = Seconds();
+  for (int i = 0; i < ROUNDS; i++)
+  {
+    bytes = snprintf(text, MESSAGE_MAX_LEN, messageData, i, telemetry.weight + i, telemetry.door,
+                     telemetry.state, telemetry.event);
+    sink = sink + bytes;
+  }
+  Report("snprintf", bytes, start);
+
+  TelemetryEncoder json(TELEMETRY_JSON);
+  start = Seconds();
+  for (int i = 0; i < ROUNDS; i++)
+  {
+    telemetry.messageId = i;
+    telemetry.weight = 123.45f + i;
+    bytes = json.encode(telemetry, buffer, sizeof(buffer));
+    sink = sink + bytes;
+  }
+  Report("json", bytes, start);
+
+  TelemetryEncoder cbor(TELEMETRY_CBOR);
+  start = Seconds();
+  for (int i = 0; i < ROUNDS; i++)
+  {
+    telemetry.messageId = i;
+    telemetry.weight = 123.45f + i;
+    bytes = cbor.encode(telemetry, buffer, sizeof(buffer));
+    sink = sink + bytes;
+  }
+  Report("cbor", bytes, start);
+  return 0;
+}
@@ -0,0 +1,193 @@
+#include "TelemetryEncoder.h"
+#include <string.h>
+#include <az_core.h>
+
+//CBOR major types, shifted into the top three bits of the initial byte
+#define CBOR_UNSIGNED 0x00
+#define CBOR_NEGATIVE 0x20
+#define CBOR_TEXT 0x60
+#define CBOR_MAP 0xA0
+#define CBOR_FALSE 0xF4
+#define CBOR_TRUE 0xF5
+#define CBOR_FLOAT32 0xFA
+
+#define TELEMETRY_FIELDS 6
+
+//key names shared by both encodings
+static const char KEY_MESSAGE_ID[] = "messageId";
+static const char KEY_WEIGHT[] = "weight";
+static const char KEY_DOOR[] = "door";
+static const char KEY_TIMESTAMP[] = "timestamp";
+static const char KEY_STATE[] = "state";
+static const char KEY_EVENT[] = "event";
+
+static az_span Span(const char* text)
+{
+  return az_span_create((uint8_t*)text, (int32_t)strlen(text));
+}
+
+//appends CBOR items, remembering if anything did not fit instead of checking every call
+struct CborWriter
+{
+  uint8_t* buffer;
+  size_t capacity;
+  size_t used;
+  bool overflow;
+
+  void put(uint8_t byte)
+  {
+    if (used < capacity)
+    {
+      buffer[used++] = byte;
+    }
+    else
+    {
+      overflow = true;
+    }
+  }
+
+  //the initial byte plus the shortest argument that holds value
+  void head(uint8_t major, uint32_t value)
+  {
+    if (value < 24)
+    {
+      put(major | value);
+    }
+    else if (value <= 0xFF)
+    {
+      put(major | 24);
+      put(value);
+    }
+    else if (value <= 0xFFFF)
+    {
+      put(major | 25);
+      put(value >> 8);
+      put(value);
+    }
+    else
+    {
+      put(major | 26);
+      put(value >> 24);
+      put(value >> 16);
+      put(value >> 8);
+      put(value);
+    }
+  }
+
+  void integer(int32_t value)
+  {
+    if (value < 0)
+    {
+      head(CBOR_NEGATIVE, (uint32_t)(-1 - value));
+    }
+    else
+    {
+      head(CBOR_UNSIGNED, (uint32_t)value);
+    }
+  }
+
+  void text(const char* value)
+  {
+    size_t length = strlen(value);
+    head(CBOR_TEXT, length);
+    if (used + length <= capacity)
+    {
+      memcpy(&buffer[used], value, length);
+      used += length;
+    }
+    else
+    {
+      overflow = true;
+    }
+  }
+
+  void float32(float value)
+  {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put(CBOR_FLOAT32);            //big endian IEEE 754 single, as CBOR wants it
+    put(bits >> 24);
+    put(bits >> 16);
+    put(bits >> 8);
+    put(bits);
+  }
+};
+
+TelemetryEncoder::TelemetryEncoder(TelemetryFormat format)
+  : current(format)
+{
+}
+
+bool TelemetryEncoder::setContentType(const char* contentType)
+{
+  if (strcmp(contentType, TELEMETRY_CONTENT_TYPE_JSON) == 0 || strcmp(contentType, "application/json") == 0)
+  {
+    current = TELEMETRY_JSON;
+    return true;
+  }
+  if (strcmp(contentType, TELEMETRY_CONTENT_TYPE_CBOR) == 0 || strcmp(contentType, "application/cbor") == 0)
+  {
+    current = TELEMETRY_CBOR;
+    return true;
+  }
+  return false;
+}
+
+const char* TelemetryEncoder::contentType() const
+{
+  return current == TELEMETRY_CBOR ? TELEMETRY_CONTENT_TYPE_CBOR : TELEMETRY_CONTENT_TYPE_JSON;
+}
+
+TelemetryFormat TelemetryEncoder::format() const
+{
+  return current;
+}
+
+size_t TelemetryEncoder::encode(const MailboxTelemetry& telemetry, uint8_t* buffer, size_t capacity) const
+{
+  return current == TELEMETRY_CBOR ? encodeCbor(telemetry, buffer, capacity) : encodeJson(telemetry, buffer, capacity);
+}
+
+size_t TelemetryEncoder::encodeJson(const MailboxTelemetry& telemetry, uint8_t* buffer, size_t capacity) const
+{
+  az_json_writer writer;
+  if (capacity > INT32_MAX
+      || az_result_failed(az_json_writer_init(&writer, az_span_create(buffer, (int32_t)capacity), NULL))
+      || az_result_failed(az_json_writer_append_begin_object(&writer))
+      || az_result_failed(az_json_writer_append_property_name(&writer, Span(KEY_MESSAGE_ID)))
+      || az_result_failed(az_json_writer_append_int32(&writer, telemetry.messageId))
+      || az_result_failed(az_json_writer_append_property_name(&writer, Span(KEY_WEIGHT)))
+      || az_result_failed(az_json_writer_append_double(&writer, telemetry.weight, TELEMETRY_WEIGHT_DIGITS))
+      || az_result_failed(az_json_writer_append_property_name(&writer, Span(KEY_DOOR)))
+      || az_result_failed(az_json_writer_append_bool(&writer, telemetry.door))
+      || az_result_failed(az_json_writer_append_property_name(&writer, Span(KEY_TIMESTAMP)))
+      || az_result_failed(az_json_writer_append_double(&writer, telemetry.timestamp, 0))   //int32 would overflow in 2038
+      || az_result_failed(az_json_writer_append_property_name(&writer, Span(KEY_STATE)))
+      || az_result_failed(az_json_writer_append_string(&writer, Span(telemetry.state)))
+      || az_result_failed(az_json_writer_append_property_name(&writer, Span(KEY_EVENT)))
+      || az_result_failed(az_json_writer_append_string(&writer, Span(telemetry.event)))
+      || az_result_failed(az_json_writer_append_end_object(&writer)))
+  {
+    return 0;
+  }
+  return az_span_size(az_json_writer_get_bytes_used_in_destination(&writer));
+}
+
+size_t TelemetryEncoder::encodeCbor(const MailboxTelemetry& telemetry, uint8_t* buffer, size_t capacity) const
+{
+  CborWriter writer = { buffer, capacity, 0, false };
+  writer.head(CBOR_MAP, TELEMETRY_FIELDS);
+  writer.text(KEY_MESSAGE_ID);
+  writer.integer(telemetry.messageId);
+  writer.text(KEY_WEIGHT);
+  writer.float32(telemetry.weight);
+  writer.text(KEY_DOOR);
+  writer.put(telemetry.door ? CBOR_TRUE : CBOR_FALSE);
+  writer.text(KEY_TIMESTAMP);
+  writer.head(CBOR_UNSIGNED, telemetry.timestamp);
+  writer.text(KEY_STATE);
+  writer.text(telemetry.state);
+  writer.text(KEY_EVENT);
+  writer.text(telemetry.event);
+  return writer.overflow ? 0 : writer.used;
+}
@@ -0,0 +1,54 @@
+#ifndef TELEMETRY_ENCODER_H
+#define TELEMETRY_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TELEMETRY_WEIGHT_DIGITS 2      //fractional digits of the weight in JSON
+
+//Content types for the message; the transport URL encodes them into the MQTT topic
+#define TELEMETRY_CONTENT_TYPE_JSON "application/json"
+#define TELEMETRY_CONTENT_TYPE_CBOR "application/cbor"
+
+enum TelemetryFormat
+{
+  TELEMETRY_JSON,
+  TELEMETRY_CBOR
+};
+
+//One telemetry message, the fixed schema sent to IoT Hub
+struct MailboxTelemetry
+{
+  int32_t messageId;
+  float weight;
+  bool door;                      //true while the door is open
+  uint32_t timestamp;             //seconds since 1970 once SNTP has synced, seconds since boot before that
+  const char* state;
+  const char* event;
+};
+
+//Writes telemetry straight into a buffer owned by the caller, without printf or the heap.
+//JSON goes through az_json_writer from the Azure SDK for C; CBOR (RFC 8949) is written by hand as a map
+//with the same keys, about a third smaller on the wire.
+class TelemetryEncoder
+{
+public:
+  TelemetryEncoder(TelemetryFormat format = TELEMETRY_JSON);
+
+  //pick the format from a content type, either plain ("application/cbor") or URL encoded; false if unknown
+  bool setContentType(const char* contentType);
+  const char* contentType() const;
+  TelemetryFormat format() const;
+
+  //encode into buffer; returns the number of bytes written, or 0 if the message does not fit.
+  //JSON is not NUL terminated.
+  size_t encode(const MailboxTelemetry& telemetry, uint8_t* buffer, size_t capacity) const;
+
+private:
+  TelemetryFormat current;
+
+  size_t encodeJson(const MailboxTelemetry& telemetry, uint8_t* buffer, size_t capacity) const;
+  size_t encodeCbor(const MailboxTelemetry& telemetry, uint8_t* buffer, size_t capacity) const;
+};
+
+#endif /* TELEMETRY_ENCODER_H */
@@ -0,0 +1,118 @@
+#include "JournalStorage.h"
+#include <string.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+FlashJournalStorage::FlashJournalStorage(const char* partitionLabel)
+  : label(partitionLabel), partition(NULL)
+{
+}
+
+bool FlashJournalStorage::begin()
+{
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+  return partition != NULL;
+}
+
+size_t FlashJournalStorage::segmentSize() const
+{
+  return SPI_FLASH_SEC_SIZE;      //the flash erases 4 KB sectors, so one segment is one sector
+}
+
+uint16_t FlashJournalStorage::segmentCount() const
+{
+  return partition == NULL ? 0 : partition->size / SPI_FLASH_SEC_SIZE;
+}
+
+bool FlashJournalStorage::read(uint32_t offset, void* data, size_t length)
+{
+  return esp_partition_read(partition, offset, data, length) == ESP_OK;
+}
+
+bool FlashJournalStorage::write(uint32_t offset, const void* data, size_t length)
+{
+  return esp_partition_write(partition, offset, data, length) == ESP_OK;
+}
+
+bool FlashJournalStorage::erase(uint16_t segment)
+{
+  return esp_partition_erase_range(partition, (size_t)segment * SPI_FLASH_SEC_SIZE, SPI_FLASH_SEC_SIZE) == ESP_OK;
+}
+
+#else
+
+FileJournalStorage::FileJournalStorage(const char* path, size_t segmentSize, uint16_t segmentCount)
+  : path(path), size(segmentSize), count(segmentCount), file(NULL)
+{
+}
+
+FileJournalStorage::~FileJournalStorage()
+{
+  if (file != NULL)
+  {
+    fclose(file);
+  }
+}
+
+bool FileJournalStorage::begin()
+{
+  file = fopen(path, "r+b");
+  if (file != NULL)
+  {
+    return true;
+  }
+  file = fopen(path, "w+b");
+  if (file == NULL)
+  {
+    return false;
+  }
+  for (uint16_t segment = 0; segment < count; segment++)
+  {
+    if (!erase(segment))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t FileJournalStorage::segmentSize() const
+{
+  return size;
+}
+
+uint16_t FileJournalStorage::segmentCount() const
+{
+  return count;
+}
+
+bool FileJournalStorage::read(uint32_t offset, void* data, size_t length)
+{
+  return fseek(file, offset, SEEK_SET) == 0 && fread(data, 1, length, file) == length;
+}
+
+bool FileJournalStorage::write(uint32_t offset, const void* data, size_t length)
+{
+  return fseek(file, offset, SEEK_SET) == 0 && fwrite(data, 1, length, file) == length && fflush(file) == 0;
+}
+
+bool FileJournalStorage::erase(uint16_t segment)
+{
+  uint8_t erased[256];
+  memset(erased, 0xFF, sizeof(erased));
+  if (fseek(file, (long)segment * size, SEEK_SET) != 0)
+  {
+    return false;
+  }
+  for (size_t done = 0; done < size; done += sizeof(erased))
+  {
+    size_t chunk = size - done < sizeof(erased) ? size - done : sizeof(erased);
+    if (fwrite(erased, 1, chunk, file) != chunk)
+    {
+      return false;
+    }
+  }
+  return fflush(file) == 0;
+}
+
+#endif
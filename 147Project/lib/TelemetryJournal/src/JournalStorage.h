@@ -0,0 +1,69 @@
+#ifndef JOURNAL_STORAGE_H
+#define JOURNAL_STORAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//Raw storage under the telemetry journal. It behaves like NOR flash: it is split into equally sized
+//segments, a segment has to be erased (all bytes 0xFF) before it is written, and every byte is written once.
+class JournalStorage
+{
+public:
+  virtual ~JournalStorage() {}
+
+  virtual size_t segmentSize() const = 0;
+  virtual uint16_t segmentCount() const = 0;
+
+  virtual bool read(uint32_t offset, void* data, size_t length) = 0;
+  virtual bool write(uint32_t offset, const void* data, size_t length) = 0;
+  virtual bool erase(uint16_t segment) = 0;
+};
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include "esp_partition.h"
+
+//Journal kept in a data partition of the ESP32 flash, see partitions.csv.
+class FlashJournalStorage : public JournalStorage
+{
+public:
+  FlashJournalStorage(const char* partitionLabel = "journal");
+
+  bool begin();                   //false if the partition is missing
+
+  size_t segmentSize() const;
+  uint16_t segmentCount() const;
+  bool read(uint32_t offset, void* data, size_t length);
+  bool write(uint32_t offset, const void* data, size_t length);
+  bool erase(uint16_t segment);
+
+private:
+  const char* label;
+  const esp_partition_t* partition;
+};
+#else
+#include <stdio.h>
+
+//Journal kept in a plain file, standing in for the flash partition on a PC.
+class FileJournalStorage : public JournalStorage
+{
+public:
+  FileJournalStorage(const char* path, size_t segmentSize = 4096, uint16_t segmentCount = 16);
+  ~FileJournalStorage();
+
+  bool begin();                   //creates an erased file if there is none yet
+
+  size_t segmentSize() const;
+  uint16_t segmentCount() const;
+  bool read(uint32_t offset, void* data, size_t length);
+  bool write(uint32_t offset, const void* data, size_t length);
+  bool erase(uint16_t segment);
+
+private:
+  const char* path;
+  size_t size;
+  uint16_t count;
+  FILE* file;
+};
+#endif
+
+#endif /* JOURNAL_STORAGE_H */
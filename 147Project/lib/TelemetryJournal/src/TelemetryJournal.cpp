@@ -0,0 +1,350 @@
+#include "TelemetryJournal.h"
+#include <string.h>
+
+#define SEGMENT_MAGIC 0x4745534AUL   //"JSEG"
+#define RECORD_MAGIC 0x4A52          //"RJ"
+#define RECORD_CURSOR 0x7F           //internal record holding the replay cursor
+#define ERASED_MAGIC 0xFFFF
+#define CRC_SIZE 4
+#define CHUNK_SIZE 64                //bytes read at a time when a record is only checked, not copied
+
+//size of a record in the storage, padded to 4 bytes
+#define RECORD_SIZE(length) ((sizeof(RecordHeader) + (length) + CRC_SIZE + 3) & ~(uint32_t)3)
+
+static uint32_t Crc32(uint32_t crc, const void* data, size_t length)
+{
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+  const uint8_t* bytes = (const uint8_t*)data;
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++)
+  {
+    crc = table[(crc ^ bytes[i]) & 0x0F] ^ (crc >> 4);
+    crc = table[(crc ^ (bytes[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+TelemetryJournal::TelemetryJournal(JournalStorage& storage)
+  : storage(storage), head(0), headSeq(0), writeOffset(0), headFull(false),
+    nextSeq(1), acked(0), droppedRecords(0)
+{
+  replay.segment = 0;
+  replay.offset = sizeof(SegmentHeader);
+}
+
+uint32_t TelemetryJournal::segmentAddress(uint16_t segment) const
+{
+  return (uint32_t)segment * storage.segmentSize();
+}
+
+uint16_t TelemetryJournal::nextSegment(uint16_t segment)
+{
+  return (segment + 1) % storage.segmentCount();
+}
+
+bool TelemetryJournal::readSegment(uint16_t segment, uint32_t* seq)
+{
+  SegmentHeader header;
+  if (!storage.read(segmentAddress(segment), &header, sizeof(header)) || header.magic != SEGMENT_MAGIC)
+  {
+    return false;
+  }
+  *seq = header.seq;
+  return true;
+}
+
+bool TelemetryJournal::openSegment(uint16_t segment, uint32_t seq)
+{
+  SegmentHeader header = { SEGMENT_MAGIC, seq };
+  if (!storage.erase(segment) || !storage.write(segmentAddress(segment), &header, sizeof(header)))
+  {
+    return false;
+  }
+  head = segment;
+  headSeq = seq;
+  writeOffset = sizeof(SegmentHeader);
+  headFull = false;
+  return true;
+}
+
+TelemetryJournal::RecordStatus TelemetryJournal::readRecord(uint16_t segment, uint32_t offset, RecordHeader* header, void* data, uint16_t capacity)
+{
+  uint32_t address = segmentAddress(segment) + offset;
+  if (offset + sizeof(RecordHeader) + CRC_SIZE > storage.segmentSize())
+  {
+    return RECORD_END;
+  }
+  if (!storage.read(address, header, sizeof(RecordHeader)))
+  {
+    return RECORD_BAD;
+  }
+  if (header->magic == ERASED_MAGIC)
+  {
+    return RECORD_END;
+  }
+  if (header->magic != RECORD_MAGIC || offset + RECORD_SIZE(header->length) > storage.segmentSize())
+  {
+    return RECORD_BAD;
+  }
+
+  //check the CRC, copying the payload out on the way if the caller wants it
+  uint32_t crc = Crc32(0, header, sizeof(RecordHeader));
+  address += sizeof(RecordHeader);
+  if (data != NULL && capacity >= header->length)
+  {
+    if (!storage.read(address, data, header->length))
+    {
+      return RECORD_BAD;
+    }
+    crc = Crc32(crc, data, header->length);
+  }
+  else
+  {
+    uint8_t chunk[CHUNK_SIZE];
+    for (uint16_t done = 0; done < header->length; done += sizeof(chunk))
+    {
+      uint16_t size = (size_t)(header->length - done) < sizeof(chunk) ? header->length - done : sizeof(chunk);
+      if (!storage.read(address + done, chunk, size))
+      {
+        return RECORD_BAD;
+      }
+      crc = Crc32(crc, chunk, size);
+    }
+  }
+
+  uint32_t stored;
+  if (!storage.read(address + header->length, &stored, CRC_SIZE) || stored != crc)
+  {
+    return RECORD_BAD;
+  }
+  return RECORD_OK;
+}
+
+bool TelemetryJournal::writeRecord(uint8_t type, uint32_t seq, const void* data, uint16_t length)
+{
+  RecordHeader header = { RECORD_MAGIC, type, 0xFF, length, 0xFFFF, seq };
+  uint32_t crc = Crc32(Crc32(0, &header, sizeof(header)), data, length);
+  uint32_t address = segmentAddress(head) + writeOffset;
+
+  //the CRC goes last, a reset part way through leaves a record that fails the check
+  writeOffset += RECORD_SIZE(length);
+  if (!storage.write(address, &header, sizeof(header))
+      || (length > 0 && !storage.write(address + sizeof(header), data, length))
+      || !storage.write(address + sizeof(header) + length, &crc, CRC_SIZE))
+  {
+    headFull = true;
+    return false;
+  }
+  return true;
+}
+
+bool TelemetryJournal::begin()
+{
+  uint16_t count = storage.segmentCount();
+  if (count < 2)
+  {
+    return false;
+  }
+
+  //the newest segment has the highest sequence number
+  bool found = false;
+  for (uint16_t segment = 0; segment < count; segment++)
+  {
+    uint32_t seq;
+    if (readSegment(segment, &seq) && (!found || seq > headSeq))
+    {
+      found = true;
+      head = segment;
+      headSeq = seq;
+    }
+  }
+  if (!found)
+  {
+    return openSegment(0, 1) && writeRecord(RECORD_CURSOR, 0, NULL, 0);
+  }
+
+  //walk the segments from the oldest to the newest
+  uint32_t cursor = 0;
+  uint32_t firstSeq = 0;
+  uint32_t lastSeq = 0;
+  bool replaySet = false;
+  uint16_t segment = head;
+  do
+  {
+    uint32_t seq;
+    segment = nextSegment(segment);
+    if (!readSegment(segment, &seq))
+    {
+      continue;
+    }
+    if (!replaySet)
+    {
+      replay.segment = segment;
+      replay.offset = sizeof(SegmentHeader);
+      replaySet = true;
+    }
+
+    uint32_t offset = sizeof(SegmentHeader);
+    RecordHeader header;
+    RecordStatus status;
+    while ((status = readRecord(segment, offset, &header, NULL, 0)) == RECORD_OK)
+    {
+      if (header.type == RECORD_CURSOR)
+      {
+        cursor = header.seq > cursor ? header.seq : cursor;
+      }
+      else
+      {
+        firstSeq = firstSeq == 0 ? header.seq : firstSeq;
+        lastSeq = header.seq;
+      }
+      offset += RECORD_SIZE(header.length);
+    }
+    if (segment == head)
+    {
+      writeOffset = offset;
+      headFull = status == RECORD_BAD;
+    }
+  } while (segment != head);
+
+  nextSeq = (lastSeq > cursor ? lastSeq : cursor) + 1;
+  acked = cursor;
+  if (firstSeq > 0 && acked < firstSeq - 1)
+  {
+    acked = firstSeq - 1;         //older records were dropped by rotation
+  }
+  return true;
+}
+
+bool TelemetryJournal::rotate()
+{
+  uint16_t segment = nextSegment(head);
+  uint32_t seq;
+
+  //the segment about to be erased is the oldest one; anything in it not yet replayed is lost
+  if (readSegment(segment, &seq))
+  {
+    uint32_t offset = sizeof(SegmentHeader);
+    RecordHeader header;
+    while (readRecord(segment, offset, &header, NULL, 0) == RECORD_OK)
+    {
+      if (header.type != RECORD_CURSOR && header.seq > acked)
+      {
+        droppedRecords++;
+        acked = header.seq;
+      }
+      offset += RECORD_SIZE(header.length);
+    }
+    if (replay.segment == segment)
+    {
+      replay.segment = nextSegment(segment);
+      replay.offset = sizeof(SegmentHeader);
+    }
+  }
+
+  //every segment starts with the cursor, so it survives the erase of the one it was written to
+  return openSegment(segment, headSeq + 1) && writeRecord(RECORD_CURSOR, acked, NULL, 0);
+}
+
+bool TelemetryJournal::append(uint8_t type, const void* data, uint16_t length)
+{
+  if (length > maxRecordLength() || type == RECORD_CURSOR)
+  {
+    return false;
+  }
+  if (headFull || writeOffset + RECORD_SIZE(length) > storage.segmentSize())
+  {
+    if (!rotate())
+    {
+      return false;
+    }
+  }
+  if (!writeRecord(type, nextSeq, data, length))
+  {
+    return false;
+  }
+  nextSeq++;
+  return true;
+}
+
+uint16_t TelemetryJournal::maxRecordLength() const
+{
+  //a new segment holds its header and a cursor record before the first data record
+  size_t room = storage.segmentSize() - sizeof(SegmentHeader) - RECORD_SIZE(0) - sizeof(RecordHeader) - CRC_SIZE;
+  return room > 0xFFFF ? 0xFFFF : (uint16_t)(room & ~(size_t)3);
+}
+
+uint32_t TelemetryJournal::pending() const
+{
+  return nextSeq - 1 - acked;
+}
+
+uint32_t TelemetryJournal::dropped() const
+{
+  return droppedRecords;
+}
+
+JournalPosition TelemetryJournal::replayStart() const
+{
+  return replay;
+}
+
+bool TelemetryJournal::readNext(JournalPosition& pos, uint8_t* type, uint32_t* seq, void* data, uint16_t capacity, uint16_t* length)
+{
+  while (true)
+  {
+    uint32_t segmentSeq;
+    if (pos.segment == head && pos.offset >= writeOffset)
+    {
+      return false;
+    }
+
+    RecordHeader header;
+    RecordStatus status = readSegment(pos.segment, &segmentSeq)
+                            ? readRecord(pos.segment, pos.offset, &header, data, capacity)
+                            : RECORD_END;
+    if (status != RECORD_OK)
+    {
+      if (pos.segment == head)
+      {
+        return false;
+      }
+      pos.segment = nextSegment(pos.segment);
+      pos.offset = sizeof(SegmentHeader);
+      continue;
+    }
+
+    if (header.type == RECORD_CURSOR || header.seq <= acked)
+    {
+      pos.offset += RECORD_SIZE(header.length);
+      continue;
+    }
+    if (capacity < header.length)
+    {
+      return false;               //pos stays on the record, so it can be read again with a larger buffer
+    }
+    pos.offset += RECORD_SIZE(header.length);
+    *type = header.type;
+    *seq = header.seq;
+    *length = header.length;
+    return true;
+  }
+}
+
+bool TelemetryJournal::acknowledge(uint32_t seq, const JournalPosition& next)
+{
+  if (seq <= acked)
+  {
+    return true;
+  }
+  acked = seq;
+  replay = next;
+  if (headFull || writeOffset + RECORD_SIZE(0) > storage.segmentSize())
+  {
+    return rotate();
+  }
+  return writeRecord(RECORD_CURSOR, acked, NULL, 0);
+}
@@ -0,0 +1,89 @@
+#ifndef TELEMETRY_JOURNAL_H
+#define TELEMETRY_JOURNAL_H
+
+#include <stdint.h>
+#include "JournalStorage.h"
+
+//Record types the application can append
+#define JOURNAL_RECORD_SAMPLE 1
+#define JOURNAL_RECORD_EVENT 2
+
+//Where a record starts in the journal
+struct JournalPosition
+{
+  uint16_t segment;
+  uint32_t offset;                //from the start of the segment
+};
+
+//Store-and-forward journal for telemetry that could not be sent yet.
+//
+//Records are appended to the storage segments in a ring, so every segment is erased equally often.
+//Each segment starts with a sequence number, which tells after a reboot which segment is the newest,
+//and every record carries a CRC, so a record torn by a reset is detected and skipped.
+//The replay cursor is stored as a record of its own whenever records are acknowledged, and repeated at
+//the start of each new segment; after a crash replay resumes at the last acknowledged record.
+//When the ring is full the oldest segment is erased, dropping its records even if they were never sent.
+class TelemetryJournal
+{
+public:
+  TelemetryJournal(JournalStorage& storage);
+
+  //find the newest segment and the replay cursor, formatting the storage if it holds no journal
+  bool begin();
+
+  //append a record; length must not exceed maxRecordLength()
+  bool append(uint8_t type, const void* data, uint16_t length);
+
+  uint16_t maxRecordLength() const;
+  uint32_t pending() const;       //records appended but not acknowledged yet
+  uint32_t dropped() const;       //records lost to segment rotation since begin()
+
+  //position of the first record that has not been acknowledged
+  JournalPosition replayStart() const;
+
+  //read the next unacknowledged record at pos into data and move pos past it. Returns false when there
+  //is nothing left to replay, or when the record does not fit in capacity bytes; pos is not moved then.
+  bool readNext(JournalPosition& pos, uint8_t* type, uint32_t* seq, void* data, uint16_t capacity, uint16_t* length);
+
+  //mark every record up to seq as delivered; next is the position readNext() returned after it
+  bool acknowledge(uint32_t seq, const JournalPosition& next);
+
+private:
+  struct SegmentHeader
+  {
+    uint32_t magic;
+    uint32_t seq;
+  };
+
+  struct RecordHeader
+  {
+    uint16_t magic;
+    uint8_t type;
+    uint8_t reserved;
+    uint16_t length;
+    uint16_t reserved2;
+    uint32_t seq;                 //data records are numbered from 1, cursor records hold the acknowledged seq
+  };
+
+  enum RecordStatus { RECORD_OK, RECORD_END, RECORD_BAD };
+
+  JournalStorage& storage;
+  uint16_t head;                  //segment being appended to
+  uint32_t headSeq;
+  uint32_t writeOffset;
+  bool headFull;                  //a torn record makes the rest of the head segment unusable
+  uint32_t nextSeq;
+  uint32_t acked;
+  JournalPosition replay;
+  uint32_t droppedRecords;
+
+  bool readSegment(uint16_t segment, uint32_t* seq);
+  bool openSegment(uint16_t segment, uint32_t seq);
+  RecordStatus readRecord(uint16_t segment, uint32_t offset, RecordHeader* header, void* data, uint16_t capacity);
+  bool writeRecord(uint8_t type, uint32_t seq, const void* data, uint16_t length);
+  bool rotate();
+  uint16_t nextSegment(uint16_t segment);
+  uint32_t segmentAddress(uint16_t segment) const;
+};
+
+#endif /* TELEMETRY_JOURNAL_H */
@@ -0,0 +1,214 @@
+//Random sequences of BUFFER calls checked against a std::vector of the same bytes, with gballoc counting the blocks.
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/buffer_.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
+#include "checks.h"
+
+#define BUFFER_SEQUENCES 64
+#define BUFFER_STEPS 500
+#define BUFFER_MAX_PIECE 40           //bytes built, appended or prepended at once
+#define BUFFER_SEED 24
+
+//a BUFFER and the bytes it should hold
+struct BufferModel
+{
+  BUFFER_HANDLE handle;
+  std::vector<unsigned char> bytes;
+  bool built;                         //BUFFER_content gives a block, not NULL
+};
+
+static std::vector<unsigned char> BufferPiece(uint32_t& seed, size_t size)
+{
+  std::vector<unsigned char> piece(size);
+  for (unsigned char& byte : piece)
+  {
+    byte = (unsigned char)CheckRandom(seed, 256);
+  }
+  return piece;
+}
+
+static bool BufferMatches(const BufferModel& model)
+{
+  const unsigned char* content = NULL;
+  if (BUFFER_content(model.handle, &content) != 0 || (content != NULL) != model.built)
+  {
+    return false;
+  }
+  if (BUFFER_length(model.handle) != model.bytes.size())
+  {
+    return false;
+  }
+  return model.bytes.empty() ? BUFFER_u_char(model.handle) == NULL :
+    memcmp(BUFFER_u_char(model.handle), model.bytes.data(), model.bytes.size()) == 0;
+}
+
+//one random call on the buffer and the model; what the call was and whether the BUFFER agreed with it
+static bool BufferStep(uint32_t& seed, BufferModel& model, BufferModel& other, const char*& op)
+{
+  size_t size = 1 + CheckRandom(seed, BUFFER_MAX_PIECE);
+  std::vector<unsigned char> piece = BufferPiece(seed, size);
+  bool ok = true;
+  switch (CheckRandom(seed, 10))
+  {
+  case 0:
+    op = "BUFFER_build";
+    if (CheckRandom(seed, 8) == 0)
+    {
+      //size 0 frees the block
+      ok = BUFFER_build(model.handle, NULL, 0) == 0;
+      model.bytes.clear();
+      model.built = false;
+    }
+    else
+    {
+      ok = BUFFER_build(model.handle, piece.data(), size) == 0;
+      model.bytes = piece;
+      model.built = true;
+    }
+    break;
+  case 1:
+    op = "BUFFER_append_build";
+    ok = BUFFER_append_build(model.handle, piece.data(), size) == 0;
+    model.bytes.insert(model.bytes.end(), piece.begin(), piece.end());
+    model.built = true;
+    break;
+  case 2:
+    op = "BUFFER_prepend_build";
+    ok = BUFFER_prepend_build(model.handle, piece.data(), size) == 0;
+    model.bytes.insert(model.bytes.begin(), piece.begin(), piece.end());
+    model.built = true;
+    break;
+  case 3:
+  {
+    //the room reserved on both sides takes a prepend and an append without moving the content or allocating
+    op = "BUFFER_reserve round trip";
+    size_t tail = 1 + CheckRandom(seed, BUFFER_MAX_PIECE);
+    std::vector<unsigned char> back = BufferPiece(seed, tail);
+    ok = BUFFER_reserve(model.handle, size, tail) == 0;
+    const unsigned char* before = BUFFER_u_char(model.handle);
+    size_t allocations = gballoc_getAllocationCount();
+    ok = ok && BUFFER_prepend_build(model.handle, piece.data(), size) == 0 &&
+      BUFFER_append_build(model.handle, back.data(), tail) == 0;
+    ok = ok && gballoc_getAllocationCount() == allocations && (before == NULL || BUFFER_u_char(model.handle) == before - size);
+    model.bytes.insert(model.bytes.begin(), piece.begin(), piece.end());
+    model.bytes.insert(model.bytes.end(), back.begin(), back.end());
+    model.built = true;
+    break;
+  }
+  case 4:
+  {
+    //a reset buffer is built again in the block it kept
+    op = "BUFFER_reset round trip";
+    size_t length = model.bytes.size();
+    ok = BUFFER_reset(model.handle) == 0 && BUFFER_length(model.handle) == 0 && BUFFER_u_char(model.handle) == NULL;
+    model.bytes.clear();
+    if (length > 0)
+    {
+      std::vector<unsigned char> again = BufferPiece(seed, 1 + CheckRandom(seed, (uint32_t)length));
+      size_t allocations = gballoc_getAllocationCount();
+      ok = ok && BUFFER_append_build(model.handle, again.data(), again.size()) == 0 &&
+        gballoc_getAllocationCount() == allocations;
+      model.bytes = again;
+    }
+    model.built = length > 0;
+    break;
+  }
+  case 5:
+  {
+    op = "BUFFER_shrink";
+    if (model.bytes.empty())
+    {
+      break;                          //nothing to cut
+    }
+    size_t cut = 1 + CheckRandom(seed, (uint32_t)model.bytes.size());
+    bool fromEnd = CheckRandom(seed, 2) == 0;
+    ok = BUFFER_shrink(model.handle, cut, fromEnd) == 0;
+    if (fromEnd)
+    {
+      model.bytes.resize(model.bytes.size() - cut);
+    }
+    else
+    {
+      model.bytes.erase(model.bytes.begin(), model.bytes.begin() + cut);
+    }
+    model.built = !model.bytes.empty();
+    break;
+  }
+  case 6:
+    //the new bytes are undefined until written
+    op = "BUFFER_enlarge";
+    ok = BUFFER_enlarge(model.handle, size) == 0;
+    if (ok)
+    {
+      memcpy(BUFFER_u_char(model.handle) + model.bytes.size(), piece.data(), size);
+    }
+    model.bytes.insert(model.bytes.end(), piece.begin(), piece.end());
+    model.built = true;
+    break;
+  case 7:
+    op = "BUFFER_append";
+    if (!model.built || !other.built)
+    {
+      ok = BUFFER_append(model.handle, other.handle) != 0;
+      break;
+    }
+    ok = BUFFER_append(model.handle, other.handle) == 0;
+    model.bytes.insert(model.bytes.end(), other.bytes.begin(), other.bytes.end());
+    break;
+  case 8:
+    op = "BUFFER_prepend";
+    if (!model.built || !other.built)
+    {
+      ok = BUFFER_prepend(model.handle, other.handle) != 0;
+      break;
+    }
+    ok = BUFFER_prepend(model.handle, other.handle) == 0;
+    model.bytes.insert(model.bytes.begin(), other.bytes.begin(), other.bytes.end());
+    break;
+  default:
+  {
+    op = "BUFFER_clone";
+    BUFFER_HANDLE clone = BUFFER_clone(model.handle);
+    BufferModel copy = { clone, model.bytes, true };
+    ok = clone != NULL && BufferMatches(copy);
+    BUFFER_delete(clone);
+    break;
+  }
+  }
+  return ok && BufferMatches(model);
+}
+
+bool CheckBuffer()
+{
+  const char* check = "BUFFER";
+  int cases = 0;
+  int failed = 0;
+  //the heap is not counted yet, the firmware starts gballoc after the checks
+  gballoc_init();
+  for (int sequence = 0; sequence < BUFFER_SEQUENCES; sequence++)
+  {
+    uint32_t seed = BUFFER_SEED + sequence;
+    BufferModel models[2] = { { BUFFER_new(), {}, false }, { BUFFER_new(), {}, false } };
+    const char* op = "BUFFER_new";
+    bool ok = models[0].handle != NULL && models[1].handle != NULL;
+    int step = 0;
+    for (; ok && step < BUFFER_STEPS; step++)
+    {
+      int which = (int)CheckRandom(seed, 2);
+      ok = BufferStep(seed, models[which], models[1 - which], op);
+    }
+    cases++;
+    char what[80];
+    snprintf(what, sizeof(what), "sequence %d, step %d: %s", sequence, step, op);
+    CheckCase(check, what, ok, failed);
+    BUFFER_delete(models[0].handle);
+    BUFFER_delete(models[1].handle);
+  }
+  cases++;
+  CheckCase(check, "every block freed", gballoc_getCurrentMemoryUsed() == 0, failed);
+  gballoc_deinit();
+  return CheckDone(check, cases, failed);
+}
@@ -0,0 +1,48 @@
+//Host checks of single modules, run by the native program before the scenario starts the firmware (see scenario.cpp).
+//Each prints one [check] line per case that failed and a summary line, and returns whether all its cases passed.
+#ifndef CHECKS_H
+#define CHECKS_H
+
+#include <Arduino.h>
+
+//HX711Array decoding 2 to 4 chips on one clock line bit for bit, and its per channel tare and scale
+bool CheckHx711Array();
+
+//HX711Fast on HX711RecordingPort: the clock train it records and the values it decodes, the same as HX711::read()
+bool CheckHx711Fast();
+
+//the mailbox state machine on replayed light and weight traces: its transitions, hysteresis and heartbeats
+bool CheckMailbox();
+
+//BUFFER on random calls against a byte vector: reserve, prepend and reset round trips, and no block left behind
+bool CheckBuffer();
+
+//MAP_HANDLE on random calls against a linear scan, the count crossing the index threshold: order, lookups, clones, JSON
+bool CheckMap();
+
+//the outcome of one case; one that failed is printed and counted in failed
+inline bool CheckCase(const char* check, const char* what, bool ok, int& failed)
+{
+  if (!ok)
+  {
+    Serial.printf("[check] %s: %s\r\n", check, what);
+    failed++;
+  }
+  return ok;
+}
+
+//a value below the given bound from a small LCG, so every run of a random check replays the same calls
+inline uint32_t CheckRandom(uint32_t& seed, uint32_t below)
+{
+  seed = seed * 1103515245UL + 12345UL;
+  return (seed >> 8) % below;
+}
+
+//the summary line of a check
+inline bool CheckDone(const char* check, int cases, int failed)
+{
+  Serial.printf("[check] %s %s, %d cases\r\n", check, failed == 0 ? "passed" : "FAILED", cases);
+  return failed == 0;
+}
+
+#endif /* CHECKS_H */
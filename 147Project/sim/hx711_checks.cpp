@@ -0,0 +1,264 @@
+//Checks of the HX711 drivers against chips simulated at the pin level, without threads or timing.
+#include <Arduino.h>
+#include <deque>
+#include <vector>
+#include "HX711.h"
+#include "HX711Array.h"
+#include "HX711Fast.h"
+#include "checks.h"
+
+#define BUS_SCK 13
+#define BUS_FIRST_DOUT 15             //the chips' DOUT pins follow on from here
+#define CLOCK_LOG_LEN 128
+
+//HX711 chips sharing one PD_SCK pin, each with its own DOUT pin. A conversion is queued with convert() and
+//handed out once the one before it has been clocked out: DOUT goes low, each rising edge on PD_SCK shifts out
+//the next of the 24 bits, most significant first, and the 25th sets DOUT high until the next conversion.
+class FakeHx711Bus : public HX711Gpio
+{
+public:
+  FakeHx711Bus() : sckLevel(LOW), pulses(0), ready(false), risingEdges(0), portReads(0)
+  {
+  }
+
+  //queue one conversion of every chip
+  void convert(const std::vector<long>& words)
+  {
+    queued.push_back(words);
+  }
+
+  unsigned long edges() const
+  {
+    return risingEdges;
+  }
+
+  unsigned long reads() const
+  {
+    return portReads;
+  }
+
+  byte dout(byte channel) const
+  {
+    return BUS_FIRST_DOUT + channel;
+  }
+
+  void pin_mode(byte pin, byte mode)
+  {
+  }
+
+  void write(byte pin, byte level)
+  {
+    if (pin == BUS_SCK)
+    {
+      if (sckLevel == LOW && level == HIGH)
+      {
+        risingEdges++;
+        if (ready && ++pulses > 24)
+        {
+          ready = false;
+        }
+      }
+      sckLevel = level;
+    }
+  }
+
+  int read(byte pin)
+  {
+    next();
+    return level(pin - BUS_FIRST_DOUT);
+  }
+
+  uint32_t read_pins(const byte* pins, byte count)
+  {
+    uint32_t levels = 0;
+    next();
+    portReads++;
+    for (byte i = 0; i < count; i++)
+    {
+      levels |= (uint32_t)level(pins[i] - BUS_FIRST_DOUT) << i;
+    }
+    return levels;
+  }
+
+  void delay_us(unsigned int us)
+  {
+  }
+
+  bool attach_falling(byte pin, void (*handler)(void*), void* arg)
+  {
+    return false;
+  }
+
+  void detach(byte pin)
+  {
+  }
+
+private:
+  byte sckLevel;
+  int pulses;                     //rising edges since DOUT went low
+  bool ready;
+  std::vector<long> words;
+  std::deque<std::vector<long>> queued;
+  unsigned long risingEdges;
+  unsigned long portReads;
+
+  //the next queued conversion, once the chips are done with the last one
+  void next()
+  {
+    if (!ready && !queued.empty())
+    {
+      words = queued.front();
+      queued.pop_front();
+      ready = true;
+      pulses = 0;
+    }
+  }
+
+  int level(int channel)
+  {
+    if (!ready)
+    {
+      return HIGH;
+    }
+    if (pulses == 0)
+    {
+      return LOW;
+    }
+    return ((unsigned long)words[channel] & 0xFFFFFFUL) >> (24 - pulses) & 1;
+  }
+};
+
+//words a chip can send, the extremes of the 24-bit range and both signs
+static const long hx711Words[] = { 0, 1, -1, 0x7FFFFF, -0x800000, 0x123456, -0x123456, 45000, -45000, 0x555555, -0x2AAAAB };
+
+static const byte hx711Gains[] = { 128, 64, 32 };
+static const byte hx711GainPulses[] = { 1, 3, 2 };
+
+bool CheckHx711Array()
+{
+  const char* check = "HX711Array";
+  int cases = 0;
+  int failed = 0;
+  const int words = sizeof(hx711Words) / sizeof(hx711Words[0]);
+
+  for (byte channels = 2; channels <= 4; channels++)
+  {
+    for (size_t gain = 0; gain < sizeof(hx711Gains); gain++)
+    {
+      FakeHx711Bus bus;
+      byte dout[HX711_ARRAY_MAX_CHANNELS];
+      for (byte i = 0; i < channels; i++)
+      {
+        dout[i] = bus.dout(i);
+      }
+      HX711Array array;
+      cases++;
+      CheckCase(check, "begin", array.begin(dout, channels, BUS_SCK, hx711Gains[gain], bus), failed);
+
+      //every word on every channel, each channel a different one in the same conversion
+      for (int conversion = 0; conversion < words; conversion++)
+      {
+        std::vector<long> expected;
+        for (byte i = 0; i < channels; i++)
+        {
+          expected.push_back(hx711Words[(conversion + i * 3) % words]);
+        }
+        bus.convert(expected);
+        unsigned long edges = bus.edges();
+        unsigned long reads = bus.reads();
+        long values[HX711_ARRAY_MAX_CHANNELS];
+        array.read(values);
+        cases += 3;
+        CheckCase(check, "decoded sample vector", std::vector<long>(values, values + channels) == expected, failed);
+        CheckCase(check, "clock pulses per conversion", bus.edges() - edges == 24UL + hx711GainPulses[gain], failed);
+        //one read to see the chips ready, then one per bit for all of them at once
+        CheckCase(check, "port reads per conversion", bus.reads() - reads == 25, failed);
+      }
+      cases++;
+      CheckCase(check, "DOUT high after the conversion", !array.is_ready(), failed);
+    }
+  }
+
+  //per channel tare and scale, on a load that differs per channel and a tare that averages exactly
+  FakeHx711Bus bus;
+  byte dout[] = { bus.dout(0), bus.dout(1), bus.dout(2) };
+  HX711Array array;
+  array.begin(dout, 3, BUS_SCK, 128, bus);
+  const long tare[] = { 45000, -12000, 0x7FFF00 };
+  for (int i = 0; i < 10; i++)
+  {
+    long jitter = i % 2 == 0 ? 20 : -20;
+    bus.convert({ tare[0] + jitter, tare[1] - jitter, tare[2] + jitter });
+  }
+  array.tare(10);
+  for (byte i = 0; i < 3; i++)
+  {
+    cases++;
+    CheckCase(check, "tare offset", array.get_offset(i) == tare[i], failed);
+  }
+  const float scale[] = { 217.5f, -100.0f, 2.0f };
+  const long load[] = { 45000 + 8700, -12000 - 2500, 0x7FFF00 + 0xFF };
+  for (byte i = 0; i < 3; i++)
+  {
+    array.set_scale(i, scale[i]);
+  }
+  bus.convert({ load[0], load[1], load[2] });
+  float units[3];
+  array.get_units(units, 1);
+  for (byte i = 0; i < 3; i++)
+  {
+    cases++;
+    CheckCase(check, "scaled units", units[i] == (load[i] - tare[i]) / scale[i], failed);
+  }
+  cases++;
+  CheckCase(check, "units of channel 0 in grams", units[0] == 40.0f, failed);
+  return CheckDone(check, cases, failed);
+}
+
+//HX711Fast on the recording port against HX711::read() on the fake bus, for one gain
+template <byte Gain, byte GainPulses>
+static void CheckHx711FastGain(const char* check, int& cases, int& failed)
+{
+  HX711Fast<BUS_FIRST_DOUT, BUS_SCK, Gain, HX711RecordingPort> fast;
+  fast.begin();
+  FakeHx711Bus bus;
+  HX711 slow;
+  slow.begin(bus.dout(0), BUS_SCK, Gain, bus);
+
+  for (long word : hx711Words)
+  {
+    uint16_t log[CLOCK_LOG_LEN];
+    HX711RecordingPort::record(log, CLOCK_LOG_LEN);
+    HX711RecordingPort::load(word);
+    cases += 8;
+    CheckCase(check, "ready once loaded", fast.is_ready(), failed);
+    long value = fast.read();
+    CheckCase(check, "decoded value", value == word, failed);
+    CheckCase(check, "clock pulses per conversion", HX711RecordingPort::pulses == 24 + GainPulses, failed);
+    bool train = HX711RecordingPort::log_length == 2 * (24 + GainPulses);
+    for (uint16_t i = 0; train && i < HX711RecordingPort::log_length; i++)
+    {
+      train = log[i] == ((BUS_SCK << 1) | (i % 2 == 0 ? 1 : 0));
+    }
+    CheckCase(check, "clock edges recorded", train, failed);
+    CheckCase(check, "critical section left", HX711RecordingPort::locks == 0, failed);
+    CheckCase(check, "DOUT high after the conversion", !fast.is_ready(), failed);
+    CheckCase(check, "nothing to read after the conversion", !fast.try_read(value), failed);
+
+    bus.convert({ word });
+    unsigned long edges = bus.edges();
+    CheckCase(check, "same as HX711::read()", slow.read() == word && bus.edges() - edges == 24UL + GainPulses, failed);
+  }
+  HX711RecordingPort::record(NULL, 0);
+}
+
+bool CheckHx711Fast()
+{
+  const char* check = "HX711Fast";
+  int cases = 0;
+  int failed = 0;
+  CheckHx711FastGain<128, 1>(check, cases, failed);
+  CheckHx711FastGain<64, 3>(check, cases, failed);
+  CheckHx711FastGain<32, 2>(check, cases, failed);
+  return CheckDone(check, cases, failed);
+}
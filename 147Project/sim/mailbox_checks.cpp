@@ -0,0 +1,116 @@
+//Replays sensor traces through the mailbox state machine and checks the events it emits.
+#include <Arduino.h>
+#include <vector>
+#include "Mailbox.h"
+#include "checks.h"
+
+#define TRACE_PERIOD 100              //ms between readings, the sensor period of main.cpp
+#define TRACE_HEARTBEAT 300000
+
+//as main.cpp configures it
+static const MailboxConfig traceConfig = { 150, 50, 5.0f, 2000, TRACE_HEARTBEAT };
+
+//a stretch of a trace: light and weight for ms, each with up to the given noise either way
+struct TraceSegment
+{
+  unsigned long ms;
+  int light;
+  int lightNoise;
+  float grams;
+  float gramsNoise;
+};
+
+struct TraceEvent
+{
+  MailboxEvent event;
+  MailboxState state;
+};
+
+struct Trace
+{
+  const char* name;
+  std::vector<TraceSegment> segments;
+  std::vector<TraceEvent> expected;
+};
+
+static const std::vector<Trace> traces = {
+  { "letter through the door",
+    { { 5000, 10, 5, 0, 1 }, { 3000, 300, 20, 60, 60 }, { 5000, 10, 5, 40, 1 } },
+    { { MAILBOX_EVENT_OPENED, MAILBOX_OPEN }, { MAILBOX_EVENT_DELIVERED, MAILBOX_MAIL_DELIVERED } } },
+  { "letter collected",
+    { { 5000, 10, 5, 40, 1 }, { 4000, 300, 20, 20, 40 }, { 5000, 10, 5, 0, 1 } },
+    { { MAILBOX_EVENT_OPENED, MAILBOX_OPEN }, { MAILBOX_EVENT_COLLECTED, MAILBOX_MAIL_COLLECTED } } },
+  { "looked inside",
+    { { 5000, 10, 5, 40, 1 }, { 2000, 300, 20, 40, 30 }, { 5000, 10, 5, 40, 1 } },
+    { { MAILBOX_EVENT_OPENED, MAILBOX_OPEN }, { MAILBOX_EVENT_CLOSED, MAILBOX_CLOSED } } },
+  //light flickering between the two thresholds, closed and then open, must not toggle the door
+  { "light chatter",
+    { { 5000, 100, 45, 0, 1 }, { 3000, 300, 20, 0, 1 }, { 5000, 125, 70, 0, 1 }, { 5000, 10, 5, 0, 1 } },
+    { { MAILBOX_EVENT_OPENED, MAILBOX_OPEN }, { MAILBOX_EVENT_CLOSED, MAILBOX_CLOSED } } },
+  //a parcel pushed through the slot, the weight swinging until it lies still
+  { "parcel through the slot",
+    { { 5000, 10, 5, 0, 1 }, { 1500, 10, 5, 150, 150 }, { 5000, 10, 5, 300, 2 } },
+    { { MAILBOX_EVENT_DELIVERED, MAILBOX_MAIL_DELIVERED } } },
+  //nothing but noise and a slow drift below weightDelta: only heartbeats, one per heartbeatMs
+  { "idle",
+    { { 30 * 60000UL, 20, 20, 0, 1.5 }, { 6 * 60000UL, 20, 20, 2, 1 } },
+    { { MAILBOX_EVENT_HEARTBEAT, MAILBOX_CLOSED }, { MAILBOX_EVENT_HEARTBEAT, MAILBOX_CLOSED },
+      { MAILBOX_EVENT_HEARTBEAT, MAILBOX_CLOSED }, { MAILBOX_EVENT_HEARTBEAT, MAILBOX_CLOSED },
+      { MAILBOX_EVENT_HEARTBEAT, MAILBOX_CLOSED }, { MAILBOX_EVENT_HEARTBEAT, MAILBOX_CLOSED },
+      { MAILBOX_EVENT_HEARTBEAT, MAILBOX_CLOSED } } },
+};
+
+//a value in [-1, 1] from a small LCG, so every run replays the same readings
+static float TraceNoise(uint32_t& seed)
+{
+  seed = seed * 1103515245UL + 12345UL;
+  return ((seed >> 8) % 2001) / 1000.0f - 1.0f;
+}
+
+bool CheckMailbox()
+{
+  const char* check = "Mailbox";
+  int cases = 0;
+  int failed = 0;
+  for (const Trace& trace : traces)
+  {
+    Mailbox mailbox(traceConfig);
+    std::vector<TraceEvent> events;
+    unsigned long now = 0;
+    unsigned long lastEvent = 0;
+    bool spaced = true;
+    uint32_t seed = 147;
+    for (const TraceSegment& segment : trace.segments)
+    {
+      for (unsigned long end = now + segment.ms; now < end; now += TRACE_PERIOD)
+      {
+        int light = segment.light + (int)(segment.lightNoise * TraceNoise(seed));
+        float grams = segment.grams + segment.gramsNoise * TraceNoise(seed);
+        MailboxEvent event = mailbox.update(now, light, grams);
+        if (event != MAILBOX_NO_EVENT)
+        {
+          events.push_back({ event, mailbox.state() });
+          //a heartbeat only once nothing else was said for heartbeatMs
+          spaced = spaced && (event != MAILBOX_EVENT_HEARTBEAT || now - lastEvent >= TRACE_HEARTBEAT);
+          lastEvent = now;
+        }
+      }
+    }
+
+    bool same = events.size() == trace.expected.size();
+    for (size_t i = 0; same && i < events.size(); i++)
+    {
+      same = events[i].event == trace.expected[i].event && events[i].state == trace.expected[i].state;
+    }
+    cases += 2;
+    if (!CheckCase(check, trace.name, same, failed))
+    {
+      for (const TraceEvent& event : events)
+      {
+        Serial.printf("[check]   %s, %s\r\n", Mailbox::eventName(event.event), Mailbox::stateName(event.state));
+      }
+    }
+    CheckCase(check, "heartbeat before heartbeatMs", spaced, failed);
+  }
+  return CheckDone(check, cases, failed);
+}
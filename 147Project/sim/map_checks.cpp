@@ -0,0 +1,195 @@
+//Random sequences of MAP_HANDLE calls checked against a linear scan of the same entries, with gballoc counting the blocks.
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "az_iot/c-utility/inc/azure_c_shared_utility/map.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/strings.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
+#include "checks.h"
+
+#define MAP_SEQUENCES 32
+#define MAP_STEPS 600
+#define MAP_KEYS 40                   //the keys a sequence picks from, enough to take the map well past the index threshold
+#define MAP_PHASE 60                  //steps of mostly adds, then as many of mostly deletes, so the count crosses 8 again and again
+#define MAP_SEED 25
+
+typedef std::vector<std::pair<std::string, std::string>> MapEntries;
+
+//the filter of every other sequence turns down values ending in 7
+static int MapFilter(const char* key, const char* value)
+{
+  (void)key;
+  return value[strlen(value) - 1] == '7' ? 1 : 0;
+}
+
+static MapEntries::iterator MapFind(MapEntries& entries, const std::string& key)
+{
+  MapEntries::iterator entry = entries.begin();
+  while (entry != entries.end() && entry->first != key)
+  {
+    entry++;
+  }
+  return entry;
+}
+
+//the entries in their order, the JSON of them, and a lookup of every key against a linear scan
+static bool MapMatches(MAP_HANDLE map, MapEntries& entries, const std::vector<std::string>& keys, bool json)
+{
+  const char* const* mapKeys;
+  const char* const* mapValues;
+  size_t count;
+  if (Map_GetInternals(map, &mapKeys, &mapValues, &count) != MAP_OK || count != entries.size())
+  {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++)
+  {
+    if (entries[i].first != mapKeys[i] || entries[i].second != mapValues[i])
+    {
+      return false;
+    }
+  }
+  for (const std::string& key : keys)
+  {
+    MapEntries::iterator entry = MapFind(entries, key);
+    const char* value = Map_GetValueFromKey(map, key.c_str());
+    bool exists = false;
+    if (Map_ContainsKey(map, key.c_str(), &exists) != MAP_OK || exists != (entry != entries.end()) ||
+      (entry == entries.end() ? value != NULL : value == NULL || entry->second != value))
+    {
+      return false;
+    }
+  }
+  if (json)
+  {
+    std::string expected = "{";
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+      expected += (i > 0 ? ",\"" : "\"") + entries[i].first + "\":\"" + entries[i].second + "\"";
+    }
+    expected += "}";
+    STRING_HANDLE text = Map_ToJSON(map);
+    bool same = text != NULL && expected == STRING_c_str(text);
+    STRING_delete(text);
+    if (!same)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//one random call on the map and the entries; what the call was and whether the map agreed with it
+static bool MapStep(uint32_t& seed, int step, bool& filtered, MAP_HANDLE map, MapEntries& entries,
+  const std::vector<std::string>& keys, const char*& op)
+{
+  bool growing = (step / MAP_PHASE) % 2 == 0;
+  uint32_t pick = CheckRandom(seed, 10);
+  std::string key = keys[CheckRandom(seed, MAP_KEYS)];
+  if (!growing && pick >= 2 && pick < 9 && !entries.empty())
+  {
+    //while shrinking, deletes take keys that are there
+    key = entries[CheckRandom(seed, (uint32_t)entries.size())].first;
+  }
+  std::string value = "v" + std::to_string(CheckRandom(seed, 1000));
+  bool rejected = filtered && value.back() == '7';
+  MapEntries::iterator entry = MapFind(entries, key);
+  bool ok;
+  if (pick < (growing ? 5u : 1u))
+  {
+    op = "Map_Add";
+    MAP_RESULT expected = entry != entries.end() ? MAP_KEYEXISTS : rejected ? MAP_FILTER_REJECT : MAP_OK;
+    ok = Map_Add(map, key.c_str(), value.c_str()) == expected;
+    if (expected == MAP_OK)
+    {
+      entries.push_back({ key, value });
+    }
+  }
+  else if (pick < (growing ? 8u : 2u))
+  {
+    op = "Map_AddOrUpdate";
+    ok = Map_AddOrUpdate(map, key.c_str(), value.c_str()) == (rejected ? MAP_FILTER_REJECT : MAP_OK);
+    if (!rejected && entry != entries.end())
+    {
+      entry->second = value;
+    }
+    else if (!rejected)
+    {
+      entries.push_back({ key, value });
+    }
+  }
+  else if (pick < 9)
+  {
+    op = "Map_Delete";
+    ok = Map_Delete(map, key.c_str()) == (entry != entries.end() ? MAP_OK : MAP_KEYNOTFOUND);
+    if (entry != entries.end())
+    {
+      entries.erase(entry);
+      //as upstream, a map emptied by Map_Delete forgets its filter
+      filtered = filtered && !entries.empty();
+    }
+  }
+  else
+  {
+    op = "Map_Clone";
+    MAP_HANDLE clone = Map_Clone(map);
+    ok = clone != NULL && MapMatches(clone, entries, keys, true);
+    if (clone != NULL && !entries.empty())
+    {
+      //the clone has an index of its own
+      MapEntries cloned = entries;
+      ok = ok && Map_Delete(clone, cloned.front().first.c_str()) == MAP_OK;
+      cloned.erase(cloned.begin());
+      ok = ok && MapMatches(clone, cloned, keys, false) && MapMatches(map, entries, keys, false);
+    }
+    Map_Destroy(clone);
+  }
+  return ok && MapMatches(map, entries, keys, step % 16 == 0);
+}
+
+bool CheckMap()
+{
+  const char* check = "MAP";
+  int cases = 0;
+  int failed = 0;
+  std::vector<std::string> keys;
+  for (int i = 0; i < MAP_KEYS; i++)
+  {
+    keys.push_back("key" + std::to_string(i));
+  }
+  //the heap is not counted yet, the firmware starts gballoc after the checks
+  gballoc_init();
+  for (int sequence = 0; sequence < MAP_SEQUENCES; sequence++)
+  {
+    uint32_t seed = MAP_SEED + sequence;
+    bool filtered = sequence % 2 == 1;
+    MAP_HANDLE map = Map_Create(filtered ? MapFilter : NULL);
+    MapEntries entries;
+    const char* op = "Map_Create";
+    bool ok = map != NULL;
+    int step = 0;
+    size_t largest = 0;
+    int dropped = 0;                  //times the count fell back to the threshold, dropping the index
+    for (; ok && step < MAP_STEPS; step++)
+    {
+      size_t before = entries.size();
+      ok = MapStep(seed, step, filtered, map, entries, keys, op);
+      largest = entries.size() > largest ? entries.size() : largest;
+      dropped += before > 8 && entries.size() <= 8 ? 1 : 0;
+    }
+    cases += 2;
+    char what[80];
+    snprintf(what, sizeof(what), "sequence %d, step %d: %s", sequence, step, op);
+    CheckCase(check, what, ok, failed);
+    //the sequence went past the 8 entries a map keeps without an index
+    CheckCase(check, "past the index threshold and back", largest > 16 && dropped >= 2, failed);
+    Map_Destroy(map);
+  }
+  cases++;
+  CheckCase(check, "every block freed", gballoc_getCurrentMemoryUsed() == 0, failed);
+  gballoc_deinit();
+  return CheckDone(check, cases, failed);
+}
@@ -0,0 +1,200 @@
+//End-to-end run of the firmware on a PC (pio run -e native && .pio/build/native/program).
+//
+//main.cpp runs unchanged on the NativeSim board: a simulated HX711 and light sensor stand in for the mailbox,
+//and the IoT Hub client talks MQTT to the loopback broker. This scenario delivers mail, loses WiFi, collects
+//the mail while offline and checks that every event reaches the broker, the offline ones through the journal.
+//Then the broker drops the connection and the client has to get back into its MQTT session without subscribing again,
+//and finally stops answering without closing it, which the client has to notice from the missing acknowledgement.
+//A direct method has to be answered, and with the heap profiler built in (GB_PROFILE_ALLOC) so does heapProfile.
+//It exits with 0 when they all arrived and 1 otherwise. Before the firmware starts, the host checks of single modules
+//in checks.h run, and the program exits with 1 straight away if one of them fails.
+#include <Arduino.h>
+#include <WiFi.h>
+#include <thread>
+#include "SimBoard.h"
+#include "SimHx711.h"
+#include "LoopbackBroker.h"
+#include "checks.h"
+
+//wired like main.cpp
+#define LIGHT_SENS 33
+#define LOADCELL_DOUT_PIN 15
+#define LOADCELL_SCK_PIN 13
+#define SCALE_COUNTS_PER_GRAM 217.5f   //matches scale.set_scale() in setup()
+#define JOURNAL_FILE "journal.bin"     //where main.cpp keeps the journal off the ESP32
+
+#define LIGHT_DARK 10
+#define LIGHT_OPEN 300
+#define LETTER_GRAMS 40.0f
+#define ROUND_TRIP_US 20000            //a nearby IoT Hub over WiFi
+#define STEP_TIMEOUT 15000             //longest wait for the firmware to react to one step
+
+static SimHx711 loadCell(LOADCELL_DOUT_PIN, LOADCELL_SCK_PIN, 45000, SCALE_COUNTS_PER_GRAM);
+
+static void Step(const char* what)
+{
+  Serial.print("[scenario] ");
+  Serial.println(what);
+}
+
+//wait until text appears count times in what the broker got
+static bool WaitFor(const char* text, size_t count)
+{
+  unsigned long start = millis();
+  while (LoopbackBroker::instance().countInPayloads(text) < count)
+  {
+    if (millis() - start >= STEP_TIMEOUT)
+    {
+      Serial.print("[scenario] timed out waiting for ");
+      Serial.println(text);
+      return false;
+    }
+    delay(50);
+  }
+  return true;
+}
+
+static void OpenAndClose(float grams)
+{
+  SimBoard::setAnalog(LIGHT_SENS, LIGHT_OPEN);
+  delay(1000);
+  loadCell.setGrams(grams);
+  delay(500);
+  SimBoard::setAnalog(LIGHT_SENS, LIGHT_DARK);
+}
+
+static void Finish(bool passed)
+{
+  LoopbackBroker& broker = LoopbackBroker::instance();
+  Serial.print("[scenario] connects ");
+  Serial.print(broker.connects());
+  Serial.print(", subscribes ");
+  Serial.print(broker.subscribes());
+  Serial.print(", messages ");
+  Serial.print(broker.publishCount());
+  Serial.print(", bytes ");
+  Serial.println((unsigned long)broker.bytesReceived());
+  Serial.println(passed ? "[scenario] PASSED" : "[scenario] FAILED");
+  fflush(stdout);
+  exit(passed ? 0 : 1);
+}
+
+static void Run()
+{
+  LoopbackBroker& broker = LoopbackBroker::instance();
+  unsigned long start = millis();
+  while (broker.connects() == 0)
+  {
+    if (millis() - start >= STEP_TIMEOUT)
+    {
+      Step("firmware never connected");
+      Finish(false);
+    }
+    delay(50);
+  }
+  delay(3000);
+  bool passed = broker.publishCount() == 0;   //nothing happened yet, so there is nothing to report
+
+  Step("letter delivered");
+  size_t opened = broker.countInPayloads("\"opened\"");
+  size_t delivered = broker.countInPayloads("\"delivered\"");
+  OpenAndClose(LETTER_GRAMS);
+  passed = passed && WaitFor("\"opened\"", opened + 1) && WaitFor("\"delivered\"", delivered + 1);
+
+  Step("WiFi down, letter collected");
+  size_t collected = broker.countInPayloads("\"collected\"");
+  WiFi.setLinkUp(false);
+  delay(1000);
+  OpenAndClose(0.0f);
+  delay(4000);                    //the settle time; the events wait in the journal
+  passed = passed && broker.countInPayloads("\"collected\"") == collected;
+
+  Step("WiFi back, journal replayed");
+  WiFi.setLinkUp(true);
+  passed = passed && WaitFor("\"opened\"", opened + 2) && WaitFor("\"collected\"", collected + 1);
+
+  Step("connection dropped, letter delivered");
+  uint32_t connects = broker.connects();
+  uint32_t subscribes = broker.subscribes();
+  broker.dropConnections();
+  delay(1000);
+  OpenAndClose(LETTER_GRAMS);
+  passed = passed && WaitFor("\"opened\"", opened + 3) && WaitFor("\"delivered\"", delivered + 2);
+  passed = passed && broker.connects() > connects && broker.subscribes() == subscribes;   //the session was resumed
+
+  Step("connection silent, letter collected");
+  connects = broker.connects();
+  collected = broker.countInPayloads("\"collected\"");
+  broker.silenceConnections();
+  delay(1000);
+  OpenAndClose(0.0f);
+  start = millis();
+  passed = passed && WaitFor("\"collected\"", collected + 1);
+  Serial.printf("[scenario] dead link noticed and the letter delivered after %lu ms\r\n", millis() - start);
+  passed = passed && broker.connects() > connects;
+
+  Step("direct method");
+  broker.invokeMethod("echo", "\"ping\"");
+  start = millis();
+  bool answered = false;
+  while (!answered && millis() - start < STEP_TIMEOUT)
+  {
+    delay(50);
+    for (const LoopbackPublish& publish : broker.publishes())
+    {
+      answered = answered || publish.topic.compare(0, 23, "$iothub/methods/res/200") == 0;
+    }
+  }
+  passed = passed && answered;
+
+#if defined(GB_PROFILE_ALLOC)
+  Step("heap profile");
+  broker.invokeMethod("heapProfile", "null");
+  start = millis();
+  answered = false;
+  while (!answered && millis() - start < STEP_TIMEOUT)
+  {
+    delay(50);
+    for (const LoopbackPublish& publish : broker.publishes())
+    {
+      answered = answered || (publish.topic.compare(0, 23, "$iothub/methods/res/200") == 0
+                              && publish.payload.find("\"umqtt\":{\"live\":") != std::string::npos);
+    }
+  }
+  for (const LoopbackPublish& publish : broker.publishes())
+  {
+    if (publish.payload.compare(0, 15, "{\"heapProfile\":") == 0)
+    {
+      Serial.print("[scenario] ");
+      Serial.println(publish.payload.c_str());
+      break;
+    }
+  }
+#endif
+  Finish(passed && answered);
+}
+
+static bool RunChecks()
+{
+  bool passed = CheckHx711Array();
+  passed = CheckHx711Fast() && passed;
+  passed = CheckMailbox() && passed;
+  passed = CheckBuffer() && passed;
+  passed = CheckMap() && passed;
+  return passed;
+}
+
+void simBegin()
+{
+  if (!RunChecks())
+  {
+    Serial.println("[scenario] FAILED");
+    fflush(stdout);
+    exit(1);
+  }
+  remove(JOURNAL_FILE);           //start without records of an earlier run
+  LoopbackBroker::instance().setRoundTripUs(ROUND_TRIP_US);
+  SimBoard::setAnalog(LIGHT_SENS, LIGHT_DARK);
+  loadCell.begin();
+  std::thread(Run).detach();
+}
@@ -2,15 +2,41 @@
 #include "HX711.h"
 #include "soc/rtc.h"
 #include <az_core.h>
-#include <esp32_azureiotkit_sensors.h>
 #include "iot_configs.h"
 #include <WiFi.h>
 #include <Esp32MQTTClient.h>
 #include <WiFiClientSecure.h>
+#include "Mailbox.h"
+#include "TelemetryJournal.h"
+#include "TelemetryEncoder.h"
+#include "SpscQueue.h"
+#include "HeapProfile.h"
+#include "az_iot/c-utility/inc/azure_c_shared_utility/gballoc.h"
 
 //Azure IOT code below obtained from https://github.com/critchards/ESP32-Azure-Iot-Central/blob/main/src/main.cpp with some changes to fit our project
-#define INTERVAL 10000        //time between messages sent to Azure IoT Hub
+#define HEARTBEAT_INTERVAL 300000   //longest time between messages sent to Azure IoT Hub when nothing happens
+#define SENSOR_PERIOD 100      //time between sensor checks, the CPU sleeps in between
 #define MESSAGE_MAX_LEN 256   //changes the maximum size of the message that can be sent
+#define CONNECT_RETRY_INTERVAL 30000   //time between attempts to reach IoT Hub while offline
+#define SEND_WINDOW 4                  //messages on their way to IoT Hub at once, each waits one round trip for its confirmation
+#define REPLAY_BATCH_LEN 1024          //largest batch of journal records sent as one message
+#define LIVE_BATCH_RECORDS 8           //live readings packed into one message when there is no journal
+#define LIVE_BATCH_AGE 10000           //longest a live reading waits for others to join it
+#define TELEMETRY_FORMAT TELEMETRY_JSON   //TELEMETRY_CBOR sends the same fields about a third smaller
+
+//tasks: the sensor task owns the scale and the mailbox, the network task owns WiFi, the IoT Hub client and the journal
+#define SENSOR_CORE 1                  //core each task is pinned to; WiFi itself runs on core 0
+#define NETWORK_CORE 0
+#define UI_CORE 1
+#define SENSOR_STACK 4096              //task stacks in bytes; TLS needs the big one
+#define NETWORK_STACK 16384
+#define UI_STACK 3072
+#define NETWORK_PERIOD 50              //longest the network task sleeps when no event wakes it
+#define UI_TASK 1                      //0 leaves out the serial monitor output of the sensor readings
+#define UI_SAMPLE_PERIOD 10            //sensor periods between two readings sent to the UI task
+#define QUEUE_LEN 16                   //messages each queue holds, a power of two
+#define HEAP_PROFILE_INTERVAL 600000   //time between heap profiles reported to the device twin, in builds with GB_PROFILE_ALLOC
+#define HEAP_PROFILE_LEN 640
 
 
 //Credentials taken from configs.h
@@ -18,12 +44,17 @@ const char* ssid     = IOT_CONFIG_WIFI_SSID;
 const char* password = IOT_CONFIG_WIFI_PASSWORD;
 static const char* connectionString = DEVICE_CONNECTION_STRING;
 
-const char *messageData = "{\"messageId\":%d, \"Weight\":%f, \"OpenStatus\":%d}";  //Structure of the message sent to Azure IoT Hub
+TelemetryEncoder encoder(TELEMETRY_FORMAT);   //writes the messages sent to Azure IoT Hub, see MailboxTelemetry for the fields
 static bool hasIoTHub = false;
 static bool hasWifi = false;
 int messageCount = 1;
 static bool messageSending = true;
-static uint64_t send_interval_ms;
+static bool hasCallbacks = false;
+static unsigned long connect_attempt_ms;
+static HeapProfile heapProfile;     //where the heap goes, for the heapProfile direct method and twin property
+static bool hasHeapProfile = false;
+static unsigned long heapProfileMs;
+static char heapProfileJson[HEAP_PROFILE_LEN];
 
 
 
@@ -85,6 +116,10 @@ static int  DeviceMethodCallback(const char *methodName, const unsigned char *pa
     Serial.println((const char *)payload);
 
   }
+  else if (strcmp(methodName, "heapProfile") == 0 && heapProfile.snapshot(millis(), heapProfileJson, sizeof(heapProfileJson)) > 0)
+  {
+    responseMessage = heapProfileJson;
+  }
 
   else
   {
@@ -94,7 +129,11 @@ static int  DeviceMethodCallback(const char *methodName, const unsigned char *pa
   }
 
   *response_size = strlen(responseMessage);       //originally had a +1 on it, messed up the JSON, made Azure IoT angry
-  *response = (unsigned char *)strdup(responseMessage);
+  *response = (unsigned char *)malloc(*response_size + 1);   //the SDK frees it, so it comes from the SDK's allocator
+  if (*response != NULL)
+  {
+    memcpy(*response, responseMessage, *response_size + 1);
+  }
 
   return result;                                  //return the status code
 }
@@ -105,44 +144,395 @@ const int LOADCELL_DOUT_PIN = 15;
 const int LOADCELL_SCK_PIN = 13;
 
 HX711 scale;
+MedianFilter<5> spikeFilter;    //drops single bad conversions
+KalmanFilter weightFilter;      //smooths the weight between loads, keeps history across sensor periods
 
-void setup() {
-  Serial.begin(9600);
+//thresholds for the mailbox state machine; the light thresholds are apart so a flickering reading near one of them does not toggle the door
+const MailboxConfig mailboxConfig = {
+  150,                  //lightOpen
+  50,                   //lightClosed
+  5.0f,                 //weightDelta, in grams
+  2000,                 //settleMs
+  HEARTBEAT_INTERVAL    //heartbeatMs
+};
+Mailbox mailbox(mailboxConfig);
 
-  Serial.println(" > WiFi");
-  Serial.println("Starting connecting WiFi.");
+//every message goes through the journal first, so nothing is lost while WiFi or IoT Hub are down
+#if defined(ARDUINO_ARCH_ESP32)
+FlashJournalStorage journalStorage;
+#else
+FileJournalStorage journalStorage("journal.bin");   //the native build keeps it in a file in the working directory
+#endif
+TelemetryJournal journal(journalStorage);
+static bool hasJournal = false;
+static uint8_t replayBatch[REPLAY_BATCH_LEN];
 
-  //initialize the wifi connection using the credentials fron iot_config.h
-  delay(10);
-  WiFi.mode(WIFI_AP);
-  WiFi.begin(ssid, password);
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(500);
-    Serial.print(".");
-    hasWifi = false;
-  }
-  hasWifi = true;
-  Serial.println("WiFi connected");
-  Serial.println("IP address: ");
-  Serial.println(WiFi.localIP());
+//a batch from the journal on its way to IoT Hub; batches are acknowledged in the order they were sent
+struct ReplayBatch
+{
+  uint32_t lastSeq;
+  JournalPosition next;           //where the journal continues after the batch
+  int records;
+  bool done;
+  bool ok;
+};
+static ReplayBatch replayQueue[SEND_WINDOW];
+static int replayHead = 0;
+static int replayCount = 0;
+static uint32_t replayRecords = 0;   //records in the batches in flight
+static bool replayFailed = false;
+static JournalPosition replayNext;   //first record not sent yet
+static int reconnectsSeen = 0;
+static unsigned long reconnectMs = 0;   //how long the last lost connection took to come back, until a message reports it
+
+//wrap an encoded payload into a message, labelled so IoT Hub can route on its fields
+static EVENT_INSTANCE* GenerateTelemetry(const uint8_t* payload, size_t length)
+{
+  EVENT_INSTANCE* message = Esp32MQTTClient_Event_GenerateBinary(payload, length, encoder.contentType());
+  if (message != NULL && encoder.format() == TELEMETRY_JSON)
+  {
+    IoTHubMessage_SetContentEncodingSystemProperty(message->messageHandle, "utf-8");
+  }
+  if (message != NULL && reconnectMs > 0)
+  {
+    char took[21];                    //the digits of an unsigned long up to 64 bits
+    snprintf(took, sizeof(took), "%lu", reconnectMs);
+    Esp32MQTTClient_Event_AddProp(message, "reconnectMs", took);      //how long the device was cut off from IoT Hub
+    reconnectMs = 0;
+  }
+  return message;
+}
+
+//connect to IoT Hub using the connection string from iot_config.h, called again from the network task while offline
+static void ConnectIoTHub()
+{
+  connect_attempt_ms = millis();
   Serial.println(" > IoT Hub");
-  
-  //connect to IoT Hub using the connection string from iot_config.h
   if (!Esp32MQTTClient_Init((const uint8_t*)connectionString, true))
   {
     hasIoTHub = false;
+    Esp32MQTTClient_Close();      //start from scratch on the next attempt
     Serial.println("Initializing IoT hub failed.");
     return;
   }
   hasIoTHub = true;
 
   //set up all the callback functions, all the subscriptions are handled in ESP32MQTTCLIENT
-  Esp32MQTTClient_SetSendConfirmationCallback(SendConfirmationCallback);
-  Esp32MQTTClient_SetMessageCallback(MessageCallback);
-  Esp32MQTTClient_SetDeviceTwinCallback(DeviceTwinCallback);
-  Esp32MQTTClient_SetDeviceMethodCallback(DeviceMethodCallback);
+  if (!hasCallbacks)
+  {
+    Esp32MQTTClient_SetSendConfirmationCallback(SendConfirmationCallback);
+    Esp32MQTTClient_SetMessageCallback(MessageCallback);
+    Esp32MQTTClient_SetDeviceTwinCallback(DeviceTwinCallback);
+    Esp32MQTTClient_SetDeviceMethodCallback(DeviceMethodCallback);
+    hasCallbacks = true;
+  }
   Serial.println("Start sending events.");
-  send_interval_ms = millis();              //state machine timer for sending telemetry
+}
+
+//runs from Esp32MQTTClient_Check() when IoT Hub confirmed a batch, or gave up on it
+static void ReplayComplete(int trackingId, IOTHUB_CLIENT_CONFIRMATION_RESULT result, void* context)
+{
+  ReplayBatch* batch = (ReplayBatch*)context;
+  batch->done = true;
+  batch->ok = result == IOTHUB_CLIENT_CONFIRMATION_OK;
+}
+
+//drop confirmed batches from the journal, oldest first. After a failure the batches behind it are not
+//acknowledged either; once they are all back, replay starts over at the failed one
+static void AcknowledgeReplay()
+{
+  while (replayCount > 0 && replayQueue[replayHead].done)
+  {
+    ReplayBatch& batch = replayQueue[replayHead];
+    if (batch.ok && !replayFailed)
+    {
+      journal.acknowledge(batch.lastSeq, batch.next);
+    }
+    else
+    {
+      replayFailed = true;
+    }
+    replayRecords -= batch.records;
+    replayHead = (replayHead + 1) % SEND_WINDOW;
+    replayCount--;
+  }
+  if (replayCount == 0)
+  {
+    replayFailed = false;
+  }
+}
+
+//send the next records from the journal as one message without waiting for IoT Hub; they are only dropped from the journal once it confirmed them
+static void ReplayJournal()
+{
+  if (replayCount == 0)
+  {
+    replayNext = journal.replayStart();
+  }
+  JournalPosition pos = replayNext;
+  JournalPosition next = pos;
+  uint32_t lastSeq = 0;
+  uint32_t seq;
+  uint8_t type;
+  uint16_t length;
+  int count = 0;
+  size_t used = 1;                //the array header
+  bool json = encoder.format() == TELEMETRY_JSON;
+
+  //read the records straight into the batch, leaving room for the separator and the end of the array.
+  //JSON gets "[rec,rec,...]", CBOR an indefinite length array, which needs no count up front and no separators
+  while (used + 2 < REPLAY_BATCH_LEN
+         && journal.readNext(next, &type, &seq, &replayBatch[used], REPLAY_BATCH_LEN - used - 2, &length))
+  {
+    used += length;
+    if (json)
+    {
+      replayBatch[used++] = ',';
+    }
+    lastSeq = seq;
+    pos = next;
+    count++;
+  }
+  if (count == 0)
+  {
+    return;
+  }
+
+  EVENT_INSTANCE* message;
+  if (count == 1)                 //a single record goes out as is, like a live message
+  {
+    message = GenerateTelemetry(&replayBatch[1], json ? used - 2 : used - 1);
+  }
+  else
+  {
+    if (json)
+    {
+      replayBatch[0] = '[';
+      replayBatch[used - 1] = ']';
+    }
+    else
+    {
+      replayBatch[0] = 0x9F;
+      replayBatch[used++] = 0xFF;
+    }
+    message = GenerateTelemetry(replayBatch, used);
+    char batchSize[12];
+    snprintf(batchSize, sizeof(batchSize), "%d", count);
+    Esp32MQTTClient_Event_AddProp(message, "batch", batchSize);      //lets the cloud side tell batches from live messages
+  }
+
+  ReplayBatch& batch = replayQueue[(replayHead + replayCount) % SEND_WINDOW];
+  batch.lastSeq = lastSeq;
+  batch.next = pos;
+  batch.records = count;
+  batch.done = false;
+  if (Esp32MQTTClient_SendEventAsync(message, ReplayComplete, &batch) < 0)
+  {
+    hasIoTHub = false;            //the client resets itself, try again after CONNECT_RETRY_INTERVAL
+    return;
+  }
+  replayCount++;
+  replayRecords += count;
+  replayNext = pos;
+}
+
+//passed from the sensor task to the others, so only the sensor task ever touches the mailbox
+enum SensorMessageKind { SENSOR_SAMPLE, SENSOR_EVENT };
+struct SensorMessage
+{
+  SensorMessageKind kind;
+  MailboxEvent event;             //SENSOR_EVENT only
+  MailboxState state;
+  bool door;
+  float weight;
+  int light;
+  uint32_t timestamp;
+};
+
+static SpscQueue<SensorMessage, QUEUE_LEN> networkQueue;   //sensor task -> network task
+static SpscQueue<SensorMessage, QUEUE_LEN> uiQueue;        //sensor task -> UI task
+static TaskHandle_t networkTask = NULL;
+
+static void SensorTask(void* parameter)
+{
+  TickType_t wake = xTaskGetTickCount();
+  int samples = 0;
+  while (true)
+  {
+    int light = analogRead(LIGHT_SENS);
+    float weight = scale.get_filtered_units();   //the filter is fed by the acquisition task, this never waits on the scale
+
+    MailboxEvent event = mailbox.update(millis(), light, weight);
+    SensorMessage message = { SENSOR_SAMPLE, event, mailbox.state(), mailbox.doorOpen(), weight, light, (uint32_t)time(NULL) };
+    if (event != MAILBOX_NO_EVENT)
+    {
+      message.kind = SENSOR_EVENT;
+      message.weight = mailbox.weight();
+      if (networkQueue.push(message))
+      {
+        xTaskNotifyGive(networkTask);        //wake the network task now instead of after NETWORK_PERIOD
+      }
+    }
+    if (UI_TASK && (message.kind == SENSOR_EVENT || ++samples >= UI_SAMPLE_PERIOD))
+    {
+      samples = 0;
+      uiQueue.push(message);      //a slow serial monitor only costs readings, never events for IoT Hub
+    }
+    vTaskDelayUntil(&wake, pdMS_TO_TICKS(SENSOR_PERIOD));   //the core idles (and WiFi modem sleeps) until the next check
+  }
+}
+
+//turn a mailbox event into a message and put it into the journal, or straight on its way when there is none
+static void SendEvent(const SensorMessage& message)
+{
+  MailboxTelemetry telemetry = { messageCount++, message.weight, message.door, message.timestamp,
+                                 Mailbox::stateName(message.state), Mailbox::eventName(message.event) };
+  uint8_t messagePayload[MESSAGE_MAX_LEN];      //the message that will be sent to Azure IoT Hub, encoded in place without the heap
+  size_t length = encoder.encode(telemetry, messagePayload, MESSAGE_MAX_LEN);
+  if (length == 0)
+  {
+    Serial.println("Message does not fit in MESSAGE_MAX_LEN.");
+  }
+  else if (hasJournal)
+  {
+    journal.append(JOURNAL_RECORD_EVENT, messagePayload, length);
+  }
+  else if (hasWifi && hasIoTHub)
+  {
+    Esp32MQTTClient_BatchAdd(messagePayload, length, message.event == MAILBOX_EVENT_OPENED);    //batched with the next readings, an opened door goes out right away
+  }
+}
+
+static void NetworkTask(void* parameter)
+{
+  while (true)
+  {
+    SensorMessage message;
+    while (networkQueue.pop(message))
+    {
+      if (messageSending)         //only talk to Azure IoT Hub when the mailbox changed state or the heartbeat is due
+      {
+        SendEvent(message);
+      }
+    }
+
+    hasWifi = WiFi.status() == WL_CONNECTED;
+    if (hasWifi && !hasIoTHub && millis() - connect_attempt_ms >= CONNECT_RETRY_INTERVAL)
+    {
+      ConnectIoTHub();
+    }
+    if (hasWifi && hasIoTHub)
+    {
+      if (hasJournal)
+      {
+        AcknowledgeReplay();
+        if (!replayFailed && replayCount < SEND_WINDOW && journal.pending() > replayRecords)
+        {
+          ReplayJournal();
+        }
+      }
+      Esp32MQTTClient_Check();                                                                    //keep the connection to Auzre IoT Hub alive and collect confirmations
+      if (hasHeapProfile && millis() - heapProfileMs >= HEAP_PROFILE_INTERVAL && !Esp32MQTTClient_IsReconnecting())   //the next loop after reconnecting reports it
+      {
+        heapProfileMs = millis();
+        if (heapProfile.snapshot(heapProfileMs, heapProfileJson, sizeof(heapProfileJson)) > 0)
+        {
+          Esp32MQTTClient_ReportStateAsync(heapProfileJson);                                      //confirmed by a later Esp32MQTTClient_Check, the loop does not wait
+        }
+      }
+
+      RECONNECT_STATS stats;
+      Esp32MQTTClient_GetReconnectStats(&stats);
+      if (stats.count != reconnectsSeen)
+      {
+        reconnectsSeen = stats.count;
+        reconnectMs = stats.lastMs > 0 ? stats.lastMs : 1;
+        Serial.printf("Reconnected to IoT Hub in %lu ms (%d reconnects, %d with a new client, slowest %lu ms)\r\n",
+                      stats.lastMs, stats.count, stats.fullResets, stats.maxMs);
+        MQTT_CLIENT_KEEPALIVE_STATS link;
+        if (Esp32MQTTClient_GetKeepAliveStats(&link))
+        {
+          Serial.printf("Round trip %u ms, jitter %u ms, ping after %u s quiet (%u pings, %u probes, %u dead links)\r\n",
+                        (unsigned)link.rttMs, (unsigned)link.rttJitterMs, (unsigned)link.pingIntervalSec,
+                        (unsigned)link.pingsSent, (unsigned)link.probesSent, (unsigned)link.deadLinks);
+        }
+      }
+    }
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NETWORK_PERIOD));
+  }
+}
+
+//everything written to the serial monitor about the mailbox, so printing never holds up the other tasks
+static void UiTask(void* parameter)
+{
+  uint32_t dropped = 0;
+  while (true)
+  {
+    SensorMessage message;
+    while (uiQueue.pop(message))
+    {
+      if (message.kind == SENSOR_EVENT)
+      {
+        Serial.print("Mailbox ");
+        Serial.print(Mailbox::eventName(message.event));
+        Serial.print(", weight ");
+        Serial.println(message.weight, 5);
+      }
+      else
+      {
+        Serial.print("Light ");
+        Serial.print(message.light);
+        Serial.print(", weight ");
+        Serial.println(message.weight, 5);
+      }
+    }
+    if (networkQueue.dropped() != dropped)
+    {
+      dropped = networkQueue.dropped();
+      Serial.print("Network task falling behind, events dropped: ");
+      Serial.println(dropped);
+    }
+    vTaskDelay(pdMS_TO_TICKS(SENSOR_PERIOD));
+  }
+}
+
+void setup() {
+  Serial.begin(9600);
+  hasHeapProfile = heapProfile.begin();   //before the IoT Hub client allocates anything
+  heapProfileMs = millis();
+
+  Serial.println(" > WiFi");
+  Serial.println("Starting connecting WiFi.");
+
+  //initialize the wifi connection using the credentials fron iot_config.h, the network task connects to IoT Hub once it is up
+  delay(10);
+  WiFi.mode(WIFI_AP);
+  WiFi.begin(ssid, password);
+  connect_attempt_ms = millis() - CONNECT_RETRY_INTERVAL;
+
+  int sendWindow = SEND_WINDOW;
+  Esp32MQTTClient_SetOption(OPTION_SEND_WINDOW, &sendWindow);
+  int batchRecords = LIVE_BATCH_RECORDS;
+  int batchBytes = REPLAY_BATCH_LEN;
+  int batchAge = LIVE_BATCH_AGE;
+  BATCH_FORMAT batchFormat = encoder.format() == TELEMETRY_JSON ? BATCH_JSON : BATCH_CBOR;
+  Esp32MQTTClient_SetOption(OPTION_BATCH_MAX_RECORDS, &batchRecords);
+  Esp32MQTTClient_SetOption(OPTION_BATCH_MAX_BYTES, &batchBytes);
+  Esp32MQTTClient_SetOption(OPTION_BATCH_MAX_AGE, &batchAge);
+  Esp32MQTTClient_SetOption(OPTION_BATCH_FORMAT, &batchFormat);
+  Esp32MQTTClient_SetOption(OPTION_BATCH_CONTENT_TYPE, encoder.contentType());
+
+  hasJournal = journalStorage.begin() && journal.begin();
+  if (hasJournal)
+  {
+    Serial.print("Journal has ");
+    Serial.print(journal.pending());
+    Serial.println(" unsent records.");
+  }
+  else
+  {
+    Serial.println("No journal partition, messages are lost while offline.");
+  }
 
   pinMode(LIGHT_SENS, INPUT);
   rtc_cpu_freq_config_t config;
@@ -153,43 +543,18 @@ void setup() {
             
   scale.set_scale(217.5);   // this value is obtained by calibrating the scale with known weights; see the README for details
   scale.tare();               // reset the scale to 0
+  spikeFilter.then(weightFilter);
+  scale.set_filter(&spikeFilter);
+  scale.start_acquisition();  // clock out conversions from the DOUT interrupt so the sensor task never waits on the scale
+
+  xTaskCreatePinnedToCore(NetworkTask, "network", NETWORK_STACK, NULL, 1, &networkTask, NETWORK_CORE);
+  xTaskCreatePinnedToCore(SensorTask, "sensor", SENSOR_STACK, NULL, 2, NULL, SENSOR_CORE);
+  if (UI_TASK)
+  {
+    xTaskCreatePinnedToCore(UiTask, "ui", UI_STACK, NULL, 0, NULL, UI_CORE);
+  }
 }
  
 void loop() {
-  int threshold = 0;
-  int curr_light;
-  bool door = false;
-  float weight;
-
-  Serial.print("Door Status: ");
-  curr_light = analogRead(LIGHT_SENS);
-  if (curr_light > threshold) {
-    door = true;
-    Serial.println("Open");
-  } else {
-    Serial.println("Closed");
-  }
-
-  Serial.print("Current Weight: ");
-  weight = scale.get_units(10);
-  Serial.println(weight, 5);
-  Serial.println("");
-  
- if (hasWifi && hasIoTHub)
-  {
-    if (messageSending && (int)(millis() - send_interval_ms) >= INTERVAL)
-    {  
-      char messagePayload[MESSAGE_MAX_LEN];         //create an array of characters to hold the message that will be sent to Azure IoT Hub
-      snprintf(messagePayload, MESSAGE_MAX_LEN, messageData, messageCount++, weight, door); //build the message from the function data and the measurements defined at the top (temp, humidity, led)
-      Serial.println(messagePayload);                                                                     //write the message to the serial monitor for debugging
-      EVENT_INSTANCE* message = Esp32MQTTClient_Event_Generate(messagePayload, MESSAGE);                  //get ready to send a message to the MQTT broker
-      Esp32MQTTClient_SendEventInstance(message);                                                         //send the message
-      send_interval_ms = millis();                                                                        //update the state machine timer
-    }
-    else
-    {
-      Esp32MQTTClient_Check();                                                                            //keep the connection to Auzre IoT Hub alive even when not sending messages
-    }
-  }
-  delay(1000);
-}
\ No newline at end of file
+  vTaskDelete(NULL);        //all the work happens in the tasks started by setup()
+}